@@ -0,0 +1,179 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <execution>
+#include <string>
+#include "RangeCompare.h"
+#include "Utils/BenchmarkUtils.h"
+#include "Utils/ParallelBenchmarkUtils.h"
+
+static void BM_Equal(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec1 = bench::iotaInts(count);
+    auto vec2 = vec1;
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::equal(vec1.begin(), vec1.end(), vec2.begin(), vec2.end()));
+    bench::reportPerOp(state, count, 2 * sizeof(int));
+}
+BENCHMARK(BM_Equal)->Apply(bench::elementSweep);
+
+static void BM_EqualPredicate(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec1 = bench::iotaInts(count);
+    auto vec2 = vec1;
+    auto checkEqual = [](int a, int b){ return a == b;};
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::equal(vec1.begin(), vec1.end(), vec2.begin(), checkEqual));
+    bench::reportPerOp(state, count, 2 * sizeof(int));
+}
+BENCHMARK(BM_EqualPredicate)->Apply(bench::elementSweep);
+
+static void BM_LexicographicalCompareString(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    std::string s1(count, 'a');
+    std::string s2 = s1;
+    s2.back() = 'b';
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::lexicographical_compare(s1.begin(), s1.end(), s2.begin(), s2.end()));
+    bench::reportPerOp(state, count, 2 * sizeof(char));
+}
+BENCHMARK(BM_LexicographicalCompareString)->Apply(bench::elementSweep);
+
+static void BM_LexicographicalCompareInts(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec1 = bench::iotaInts(count);
+    auto vec2 = vec1;
+    vec2.back() += 1;
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::lexicographical_compare(vec1.begin(), vec1.end(), vec2.begin(), vec2.end()));
+    bench::reportPerOp(state, count, 2 * sizeof(int));
+}
+BENCHMARK(BM_LexicographicalCompareInts)->Apply(bench::elementSweep);
+
+//Thread scaling of the execution policy overloads, {elements, threads} args from bench::threadSweep
+template<typename Policy>
+static void BM_EqualPolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    auto vec1 = bench::iotaInts(count);
+    auto vec2 = vec1;
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::equal(utils::executionPolicy<Policy>, vec1.begin(), vec1.end(), vec2.begin(), vec2.end()));
+    bench::reportPerOp(state, count, 2 * sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_EqualPolicy);
+
+template<typename Policy>
+static void BM_LexicographicalComparePolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    auto vec1 = bench::iotaInts(count);
+    auto vec2 = vec1;
+    vec2.back() += 1;
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::lexicographical_compare(utils::executionPolicy<Policy>, vec1.begin(), vec1.end(), vec2.begin(), vec2.end()));
+    bench::reportPerOp(state, count, 2 * sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_LexicographicalComparePolicy);
+
+//std against practise on a table of fixed length keys compared with the same table where every other key
+//differs in its last element, as a dedup layer sees them. Short, medium and long keys are swept by their
+//length in bytes, the tables always hold 16 MiB of keys
+struct StdCompare
+{
+    template<typename It> static bool equal(It first1, It last1, It first2, It last2) { return std::equal(first1, last1, first2, last2); }
+    template<typename It> static auto mismatch(It first1, It last1, It first2, It last2) { return std::mismatch(first1, last1, first2, last2); }
+    template<typename It> static bool less(It first1, It last1, It first2, It last2) { return std::lexicographical_compare(first1, last1, first2, last2); }
+};
+
+struct SimdCompare
+{
+    template<typename It> static bool equal(It first1, It last1, It first2, It last2) { return practise::equal(first1, last1, first2, last2); }
+    template<typename It> static auto mismatch(It first1, It last1, It first2, It last2) { return practise::mismatch(first1, last1, first2, last2); }
+    template<typename It> static bool less(It first1, It last1, It first2, It last2) { return practise::lexicographical_compare(first1, last1, first2, last2); }
+};
+
+static void keyLengths(benchmark::internal::Benchmark* b)
+{
+    b->ArgName("keyBytes");
+    for(std::int64_t bytes : {8, 16, 32, 64, 256, 1024, 4096})
+        b->Arg(bytes);
+}
+
+template<typename T>
+struct KeyTables
+{
+    explicit KeyTables(std::int64_t keyBytes)
+        : keyLength(static_cast<std::size_t>(keyBytes) / sizeof(T)), keyCount((16 << 20) / static_cast<std::size_t>(keyBytes)),
+          keys(bench::randomValues<T>(static_cast<std::int64_t>(keyLength * keyCount))), others(keys)
+    {
+        for(std::size_t key = 1; key < keyCount; key += 2)
+            others[(key + 1) * keyLength - 1] += 1;
+    }
+
+    std::size_t keyLength;
+    std::size_t keyCount;
+    std::vector<T> keys;
+    std::vector<T> others;
+};
+
+template<typename Compare, typename T>
+static void BM_EqualKeys(benchmark::State& state)
+{
+    KeyTables<T> tables(state.range(0));
+    for(auto _ : state)
+    {
+        std::size_t equalKeys = 0;
+        for(std::size_t pos = 0; pos < tables.keys.size(); pos += tables.keyLength)
+            equalKeys += Compare::equal(tables.keys.begin() + pos, tables.keys.begin() + pos + tables.keyLength,
+                                        tables.others.begin() + pos, tables.others.begin() + pos + tables.keyLength);
+        benchmark::DoNotOptimize(equalKeys);
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(tables.keyCount), 2 * state.range(0));
+}
+
+template<typename Compare, typename T>
+static void BM_MismatchKeys(benchmark::State& state)
+{
+    KeyTables<T> tables(state.range(0));
+    for(auto _ : state)
+    {
+        for(std::size_t pos = 0; pos < tables.keys.size(); pos += tables.keyLength)
+            benchmark::DoNotOptimize(Compare::mismatch(tables.keys.begin() + pos, tables.keys.begin() + pos + tables.keyLength,
+                                                       tables.others.begin() + pos, tables.others.begin() + pos + tables.keyLength));
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(tables.keyCount), 2 * state.range(0));
+}
+
+template<typename Compare, typename T>
+static void BM_LexicographicalCompareKeys(benchmark::State& state)
+{
+    KeyTables<T> tables(state.range(0));
+    for(auto _ : state)
+    {
+        std::size_t lessKeys = 0;
+        for(std::size_t pos = 0; pos < tables.keys.size(); pos += tables.keyLength)
+            lessKeys += Compare::less(tables.keys.begin() + pos, tables.keys.begin() + pos + tables.keyLength,
+                                      tables.others.begin() + pos, tables.others.begin() + pos + tables.keyLength);
+        benchmark::DoNotOptimize(lessKeys);
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(tables.keyCount), 2 * state.range(0));
+}
+
+#define BENCHMARK_COMPARE_KEYS(func) \
+    BENCHMARK_TEMPLATE(func, StdCompare, std::uint8_t)->Apply(keyLengths); \
+    BENCHMARK_TEMPLATE(func, SimdCompare, std::uint8_t)->Apply(keyLengths); \
+    BENCHMARK_TEMPLATE(func, StdCompare, std::int32_t)->Apply(keyLengths); \
+    BENCHMARK_TEMPLATE(func, SimdCompare, std::int32_t)->Apply(keyLengths)
+
+BENCHMARK_COMPARE_KEYS(BM_EqualKeys);
+BENCHMARK_COMPARE_KEYS(BM_MismatchKeys);
+BENCHMARK_COMPARE_KEYS(BM_LexicographicalCompareKeys);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <execution>
+#include <iterator>
+#include <ranges>
+#include <vector>
+#include "FusedPipeline.h"
+#include "Utils/BenchmarkUtils.h"
+
+//transform -> filter -> replace -> unique -> copy over random ints, as five separate std passes into vectors
+//of their own (the style of TestModSequenceOperations.cpp), as std::views chained into std::ranges::unique_copy,
+//and as one fused pipeline, sequential and parallel. traffic/op counts the bytes read and written per input
+//element, intermediate vectors included.
+static int scale(int num) { return num * 3 + 1; }
+static bool keep(int num) { return num % 4 != 0; }
+static int replaceSeven(int num) { return num == 7 ? -7 : num; }
+
+//Small values so that unique finds runs to drop
+static std::vector<int> etlInput(std::int64_t count)
+{
+    return bench::randomInts(count, 7);
+}
+
+static void reportTraffic(benchmark::State& state, std::int64_t count, std::size_t elementsMoved)
+{
+    bench::reportPerOp(state, count, sizeof(int));
+    state.counters["traffic/op"] = benchmark::Counter(static_cast<double>(elementsMoved * sizeof(int)) / static_cast<double>(count));
+}
+
+static void BM_EtlSeparatePasses(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto input = etlInput(count);
+    std::size_t moved = 0;
+    for(auto _ : state)
+    {
+        std::vector<int> scaled, kept, replaced, unique, output;
+        std::transform(input.begin(), input.end(), std::back_inserter(scaled), scale);
+        std::copy_if(scaled.begin(), scaled.end(), std::back_inserter(kept), keep);
+        std::replace_copy(kept.begin(), kept.end(), std::back_inserter(replaced), 7, -7);
+        std::unique_copy(replaced.begin(), replaced.end(), std::back_inserter(unique));
+        std::copy(unique.begin(), unique.end(), std::back_inserter(output));
+        benchmark::DoNotOptimize(output.data());
+        moved = input.size() + 2 * (scaled.size() + kept.size() + replaced.size() + unique.size()) + output.size();
+    }
+    reportTraffic(state, count, moved);
+}
+BENCHMARK(BM_EtlSeparatePasses)->Apply(bench::elementSweep);
+
+static void BM_EtlRangesViews(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto input = etlInput(count);
+    std::size_t moved = 0;
+    for(auto _ : state)
+    {
+        std::vector<int> output;
+        std::ranges::unique_copy(input | std::views::transform(scale) | std::views::filter(keep) | std::views::transform(replaceSeven),
+                                 std::back_inserter(output));
+        benchmark::DoNotOptimize(output.data());
+        moved = input.size() + output.size();
+    }
+    reportTraffic(state, count, moved);
+}
+BENCHMARK(BM_EtlRangesViews)->Apply(bench::elementSweep);
+
+template<typename Policy>
+static void BM_EtlFused(benchmark::State& state)
+{
+    namespace fused = practise::fused;
+    const auto count = state.range(0);
+    const auto input = etlInput(count);
+    const auto etl = fused::transform(scale) | fused::filter(keep) | fused::replace(7, -7) | fused::unique();
+    //With more than one chunk the outputs go through a buffer per chunk
+    const auto chunks = std::min<std::size_t>(input.size() / practise::detail::minParallelChunk, practise::detail::policyThreads<Policy>());
+    std::size_t moved = 0;
+    for(auto _ : state)
+    {
+        std::vector<int> output;
+        fused::copy(utils::executionPolicy<Policy>, input | etl, std::back_inserter(output));
+        benchmark::DoNotOptimize(output.data());
+        moved = input.size() + (chunks > 1 ? 3 : 1) * output.size();
+    }
+    reportTraffic(state, count, moved);
+}
+BENCHMARK_TEMPLATE(BM_EtlFused, std::execution::sequenced_policy)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_EtlFused, std::execution::parallel_policy)->Apply(bench::elementSweep)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,128 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <execution>
+#include "MinMaxElement.h"
+#include "Utils/BenchmarkUtils.h"
+#include "Utils/ParallelBenchmarkUtils.h"
+
+static void BM_MaxElement(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec = bench::randomInts(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::max_element(vec.begin(), vec.end()));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_MaxElement)->Apply(bench::elementSweep);
+
+static void BM_MinElement(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec = bench::randomInts(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::min_element(vec.begin(), vec.end()));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_MinElement)->Apply(bench::elementSweep);
+
+static void BM_MinMaxElement(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec = bench::randomInts(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::minmax_element(vec.begin(), vec.end()));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_MinMaxElement)->Apply(bench::elementSweep);
+
+//Thread scaling of the execution policy overloads, {elements, threads} args from bench::threadSweep
+template<typename Policy>
+static void BM_MaxElementPolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    auto vec = bench::randomInts(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::max_element(utils::executionPolicy<Policy>, vec.begin(), vec.end()));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_MaxElementPolicy);
+
+template<typename Policy>
+static void BM_MinMaxElementPolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    auto vec = bench::randomInts(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::minmax_element(utils::executionPolicy<Policy>, vec.begin(), vec.end()));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_MinMaxElementPolicy);
+
+//std against the practise vector kernels, per element type (run with --benchmark_filter=/100000000 for the
+//1e8 comparison, --benchmark_filter=Simd.*int8 for one type)
+struct StdMinMax
+{
+    template<typename It> static It min(It first, It last) { return std::min_element(first, last); }
+    template<typename It> static It max(It first, It last) { return std::max_element(first, last); }
+    template<typename It> static auto minmax(It first, It last) { return std::minmax_element(first, last); }
+};
+
+struct SimdMinMax
+{
+    template<typename It> static It min(It first, It last) { return practise::min_element(first, last); }
+    template<typename It> static It max(It first, It last) { return practise::max_element(first, last); }
+    template<typename It> static auto minmax(It first, It last) { return practise::minmax_element(first, last); }
+};
+
+template<typename Algorithms, typename T>
+static void BM_MinElementTyped(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec = bench::randomValues<T>(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(Algorithms::min(vec.begin(), vec.end()));
+    bench::reportPerOp(state, count, sizeof(T));
+}
+
+template<typename Algorithms, typename T>
+static void BM_MaxElementTyped(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec = bench::randomValues<T>(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(Algorithms::max(vec.begin(), vec.end()));
+    bench::reportPerOp(state, count, sizeof(T));
+}
+
+template<typename Algorithms, typename T>
+static void BM_MinMaxElementTyped(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec = bench::randomValues<T>(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(Algorithms::minmax(vec.begin(), vec.end()));
+    bench::reportPerOp(state, count, sizeof(T));
+}
+
+#define BENCHMARK_MINMAX_TYPED(func) \
+    BENCHMARK_TEMPLATE(func, StdMinMax, std::int8_t)->Apply(bench::elementSweep); \
+    BENCHMARK_TEMPLATE(func, SimdMinMax, std::int8_t)->Apply(bench::elementSweep); \
+    BENCHMARK_TEMPLATE(func, StdMinMax, std::int16_t)->Apply(bench::elementSweep); \
+    BENCHMARK_TEMPLATE(func, SimdMinMax, std::int16_t)->Apply(bench::elementSweep); \
+    BENCHMARK_TEMPLATE(func, StdMinMax, std::int32_t)->Apply(bench::elementSweep); \
+    BENCHMARK_TEMPLATE(func, SimdMinMax, std::int32_t)->Apply(bench::elementSweep); \
+    BENCHMARK_TEMPLATE(func, StdMinMax, std::int64_t)->Apply(bench::elementSweep); \
+    BENCHMARK_TEMPLATE(func, SimdMinMax, std::int64_t)->Apply(bench::elementSweep); \
+    BENCHMARK_TEMPLATE(func, StdMinMax, float)->Apply(bench::elementSweep); \
+    BENCHMARK_TEMPLATE(func, SimdMinMax, float)->Apply(bench::elementSweep); \
+    BENCHMARK_TEMPLATE(func, StdMinMax, double)->Apply(bench::elementSweep); \
+    BENCHMARK_TEMPLATE(func, SimdMinMax, double)->Apply(bench::elementSweep)
+
+BENCHMARK_MINMAX_TYPED(BM_MinElementTyped);
+BENCHMARK_MINMAX_TYPED(BM_MaxElementTyped);
+BENCHMARK_MINMAX_TYPED(BM_MinMaxElementTyped);
+
+BENCHMARK_MAIN();
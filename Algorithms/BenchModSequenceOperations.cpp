@@ -0,0 +1,576 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <execution>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+#include "StreamCompaction.h"
+#include "StreamingStores.h"
+#include "Utils/BenchmarkUtils.h"
+#include "Utils/ParallelBenchmarkUtils.h"
+
+static void BM_Copy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto src = bench::iotaInts(count);
+    std::vector<int> dst(count);
+    for(auto _ : state)
+    {
+        std::copy(src.begin(), src.end(), dst.begin());
+        benchmark::DoNotOptimize(dst.data());
+    }
+    bench::reportPerOp(state, count, 2 * sizeof(int));
+}
+BENCHMARK(BM_Copy)->Apply(bench::elementSweep);
+
+static void BM_CopyIf(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto src = bench::randomInts(count);
+    std::vector<int> dst;
+    dst.reserve(count);
+    for(auto _ : state)
+    {
+        dst.clear();
+        std::copy_if(src.begin(), src.end(), std::back_inserter(dst), [](int num){return (num % 2) == 0;});
+        benchmark::DoNotOptimize(dst.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_CopyIf)->Apply(bench::elementSweep);
+
+static void BM_Fill(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    std::vector<int> vec(count);
+    for(auto _ : state)
+    {
+        std::fill(vec.begin(), vec.end(), 5);
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_Fill)->Apply(bench::elementSweep);
+
+static void BM_Transform(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto src = bench::iotaInts(count);
+    std::vector<int> dst(count);
+    for(auto _ : state)
+    {
+        std::transform(src.begin(), src.end(), dst.begin(), [](int num){return num * 2;});
+        benchmark::DoNotOptimize(dst.data());
+    }
+    bench::reportPerOp(state, count, 2 * sizeof(int));
+}
+BENCHMARK(BM_Transform)->Apply(bench::elementSweep);
+
+static void BM_Remove(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto src = bench::randomInts(count, 9);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        auto vec = src;
+        state.ResumeTiming();
+        vec.erase(std::remove(vec.begin(), vec.end(), 4), vec.end());
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_Remove)->Apply(bench::elementSweep);
+
+static void BM_Replace(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec = bench::randomInts(count, 9);
+    for(auto _ : state)
+    {
+        std::replace(vec.begin(), vec.end(), 4, 5);
+        std::replace(vec.begin(), vec.end(), 5, 4);
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, 2 * count, sizeof(int));
+}
+BENCHMARK(BM_Replace)->Apply(bench::elementSweep);
+
+static void BM_Reverse(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec = bench::iotaInts(count);
+    for(auto _ : state)
+    {
+        std::reverse(vec.begin(), vec.end());
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_Reverse)->Apply(bench::elementSweep);
+
+static void BM_Rotate(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec = bench::iotaInts(count);
+    for(auto _ : state)
+    {
+        std::rotate(vec.begin(), vec.begin() + count / 3, vec.end());
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_Rotate)->Apply(bench::elementSweep);
+
+static void BM_ShiftLeft(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec = bench::iotaInts(count);
+    for(auto _ : state)
+    {
+        std::shift_left(vec.begin(), vec.end(), 3);
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_ShiftLeft)->Apply(bench::elementSweep);
+
+static void BM_Unique(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto src = bench::randomInts(count, 4);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        auto vec = src;
+        state.ResumeTiming();
+        vec.erase(std::unique(vec.begin(), vec.end()), vec.end());
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_Unique)->Apply(bench::elementSweep);
+
+//Thread scaling of the execution policy overloads, {elements, threads} args from bench::threadSweep
+template<typename Policy>
+static void BM_CopyPolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    auto src = bench::iotaInts(count);
+    std::vector<int> dst(count);
+    for(auto _ : state)
+    {
+        std::copy(utils::executionPolicy<Policy>, src.begin(), src.end(), dst.begin());
+        benchmark::DoNotOptimize(dst.data());
+    }
+    bench::reportPerOp(state, count, 2 * sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_CopyPolicy);
+
+template<typename Policy>
+static void BM_CopyIfPolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    auto src = bench::randomInts(count);
+    std::vector<int> dst(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::copy_if(utils::executionPolicy<Policy>, src.begin(), src.end(), dst.begin(), [](int num){return (num % 2) == 0;}));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_CopyIfPolicy);
+
+template<typename Policy>
+static void BM_FillPolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    std::vector<int> vec(count);
+    for(auto _ : state)
+    {
+        std::fill(utils::executionPolicy<Policy>, vec.begin(), vec.end(), 5);
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_FillPolicy);
+
+template<typename Policy>
+static void BM_TransformPolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    auto src = bench::iotaInts(count);
+    std::vector<int> dst(count);
+    for(auto _ : state)
+    {
+        std::transform(utils::executionPolicy<Policy>, src.begin(), src.end(), dst.begin(), [](int num){return num * 2;});
+        benchmark::DoNotOptimize(dst.data());
+    }
+    bench::reportPerOp(state, count, 2 * sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_TransformPolicy);
+
+template<typename Policy>
+static void BM_RemovePolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    auto src = bench::randomInts(count, 9);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        auto vec = src;
+        state.ResumeTiming();
+        vec.erase(std::remove(utils::executionPolicy<Policy>, vec.begin(), vec.end(), 4), vec.end());
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_RemovePolicy);
+
+template<typename Policy>
+static void BM_ReplacePolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    auto vec = bench::randomInts(count, 9);
+    for(auto _ : state)
+    {
+        std::replace(utils::executionPolicy<Policy>, vec.begin(), vec.end(), 4, 5);
+        std::replace(utils::executionPolicy<Policy>, vec.begin(), vec.end(), 5, 4);
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, 2 * count, sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_ReplacePolicy);
+
+template<typename Policy>
+static void BM_ReversePolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    auto vec = bench::iotaInts(count);
+    for(auto _ : state)
+    {
+        std::reverse(utils::executionPolicy<Policy>, vec.begin(), vec.end());
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_ReversePolicy);
+
+template<typename Policy>
+static void BM_RotatePolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    auto vec = bench::iotaInts(count);
+    for(auto _ : state)
+    {
+        std::rotate(utils::executionPolicy<Policy>, vec.begin(), vec.begin() + count / 3, vec.end());
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_RotatePolicy);
+
+template<typename Policy>
+static void BM_UniquePolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    auto src = bench::randomInts(count, 4);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        auto vec = src;
+        state.ResumeTiming();
+        vec.erase(std::unique(utils::executionPolicy<Policy>, vec.begin(), vec.end()), vec.end());
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_UniquePolicy);
+
+//Stream compaction: practise::remove, copy_if and unique against the std algorithms with 10%, 50% and 90%
+//of the random input kept. At 50% the keep decision is a coin flip for the branch predictor of the std loops,
+//the branchless kernels run at the same speed for every selectivity. Args are {elements, kept percent}.
+static void selectivitySweep(benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({"elements", "kept"});
+    for(std::int64_t count : {std::int64_t{1} << 16, bench::scalingElements})
+        for(std::int64_t kept : {10, 50, 90})
+            b->Args({count, kept});
+}
+
+//Percentages in [0, 100), element i is kept when keys[i] < kept
+static std::vector<int> selectivityKeys(std::int64_t count)
+{
+    return bench::randomInts(count, 99);
+}
+
+struct StdCompaction
+{
+    template<typename It, typename T>
+    static It remove(It first, It last, const T& value) { return std::remove(first, last, value); }
+    template<typename It, typename OutIt, typename Pred>
+    static OutIt copy_if(It first, It last, OutIt out, Pred pred) { return std::copy_if(first, last, out, pred); }
+    template<typename It>
+    static It unique(It first, It last) { return std::unique(first, last); }
+};
+
+struct PractiseCompaction
+{
+    template<typename It, typename T>
+    static It remove(It first, It last, const T& value) { return practise::remove(first, last, value); }
+    template<typename It, typename OutIt, typename Pred>
+    static OutIt copy_if(It first, It last, OutIt out, Pred pred) { return practise::copy_if(first, last, out, pred); }
+    template<typename It>
+    static It unique(It first, It last) { return practise::unique(first, last); }
+};
+
+struct PractiseCompactionPar
+{
+    template<typename It, typename T>
+    static It remove(It first, It last, const T& value) { return practise::remove(std::execution::par, first, last, value); }
+    template<typename It, typename OutIt, typename Pred>
+    static OutIt copy_if(It first, It last, OutIt out, Pred pred) { return practise::copy_if(std::execution::par, first, last, out, pred); }
+    template<typename It>
+    static It unique(It first, It last) { return practise::unique(std::execution::par, first, last); }
+};
+
+template<typename Algorithm>
+static void BM_CompactRemove(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto src = selectivityKeys(count);
+    for(auto& key : src)
+        key = key < state.range(1) ? key + 1 : 0;
+    std::vector<int> vec;
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        vec = src;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(Algorithm::remove(vec.begin(), vec.end(), 0));
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_CompactRemove, StdCompaction)->Apply(selectivitySweep);
+BENCHMARK_TEMPLATE(BM_CompactRemove, PractiseCompaction)->Apply(selectivitySweep);
+BENCHMARK_TEMPLATE(BM_CompactRemove, PractiseCompactionPar)->Apply(selectivitySweep);
+
+template<typename Algorithm>
+static void BM_CompactCopyIf(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto src = selectivityKeys(count);
+    const auto kept = static_cast<int>(state.range(1));
+    std::vector<int> dst(src.size());
+    for(auto _ : state)
+        benchmark::DoNotOptimize(Algorithm::copy_if(src.begin(), src.end(), dst.begin(), [kept](int key){ return key < kept; }));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_CompactCopyIf, StdCompaction)->Apply(selectivitySweep);
+BENCHMARK_TEMPLATE(BM_CompactCopyIf, PractiseCompaction)->Apply(selectivitySweep);
+BENCHMARK_TEMPLATE(BM_CompactCopyIf, PractiseCompactionPar)->Apply(selectivitySweep);
+
+template<typename Algorithm>
+static void BM_CompactUnique(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto src = selectivityKeys(count);
+    //The value only changes where an element is kept
+    int value = 0;
+    for(auto& key : src)
+        key = value += key < state.range(1);
+    std::vector<int> vec;
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        vec = src;
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(Algorithm::unique(vec.begin(), vec.end()));
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_CompactUnique, StdCompaction)->Apply(selectivitySweep);
+BENCHMARK_TEMPLATE(BM_CompactUnique, PractiseCompaction)->Apply(selectivitySweep);
+BENCHMARK_TEMPLATE(BM_CompactUnique, PractiseCompactionPar)->Apply(selectivitySweep);
+
+//Streaming stores: std::fill/std::copy against practise::streaming_fill/streaming_copy, sequential and with
+//std::execution::par. Below streaming_threshold() (the L1, L2 and L3 sizes of bench::cacheLevelSweep, the arg is
+//the buffer size in bytes) both write through the cache, the DRAM size streams.
+struct StdBulk
+{
+    static void fill(std::vector<int>& out, int value) { std::fill(out.begin(), out.end(), value); }
+    static void copy(const std::vector<int>& in, std::vector<int>& out) { std::copy(in.begin(), in.end(), out.begin()); }
+};
+
+struct StreamingBulk
+{
+    static void fill(std::vector<int>& out, int value) { practise::streaming_fill(out.begin(), out.end(), value); }
+    static void copy(const std::vector<int>& in, std::vector<int>& out) { practise::streaming_copy(in.begin(), in.end(), out.begin()); }
+};
+
+struct StreamingBulkPar
+{
+    static void fill(std::vector<int>& out, int value) { practise::streaming_fill(std::execution::par, out.begin(), out.end(), value); }
+    static void copy(const std::vector<int>& in, std::vector<int>& out) { practise::streaming_copy(std::execution::par, in.begin(), in.end(), out.begin()); }
+};
+
+//Leaves the cache to the probe alone, the baseline of BM_CachePollution
+struct NoBulk
+{
+    static void fill(std::vector<int>&, int) {}
+    static void copy(const std::vector<int>&, std::vector<int>&) {}
+};
+
+template<typename Bulk>
+static void BM_StreamingFill(benchmark::State& state)
+{
+    std::vector<int> values(static_cast<std::size_t>(state.range(0)) / sizeof(int));
+    int value = 0;
+    for(auto _ : state)
+    {
+        Bulk::fill(values, ++value);
+        benchmark::ClobberMemory();
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(values.size()), sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_StreamingFill, StdBulk)->Apply(bench::cacheLevelSweep);
+BENCHMARK_TEMPLATE(BM_StreamingFill, StreamingBulk)->Apply(bench::cacheLevelSweep);
+BENCHMARK_TEMPLATE(BM_StreamingFill, StreamingBulkPar)->Apply(bench::cacheLevelSweep)->UseRealTime();
+
+//Half the buffer is the source, half the destination
+template<typename Bulk>
+static void BM_StreamingCopy(benchmark::State& state)
+{
+    const auto count = static_cast<std::int64_t>(static_cast<std::size_t>(state.range(0)) / sizeof(int) / 2);
+    const auto src = bench::iotaInts(count);
+    std::vector<int> dst(src.size());
+    for(auto _ : state)
+    {
+        Bulk::copy(src, dst);
+        benchmark::ClobberMemory();
+    }
+    bench::reportPerOp(state, count, 2 * sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_StreamingCopy, StdBulk)->Apply(bench::cacheLevelSweep);
+BENCHMARK_TEMPLATE(BM_StreamingCopy, StreamingBulk)->Apply(bench::cacheLevelSweep);
+BENCHMARK_TEMPLATE(BM_StreamingCopy, StreamingBulkPar)->Apply(bench::cacheLevelSweep)->UseRealTime();
+
+//Cache pollution: a probe chases pointers through a table of a quarter of L3, one random line per lookup,
+//while bulk fills or copies of a DRAM sized buffer run. Cached stores evict the table and the lookups go to
+//DRAM, streaming stores leave it in the cache. probe ns/lookup is the latency seen by the probe.
+//concurrent:0 runs one pass over the table after every bulk operation, concurrent:1 chases on a second
+//thread for the whole run and counts its CPU time, so it also holds with fewer cores than threads.
+class PointerChase
+{
+    public:
+        PointerChase() : mNext(static_cast<std::size_t>(bench::cacheBytes(3) / 4) / sizeof(std::uint32_t))
+        {
+            //One cycle through the first slot of every line in random order (Sattolo)
+            const auto lines = static_cast<std::uint32_t>(mNext.size() / slotsPerLine);
+            std::vector<std::uint32_t> order(lines);
+            std::iota(order.begin(), order.end(), 0u);
+            std::mt19937 gen{42};
+            for(std::uint32_t i = lines - 1; i > 0; --i)
+                std::swap(order[i], order[std::uniform_int_distribution<std::uint32_t>{0, i - 1}(gen)]);
+            for(std::uint32_t i = 0; i < lines; ++i)
+                mNext[order[i] * slotsPerLine] = order[(i + 1) % lines] * slotsPerLine;
+        }
+
+        std::size_t lines() const { return mNext.size() / slotsPerLine; }
+
+        void chase(std::size_t lookups)
+        {
+            auto slot = mSlot;
+            for(; lookups; --lookups)
+                slot = mNext[slot];
+            mSlot = slot;
+            benchmark::DoNotOptimize(mSlot);
+        }
+
+    private:
+        static constexpr std::size_t slotsPerLine = 64 / sizeof(std::uint32_t);
+        std::vector<std::uint32_t> mNext;
+        std::uint32_t mSlot = 0;
+};
+
+static double threadCpuSeconds()
+{
+    timespec time{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return static_cast<double>(time.tv_sec) + static_cast<double>(time.tv_nsec) * 1e-9;
+}
+
+template<typename Bulk, bool Copy>
+static void BM_CachePollution(benchmark::State& state)
+{
+    const auto count = std::max<std::int64_t>(2 * bench::cacheBytes(3), std::int64_t{256} << 20) / static_cast<std::int64_t>(sizeof(int)) / (Copy ? 2 : 1);
+    const auto src = Copy ? bench::iotaInts(count) : std::vector<int>();
+    std::vector<int> dst(static_cast<std::size_t>(count));
+    auto bulk = [&] { if constexpr(Copy) Bulk::copy(src, dst); else Bulk::fill(dst, 3); };
+
+    PointerChase probe;
+    probe.chase(probe.lines());
+    double probeSeconds = 0;
+    std::size_t lookups = 0;
+    if(state.range(0) == 0)
+    {
+        for(auto _ : state)
+        {
+            bulk();
+            const auto start = std::chrono::steady_clock::now();
+            probe.chase(probe.lines());
+            probeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            lookups += probe.lines();
+        }
+    }
+    else
+    {
+        std::atomic<bool> done{false};
+        std::thread prober([&]
+        {
+            const auto start = threadCpuSeconds();
+            while(!done.load(std::memory_order_relaxed))
+            {
+                probe.chase(1024);
+                lookups += 1024;
+            }
+            probeSeconds = threadCpuSeconds() - start;
+        });
+        for(auto _ : state)
+        {
+            bulk();
+            benchmark::ClobberMemory();
+        }
+        done = true;
+        prober.join();
+    }
+    bench::reportPerOp(state, count, (Copy ? 2 : 1) * sizeof(int));
+    state.counters["probe ns/lookup"] = benchmark::Counter(lookups ? probeSeconds * 1e9 / static_cast<double>(lookups) : 0);
+}
+
+static void concurrentSweep(benchmark::internal::Benchmark* b)
+{
+    b->ArgName("concurrent")->Arg(0)->Arg(1)->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(BM_CachePollution, NoBulk, false)->ArgName("concurrent")->Arg(0);
+BENCHMARK_TEMPLATE(BM_CachePollution, StdBulk, false)->Apply(concurrentSweep);
+BENCHMARK_TEMPLATE(BM_CachePollution, StreamingBulk, false)->Apply(concurrentSweep);
+BENCHMARK_TEMPLATE(BM_CachePollution, StreamingBulkPar, false)->Apply(concurrentSweep);
+BENCHMARK_TEMPLATE(BM_CachePollution, StdBulk, true)->Apply(concurrentSweep);
+BENCHMARK_TEMPLATE(BM_CachePollution, StreamingBulk, true)->Apply(concurrentSweep);
+BENCHMARK_TEMPLATE(BM_CachePollution, StreamingBulkPar, true)->Apply(concurrentSweep);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,229 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <execution>
+#include <random>
+#include <vector>
+#include "Utils/BenchmarkUtils.h"
+#include "Utils/MappedFile.h"
+#include "Utils/ParallelBenchmarkUtils.h"
+
+static void BM_AllOf(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    std::vector<int> vec(count, 2);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::all_of(vec.begin(), vec.end(), [](int num){return (num % 2) == 0;}));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_AllOf)->Apply(bench::elementSweep);
+
+static void BM_AllOfPar(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    std::vector<int> vec(count, 2);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::all_of(std::execution::par, vec.begin(), vec.end(), [](int num){return (num % 2) == 0;}));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_AllOfPar)->Apply(bench::elementSweep)->UseRealTime();
+
+static void BM_CountIf(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec = bench::randomInts(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::count_if(vec.begin(), vec.end(), [](int num){return (num % 2) == 0;}));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_CountIf)->Apply(bench::elementSweep);
+
+static void BM_Find(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec = bench::iotaInts(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::find(vec.begin(), vec.end(), -1));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_Find)->Apply(bench::elementSweep);
+
+static void BM_Mismatch(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec1 = bench::iotaInts(count);
+    auto vec2 = vec1;
+    vec2.back() = -1;
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::mismatch(vec1.begin(), vec1.end(), vec2.begin()));
+    bench::reportPerOp(state, count, 2 * sizeof(int));
+}
+BENCHMARK(BM_Mismatch)->Apply(bench::elementSweep);
+
+static void BM_FindEnd(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec = bench::randomInts(count, 9);
+    std::vector<int> pattern{1,2,3};
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::find_end(vec.begin(), vec.end(), pattern.begin(), pattern.end()));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_FindEnd)->Apply(bench::elementSweep);
+
+static void BM_AdjacentFind(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec = bench::iotaInts(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::adjacent_find(vec.begin(), vec.end()));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_AdjacentFind)->Apply(bench::elementSweep);
+
+static void BM_Search(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec = bench::randomInts(count, 9);
+    std::vector<int> pattern{10,11,12};
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::search(vec.begin(), vec.end(), pattern.begin(), pattern.end()));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_Search)->Apply(bench::elementSweep);
+
+static void BM_SearchN(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec = bench::randomInts(count, 9);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::search_n(vec.begin(), vec.end(), 8, 4));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_SearchN)->Apply(bench::elementSweep);
+
+//search, search_n, find_end and adjacent_find again over ints mapped from files of 1 GiB and 4 GiB, written to
+//utils::inputDirectory() on the first run. Every iteration reads the whole file, from disk once it stops
+//fitting into the page cache.
+static utils::MappedFile mappedDigits(std::int64_t bytes)
+{
+    return utils::generatedFile<int>("bench-digits", static_cast<std::size_t>(bytes) / sizeof(int), [](std::span<int> chunk, std::size_t first)
+    {
+        std::mt19937_64 gen{first};
+        for(auto& val : chunk)
+            val = static_cast<int>(gen() % 10);
+    });
+}
+
+static void BM_SearchMapped(benchmark::State& state)
+{
+    const auto file = mappedDigits(state.range(0));
+    const auto values = file.span<int>();
+    std::vector<int> pattern{10,11,12};
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::search(values.begin(), values.end(), pattern.begin(), pattern.end()));
+    bench::reportPerOp(state, static_cast<std::int64_t>(values.size()), sizeof(int));
+}
+BENCHMARK(BM_SearchMapped)->Apply(bench::mappedFileSizes)->UseRealTime();
+
+static void BM_SearchNMapped(benchmark::State& state)
+{
+    const auto file = mappedDigits(state.range(0));
+    const auto values = file.span<int>();
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::search_n(values.begin(), values.end(), 16, 4));
+    bench::reportPerOp(state, static_cast<std::int64_t>(values.size()), sizeof(int));
+}
+BENCHMARK(BM_SearchNMapped)->Apply(bench::mappedFileSizes)->UseRealTime();
+
+static void BM_FindEndMapped(benchmark::State& state)
+{
+    const auto file = mappedDigits(state.range(0));
+    const auto values = file.span<int>();
+    std::vector<int> pattern{10,11,12};
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::find_end(values.begin(), values.end(), pattern.begin(), pattern.end()));
+    bench::reportPerOp(state, static_cast<std::int64_t>(values.size()), sizeof(int));
+}
+BENCHMARK(BM_FindEndMapped)->Apply(bench::mappedFileSizes)->UseRealTime();
+
+//Equal neighbours are common among digits, so every pair is counted to walk the whole file
+static void BM_AdjacentFindMapped(benchmark::State& state)
+{
+    const auto file = mappedDigits(state.range(0));
+    const auto values = file.span<int>();
+    for(auto _ : state)
+    {
+        std::size_t pairs = 0;
+        for(auto it = std::adjacent_find(values.begin(), values.end()); it != values.end(); it = std::adjacent_find(it + 1, values.end()))
+            ++pairs;
+        benchmark::DoNotOptimize(pairs);
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(values.size()), sizeof(int));
+}
+BENCHMARK(BM_AdjacentFindMapped)->Apply(bench::mappedFileSizes)->UseRealTime();
+
+//Thread scaling of the execution policy overloads, {elements, threads} args from bench::threadSweep
+template<typename Policy>
+static void BM_AllOfPolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    std::vector<int> vec(count, 2);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::all_of(utils::executionPolicy<Policy>, vec.begin(), vec.end(), [](int num){return (num % 2) == 0;}));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_AllOfPolicy);
+
+template<typename Policy>
+static void BM_CountIfPolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    auto vec = bench::randomInts(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::count_if(utils::executionPolicy<Policy>, vec.begin(), vec.end(), [](int num){return (num % 2) == 0;}));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_CountIfPolicy);
+
+template<typename Policy>
+static void BM_FindPolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    auto vec = bench::iotaInts(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::find(utils::executionPolicy<Policy>, vec.begin(), vec.end(), -1));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_FindPolicy);
+
+template<typename Policy>
+static void BM_MismatchPolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    auto vec1 = bench::iotaInts(count);
+    auto vec2 = vec1;
+    vec2.back() = -1;
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::mismatch(utils::executionPolicy<Policy>, vec1.begin(), vec1.end(), vec2.begin()));
+    bench::reportPerOp(state, count, 2 * sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_MismatchPolicy);
+
+template<typename Policy>
+static void BM_SearchPolicy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto limit = bench::limitThreads(state);
+    auto vec = bench::randomInts(count, 9);
+    std::vector<int> pattern{10,11,12};
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::search(utils::executionPolicy<Policy>, vec.begin(), vec.end(), pattern.begin(), pattern.end()));
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_EXECUTION_POLICIES(BM_SearchPolicy);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "RotateReverse.h"
+#include "Utils/BenchmarkUtils.h"
+
+//std against practise:: rotate, reverse, reverse_copy and shift_left on buffers sized for L1, L2, L3 and DRAM
+//(bench::cacheLevelSweep, the arg is the buffer size in bytes). Every iteration works on the result of the one
+//before, there is no reset to time.
+struct StdAlgorithms
+{
+    template<typename It>
+    static void rotate(It first, It middle, It last) { benchmark::DoNotOptimize(std::rotate(first, middle, last)); }
+    template<typename It>
+    static void reverse(It first, It last) { std::reverse(first, last); }
+    template<typename It, typename OutIt>
+    static void reverse_copy(It first, It last, OutIt out) { benchmark::DoNotOptimize(std::reverse_copy(first, last, out)); }
+    template<typename It>
+    static void shift_left(It first, It last, std::ptrdiff_t n) { benchmark::DoNotOptimize(std::shift_left(first, last, n)); }
+};
+
+struct PractiseAlgorithms
+{
+    template<typename It>
+    static void rotate(It first, It middle, It last) { benchmark::DoNotOptimize(practise::rotate(first, middle, last)); }
+    template<typename It>
+    static void reverse(It first, It last) { practise::reverse(first, last); }
+    template<typename It, typename OutIt>
+    static void reverse_copy(It first, It last, OutIt out) { benchmark::DoNotOptimize(practise::reverse_copy(first, last, out)); }
+    template<typename It>
+    static void shift_left(It first, It last, std::ptrdiff_t n) { benchmark::DoNotOptimize(practise::shift_left(first, last, n)); }
+};
+
+template<typename T>
+static std::vector<T> buffer(const benchmark::State& state)
+{
+    return bench::randomValues<T>(state.range(0) / static_cast<std::int64_t>(sizeof(T)));
+}
+
+//Split at a third, and at 1/64 like a ring buffer dropping a consumed head
+template<typename Algorithm, int Divisor>
+static void BM_Rotate(benchmark::State& state)
+{
+    auto values = buffer<std::uint32_t>(state);
+    const auto middle = static_cast<std::ptrdiff_t>(values.size() / Divisor);
+    for(auto _ : state)
+    {
+        Algorithm::rotate(values.begin(), values.begin() + middle, values.end());
+        benchmark::ClobberMemory();
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(values.size()), sizeof(std::uint32_t));
+}
+BENCHMARK_TEMPLATE(BM_Rotate, StdAlgorithms, 3)->Apply(bench::cacheLevelSweep);
+BENCHMARK_TEMPLATE(BM_Rotate, PractiseAlgorithms, 3)->Apply(bench::cacheLevelSweep);
+BENCHMARK_TEMPLATE(BM_Rotate, StdAlgorithms, 64)->Apply(bench::cacheLevelSweep);
+BENCHMARK_TEMPLATE(BM_Rotate, PractiseAlgorithms, 64)->Apply(bench::cacheLevelSweep);
+
+template<typename Algorithm, typename T>
+static void BM_Reverse(benchmark::State& state)
+{
+    auto values = buffer<T>(state);
+    for(auto _ : state)
+    {
+        Algorithm::reverse(values.begin(), values.end());
+        benchmark::ClobberMemory();
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(values.size()), sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_Reverse, StdAlgorithms, std::uint8_t)->Apply(bench::cacheLevelSweep);
+BENCHMARK_TEMPLATE(BM_Reverse, PractiseAlgorithms, std::uint8_t)->Apply(bench::cacheLevelSweep);
+BENCHMARK_TEMPLATE(BM_Reverse, StdAlgorithms, std::uint32_t)->Apply(bench::cacheLevelSweep);
+BENCHMARK_TEMPLATE(BM_Reverse, PractiseAlgorithms, std::uint32_t)->Apply(bench::cacheLevelSweep);
+BENCHMARK_TEMPLATE(BM_Reverse, StdAlgorithms, std::uint64_t)->Apply(bench::cacheLevelSweep);
+BENCHMARK_TEMPLATE(BM_Reverse, PractiseAlgorithms, std::uint64_t)->Apply(bench::cacheLevelSweep);
+
+//Half the buffer is the source, half the destination
+template<typename Algorithm>
+static void BM_ReverseCopy(benchmark::State& state)
+{
+    auto values = buffer<std::uint32_t>(state);
+    const auto half = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+    for(auto _ : state)
+    {
+        Algorithm::reverse_copy(values.begin(), half, half);
+        benchmark::ClobberMemory();
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(values.size() / 2), 2 * sizeof(std::uint32_t));
+}
+BENCHMARK_TEMPLATE(BM_ReverseCopy, StdAlgorithms)->Apply(bench::cacheLevelSweep);
+BENCHMARK_TEMPLATE(BM_ReverseCopy, PractiseAlgorithms)->Apply(bench::cacheLevelSweep);
+
+template<typename Algorithm>
+static void BM_ShiftLeft(benchmark::State& state)
+{
+    auto values = buffer<std::uint32_t>(state);
+    for(auto _ : state)
+    {
+        Algorithm::shift_left(values.begin(), values.end(), 1024);
+        benchmark::ClobberMemory();
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(values.size()), sizeof(std::uint32_t));
+}
+BENCHMARK_TEMPLATE(BM_ShiftLeft, StdAlgorithms)->Apply(bench::cacheLevelSweep);
+BENCHMARK_TEMPLATE(BM_ShiftLeft, PractiseAlgorithms)->Apply(bench::cacheLevelSweep);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,181 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <execution>
+#include <numeric>
+#include <vector>
+#include "RadixSort.h"
+#include "Utils/BenchmarkUtils.h"
+
+//radix_sort against std::sort, sequential and parallel, from 1e6 elements up to BENCH_MAX_ELEMENTS
+//(configure with -DBENCH_MAX_ELEMENTS=1000000000 for the 1e9 runs, they need about 3x the input in RAM)
+static void sortSweep(benchmark::internal::Benchmark* b)
+{
+    for(std::int64_t n = std::min<std::int64_t>(1'000'000, bench::maxElements); n <= bench::maxElements; n *= 10)
+        b->Arg(n);
+    b->Unit(benchmark::kMillisecond);
+    b->UseRealTime();
+}
+
+struct StdSort
+{
+    template<typename T>
+    static void sort(std::vector<T>& values) { std::sort(values.begin(), values.end()); }
+};
+
+struct StdSortPar
+{
+    template<typename T>
+    static void sort(std::vector<T>& values) { std::sort(std::execution::par, values.begin(), values.end()); }
+};
+
+struct RadixSort
+{
+    template<typename T>
+    static void sort(std::vector<T>& values) { practise::radix_sort(values); }
+};
+
+struct RadixSortPar
+{
+    template<typename T>
+    static void sort(std::vector<T>& values) { practise::radix_sort(std::execution::par, values); }
+};
+
+//Every iteration sorts a fresh copy of the same random input
+template<typename Algorithm, typename T>
+static void BM_Sort(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto input = bench::randomValues<T>(count);
+    std::vector<T> values;
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        values = input;
+        state.ResumeTiming();
+        Algorithm::sort(values);
+        benchmark::DoNotOptimize(values.data());
+    }
+    bench::reportPerOp(state, count, sizeof(T));
+}
+
+#define BENCHMARK_SORT(type) \
+    BENCHMARK_TEMPLATE(BM_Sort, StdSort, type)->Apply(sortSweep); \
+    BENCHMARK_TEMPLATE(BM_Sort, StdSortPar, type)->Apply(sortSweep); \
+    BENCHMARK_TEMPLATE(BM_Sort, RadixSort, type)->Apply(sortSweep); \
+    BENCHMARK_TEMPLATE(BM_Sort, RadixSortPar, type)->Apply(sortSweep)
+
+BENCHMARK_SORT(std::uint32_t);
+BENCHMARK_SORT(std::int64_t);
+BENCHMARK_SORT(float);
+BENCHMARK_SORT(double);
+
+//Records sorted on one member: std::stable_sort with a comparison against radix_sort with the key
+struct Record
+{
+    std::uint64_t id;
+    std::int32_t score;
+    float weight;
+};
+
+template<bool Radix, typename Policy>
+static void BM_SortRecords(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto scores = bench::randomInts(count);
+    std::vector<Record> input(static_cast<std::size_t>(count));
+    for(std::size_t i = 0; i < input.size(); ++i)
+        input[i] = {i, scores[i], static_cast<float>(i)};
+    std::vector<Record> records;
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        records = input;
+        state.ResumeTiming();
+        if constexpr(Radix)
+            practise::radix_sort(utils::executionPolicy<Policy>, records.begin(), records.end(), &Record::score);
+        else
+            std::stable_sort(utils::executionPolicy<Policy>, records.begin(), records.end(), [](auto& a, auto& b) { return a.score < b.score; });
+        benchmark::DoNotOptimize(records.data());
+    }
+    bench::reportPerOp(state, count, sizeof(Record));
+}
+BENCHMARK_TEMPLATE(BM_SortRecords, false, std::execution::sequenced_policy)->Apply(sortSweep);
+BENCHMARK_TEMPLATE(BM_SortRecords, false, std::execution::parallel_policy)->Apply(sortSweep);
+BENCHMARK_TEMPLATE(BM_SortRecords, true, std::execution::sequenced_policy)->Apply(sortSweep);
+BENCHMARK_TEMPLATE(BM_SortRecords, true, std::execution::parallel_policy)->Apply(sortSweep);
+
+//Separate key and value arrays: radix_sort_by_key against std::stable_sort of (key, value) pairs
+template<typename Policy>
+static void BM_SortPairs(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto keys = bench::randomInts(count);
+    std::vector<std::pair<int, int>> input(keys.size());
+    for(std::size_t i = 0; i < keys.size(); ++i)
+        input[i] = {keys[i], static_cast<int>(i)};
+    std::vector<std::pair<int, int>> pairs;
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        pairs = input;
+        state.ResumeTiming();
+        std::stable_sort(utils::executionPolicy<Policy>, pairs.begin(), pairs.end(), [](auto& a, auto& b) { return a.first < b.first; });
+        benchmark::DoNotOptimize(pairs.data());
+    }
+    bench::reportPerOp(state, count, 2 * sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_SortPairs, std::execution::sequenced_policy)->Apply(sortSweep);
+BENCHMARK_TEMPLATE(BM_SortPairs, std::execution::parallel_policy)->Apply(sortSweep);
+
+template<typename Policy>
+static void BM_RadixSortByKey(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto input = bench::randomInts(count);
+    std::vector<int> keys;
+    std::vector<int> values(input.size());
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        keys = input;
+        std::iota(values.begin(), values.end(), 0);
+        state.ResumeTiming();
+        practise::radix_sort_by_key(utils::executionPolicy<Policy>, keys.begin(), keys.end(), values.begin());
+        benchmark::DoNotOptimize(values.data());
+    }
+    bench::reportPerOp(state, count, 2 * sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_RadixSortByKey, std::execution::sequenced_policy)->Apply(sortSweep);
+BENCHMARK_TEMPLATE(BM_RadixSortByKey, std::execution::parallel_policy)->Apply(sortSweep);
+
+//Records partitioned into 256 buckets on their score: radix_partition against std::stable_sort on the bucket
+template<bool Radix, typename Policy>
+static void BM_PartitionRecords(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto scores = bench::randomInts(count);
+    std::vector<Record> input(static_cast<std::size_t>(count));
+    for(std::size_t i = 0; i < input.size(); ++i)
+        input[i] = {i, scores[i], static_cast<float>(i)};
+    auto bucket = [](const Record& record) { return record.score & 0xFF; };
+    std::vector<Record> records;
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        records = input;
+        state.ResumeTiming();
+        if constexpr(Radix)
+            benchmark::DoNotOptimize(practise::radix_partition(utils::executionPolicy<Policy>, records.begin(), records.end(), bucket));
+        else
+            std::stable_sort(utils::executionPolicy<Policy>, records.begin(), records.end(), [&](auto& a, auto& b) { return bucket(a) < bucket(b); });
+        benchmark::DoNotOptimize(records.data());
+    }
+    bench::reportPerOp(state, count, sizeof(Record));
+}
+BENCHMARK_TEMPLATE(BM_PartitionRecords, false, std::execution::sequenced_policy)->Apply(sortSweep);
+BENCHMARK_TEMPLATE(BM_PartitionRecords, false, std::execution::parallel_policy)->Apply(sortSweep);
+BENCHMARK_TEMPLATE(BM_PartitionRecords, true, std::execution::sequenced_policy)->Apply(sortSweep);
+BENCHMARK_TEMPLATE(BM_PartitionRecords, true, std::execution::parallel_policy)->Apply(sortSweep);
+
+BENCHMARK_MAIN();
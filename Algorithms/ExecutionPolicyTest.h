@@ -0,0 +1,41 @@
+//Typed fixture which runs an algorithm test once per standard execution policy (seq, par, par_unseq, unseq)
+#pragma once
+
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+#include "Utils/ExecutionPolicies.h"
+
+using ExecutionPolicies = testing::Types<std::execution::sequenced_policy,
+                                         std::execution::parallel_policy,
+                                         std::execution::parallel_unsequenced_policy,
+                                         std::execution::unsequenced_policy>;
+
+//Prints the tests as <Suite>/seq.<Test> instead of <Suite>/0.<Test>
+struct ExecutionPolicyNames
+{
+    template<typename Policy>
+    static std::string GetName(int) { return std::string(utils::ExecutionPolicyTraits<Policy>::name); }
+};
+
+template<typename Policy>
+class ExecutionPolicyTest : public testing::Test
+{
+    protected:
+        static constexpr const Policy& policy = utils::executionPolicy<Policy>;
+
+        //Large enough for the parallel backend to split the range into several chunks, the results are
+        //compared against the sequential overload without a policy
+        static constexpr std::size_t largeSize = 1 << 17;
+
+        static std::vector<int> largeInput(int maxValue = 1000)
+        {
+            std::mt19937 gen{42};
+            std::uniform_int_distribution<int> dist{0, maxValue};
+            std::vector<int> values(largeSize);
+            for(auto& val : values)
+                val = dist(gen);
+            return values;
+        }
+};
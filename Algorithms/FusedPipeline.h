@@ -0,0 +1,478 @@
+//Lazy pipelines of transform, filter, replace, replace_if and unique which run in a single loop over the input.
+//Chaining the std algorithms materializes every step in a vector of its own, and every pass reads and writes
+//the whole range again:
+//    std::transform(in.begin(), in.end(), std::back_inserter(a), f);
+//    std::copy_if(a.begin(), a.end(), std::back_inserter(b), pred); ...
+//A fused pipeline pushes each input element through all the stages before it takes the next one:
+//    auto etl = in | fused::transform(f) | fused::filter(pred) | fused::replace(0, -1) | fused::unique();
+//    fused::copy(etl, std::back_inserter(out));
+//The stages are composed at compile time and inlined into the loop of fused::copy, so the only memory
+//traffic is the input and the output. Stages can also be combined without a range, as a reusable pipeline:
+//    auto clean = fused::filter(pred) | fused::unique();
+//    fused::copy(in | fused::transform(f) | clean, out);
+//A fused_view is a std::ranges input view over the outputs, usable with range-for and the std::ranges
+//algorithms. They pull one element at a time, which is slower than fused::copy.
+//fused::copy(std::execution::par, ...) and fused::parallel_copy cut random access inputs into one chunk per
+//thread. Each chunk runs the pipeline into a buffer of its own, and the buffers are copied to the output in
+//order. A unique stage in a chunk starts from the last earlier element that reaches it, found by running the
+//stages before it backwards from the chunk start. For that, stage functions must be regular (equal inputs
+//give equal results), and unique predicates must be equivalences. Which elements reach a second unique stage
+//depends on the state of the first one, so pipelines with more than one unique stage run in a single loop.
+//Stage functions are called from several threads at once.
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "ParallelChunks.h"
+
+namespace practise
+{
+
+namespace detail
+{
+    //Stages bound to the type In of the values reaching them: push(value, next) calls next with the value
+    //passed on, or does not call it. Only the stateful ones keep anything from one element to the next.
+
+    template<typename In, typename F>
+    struct FusedTransformStage
+    {
+        static constexpr bool stateful = false;
+        using output = std::remove_cvref_t<std::invoke_result_t<const F&, In&>>;
+        const F* fun;
+
+        template<typename T, typename Next>
+        void push(T&& value, Next&& next) const { next(std::invoke(*fun, value)); }
+    };
+
+    template<typename In, typename Pred>
+    struct FusedFilterStage
+    {
+        static constexpr bool stateful = false;
+        using output = In;
+        const Pred* pred;
+
+        template<typename T, typename Next>
+        void push(T&& value, Next&& next) const
+        {
+            if(std::invoke(*pred, value))
+                next(std::forward<T>(value));
+        }
+    };
+
+    template<typename In, typename Pred>
+    struct FusedReplaceStage
+    {
+        static constexpr bool stateful = false;
+        using output = In;
+        const Pred* pred;
+        In newValue;
+
+        //A select between two lvalues, no branch and no copy
+        template<typename T, typename Next>
+        void push(T&& value, Next&& next) const
+        {
+            const In& replaced = std::invoke(*pred, value) ? newValue : value;
+            next(replaced);
+        }
+    };
+
+    template<typename In, typename Pred>
+    struct FusedUniqueStage
+    {
+        static constexpr bool stateful = true;
+        using output = In;
+        const Pred* pred;
+        //Last value passed on, compared as std::unique compares with the last element kept
+        std::optional<In> previous;
+
+        template<typename T, typename Next>
+        void push(T&& value, Next&& next)
+        {
+            if(previous && std::invoke(*pred, std::as_const(*previous), std::as_const(value)))
+                return;
+            previous = value;
+            next(std::forward<T>(value));
+        }
+
+        void seed(const In& value) { previous = value; }
+    };
+
+    //Unbound stages as the pipelines hold them, bind<In>() gives the stage for values of type In
+
+    template<typename F>
+    struct FusedTransform
+    {
+        F fun;
+
+        template<typename In>
+        auto bind() const { return FusedTransformStage<In, F>{&fun}; }
+    };
+
+    template<typename Pred>
+    struct FusedFilter
+    {
+        Pred pred;
+
+        template<typename In>
+        auto bind() const { return FusedFilterStage<In, Pred>{&pred}; }
+    };
+
+    template<typename Pred, typename U>
+    struct FusedReplace
+    {
+        Pred pred;
+        U newValue;
+
+        template<typename In>
+        auto bind() const { return FusedReplaceStage<In, Pred>{&pred, static_cast<In>(newValue)}; }
+    };
+
+    template<typename Pred>
+    struct FusedUnique
+    {
+        Pred pred;
+
+        template<typename In>
+        auto bind() const { return FusedUniqueStage<In, Pred>{&pred, std::nullopt}; }
+    };
+
+    //Predicate of replace
+    template<typename T>
+    struct FusedEqualTo
+    {
+        T value;
+
+        template<typename U>
+        bool operator()(const U& element) const { return element == value; }
+    };
+
+    //Tuple of the stages I... bound one after the other, starting with values of type In
+    template<typename In, std::size_t I = 0, typename Stages>
+    auto bindFusedStages(const Stages& stages)
+    {
+        if constexpr(I == std::tuple_size_v<Stages>)
+            return std::tuple<>{};
+        else
+        {
+            auto stage = std::get<I>(stages).template bind<In>();
+            return std::tuple_cat(std::make_tuple(stage), bindFusedStages<typename decltype(stage)::output, I + 1>(stages));
+        }
+    }
+
+    template<typename In, typename Bound>
+    struct FusedOutput
+    {
+        using type = In;
+    };
+
+    template<typename In, typename... Stages>
+        requires (sizeof...(Stages) > 0)
+    struct FusedOutput<In, std::tuple<Stages...>>
+    {
+        using type = typename std::tuple_element_t<sizeof...(Stages) - 1, std::tuple<Stages...>>::output;
+    };
+
+    //Runs value through the bound stages from I on, sink gets what comes out of the last one
+    template<std::size_t I = 0, typename Bound, typename T, typename Sink>
+    void pushFused(Bound& bound, T&& value, Sink& sink)
+    {
+        if constexpr(I == std::tuple_size_v<Bound>)
+            sink(std::forward<T>(value));
+        else
+            std::get<I>(bound).push(std::forward<T>(value), [&bound, &sink](auto&& next)
+            {
+                pushFused<I + 1>(bound, std::forward<decltype(next)>(next), sink);
+            });
+    }
+
+    //Runs value through the stages before Target, letting it pass the stateful ones. When it reaches Target,
+    //that stage is seeded with it and the result is true.
+    template<std::size_t Target, std::size_t I = 0, typename Bound, typename T>
+    bool seedFused(Bound& bound, T&& value)
+    {
+        if constexpr(I == Target)
+        {
+            std::get<Target>(bound).seed(value);
+            return true;
+        }
+        else if constexpr(std::tuple_element_t<I, Bound>::stateful)
+            return seedFused<Target, I + 1>(bound, std::forward<T>(value));
+        else
+        {
+            bool reached = false;
+            std::get<I>(bound).push(std::forward<T>(value), [&bound, &reached](auto&& next)
+            {
+                reached = seedFused<Target, I + 1>(bound, std::forward<decltype(next)>(next));
+            });
+            return reached;
+        }
+    }
+
+    template<typename Bound>
+    inline constexpr std::size_t fusedStatefulCount = 0;
+
+    template<typename... Stages>
+    inline constexpr std::size_t fusedStatefulCount<std::tuple<Stages...>> = (std::size_t{Stages::stateful} + ... + 0);
+
+    //Seeds each stateful stage of the chunk starting at first with the last element of [begin, first)
+    //that reaches it. Only exact when there is at most one stateful stage: the earlier ones are let through.
+    template<std::size_t I = 0, typename Bound, typename It>
+    void seedFusedStages(Bound& bound, It begin, It first)
+    {
+        if constexpr(I < std::tuple_size_v<Bound>)
+        {
+            if constexpr(std::tuple_element_t<I, Bound>::stateful)
+                for(auto it = first; it != begin;)
+                    if(seedFused<I>(bound, *--it))
+                        break;
+            seedFusedStages<I + 1>(bound, begin, first);
+        }
+    }
+}
+
+namespace fused
+{
+
+//Stages not bound to a range yet, pipeline | pipeline appends the stages of the second one
+template<typename... Stages>
+class pipeline
+{
+    public:
+        explicit pipeline(std::tuple<Stages...> stages) : mStages(std::move(stages)) {}
+
+        const std::tuple<Stages...>& stages() const { return mStages; }
+
+        template<typename... Others>
+        friend pipeline<Stages..., Others...> operator|(const pipeline& first, const pipeline<Others...>& second)
+        {
+            return pipeline<Stages..., Others...>(std::tuple_cat(first.stages(), second.stages()));
+        }
+
+    private:
+        std::tuple<Stages...> mStages;
+};
+
+//Input view of the outputs of the stages over the elements of V
+template<std::ranges::view V, typename... Stages>
+class fused_view : public std::ranges::view_interface<fused_view<V, Stages...>>
+{
+        using input_type = std::ranges::range_value_t<V>;
+        using bound_type = decltype(detail::bindFusedStages<input_type>(std::declval<const std::tuple<Stages...>&>()));
+
+    public:
+        using base_type = V;
+        using value_type = typename detail::FusedOutput<input_type, bound_type>::type;
+
+        //Chunks can only be seeded independently with at most one unique stage
+        static constexpr bool chunkable = detail::fusedStatefulCount<bound_type> <= 1;
+
+        class iterator
+        {
+            public:
+                using value_type = fused_view::value_type;
+                using difference_type = std::ptrdiff_t;
+
+                explicit iterator(fused_view& view)
+                    : mCurrent(std::ranges::begin(view.mBase)), mEnd(std::ranges::end(view.mBase)), mStages(view.bind())
+                {
+                    next();
+                }
+
+                const value_type& operator*() const { return *mValue; }
+                iterator& operator++() { next(); return *this; }
+                void operator++(int) { next(); }
+
+                friend bool operator==(const iterator& it, std::default_sentinel_t) { return !it.mValue; }
+
+            private:
+                //Pulls input elements until one comes out of the last stage
+                void next()
+                {
+                    mValue.reset();
+                    auto store = [this](auto&& value) { mValue.emplace(std::forward<decltype(value)>(value)); };
+                    for(; !mValue && mCurrent != mEnd; ++mCurrent)
+                        detail::pushFused(mStages, *mCurrent, store);
+                }
+
+                std::ranges::iterator_t<V> mCurrent;
+                std::ranges::sentinel_t<V> mEnd;
+                bound_type mStages;
+                std::optional<value_type> mValue;
+        };
+
+        fused_view(V base, std::tuple<Stages...> stages) : mBase(std::move(base)), mStages(std::move(stages)) {}
+
+        V base() const& requires std::copy_constructible<V> { return mBase; }
+        V base() && { return std::move(mBase); }
+        const std::tuple<Stages...>& stages() const { return mStages; }
+
+        //Input elements, not outputs
+        std::size_t input_size() requires std::ranges::sized_range<V> { return static_cast<std::size_t>(std::ranges::size(mBase)); }
+
+        iterator begin() { return iterator(*this); }
+        std::default_sentinel_t end() const { return {}; }
+
+        //Stages with fresh state, for one run over the input
+        bound_type bind() const { return detail::bindFusedStages<input_type>(mStages); }
+
+        //The single loop of fused::copy: every input element through all the stages, sink(value) for each output
+        template<typename Sink>
+        void run(Sink&& sink)
+        {
+            auto stages = bind();
+            for(auto&& element : mBase)
+                detail::pushFused(stages, element, sink);
+        }
+
+        //The same over the input elements [first, last), the unique stages start from the elements before first
+        template<typename Sink>
+            requires std::ranges::random_access_range<V>
+        void run(std::size_t first, std::size_t last, Sink&& sink)
+        {
+            auto stages = bind();
+            const auto begin = std::ranges::begin(mBase);
+            const auto chunkBegin = begin + static_cast<std::ranges::range_difference_t<V>>(first);
+            const auto chunkEnd = begin + static_cast<std::ranges::range_difference_t<V>>(last);
+            detail::seedFusedStages(stages, begin, chunkBegin);
+            for(auto it = chunkBegin; it != chunkEnd; ++it)
+                detail::pushFused(stages, *it, sink);
+        }
+
+    private:
+        V mBase;
+        std::tuple<Stages...> mStages;
+};
+
+template<typename T>
+inline constexpr bool is_fused_view = false;
+
+template<typename V, typename... Stages>
+inline constexpr bool is_fused_view<fused_view<V, Stages...>> = true;
+
+template<typename View>
+concept FusedView = is_fused_view<std::remove_cvref_t<View>>;
+
+//Parallel mode: random access inputs of known size
+template<typename View>
+concept ParallelFusedView = FusedView<View>
+                         && std::ranges::random_access_range<typename std::remove_cvref_t<View>::base_type>
+                         && std::ranges::sized_range<typename std::remove_cvref_t<View>::base_type>;
+
+template<std::ranges::viewable_range R, typename... Stages>
+    requires (!FusedView<R>)
+fused_view<std::views::all_t<R>, Stages...> operator|(R&& range, const pipeline<Stages...>& stages)
+{
+    return {std::views::all(std::forward<R>(range)), stages.stages()};
+}
+
+template<typename V, typename... Stages, typename... Others>
+fused_view<V, Stages..., Others...> operator|(fused_view<V, Stages...> view, const pipeline<Others...>& stages)
+{
+    auto combined = std::tuple_cat(view.stages(), stages.stages());
+    return {std::move(view).base(), std::move(combined)};
+}
+
+template<typename F>
+pipeline<detail::FusedTransform<F>> transform(F fun)
+{
+    return pipeline<detail::FusedTransform<F>>({{std::move(fun)}});
+}
+
+template<typename Pred>
+pipeline<detail::FusedFilter<Pred>> filter(Pred pred)
+{
+    return pipeline<detail::FusedFilter<Pred>>({{std::move(pred)}});
+}
+
+template<typename Pred, typename U>
+pipeline<detail::FusedReplace<Pred, U>> replace_if(Pred pred, U newValue)
+{
+    return pipeline<detail::FusedReplace<Pred, U>>({{std::move(pred), std::move(newValue)}});
+}
+
+template<typename T, typename U>
+pipeline<detail::FusedReplace<detail::FusedEqualTo<T>, U>> replace(T oldValue, U newValue)
+{
+    return replace_if(detail::FusedEqualTo<T>{std::move(oldValue)}, std::move(newValue));
+}
+
+template<typename BinaryPred = std::equal_to<>>
+pipeline<detail::FusedUnique<BinaryPred>> unique(BinaryPred pred = BinaryPred())
+{
+    return pipeline<detail::FusedUnique<BinaryPred>>({{std::move(pred)}});
+}
+
+//Runs the pipeline of view in a single loop and writes the outputs to out
+template<FusedView View, std::weakly_incrementable OutIt>
+OutIt copy(View&& view, OutIt out)
+{
+    view.run([&out](auto&& value)
+    {
+        *out = std::forward<decltype(value)>(value);
+        ++out;
+    });
+    return out;
+}
+
+//Parallel mode, chunks of at least detail::minParallelChunk input elements (ParallelChunks.h)
+template<ParallelFusedView View, std::weakly_incrementable OutIt>
+OutIt parallel_copy(View&& view, OutIt out, unsigned threadCount)
+{
+    using value_type = typename std::remove_cvref_t<View>::value_type;
+    const auto size = view.input_size();
+    const detail::Chunks chunks(size, detail::minParallelChunk, threadCount);
+    if(chunks.count == 1 || !std::remove_cvref_t<View>::chunkable)
+        return copy(view, out);
+
+    std::vector<std::vector<value_type>> buffers(chunks.count);
+    auto runChunk = [&](std::size_t chunk)
+    {
+        auto& buffer = buffers[chunk];
+        buffer.reserve((size / chunks.count) / 4);
+        view.run(chunks.first(chunk), chunks.last(chunk), [&buffer](auto&& value) { buffer.push_back(std::forward<decltype(value)>(value)); });
+    };
+    detail::runChunks(chunks.count, runChunk);
+
+    if constexpr(std::random_access_iterator<OutIt>)
+    {
+        std::vector<std::size_t> offsets(chunks.count + 1);
+        for(std::size_t chunk = 0; chunk < chunks.count; ++chunk)
+            offsets[chunk + 1] = offsets[chunk] + buffers[chunk].size();
+        auto copyChunk = [&](std::size_t chunk)
+        {
+            std::move(buffers[chunk].begin(), buffers[chunk].end(), out + static_cast<std::iter_difference_t<OutIt>>(offsets[chunk]));
+        };
+        detail::runChunks(chunks.count, copyChunk);
+        return out + static_cast<std::iter_difference_t<OutIt>>(offsets[chunks.count]);
+    }
+    else
+    {
+        for(auto& buffer : buffers)
+            out = std::move(buffer.begin(), buffer.end(), out);
+        return out;
+    }
+}
+
+//par and par_unseq run parallel_copy on every hardware thread, seq and unseq and the inputs without random
+//access the single loop
+template<detail::ExecutionPolicy Policy, FusedView View, std::weakly_incrementable OutIt>
+OutIt copy(Policy&&, View&& view, OutIt out)
+{
+    if constexpr(ParallelFusedView<View>)
+        return parallel_copy(view, out, detail::policyThreads<Policy>());
+    else
+        return copy(view, out);
+}
+
+}
+
+}
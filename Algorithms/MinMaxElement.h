@@ -0,0 +1,257 @@
+//Vectorized min_element, max_element and minmax_element for contiguous ranges of 8 to 64 bit integers, float
+//and double, with the results of the std versions: the first smallest, the first largest (max_element) and
+//the last largest (minmax_element) element. The range is scanned in blocks that fit in L1: each block is
+//reduced to its smallest/largest value with the widest vectors the CPU offers, picked at runtime (AVX-512BW
+//or AVX2 on x86-64, SSE2 otherwise), and only the block holding the winner is searched again for its
+//position. A float range holding a NaN falls back to the std algorithm, whose result then depends on
+//where the NaN sits. Any other range, iterator or element type, and every range when not built by GCC or
+//Clang for x86, goes straight to the std algorithm.
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "SimdDispatch.h"
+
+namespace practise
+{
+
+namespace detail
+{
+    template<typename T>
+    concept SimdMinMaxValue = (std::integral<T> && !std::same_as<T, bool>) || std::same_as<T, float> || std::same_as<T, double>;
+
+    template<typename It>
+    concept SimdMinMaxIterator = std::contiguous_iterator<It> && SimdMinMaxValue<std::iter_value_t<It>>;
+
+    enum class MinMaxKind { min, max, minmax };
+
+    //Positions of the winners, count when the range holds a NaN and the caller has to use the std algorithm
+    struct MinMaxIndex
+    {
+        std::size_t min;
+        std::size_t max;
+    };
+
+#if PRACTISE_SIMD_DISPATCH
+    //Elements reduced per block, 8 KiB keeps the block in L1 for the second look at the winning block
+    template<typename T>
+    inline constexpr std::size_t minMaxBlock = 8192 / sizeof(T);
+
+    //Smallest and largest value of a block and whether the block holds a NaN
+    template<typename T>
+    struct BlockBounds
+    {
+        T min;
+        T max;
+        bool unordered;
+    };
+
+    //Block reduction over Bytes wide vectors (GCC vector extensions, lowered to the instruction set of the
+    //calling kernel), four accumulators deep to hide the latency of the compares.
+    //count is a multiple of 4 vectors.
+    template<bool WantMin, bool WantMax, std::size_t Bytes, typename T>
+    [[gnu::always_inline]] inline BlockBounds<T> reduceBlock(const T* first, std::size_t count)
+    {
+        typedef T Vec __attribute__((vector_size(Bytes)));
+        constexpr std::size_t lanes = Bytes / sizeof(T);
+        constexpr bool floating = std::is_floating_point_v<T>;
+
+        Vec lo[4], hi[4], nan[4];
+        for(std::size_t acc = 0; acc < 4; ++acc)
+        {
+            std::memcpy(&lo[acc], first + acc * lanes, Bytes);
+            hi[acc] = lo[acc];
+            nan[acc] = lo[acc] - lo[acc];
+        }
+        for(std::size_t pos = 4 * lanes; pos < count; pos += 4 * lanes)
+        {
+            for(std::size_t acc = 0; acc < 4; ++acc)
+            {
+                Vec vec;
+                std::memcpy(&vec, first + pos + acc * lanes, Bytes);
+                if constexpr(WantMin)
+                    lo[acc] = vec < lo[acc] ? vec : lo[acc];
+                if constexpr(WantMax)
+                    hi[acc] = hi[acc] < vec ? vec : hi[acc];
+                //x - x is 0 for every number and NaN for NaN and infinities, NaN sticks in the sum
+                if constexpr(floating)
+                    nan[acc] += vec - vec;
+            }
+        }
+
+        BlockBounds<T> bounds{lo[0][0], hi[0][0], false};
+        for(std::size_t acc = 0; acc < 4; ++acc)
+            for(std::size_t lane = 0; lane < lanes; ++lane)
+            {
+                bounds.min = std::min(bounds.min, lo[acc][lane]);
+                bounds.max = std::max(bounds.max, hi[acc][lane]);
+                if constexpr(floating)
+                    bounds.unordered |= nan[acc][lane] != nan[acc][lane];
+            }
+        return bounds;
+    }
+
+    //Infinities also make x - x NaN, so a flagged block is checked element by element
+    template<typename T>
+    bool holdsNaN(const T* first, std::size_t count)
+    {
+        if constexpr(std::is_floating_point_v<T>)
+            return std::any_of(first, first + count, [](T val) { return val != val; });
+        else
+            return false;
+    }
+
+    template<MinMaxKind Kind, std::size_t Bytes, typename T>
+    [[gnu::always_inline]] inline MinMaxIndex minMaxKernel(const T* first, std::size_t count)
+    {
+        constexpr bool wantMin = Kind != MinMaxKind::max;
+        constexpr bool wantMax = Kind != MinMaxKind::min;
+        constexpr std::size_t step = 4 * Bytes / sizeof(T);
+        constexpr std::size_t block = std::max(minMaxBlock<T>, step);
+
+        //Only whole blocks of 4 vectors are reduced, the tail is folded in with scalar compares
+        const std::size_t vectorCount = count - count % step;
+        std::size_t minBlock = 0, maxBlock = 0;
+        T minValue = first[0], maxValue = first[0];
+        for(std::size_t pos = 0; pos < vectorCount; pos += block)
+        {
+            const auto size = std::min(block, vectorCount - pos);
+            const auto bounds = reduceBlock<wantMin, wantMax, Bytes>(first + pos, size);
+            if(bounds.unordered && holdsNaN(first + pos, size))
+                return {count, count};
+            //The first block reaching the minimum wins, and for minmax the last one reaching the maximum
+            if(wantMin && bounds.min < minValue)
+                minValue = bounds.min, minBlock = pos;
+            if constexpr(Kind == MinMaxKind::minmax)
+            {
+                if(!(bounds.max < maxValue))
+                    maxValue = bounds.max, maxBlock = pos;
+            }
+            else if(wantMax && maxValue < bounds.max)
+                maxValue = bounds.max, maxBlock = pos;
+        }
+
+        MinMaxIndex index{count, count};
+        if constexpr(wantMin)
+            index.min = static_cast<std::size_t>(std::find(first + minBlock, first + count, minValue) - first);
+        if constexpr(Kind == MinMaxKind::max)
+            index.max = static_cast<std::size_t>(std::find(first + maxBlock, first + count, maxValue) - first);
+        if constexpr(Kind == MinMaxKind::minmax)
+        {
+            //first[0] is the running value when no block was reduced, the search then starts at the front
+            const auto end = vectorCount ? std::min(maxBlock + block, vectorCount) : std::size_t{1};
+            std::size_t pos = end;
+            while(first[pos - 1] != maxValue)
+                --pos;
+            index.max = pos - 1;
+        }
+
+        for(std::size_t pos = vectorCount; pos < count; ++pos)
+        {
+            const T val = first[pos];
+            if(val != val)
+                return {count, count};
+            if(wantMin && val < first[index.min])
+                index.min = pos;
+            if constexpr(Kind == MinMaxKind::minmax)
+            {
+                if(!(val < first[index.max]))
+                    index.max = pos;
+            }
+            else if(wantMax && first[index.max] < val)
+                index.max = pos;
+        }
+        return index;
+    }
+
+    template<MinMaxKind Kind, typename T>
+    [[gnu::target("avx2")]] MinMaxIndex minMaxAvx2(const T* first, std::size_t count)
+    {
+        return minMaxKernel<Kind, 32>(first, count);
+    }
+
+    template<MinMaxKind Kind, typename T>
+    [[gnu::target("avx512f,avx512bw")]] MinMaxIndex minMaxAvx512(const T* first, std::size_t count)
+    {
+        return minMaxKernel<Kind, 64>(first, count);
+    }
+
+    //AVX-512 and AVX2 kernels, 16 byte blocks of the SSE2 baseline at the lower levels
+    template<MinMaxKind Kind, typename T>
+    MinMaxIndex minMaxIndex(const T* first, std::size_t count, SimdLevel level = simdLevel())
+    {
+        if(level == SimdLevel::avx512)
+            return minMaxAvx512<Kind>(first, count);
+        if(level == SimdLevel::avx2)
+            return minMaxAvx2<Kind>(first, count);
+        return minMaxKernel<Kind, 16>(first, count);
+    }
+#else
+    //Without dispatch the positions come from the std algorithms
+    template<MinMaxKind Kind, typename T>
+    MinMaxIndex minMaxIndex(const T* first, std::size_t count, SimdLevel = simdLevel())
+    {
+        const auto last = first + count;
+        if constexpr(Kind == MinMaxKind::min)
+            return {static_cast<std::size_t>(std::min_element(first, last) - first), count};
+        else if constexpr(Kind == MinMaxKind::max)
+            return {count, static_cast<std::size_t>(std::max_element(first, last) - first)};
+        else
+        {
+            const auto [min, max] = std::minmax_element(first, last);
+            return {static_cast<std::size_t>(min - first), static_cast<std::size_t>(max - first)};
+        }
+    }
+#endif
+}
+
+template<std::forward_iterator It>
+It min_element(It first, It last)
+{
+    if constexpr(PRACTISE_SIMD_DISPATCH && detail::SimdMinMaxIterator<It>)
+    {
+        if(first == last)
+            return last;
+        const auto index = detail::minMaxIndex<detail::MinMaxKind::min>(std::to_address(first), static_cast<std::size_t>(last - first));
+        if(index.min != static_cast<std::size_t>(last - first))
+            return first + static_cast<std::ptrdiff_t>(index.min);
+    }
+    return std::min_element(first, last);
+}
+
+template<std::forward_iterator It>
+It max_element(It first, It last)
+{
+    if constexpr(PRACTISE_SIMD_DISPATCH && detail::SimdMinMaxIterator<It>)
+    {
+        if(first == last)
+            return last;
+        const auto index = detail::minMaxIndex<detail::MinMaxKind::max>(std::to_address(first), static_cast<std::size_t>(last - first));
+        if(index.max != static_cast<std::size_t>(last - first))
+            return first + static_cast<std::ptrdiff_t>(index.max);
+    }
+    return std::max_element(first, last);
+}
+
+template<std::forward_iterator It>
+std::pair<It, It> minmax_element(It first, It last)
+{
+    if constexpr(PRACTISE_SIMD_DISPATCH && detail::SimdMinMaxIterator<It>)
+    {
+        if(first == last)
+            return {last, last};
+        const auto index = detail::minMaxIndex<detail::MinMaxKind::minmax>(std::to_address(first), static_cast<std::size_t>(last - first));
+        if(index.min != static_cast<std::size_t>(last - first))
+            return {first + static_cast<std::ptrdiff_t>(index.min), first + static_cast<std::ptrdiff_t>(index.max)};
+    }
+    return std::minmax_element(first, last);
+}
+
+}
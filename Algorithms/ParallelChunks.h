@@ -0,0 +1,95 @@
+//Fork/join helper of the parallel modes in the Algorithms headers: the range is cut in one chunk per thread,
+//the calling thread takes the first chunk and std::async threads the others.
+//Every parallel_* function takes threadCount, the calling thread included, and has a minimum chunk: a thread
+//costs a few microseconds to start and join, so inputs too short to give every thread a chunk of at least that
+//size use fewer threads, down to the calling thread alone. minParallelChunk is the default; headers whose
+//per element cost is far from that of a simple loop over ints keep their own minimum next to their kernels.
+//The execution policy overloads use every hardware thread for par and par_unseq and the calling thread only
+//for seq and unseq. Inputs without a fast path go to the std algorithm with the policy.
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <execution>
+#include <future>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "Utils/ExecutionPolicies.h"
+
+namespace practise::detail
+{
+    //Runs task(0) ... task(count - 1), task(0) on the calling thread, waits for all of them and rethrows the
+    //first exception one of them threw
+    template<typename Task>
+    void runChunks(std::size_t count, Task& task)
+    {
+        if(count == 1)
+        {
+            task(0);
+            return;
+        }
+        std::vector<std::future<void>> tasks;
+        std::exception_ptr error;
+        try
+        {
+            for(std::size_t chunk = 1; chunk < count; ++chunk)
+                tasks.push_back(std::async(std::launch::async, [&task, chunk] { task(chunk); }));
+            task(0);
+        }
+        catch(...)
+        {
+            error = std::current_exception();
+        }
+        for(auto& pending : tasks)
+        {
+            try
+            {
+                pending.get();
+            }
+            catch(...)
+            {
+                if(!error)
+                    error = std::current_exception();
+            }
+        }
+        if(error)
+            std::rethrow_exception(error);
+    }
+
+    //Elements of a simple loop below which a chunk does not earn back its thread
+    inline constexpr std::size_t minParallelChunk = 1 << 14;
+
+    //size elements cut in count chunks for runChunks: one per thread, fewer when the chunks would be shorter
+    //than minChunk elements. Every chunk has size / count elements, the last one also takes the rest.
+    struct Chunks
+    {
+        std::size_t size;
+        std::size_t count;
+
+        Chunks(std::size_t elements, std::size_t minChunk, unsigned threadCount)
+            : size(elements), count(std::clamp<std::size_t>(elements / std::max<std::size_t>(minChunk, 1), 1, std::max(1u, threadCount)))
+        {
+        }
+
+        std::size_t first(std::size_t chunk) const { return size / count * chunk; }
+        std::size_t last(std::size_t chunk) const { return chunk + 1 == count ? size : first(chunk + 1); }
+    };
+
+    //Thread count of std::execution::par and par_unseq
+    inline unsigned hardwareThreads()
+    {
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    template<typename Policy>
+    concept ExecutionPolicy = std::is_execution_policy_v<std::remove_cvref_t<Policy>>;
+
+    //Threads of the parallel mode behind a policy overload
+    template<typename Policy>
+    unsigned policyThreads()
+    {
+        return utils::ExecutionPolicyTraits<std::remove_cvref_t<Policy>>::parallel ? hardwareThreads() : 1;
+    }
+}
@@ -0,0 +1,441 @@
+//radix_sort : LSD radix sort for contiguous ranges (std::vector, std::array, plain arrays) of integers, float and
+//double, or of any element sorted on an arithmetic key extracted from it, and radix_sort_by_key which sorts a key
+//array and moves a parallel value array along with it. Keys are mapped to unsigned integers with the order of
+//the keys (sign bit flipped, negative floating point values inverted), then sorted one byte at a time from the
+//lowest: one pass counts every byte of every key, then each byte is a stable scatter into a buffer of the same
+//size and back. Bytes shared by all the keys skip their pass, so small values in wide types cost fewer passes.
+//All modes are stable, floating point keys order -0.0 before 0.0 and NaNs by their sign (after +inf or before
+//-inf). Ranges shorter than detail::minRadixSort use an insertion sort.
+//radix_partition is one of those passes on its own, a stable partition into 256 buckets (e.g. by hash or shard
+//before handing every bucket to its own thread), and shares the scatter with the sort.
+//The parallel mode cuts the range in one chunk per thread: each thread counts the bytes of its chunk, the
+//offsets are laid out bucket by bucket and chunk by chunk, and each thread scatters its own chunk, which keeps
+//the sort stable. After the first scatter each chunk counts its byte again before the pass. key is called from
+//several threads and must not throw, the range is left with valid but unspecified elements otherwise.
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "ParallelChunks.h"
+
+namespace practise
+{
+
+//Bounds of the buckets of radix_partition, bucket b holds the elements [bounds[b], bounds[b + 1])
+using radix_buckets = std::array<std::size_t, 257>;
+
+namespace detail
+{
+    template<typename T>
+    concept RadixKey = (std::integral<T> && !std::same_as<T, bool>) || std::same_as<T, float> || std::same_as<T, double>;
+
+    //Unsigned integer of the same width as the key
+    template<RadixKey T>
+    struct RadixBitsOf : std::make_unsigned<T> {};
+
+    template<>
+    struct RadixBitsOf<float> { using type = std::uint32_t; };
+
+    template<>
+    struct RadixBitsOf<double> { using type = std::uint64_t; };
+
+    template<RadixKey T>
+    using RadixBits = typename RadixBitsOf<T>::type;
+
+    //Maps a key to an unsigned integer whose order is the order of the keys
+    template<RadixKey T>
+    constexpr RadixBits<T> radixBits(T key) noexcept
+    {
+        using Bits = RadixBits<T>;
+        constexpr Bits signBit = Bits{1} << (8 * sizeof(Bits) - 1);
+        if constexpr(std::is_floating_point_v<T>)
+        {
+            const auto bits = std::bit_cast<Bits>(key);
+            return (bits & signBit) ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | signBit);
+        }
+        else if constexpr(std::is_signed_v<T>)
+            return static_cast<Bits>(static_cast<Bits>(key) ^ signBit);
+        else
+            return key;
+    }
+
+    template<typename T, typename Key>
+    concept RadixSortable = std::movable<T> && std::default_initializable<T> && std::invocable<Key&, const T&>
+                         && RadixKey<std::remove_cvref_t<std::invoke_result_t<Key&, const T&>>>;
+
+    template<typename T, typename Bucket>
+    concept RadixPartitionable = std::movable<T> && std::default_initializable<T> && std::invocable<Bucket&, const T&>
+                              && std::integral<std::remove_cvref_t<std::invoke_result_t<Bucket&, const T&>>>;
+
+    using RadixHistogram = std::array<std::size_t, 256>;
+
+    //Below this an insertion sort beats clearing and walking the histograms
+    inline constexpr std::size_t minRadixSort = 64;
+
+    //Each chunk also clears and lays out 256 offsets per byte pass, so radix chunks are longer than the
+    //default minParallelChunk
+    inline constexpr std::size_t minParallelRadixChunk = 1 << 16;
+
+    template<typename Bits>
+    constexpr std::size_t radixDigit(Bits bits, unsigned digit) noexcept
+    {
+        return static_cast<std::size_t>((bits >> (8 * digit)) & 0xFF);
+    }
+
+    //The elements of one range and a buffer of the same size, sorted on key(element)
+    template<typename T, typename Key>
+    struct RadixElements
+    {
+        using Bits = RadixBits<std::remove_cvref_t<std::invoke_result_t<Key&, const T&>>>;
+
+        T* data;
+        T* buffer;
+        Key& key;
+
+        template<bool FromBuffer>
+        Bits bits(std::size_t index) const
+        {
+            return radixBits(std::invoke(key, std::as_const((FromBuffer ? buffer : data)[index])));
+        }
+
+        template<bool FromBuffer>
+        void move(std::size_t from, std::size_t to) const
+        {
+            (FromBuffer ? data : buffer)[to] = std::move((FromBuffer ? buffer : data)[from]);
+        }
+
+        void moveBack(std::size_t first, std::size_t last) const
+        {
+            std::move(buffer + first, buffer + last, data + first);
+        }
+    };
+
+    //A key array and a value array permuted together, each with its buffer
+    template<typename K, typename V>
+    struct RadixKeyValues
+    {
+        using Bits = RadixBits<K>;
+
+        K* keys;
+        K* keyBuffer;
+        V* values;
+        V* valueBuffer;
+
+        template<bool FromBuffer>
+        Bits bits(std::size_t index) const
+        {
+            return radixBits((FromBuffer ? keyBuffer : keys)[index]);
+        }
+
+        template<bool FromBuffer>
+        void move(std::size_t from, std::size_t to) const
+        {
+            (FromBuffer ? keys : keyBuffer)[to] = std::move((FromBuffer ? keyBuffer : keys)[from]);
+            (FromBuffer ? values : valueBuffer)[to] = std::move((FromBuffer ? valueBuffer : values)[from]);
+        }
+
+        void moveBack(std::size_t first, std::size_t last) const
+        {
+            std::move(keyBuffer + first, keyBuffer + last, keys + first);
+            std::move(valueBuffer + first, valueBuffer + last, values + first);
+        }
+    };
+
+    //Stable insertion sort of data on bitsOf(element), moving values[i] along with data[i] when given
+    template<typename T, typename V, typename BitsOf>
+    void radixInsertionSort(T* data, V* values, std::size_t size, BitsOf bitsOf)
+    {
+        for(std::size_t i = 1; i < size; ++i)
+        {
+            const auto bits = bitsOf(std::as_const(data[i]));
+            if(!(bits < bitsOf(std::as_const(data[i - 1]))))
+                continue;
+            T element = std::move(data[i]);
+            std::size_t j = i;
+            if constexpr(std::is_void_v<V>)
+            {
+                for(; j > 0 && bits < bitsOf(std::as_const(data[j - 1])); --j)
+                    data[j] = std::move(data[j - 1]);
+            }
+            else
+            {
+                V value = std::move(values[i]);
+                for(; j > 0 && bits < bitsOf(std::as_const(data[j - 1])); --j)
+                {
+                    data[j] = std::move(data[j - 1]);
+                    values[j] = std::move(values[j - 1]);
+                }
+                values[j] = std::move(value);
+            }
+            data[j] = std::move(element);
+        }
+    }
+
+    //One stable counting sort pass of the chunks on byte digit of the keys, from data to the buffer or back
+    //(FromBuffer), counts[chunk] being the histogram of that byte in the chunk. The offsets are laid out bucket by
+    //bucket and inside a bucket chunk by chunk, so equal bytes keep their order. Returns where every bucket starts.
+    template<bool FromBuffer, typename Columns>
+    RadixHistogram radixScatter(const Columns& columns, const Chunks& chunks, unsigned digit,
+                                const std::vector<RadixHistogram>& counts, std::vector<RadixHistogram>& offsets)
+    {
+        RadixHistogram starts;
+        std::size_t offset = 0;
+        for(std::size_t bucket = 0; bucket < 256; ++bucket)
+        {
+            starts[bucket] = offset;
+            for(std::size_t chunk = 0; chunk < chunks.count; ++chunk)
+            {
+                offsets[chunk][bucket] = offset;
+                offset += counts[chunk][bucket];
+            }
+        }
+
+        auto scatter = [&](std::size_t chunk)
+        {
+            auto& next = offsets[chunk];
+            for(std::size_t i = chunks.first(chunk), last = chunks.last(chunk); i < last; ++i)
+                columns.template move<FromBuffer>(i, next[radixDigit(columns.template bits<FromBuffer>(i), digit)]++);
+        };
+        runChunks(chunks.count, scatter);
+        return starts;
+    }
+
+    //LSD passes over size elements of columns, on up to threadCount threads
+    template<typename Columns>
+    void lsdRadixSort(const Columns& columns, std::size_t size, unsigned threadCount)
+    {
+        using Bits = typename Columns::Bits;
+        constexpr unsigned digitCount = sizeof(Bits);
+
+        const Chunks chunks(size, minParallelRadixChunk, threadCount);
+
+        //Histograms of every byte of the chunks in the initial order, they add up to the histograms of the
+        //whole range whatever the order. counts[digit][chunk] is the histogram of one byte in one chunk.
+        std::array<std::vector<RadixHistogram>, digitCount> counts;
+        counts.fill(std::vector<RadixHistogram>(chunks.count));
+        auto countAll = [&](std::size_t chunk)
+        {
+            std::array<RadixHistogram, digitCount> histograms{};
+            for(std::size_t i = chunks.first(chunk), last = chunks.last(chunk); i < last; ++i)
+            {
+                const auto bits = columns.template bits<false>(i);
+                for(unsigned digit = 0; digit < digitCount; ++digit)
+                    ++histograms[digit][radixDigit(bits, digit)];
+            }
+            for(unsigned digit = 0; digit < digitCount; ++digit)
+                counts[digit][chunk] = histograms[digit];
+        };
+        runChunks(chunks.count, countAll);
+
+        std::vector<RadixHistogram> offsets(chunks.count);
+        bool inBuffer = false;
+        bool countsCurrent = true;
+        for(unsigned digit = 0; digit < digitCount; ++digit)
+        {
+            //A byte shared by all the keys leaves the order as it is
+            const auto firstBucket = radixDigit(inBuffer ? columns.template bits<true>(0) : columns.template bits<false>(0), digit);
+            std::size_t firstBucketSize = 0;
+            for(auto& histogram : counts[digit])
+                firstBucketSize += histogram[firstBucket];
+            if(firstBucketSize == size)
+                continue;
+
+            auto pass = [&]<bool FromBuffer>()
+            {
+                //After the first scatter the chunks hold other elements, their counts are taken again. A single
+                //chunk is the whole range, its first counts stay exact.
+                if(!countsCurrent && chunks.count > 1)
+                {
+                    auto countDigit = [&](std::size_t chunk)
+                    {
+                        auto& histogram = counts[digit][chunk];
+                        histogram.fill(0);
+                        for(std::size_t i = chunks.first(chunk), last = chunks.last(chunk); i < last; ++i)
+                            ++histogram[radixDigit(columns.template bits<FromBuffer>(i), digit)];
+                    };
+                    runChunks(chunks.count, countDigit);
+                }
+                radixScatter<FromBuffer>(columns, chunks, digit, counts[digit], offsets);
+            };
+            if(inBuffer)
+                pass.template operator()<true>();
+            else
+                pass.template operator()<false>();
+            inBuffer = !inBuffer;
+            countsCurrent = false;
+        }
+
+        if(inBuffer)
+        {
+            auto moveBack = [&](std::size_t chunk) { columns.moveBack(chunks.first(chunk), chunks.last(chunk)); };
+            runChunks(chunks.count, moveBack);
+        }
+    }
+
+    //Stable partition of size elements of columns on the low byte of their keys, on up to threadCount threads:
+    //one count and one scatter pass into the buffer, then the elements move back
+    template<typename Columns>
+    radix_buckets radixPartition(const Columns& columns, std::size_t size, unsigned threadCount)
+    {
+        const Chunks chunks(size, minParallelRadixChunk, threadCount);
+        std::vector<RadixHistogram> counts(chunks.count);
+        auto countLowByte = [&](std::size_t chunk)
+        {
+            auto& histogram = counts[chunk];
+            for(std::size_t i = chunks.first(chunk), last = chunks.last(chunk); i < last; ++i)
+                ++histogram[radixDigit(columns.template bits<false>(i), 0)];
+        };
+        runChunks(chunks.count, countLowByte);
+
+        std::vector<RadixHistogram> offsets(chunks.count);
+        const auto starts = radixScatter<false>(columns, chunks, 0, counts, offsets);
+        auto moveBack = [&](std::size_t chunk) { columns.moveBack(chunks.first(chunk), chunks.last(chunk)); };
+        runChunks(chunks.count, moveBack);
+
+        radix_buckets bounds;
+        std::copy(starts.begin(), starts.end(), bounds.begin());
+        bounds[256] = size;
+        return bounds;
+    }
+
+    template<typename T, typename Key>
+    void radixSortElements(T* data, std::size_t size, Key& key, unsigned threadCount)
+    {
+        if(size < minRadixSort)
+        {
+            radixInsertionSort<T, void>(data, nullptr, size, [&](const T& element) { return radixBits(std::invoke(key, element)); });
+            return;
+        }
+        auto buffer = std::make_unique_for_overwrite<T[]>(size);
+        lsdRadixSort(RadixElements<T, Key>{data, buffer.get(), key}, size, threadCount);
+    }
+
+    template<typename K, typename V>
+    void radixSortKeyValues(K* keys, V* values, std::size_t size, unsigned threadCount)
+    {
+        if(size < minRadixSort)
+        {
+            radixInsertionSort(keys, values, size, [](const K& key) { return radixBits(key); });
+            return;
+        }
+        auto keyBuffer = std::make_unique_for_overwrite<K[]>(size);
+        auto valueBuffer = std::make_unique_for_overwrite<V[]>(size);
+        lsdRadixSort(RadixKeyValues<K, V>{keys, keyBuffer.get(), values, valueBuffer.get()}, size, threadCount);
+    }
+
+    //The low byte of bucket(element) is the key of the partition
+    template<typename T, typename Bucket>
+    radix_buckets radixPartitionElements(T* data, std::size_t size, Bucket& bucket, unsigned threadCount)
+    {
+        auto lowByte = [&bucket](const T& element) { return static_cast<std::uint8_t>(std::invoke(bucket, element)); };
+        auto buffer = std::make_unique_for_overwrite<T[]>(size);
+        return radixPartition(RadixElements<T, decltype(lowByte)>{data, buffer.get(), lowByte}, size, threadCount);
+    }
+}
+
+//Sequential mode, sorts [first, last) on key(element), by default the elements themselves
+template<std::contiguous_iterator It, typename Key = std::identity>
+    requires std::permutable<It> && detail::RadixSortable<std::iter_value_t<It>, Key>
+void radix_sort(It first, It last, Key key = Key())
+{
+    detail::radixSortElements(std::to_address(first), static_cast<std::size_t>(last - first), key, 1);
+}
+
+template<std::ranges::contiguous_range Range, typename Key = std::identity>
+    requires std::permutable<std::ranges::iterator_t<Range>> && detail::RadixSortable<std::ranges::range_value_t<Range>, Key>
+void radix_sort(Range&& range, Key key = Key())
+{
+    detail::radixSortElements(std::ranges::data(range), std::ranges::size(range), key, 1);
+}
+
+//Parallel mode, chunks of at least detail::minParallelRadixChunk elements (ParallelChunks.h)
+template<std::contiguous_iterator It, typename Key = std::identity>
+    requires std::permutable<It> && detail::RadixSortable<std::iter_value_t<It>, Key>
+void parallel_radix_sort(It first, It last, unsigned threadCount, Key key = Key())
+{
+    detail::radixSortElements(std::to_address(first), static_cast<std::size_t>(last - first), key, threadCount);
+}
+
+//Execution policy front ends
+template<typename Policy, std::contiguous_iterator It, typename Key = std::identity>
+    requires std::is_execution_policy_v<std::remove_cvref_t<Policy>> && std::permutable<It>
+          && detail::RadixSortable<std::iter_value_t<It>, Key>
+void radix_sort(Policy&&, It first, It last, Key key = Key())
+{
+    const unsigned threadCount = detail::policyThreads<Policy>();
+    detail::radixSortElements(std::to_address(first), static_cast<std::size_t>(last - first), key, threadCount);
+}
+
+template<typename Policy, std::ranges::contiguous_range Range, typename Key = std::identity>
+    requires std::is_execution_policy_v<std::remove_cvref_t<Policy>> && std::permutable<std::ranges::iterator_t<Range>>
+          && detail::RadixSortable<std::ranges::range_value_t<Range>, Key>
+void radix_sort(Policy&& policy, Range&& range, Key key = Key())
+{
+    radix_sort(std::forward<Policy>(policy), std::ranges::begin(range), std::ranges::begin(range) + std::ranges::ssize(range), key);
+}
+
+//Sorts the keys [keysFirst, keysLast) and applies the same permutation to the values starting at valuesFirst
+template<std::contiguous_iterator KeyIt, std::contiguous_iterator ValueIt>
+    requires std::permutable<KeyIt> && std::permutable<ValueIt> && detail::RadixKey<std::iter_value_t<KeyIt>>
+          && std::default_initializable<std::iter_value_t<ValueIt>>
+void radix_sort_by_key(KeyIt keysFirst, KeyIt keysLast, ValueIt valuesFirst)
+{
+    detail::radixSortKeyValues(std::to_address(keysFirst), std::to_address(valuesFirst), static_cast<std::size_t>(keysLast - keysFirst), 1);
+}
+
+template<std::contiguous_iterator KeyIt, std::contiguous_iterator ValueIt>
+    requires std::permutable<KeyIt> && std::permutable<ValueIt> && detail::RadixKey<std::iter_value_t<KeyIt>>
+          && std::default_initializable<std::iter_value_t<ValueIt>>
+void parallel_radix_sort_by_key(KeyIt keysFirst, KeyIt keysLast, ValueIt valuesFirst, unsigned threadCount)
+{
+    detail::radixSortKeyValues(std::to_address(keysFirst), std::to_address(valuesFirst), static_cast<std::size_t>(keysLast - keysFirst), threadCount);
+}
+
+template<typename Policy, std::contiguous_iterator KeyIt, std::contiguous_iterator ValueIt>
+    requires std::is_execution_policy_v<std::remove_cvref_t<Policy>> && std::permutable<KeyIt> && std::permutable<ValueIt>
+          && detail::RadixKey<std::iter_value_t<KeyIt>> && std::default_initializable<std::iter_value_t<ValueIt>>
+void radix_sort_by_key(Policy&&, KeyIt keysFirst, KeyIt keysLast, ValueIt valuesFirst)
+{
+    const unsigned threadCount = detail::policyThreads<Policy>();
+    detail::radixSortKeyValues(std::to_address(keysFirst), std::to_address(valuesFirst), static_cast<std::size_t>(keysLast - keysFirst), threadCount);
+}
+
+//Stable partition of [first, last) into 256 buckets on bucket(element), a value below 256: the elements of bucket
+//0 first, then those of bucket 1 and so on, each bucket in the order of the input. It is one counting and scatter
+//pass of radix_sort, parallel the same way.
+template<std::contiguous_iterator It, typename Bucket>
+    requires std::permutable<It> && detail::RadixPartitionable<std::iter_value_t<It>, Bucket>
+radix_buckets radix_partition(It first, It last, Bucket bucket)
+{
+    return detail::radixPartitionElements(std::to_address(first), static_cast<std::size_t>(last - first), bucket, 1);
+}
+
+template<std::contiguous_iterator It, typename Bucket>
+    requires std::permutable<It> && detail::RadixPartitionable<std::iter_value_t<It>, Bucket>
+radix_buckets parallel_radix_partition(It first, It last, unsigned threadCount, Bucket bucket)
+{
+    return detail::radixPartitionElements(std::to_address(first), static_cast<std::size_t>(last - first), bucket, threadCount);
+}
+
+template<typename Policy, std::contiguous_iterator It, typename Bucket>
+    requires std::is_execution_policy_v<std::remove_cvref_t<Policy>> && std::permutable<It>
+          && detail::RadixPartitionable<std::iter_value_t<It>, Bucket>
+radix_buckets radix_partition(Policy&&, It first, It last, Bucket bucket)
+{
+    const unsigned threadCount = detail::policyThreads<Policy>();
+    return detail::radixPartitionElements(std::to_address(first), static_cast<std::size_t>(last - first), bucket, threadCount);
+}
+
+}
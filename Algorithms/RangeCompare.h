@@ -0,0 +1,232 @@
+//equal, mismatch and lexicographical_compare for contiguous ranges whose elements are equal exactly when their
+//bytes are (integers, enums and pointers), compared with the default equal_to/less. equal, and
+//lexicographical_compare over unsigned bytes, go to memcmp. mismatch and the other lexicographical_compare
+//ranges use a mismatch-finding kernel: 32 bytes of each range are compared per step with AVX2 (16 with SSE2,
+//picked at runtime), keys shorter than a vector as two overlapping words, and the first differing byte gives
+//the first differing element, which is then ordered with comp.
+//Custom predicates, floating point, class types and other iterators take the std algorithms.
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "SimdDispatch.h"
+
+#if PRACTISE_SIMD_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace practise
+{
+
+namespace detail
+{
+    template<typename T>
+    concept BytewiseComparable = std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>;
+
+    template<typename It1, typename It2>
+    concept BytewiseRanges = std::contiguous_iterator<It1> && std::contiguous_iterator<It2>
+                          && std::same_as<std::iter_value_t<It1>, std::iter_value_t<It2>>
+                          && BytewiseComparable<std::iter_value_t<It1>>;
+
+    template<typename Pred, typename T>
+    concept DefaultEqual = std::same_as<Pred, std::equal_to<>> || std::same_as<Pred, std::equal_to<T>>
+                        || std::same_as<Pred, std::ranges::equal_to>;
+
+    template<typename Comp, typename T>
+    concept DefaultLess = std::same_as<Comp, std::less<>> || std::same_as<Comp, std::less<T>>
+                       || std::same_as<Comp, std::ranges::less>;
+
+    //memcmp orders the bytes as unsigned char, which is the element order only for unsigned single bytes
+    template<typename T>
+    concept MemcmpOrdered = sizeof(T) == 1 && (std::is_unsigned_v<T> || std::same_as<T, std::byte>);
+
+#if PRACTISE_SIMD_DISPATCH
+    //First differing byte of two Word sized loads, Word when they are equal (x86 is little endian, the lowest
+    //set bit of the xor is in the first differing byte)
+    template<typename Word>
+    std::size_t mismatchWord(const unsigned char* first1, const unsigned char* first2)
+    {
+        Word lhs, rhs;
+        std::memcpy(&lhs, first1, sizeof(Word));
+        std::memcpy(&rhs, first2, sizeof(Word));
+        return static_cast<std::size_t>(std::countr_zero(static_cast<Word>(lhs ^ rhs))) / 8;
+    }
+
+    //Buffers shorter than 16 bytes, read as two overlapping words
+    inline std::size_t mismatchShort(const unsigned char* first1, const unsigned char* first2, std::size_t count)
+    {
+        auto overlapping = [&]<typename Word>(Word)
+        {
+            if(const auto pos = mismatchWord<Word>(first1, first2); pos < sizeof(Word))
+                return pos;
+            const auto tail = count - sizeof(Word);
+            const auto pos = mismatchWord<Word>(first1 + tail, first2 + tail);
+            return pos < sizeof(Word) ? tail + pos : count;
+        };
+        if(count >= 8)
+            return overlapping(std::uint64_t{});
+        if(count >= 4)
+            return overlapping(std::uint32_t{});
+        for(std::size_t pos = 0; pos < count; ++pos)
+            if(first1[pos] != first2[pos])
+                return pos;
+        return count;
+    }
+
+    inline std::uint32_t equalMaskSse2(const unsigned char* first1, const unsigned char* first2)
+    {
+        const auto lhs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first1));
+        const auto rhs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first2));
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(lhs, rhs)));
+    }
+
+    inline std::size_t mismatchBytesSse2(const unsigned char* first1, const unsigned char* first2, std::size_t count)
+    {
+        if(count < 16)
+            return mismatchShort(first1, first2, count);
+        std::size_t pos = 0;
+        for(; pos + 16 <= count; pos += 16)
+            if(const auto mask = equalMaskSse2(first1 + pos, first2 + pos); mask != 0xFFFFu)
+                return pos + static_cast<std::size_t>(std::countr_one(mask));
+        //The last block overlaps bytes already found equal
+        if(pos < count)
+        {
+            const auto mask = equalMaskSse2(first1 + count - 16, first2 + count - 16);
+            return mask == 0xFFFFu ? count : count - 16 + static_cast<std::size_t>(std::countr_one(mask));
+        }
+        return count;
+    }
+
+    //Bit i set when byte i of the two 32 byte blocks is equal
+    [[gnu::target("avx2")]] inline std::uint32_t equalMaskAvx2(const unsigned char* first1, const unsigned char* first2)
+    {
+        const auto lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first1));
+        const auto rhs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first2));
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)));
+    }
+
+    [[gnu::target("avx2")]] inline std::size_t mismatchBytesAvx2(const unsigned char* first1, const unsigned char* first2, std::size_t count)
+    {
+        if(count < 32)
+            return mismatchBytesSse2(first1, first2, count);
+        std::size_t pos = 0;
+        //Two blocks per step, they are only looked at one by one once the step found a difference
+        for(; pos + 64 <= count; pos += 64)
+            if((equalMaskAvx2(first1 + pos, first2 + pos) & equalMaskAvx2(first1 + pos + 32, first2 + pos + 32)) != 0xFFFFFFFFu)
+                break;
+        for(; pos + 32 <= count; pos += 32)
+            if(const auto mask = equalMaskAvx2(first1 + pos, first2 + pos); mask != 0xFFFFFFFFu)
+                return pos + static_cast<std::size_t>(std::countr_one(mask));
+        if(pos < count)
+        {
+            const auto mask = equalMaskAvx2(first1 + count - 32, first2 + count - 32);
+            return mask == 0xFFFFFFFFu ? count : count - 32 + static_cast<std::size_t>(std::countr_one(mask));
+        }
+        return count;
+    }
+
+    //Index of the first byte differing between the two buffers, count when they are equal
+    inline std::size_t mismatchBytes(const void* first1, const void* first2, std::size_t count, SimdLevel level)
+    {
+        const auto lhs = static_cast<const unsigned char*>(first1);
+        const auto rhs = static_cast<const unsigned char*>(first2);
+        if(level >= SimdLevel::avx2)
+            return mismatchBytesAvx2(lhs, rhs, count);
+        return mismatchBytesSse2(lhs, rhs, count);
+    }
+
+    //Short keys need neither a vector nor the CPU lookup
+    inline std::size_t mismatchBytes(const void* first1, const void* first2, std::size_t count)
+    {
+        if(count < 16)
+            return mismatchShort(static_cast<const unsigned char*>(first1), static_cast<const unsigned char*>(first2), count);
+        return mismatchBytes(first1, first2, count, simdLevel());
+    }
+#endif
+
+    //Index of the first differing element of two bytewise comparable ranges of count elements
+    template<typename It1, typename It2>
+    std::size_t mismatchIndex(It1 first1, It2 first2, std::size_t count)
+    {
+        using T = std::iter_value_t<It1>;
+#if PRACTISE_SIMD_DISPATCH
+        return mismatchBytes(std::to_address(first1), std::to_address(first2), count * sizeof(T)) / sizeof(T);
+#else
+        return static_cast<std::size_t>(std::mismatch(first1, first1 + count, first2).first - first1);
+#endif
+    }
+}
+
+template<std::input_iterator It1, std::input_iterator It2, typename Pred = std::equal_to<>>
+std::pair<It1, It2> mismatch(It1 first1, It1 last1, It2 first2, It2 last2, Pred pred = Pred())
+{
+    if constexpr(detail::BytewiseRanges<It1, It2> && detail::DefaultEqual<Pred, std::iter_value_t<It1>>)
+    {
+        const auto count = static_cast<std::size_t>(std::min(last1 - first1, last2 - first2));
+        const auto index = static_cast<std::ptrdiff_t>(detail::mismatchIndex(first1, first2, count));
+        return {first1 + index, first2 + index};
+    }
+    else
+        return std::mismatch(first1, last1, first2, last2, pred);
+}
+
+template<std::input_iterator It1, std::input_iterator It2, typename Pred = std::equal_to<>>
+bool equal(It1 first1, It1 last1, It2 first2, It2 last2, Pred pred = Pred())
+{
+    if constexpr(detail::BytewiseRanges<It1, It2> && detail::DefaultEqual<Pred, std::iter_value_t<It1>>)
+    {
+        const auto count = last1 - first1;
+        return count == last2 - first2
+            && (count == 0 || std::memcmp(std::to_address(first1), std::to_address(first2), static_cast<std::size_t>(count) * sizeof(*first1)) == 0);
+    }
+    else
+        return std::equal(first1, last1, first2, last2, pred);
+}
+
+//Second range as long as the first one
+template<std::input_iterator It1, std::input_iterator It2, typename Pred = std::equal_to<>>
+    requires std::indirect_binary_predicate<Pred, It1, It2>
+bool equal(It1 first1, It1 last1, It2 first2, Pred pred = Pred())
+{
+    if constexpr(detail::BytewiseRanges<It1, It2> && detail::DefaultEqual<Pred, std::iter_value_t<It1>>)
+        return practise::equal(first1, last1, first2, first2 + (last1 - first1), pred);
+    else
+        return std::equal(first1, last1, first2, pred);
+}
+
+template<std::input_iterator It1, std::input_iterator It2, typename Compare = std::less<>>
+bool lexicographical_compare(It1 first1, It1 last1, It2 first2, It2 last2, Compare comp = Compare())
+{
+    if constexpr(detail::BytewiseRanges<It1, It2> && detail::DefaultLess<Compare, std::iter_value_t<It1>>)
+    {
+        const auto size1 = static_cast<std::size_t>(last1 - first1);
+        const auto size2 = static_cast<std::size_t>(last2 - first2);
+        const auto count = std::min(size1, size2);
+        if constexpr(detail::MemcmpOrdered<std::iter_value_t<It1>>)
+        {
+            if(const auto order = count ? std::memcmp(std::to_address(first1), std::to_address(first2), count) : 0; order != 0)
+                return order < 0;
+            return size1 < size2;
+        }
+        else
+        {
+            const auto index = detail::mismatchIndex(first1, first2, count);
+            if(index == count)
+                return size1 < size2;
+            return comp(first1[static_cast<std::ptrdiff_t>(index)], first2[static_cast<std::ptrdiff_t>(index)]);
+        }
+    }
+    else
+        return std::lexicographical_compare(first1, last1, first2, last2, comp);
+}
+
+}
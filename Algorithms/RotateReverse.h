@@ -0,0 +1,280 @@
+//rotate, rotate_copy, reverse, reverse_copy, shift_left and shift_right for contiguous ranges of trivially copyable
+//types, tuned for buffers far larger than the caches.
+//The random access std::rotate swaps one element at a time along cycles which jump across the whole range.
+//practise::rotate is a block swap rotation (Gries-Mills): it swaps the smaller side with the end of the larger
+//side in sequential 64 byte blocks, which shrinks the larger side, and repeats on the remainder. Once the
+//smaller side fits in a 4 KiB stack buffer, it finishes with a copy to the buffer, a memmove and a copy
+//back. Every pass over memory is sequential, and in total about n elements are swapped.
+//reverse and reverse_copy swap 32 byte vectors from both ends. The lanes are reversed by byte shuffles for
+//1, 2, 4, 8 and 16 byte elements (AVX2, picked at runtime like MinMaxElement.h). Other element sizes and
+//iterators take the std algorithms.
+//rotate_copy, shift_left and shift_right are memcpy/memmove. libstdc++ lowers its own versions for trivially
+//copyable types to the same calls, so these are here for a uniform interface and for the benchmarks.
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "SimdDispatch.h"
+
+#if PRACTISE_SIMD_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace practise
+{
+
+namespace detail
+{
+    template<typename It>
+    concept TrivialContiguousIterator = std::contiguous_iterator<It> && std::is_trivially_copyable_v<std::iter_value_t<It>>;
+
+    template<typename It>
+    concept TrivialPermutableIterator = TrivialContiguousIterator<It> && std::permutable<It>;
+
+    //Element sizes the vector reverse handles as lanes
+    template<typename T>
+    inline constexpr bool reversibleLanes = sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8 || sizeof(T) == 16;
+
+    template<typename It>
+    concept ReversibleLanes = TrivialContiguousIterator<It> && reversibleLanes<std::iter_value_t<It>>;
+
+    //Smaller side of a rotation which goes through a stack buffer instead of block swaps
+    inline constexpr std::size_t rotateBufferBytes = 4096;
+
+    //Swaps two disjoint byte ranges in 64 byte blocks, which the compiler keeps in vector registers
+    inline void swapBytes(std::byte* lhs, std::byte* rhs, std::size_t bytes)
+    {
+        constexpr std::size_t block = 64;
+        std::byte left[block];
+        std::byte right[block];
+        std::size_t i = 0;
+        for(; i + block <= bytes; i += block)
+        {
+            std::memcpy(left, lhs + i, block);
+            std::memcpy(right, rhs + i, block);
+            std::memcpy(lhs + i, right, block);
+            std::memcpy(rhs + i, left, block);
+        }
+        for(; i < bytes; ++i)
+            std::swap(lhs[i], rhs[i]);
+    }
+
+    //Rotates [data, data + leftBytes + rightBytes) so that the right part comes first. Both sides are multiples of
+    //the element size, and so is every block moved.
+    inline void rotateBytes(std::byte* data, std::size_t leftBytes, std::size_t rightBytes)
+    {
+        while(leftBytes && rightBytes)
+        {
+            if(std::min(leftBytes, rightBytes) <= rotateBufferBytes)
+            {
+                std::byte buffer[rotateBufferBytes];
+                if(leftBytes <= rightBytes)
+                {
+                    std::memcpy(buffer, data, leftBytes);
+                    std::memmove(data, data + leftBytes, rightBytes);
+                    std::memcpy(data + rightBytes, buffer, leftBytes);
+                }
+                else
+                {
+                    std::memcpy(buffer, data + leftBytes, rightBytes);
+                    std::memmove(data + rightBytes, data, leftBytes);
+                    std::memcpy(data, buffer, rightBytes);
+                }
+                return;
+            }
+            if(leftBytes <= rightBytes)
+            {
+                //A B1 B2 -> B1 A B2, B1 is in place, A B2 is left to rotate
+                swapBytes(data, data + leftBytes, leftBytes);
+                data += leftBytes;
+                rightBytes -= leftBytes;
+            }
+            else
+            {
+                //A1 A2 B -> A1 B A2, A2 is in place, A1 B is left to rotate
+                swapBytes(data + leftBytes - rightBytes, data + leftBytes, rightBytes);
+                leftBytes -= rightBytes;
+            }
+        }
+    }
+
+#if PRACTISE_SIMD_DISPATCH
+    //Lanes of Size bytes in reverse order
+    template<std::size_t Size>
+    [[gnu::target("avx2")]] inline __m256i reverseLanesAvx2(__m256i values)
+    {
+        if constexpr(Size == 1)
+        {
+            const auto bytes = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                                15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+            return _mm256_permute4x64_epi64(_mm256_shuffle_epi8(values, bytes), 0x4E);
+        }
+        else if constexpr(Size == 2)
+        {
+            const auto pairs = _mm256_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1,
+                                                14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+            return _mm256_permute4x64_epi64(_mm256_shuffle_epi8(values, pairs), 0x4E);
+        }
+        else if constexpr(Size == 4)
+            return _mm256_permutevar8x32_epi32(values, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+        else if constexpr(Size == 8)
+            return _mm256_permute4x64_epi64(values, 0x1B);
+        else
+            return _mm256_permute4x64_epi64(values, 0x4E);
+    }
+
+    template<typename T>
+    [[gnu::target("avx2")]] void reverseAvx2(T* first, T* last)
+    {
+        constexpr std::ptrdiff_t lanes = 32 / sizeof(T);
+        while(last - first >= 2 * lanes)
+        {
+            last -= lanes;
+            const auto front = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            const auto back = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(last));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(first), reverseLanesAvx2<sizeof(T)>(back));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(last), reverseLanesAvx2<sizeof(T)>(front));
+            first += lanes;
+        }
+        std::reverse(first, last);
+    }
+
+    template<typename T>
+    [[gnu::target("avx2")]] T* reverseCopyAvx2(const T* first, const T* last, T* out)
+    {
+        constexpr std::ptrdiff_t lanes = 32 / sizeof(T);
+        while(last - first >= lanes)
+        {
+            last -= lanes;
+            const auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(last));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), reverseLanesAvx2<sizeof(T)>(values));
+            out += lanes;
+        }
+        return std::reverse_copy(first, last, out);
+    }
+#endif
+
+    //AVX2 lane reversal from SimdLevel::avx2 up, std below. Other element sizes always take std.
+    template<typename T>
+    void reverseElements(T* first, T* last, SimdLevel level = simdLevel())
+    {
+#if PRACTISE_SIMD_DISPATCH
+        if constexpr(reversibleLanes<T>)
+            if(level >= SimdLevel::avx2)
+                return reverseAvx2(first, last);
+#endif
+        (void)level;
+        std::reverse(first, last);
+    }
+
+    template<typename T>
+    T* reverseCopyElements(const T* first, const T* last, T* out, SimdLevel level = simdLevel())
+    {
+#if PRACTISE_SIMD_DISPATCH
+        if constexpr(reversibleLanes<T>)
+            if(level >= SimdLevel::avx2)
+                return reverseCopyAvx2(first, last, out);
+#endif
+        (void)level;
+        return std::reverse_copy(first, last, out);
+    }
+}
+
+//Same signatures and results as the std algorithms
+
+template<std::forward_iterator It>
+It rotate(It first, It middle, It last)
+{
+    if constexpr(detail::TrivialPermutableIterator<It>)
+    {
+        using T = std::iter_value_t<It>;
+        const auto left = static_cast<std::size_t>(middle - first);
+        const auto right = static_cast<std::size_t>(last - middle);
+        detail::rotateBytes(reinterpret_cast<std::byte*>(std::to_address(first)), left * sizeof(T), right * sizeof(T));
+        return first + static_cast<std::ptrdiff_t>(right);
+    }
+    else
+        return std::rotate(first, middle, last);
+}
+
+template<std::forward_iterator It, std::weakly_incrementable OutIt>
+OutIt rotate_copy(It first, It middle, It last, OutIt d_first)
+{
+    if constexpr(detail::TrivialContiguousIterator<It> && std::contiguous_iterator<OutIt>
+                 && std::same_as<std::iter_value_t<It>, std::iter_value_t<OutIt>>)
+    {
+        using T = std::iter_value_t<It>;
+        const auto left = static_cast<std::size_t>(middle - first);
+        const auto right = static_cast<std::size_t>(last - middle);
+        if(right)
+            std::memcpy(std::to_address(d_first), std::to_address(middle), right * sizeof(T));
+        if(left)
+            std::memcpy(std::to_address(d_first) + right, std::to_address(first), left * sizeof(T));
+        return d_first + static_cast<std::ptrdiff_t>(left + right);
+    }
+    else
+        return std::rotate_copy(first, middle, last, d_first);
+}
+
+template<std::bidirectional_iterator It>
+void reverse(It first, It last)
+{
+    if constexpr(detail::ReversibleLanes<It> && std::permutable<It>)
+        detail::reverseElements(std::to_address(first), std::to_address(last));
+    else
+        std::reverse(first, last);
+}
+
+template<std::bidirectional_iterator It, std::weakly_incrementable OutIt>
+OutIt reverse_copy(It first, It last, OutIt d_first)
+{
+    if constexpr(detail::ReversibleLanes<It> && std::contiguous_iterator<OutIt>
+                 && std::same_as<std::iter_value_t<It>, std::iter_value_t<OutIt>>)
+    {
+        const auto end = detail::reverseCopyElements(std::to_address(first), std::to_address(last), std::to_address(d_first));
+        return d_first + (end - std::to_address(d_first));
+    }
+    else
+        return std::reverse_copy(first, last, d_first);
+}
+
+template<std::forward_iterator It>
+It shift_left(It first, It last, std::iter_difference_t<It> n)
+{
+    if constexpr(detail::TrivialPermutableIterator<It>)
+    {
+        const auto size = last - first;
+        if(n <= 0)
+            return last;
+        if(n >= size)
+            return first;
+        std::memmove(std::to_address(first), std::to_address(first + n), static_cast<std::size_t>(size - n) * sizeof(std::iter_value_t<It>));
+        return first + (size - n);
+    }
+    else
+        return std::shift_left(first, last, n);
+}
+
+template<std::forward_iterator It>
+It shift_right(It first, It last, std::iter_difference_t<It> n)
+{
+    if constexpr(detail::TrivialPermutableIterator<It>)
+    {
+        const auto size = last - first;
+        if(n <= 0)
+            return first;
+        if(n >= size)
+            return last;
+        std::memmove(std::to_address(first + n), std::to_address(first), static_cast<std::size_t>(size - n) * sizeof(std::iter_value_t<It>));
+        return first + n;
+    }
+    else
+        return std::shift_right(first, last, n);
+}
+
+}
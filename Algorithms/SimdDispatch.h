@@ -0,0 +1,37 @@
+//Runtime selection of the vector kernels in the Algorithms and Strings headers. A kernel is written once for
+//the widest instruction set it uses and compiled with [[gnu::target(...)]], the caller picks it with
+//simdLevel() so the binary runs everywhere without -march flags. Only GCC and Clang on x86 dispatch, other
+//builds use the std algorithms.
+#pragma once
+
+namespace practise::detail
+{
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__) && defined(__GNUC__)
+    #define PRACTISE_SIMD_DISPATCH 1
+#else
+    #define PRACTISE_SIMD_DISPATCH 0
+#endif
+
+    //Instruction sets of the kernels, in order. The dispatch functions take the level as a parameter, simdLevel()
+    //by default, so the tests run every level the CPU supports (Algorithms/SimdLevelTest.h).
+    enum class SimdLevel { scalar, sse2, avx2, avx512 };
+
+    //Widest instruction set usable by the vector kernels on this CPU, looked up once
+    inline SimdLevel simdLevel()
+    {
+#if PRACTISE_SIMD_DISPATCH
+        static const SimdLevel level = []
+        {
+            __builtin_cpu_init();
+            if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+                return SimdLevel::avx512;
+            if(__builtin_cpu_supports("avx2"))
+                return SimdLevel::avx2;
+            return SimdLevel::sse2;
+        }();
+        return level;
+#else
+        return SimdLevel::scalar;
+#endif
+    }
+}
@@ -0,0 +1,22 @@
+//Levels for the tests of the vector kernels in the Algorithms and Strings headers, which call every kernel
+//the CPU can run directly and compare it with the std algorithm
+#pragma once
+
+#include <initializer_list>
+#include <vector>
+#include "SimdDispatch.h"
+
+//The candidates not above practise::detail::simdLevel(). Tests list the levels which have a kernel of
+//their own, by default every level.
+inline std::vector<practise::detail::SimdLevel> supportedSimdLevels(
+    std::initializer_list<practise::detail::SimdLevel> candidates = {practise::detail::SimdLevel::scalar,
+                                                                     practise::detail::SimdLevel::sse2,
+                                                                     practise::detail::SimdLevel::avx2,
+                                                                     practise::detail::SimdLevel::avx512})
+{
+    std::vector<practise::detail::SimdLevel> supported;
+    for(auto level : candidates)
+        if(level <= practise::detail::simdLevel())
+            supported.push_back(level);
+    return supported;
+}
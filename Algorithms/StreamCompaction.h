@@ -0,0 +1,717 @@
+//remove, remove_if, remove_copy, remove_copy_if, copy_if, unique and unique_copy for contiguous ranges of integers,
+//float and double, written as stream compaction without a branch on the data. The range is read in blocks of 64
+//elements: each block first gives a 64 bit mask of the elements it keeps (vector compares for remove and for
+//unique with the default equality, one predicate call per element otherwise), then the kept elements are
+//packed with compress stores: AVX-512 vpcompress for 4 and 8 byte elements, AVX2/SSSE3 shuffles indexed by 8
+//mask bits at a time, or a store-and-advance loop without SIMD, picked at runtime like MinMaxElement.h.
+//The in place algorithms pack the block to the front of the range, the compress stores only ever overwrite
+//elements already read. The copy algorithms pack each block in a buffer and copy out exactly the kept
+//elements, so any output iterator works and nothing is written past the returned iterator.
+//The parallel mode (parallel_*, or the overloads taking std::execution::par/par_unseq) cuts the range in one
+//chunk per thread. The copies are two passes with a prefix sum: every chunk counts its kept elements, then
+//packs them at its offset of the output, pred is called twice per element. The in place algorithms pack each
+//chunk on its own thread and move the packed chunks down in order.
+//Other iterators, element types and predicates of unique take the std algorithms.
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <execution>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "ParallelChunks.h"
+#include "RangeCompare.h"
+#include "SimdDispatch.h"
+
+#if PRACTISE_SIMD_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace practise
+{
+
+namespace detail
+{
+    template<typename T>
+    concept CompactValue = std::is_arithmetic_v<T> && !std::same_as<T, bool>;
+
+    //Input of the copy algorithms
+    template<typename It>
+    concept CompactIterator = std::contiguous_iterator<It> && CompactValue<std::iter_value_t<It>>;
+
+    //Range packed in place
+    template<typename It>
+    concept CompactInPlaceIterator = CompactIterator<It> && std::permutable<It>;
+
+    //Elements per keep mask
+    inline constexpr std::size_t compactBlock = 64;
+
+    //The vector kernels take a cycle or two per element, a chunk needs more of them than the default
+    //minParallelChunk to pay for its thread
+    inline constexpr std::size_t minParallelCompactChunk = 1 << 16;
+
+    constexpr std::uint64_t lowBits(std::size_t count) noexcept
+    {
+        return count >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << count) - 1;
+    }
+
+#if PRACTISE_SIMD_DISPATCH
+    //One bit per lane of a compare result, for lanes of Size bytes
+    template<std::size_t Size>
+    [[gnu::target("avx2")]] inline std::uint32_t laneMaskAvx2(__m256i lanes)
+    {
+        if constexpr(Size == 1)
+            return static_cast<std::uint32_t>(_mm256_movemask_epi8(lanes));
+        else if constexpr(Size == 2)
+        {
+            //Packing to bytes leaves the lanes in bytes 0-7 and 16-23
+            const auto bytes = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_packs_epi16(lanes, _mm256_setzero_si256())));
+            return (bytes & 0xFFu) | ((bytes >> 8) & 0xFF00u);
+        }
+        else if constexpr(Size == 4)
+            return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(lanes)));
+        else
+            return static_cast<std::uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(lanes)));
+    }
+
+    //Bit i set when lhs[i] == rhs[i], over 32 bytes. Floating point lanes compare as numbers (NaN unequal, -0 == 0)
+    template<typename T>
+    [[gnu::target("avx2")]] inline std::uint32_t equalLanesAvx2(const T* lhs, const T* rhs)
+    {
+        typedef T Vec __attribute__((vector_size(32)));
+        Vec left, right;
+        std::memcpy(&left, lhs, sizeof(Vec));
+        std::memcpy(&right, rhs, sizeof(Vec));
+        return laneMaskAvx2<sizeof(T)>((__m256i)(left == right));
+    }
+
+    template<typename T>
+    [[gnu::target("avx2")]] inline std::uint32_t equalLanesAvx2(const T* lhs, T value)
+    {
+        typedef T Vec __attribute__((vector_size(32)));
+        Vec left;
+        std::memcpy(&left, lhs, sizeof(Vec));
+        return laneMaskAvx2<sizeof(T)>((__m256i)(left == (Vec{} + value)));
+    }
+#endif
+
+    //Keep mask selectors: mask(in, count) sets bit j when in[j] is kept, maskAvx2 is the version called from
+    //the vector kernels. A block is never empty.
+
+    //remove/remove_copy: keeps the elements unequal to value
+    template<typename T>
+    struct KeepUnequal
+    {
+        T value;
+
+        std::uint64_t mask(const T* in, std::size_t count) const
+        {
+            std::uint64_t equal = 0;
+            for(std::size_t j = 0; j < count; ++j)
+                equal |= std::uint64_t{in[j] == value} << j;
+            return ~equal & lowBits(count);
+        }
+
+#if PRACTISE_SIMD_DISPATCH
+        [[gnu::target("avx2")]] std::uint64_t maskAvx2(const T* in, std::size_t count) const
+        {
+            constexpr std::size_t lanes = 32 / sizeof(T);
+            if(count < lanes)
+                return mask(in, count);
+            std::uint64_t equal = 0;
+            std::size_t j = 0;
+            for(; j + lanes <= count; j += lanes)
+                equal |= std::uint64_t{equalLanesAvx2(in + j, value)} << j;
+            //The last vector overlaps lanes already compared
+            if(j < count)
+                equal |= std::uint64_t{equalLanesAvx2(in + count - lanes, value)} << (count - lanes);
+            return ~equal & lowBits(count);
+        }
+#endif
+    };
+
+    //remove_if/remove_copy_if keep the elements failing pred (Keep false), copy_if the ones passing it
+    template<typename Pred, bool Keep>
+    struct KeepIf
+    {
+        Pred pred;
+
+        template<typename T>
+        std::uint64_t mask(T* in, std::size_t count)
+        {
+            std::uint64_t keep = 0;
+            for(std::size_t j = 0; j < count; ++j)
+                keep |= std::uint64_t{static_cast<bool>(std::invoke(pred, in[j])) == Keep} << j;
+            return keep;
+        }
+
+        template<typename T>
+        std::uint64_t maskAvx2(T* in, std::size_t count)
+        {
+            return mask(in, count);
+        }
+    };
+
+    //remove/remove_copy with a value of another type than the elements
+    template<typename T>
+    struct EqualToValue
+    {
+        const T& value;
+
+        template<typename U>
+        bool operator()(const U& element) const { return element == value; }
+    };
+
+    //unique/unique_copy: keeps the elements unequal to the one before them. With an equality that is an
+    //equivalence this is the same as comparing with the last kept element, as std::unique does.
+    template<typename T>
+    struct KeepUnique
+    {
+        //Last element of the previous block, or of the previous chunk
+        T previous{};
+        bool started = false;
+
+        std::uint64_t mask(const T* in, std::size_t count)
+        {
+            std::uint64_t equalNext = 0;
+            for(std::size_t j = 0; j + 1 < count; ++j)
+                equalNext |= std::uint64_t{in[j] == in[j + 1]} << j;
+            return finish(in, count, equalNext);
+        }
+
+#if PRACTISE_SIMD_DISPATCH
+        [[gnu::target("avx2")]] std::uint64_t maskAvx2(const T* in, std::size_t count)
+        {
+            constexpr std::size_t lanes = 32 / sizeof(T);
+            if(count <= lanes)
+                return mask(in, count);
+            //Bit j: in[j] == in[j + 1], for j < count - 1
+            std::uint64_t equalNext = 0;
+            std::size_t j = 0;
+            for(; j + lanes < count; j += lanes)
+                equalNext |= std::uint64_t{equalLanesAvx2(in + j, in + j + 1)} << j;
+            if(j + 1 < count)
+                equalNext |= std::uint64_t{equalLanesAvx2(in + count - 1 - lanes, in + count - lanes)} << (count - 1 - lanes);
+            return finish(in, count, equalNext);
+        }
+#endif
+
+        //Read before the block is packed, which may overwrite it
+        std::uint64_t finish(const T* in, std::size_t count, std::uint64_t equalNext)
+        {
+            auto keep = ~(equalNext << 1) & lowBits(count);
+            if(started && in[0] == previous)
+                keep &= ~std::uint64_t{1};
+            previous = in[count - 1];
+            started = true;
+            return keep;
+        }
+    };
+
+    //Packs the elements of in whose bit is set in mask to out without branches: every element is stored, the
+    //position only moves on for the kept ones. out may be in itself.
+    template<typename T>
+    std::size_t compressScalar(const T* in, std::size_t count, std::uint64_t mask, T* out)
+    {
+        std::size_t kept = 0;
+        for(std::size_t j = 0; j < count; ++j)
+        {
+            out[kept] = in[j];
+            kept += (mask >> j) & 1;
+        }
+        return kept;
+    }
+
+#if PRACTISE_SIMD_DISPATCH
+    //Positions of the set bits of every 8 bit mask, one per byte from the lowest: the shuffle and permute
+    //indices which move the kept lanes of a group to its front
+    inline constexpr auto compressIndices = []
+    {
+        std::array<std::uint64_t, 256> table{};
+        for(unsigned mask = 0; mask < 256; ++mask)
+        {
+            unsigned kept = 0;
+            for(unsigned lane = 0; lane < 8; ++lane)
+                if(mask & (1u << lane))
+                    table[mask] |= std::uint64_t{lane} << (8 * kept++);
+        }
+        return table;
+    }();
+
+    //Every bit of a 4 bit mask doubled, 8 byte lanes permuted as pairs of 4 byte lanes
+    inline constexpr auto pairedLanes = []
+    {
+        std::array<std::uint8_t, 16> table{};
+        for(unsigned mask = 0; mask < 16; ++mask)
+            for(unsigned lane = 0; lane < 4; ++lane)
+                if(mask & (1u << lane))
+                    table[mask] = static_cast<std::uint8_t>(table[mask] | (3u << (2 * lane)));
+        return table;
+    }();
+
+    //Packs one group (8 lanes, 4 for 8 byte elements) and stores the whole group: the lanes past the kept ones
+    //are garbage
+    template<typename T>
+    [[gnu::target("avx2")]] inline void compressGroupAvx2(const T* in, unsigned mask, T* out)
+    {
+        if constexpr(sizeof(T) == 1)
+        {
+            const auto values = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in));
+            const auto indices = _mm_cvtsi64_si128(static_cast<long long>(compressIndices[mask]));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(values, indices));
+        }
+        else if constexpr(sizeof(T) == 2)
+        {
+            //Lane l is bytes 2l and 2l + 1
+            const auto values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+            const auto lanes = _mm_cvtepu8_epi16(_mm_cvtsi64_si128(static_cast<long long>(compressIndices[mask])));
+            const auto indices = _mm_add_epi16(_mm_mullo_epi16(lanes, _mm_set1_epi16(0x0202)), _mm_set1_epi16(0x0100));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(values, indices));
+        }
+        else
+        {
+            const auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+            const auto lanes = compressIndices[sizeof(T) == 4 ? mask : pairedLanes[mask]];
+            const auto indices = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(lanes)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_permutevar8x32_epi32(values, indices));
+        }
+    }
+
+    template<typename T>
+    [[gnu::target("avx2")]] inline std::size_t compressAvx2(const T* in, std::size_t count, std::uint64_t mask, T* out)
+    {
+        constexpr std::size_t group = sizeof(T) == 8 ? 4 : 8;
+        std::size_t kept = 0;
+        std::size_t j = 0;
+        for(; j + group <= count; j += group)
+        {
+            const auto bits = static_cast<unsigned>((mask >> j) & ((1u << group) - 1));
+            compressGroupAvx2(in + j, bits, out + kept);
+            kept += static_cast<std::size_t>(std::popcount(bits));
+        }
+        for(; j < count; ++j)
+        {
+            out[kept] = in[j];
+            kept += (mask >> j) & 1;
+        }
+        return kept;
+    }
+
+    //vpcompress for 4 and 8 byte lanes, 1 and 2 byte lanes would need AVX-512 VBMI2 and use the AVX2 groups
+    template<typename T>
+    [[gnu::target("avx512f,avx512bw")]] inline std::size_t compressAvx512(const T* in, std::size_t count, std::uint64_t mask, T* out)
+    {
+        if constexpr(sizeof(T) < 4)
+            return compressAvx2(in, count, mask, out);
+        else
+        {
+            constexpr std::size_t group = 64 / sizeof(T);
+            std::size_t kept = 0;
+            std::size_t j = 0;
+            for(; j + group <= count; j += group)
+            {
+                const auto bits = static_cast<unsigned>((mask >> j) & ((1u << group) - 1));
+                const auto values = _mm512_loadu_si512(in + j);
+                if constexpr(sizeof(T) == 4)
+                    _mm512_storeu_si512(out + kept, _mm512_maskz_compress_epi32(static_cast<__mmask16>(bits), values));
+                else
+                    _mm512_storeu_si512(out + kept, _mm512_maskz_compress_epi64(static_cast<__mmask8>(bits), values));
+                kept += static_cast<std::size_t>(std::popcount(bits));
+            }
+            for(; j < count; ++j)
+            {
+                out[kept] = in[j];
+                kept += (mask >> j) & 1;
+            }
+            return kept;
+        }
+    }
+#endif
+
+    //Packs in place: out never passes the block being read, the garbage lanes of the compress stores only land
+    //on elements already read
+    template<typename T>
+    struct InPlaceSink
+    {
+        T* out;
+
+        T* block() { return out; }
+        void commit(std::size_t kept) { out += kept; }
+    };
+
+    //Packs each block in a buffer and copies the kept elements to out. The buffer is left uninitialized, the
+    //kernels write it before it is read.
+    template<typename T, typename OutIt>
+    struct CopySink
+    {
+        explicit CopySink(OutIt first) : out(first) {}
+
+        OutIt out;
+        T buffer[compactBlock];
+
+        T* block() { return buffer; }
+        void commit(std::size_t kept) { out = std::copy(buffer, buffer + kept, out); }
+    };
+
+    //Only counts the kept elements, first pass of the parallel copies
+    struct CountSink
+    {
+        std::size_t kept = 0;
+    };
+
+    template<typename Sink>
+    inline constexpr bool countingSink = std::same_as<Sink, CountSink>;
+
+    template<typename T, typename Selector, typename Sink>
+    void compactScalar(T* in, std::size_t count, Selector& selector, Sink& sink)
+    {
+        for(std::size_t i = 0; i < count; i += compactBlock)
+        {
+            const auto size = std::min(compactBlock, count - i);
+            const auto keep = selector.mask(in + i, size);
+            if constexpr(countingSink<Sink>)
+                sink.kept += static_cast<std::size_t>(std::popcount(keep));
+            else
+                sink.commit(compressScalar<std::remove_const_t<T>>(in + i, size, keep, sink.block()));
+        }
+    }
+
+#if PRACTISE_SIMD_DISPATCH
+    template<typename T, typename Selector, typename Sink>
+    [[gnu::target("avx2")]] void compactAvx2(T* in, std::size_t count, Selector& selector, Sink& sink)
+    {
+        for(std::size_t i = 0; i < count; i += compactBlock)
+        {
+            const auto size = std::min(compactBlock, count - i);
+            const auto keep = selector.maskAvx2(in + i, size);
+            if constexpr(countingSink<Sink>)
+                sink.kept += static_cast<std::size_t>(std::popcount(keep));
+            else
+                sink.commit(compressAvx2<std::remove_const_t<T>>(in + i, size, keep, sink.block()));
+        }
+    }
+
+    template<typename T, typename Selector, typename Sink>
+    [[gnu::target("avx512f,avx512bw")]] void compactAvx512(T* in, std::size_t count, Selector& selector, Sink& sink)
+    {
+        for(std::size_t i = 0; i < count; i += compactBlock)
+        {
+            const auto size = std::min(compactBlock, count - i);
+            const auto keep = selector.maskAvx2(in + i, size);
+            if constexpr(countingSink<Sink>)
+                sink.kept += static_cast<std::size_t>(std::popcount(keep));
+            else
+                sink.commit(compressAvx512<std::remove_const_t<T>>(in + i, size, keep, sink.block()));
+        }
+    }
+#endif
+
+    //AVX-512 or AVX2 compress kernel, the scalar loop at the other levels
+    template<typename T, typename Selector, typename Sink>
+    void compact(T* in, std::size_t count, Selector& selector, Sink& sink, SimdLevel level)
+    {
+#if PRACTISE_SIMD_DISPATCH
+        if(level == SimdLevel::avx512)
+            return compactAvx512(in, count, selector, sink);
+        if(level == SimdLevel::avx2)
+            return compactAvx2(in, count, selector, sink);
+#endif
+        (void)level;
+        compactScalar(in, count, selector, sink);
+    }
+
+    //Packs the kept elements of [data, data + size) to its front and returns their count
+    template<typename T, typename Selector>
+    std::size_t compactInPlace(T* data, std::size_t size, Selector selector, SimdLevel level = simdLevel())
+    {
+        InPlaceSink<T> sink{data};
+        compact(data, size, selector, sink, level);
+        return static_cast<std::size_t>(sink.out - data);
+    }
+
+    template<typename T, typename OutIt, typename Selector>
+    OutIt compactCopy(T* in, std::size_t size, OutIt out, Selector selector, SimdLevel level = simdLevel())
+    {
+        CopySink<std::remove_const_t<T>, OutIt> sink(out);
+        compact(in, size, selector, sink, level);
+        return sink.out;
+    }
+
+    //makeSelector(data, firstIndex) gives the selector of the chunk starting at firstIndex
+    template<typename T, typename MakeSelector>
+    std::size_t parallelCompactInPlace(T* data, std::size_t size, unsigned threadCount, MakeSelector makeSelector)
+    {
+        const Chunks chunks(size, minParallelCompactChunk, threadCount);
+        if(chunks.count == 1)
+            return compactInPlace(data, size, makeSelector(data, 0));
+
+        //Made before any chunk is packed, unique reads the last element of the chunk before
+        std::vector<decltype(makeSelector(data, 0))> selectors;
+        selectors.reserve(chunks.count);
+        for(std::size_t chunk = 0; chunk < chunks.count; ++chunk)
+            selectors.push_back(makeSelector(data, chunks.first(chunk)));
+
+        std::vector<std::size_t> kept(chunks.count);
+        auto pack = [&](std::size_t chunk)
+        {
+            kept[chunk] = compactInPlace(data + chunks.first(chunk), chunks.last(chunk) - chunks.first(chunk), selectors[chunk]);
+        };
+        runChunks(chunks.count, pack);
+
+        //Each packed chunk moves down right after the one before, never past its own start
+        std::size_t total = kept[0];
+        for(std::size_t chunk = 1; chunk < chunks.count; ++chunk)
+        {
+            std::memmove(data + total, data + chunks.first(chunk), kept[chunk] * sizeof(T));
+            total += kept[chunk];
+        }
+        return total;
+    }
+
+    template<typename T, std::random_access_iterator OutIt, typename MakeSelector>
+    OutIt parallelCompactCopy(T* in, std::size_t size, OutIt out, unsigned threadCount, MakeSelector makeSelector)
+    {
+        const Chunks chunks(size, minParallelCompactChunk, threadCount);
+        if(chunks.count == 1)
+            return compactCopy(in, size, out, makeSelector(in, 0));
+
+        //First pass: kept elements per chunk, their prefix sum is where each chunk starts in out
+        std::vector<std::size_t> offsets(chunks.count + 1);
+        auto count = [&](std::size_t chunk)
+        {
+            CountSink sink;
+            auto selector = makeSelector(in, chunks.first(chunk));
+            compact(in + chunks.first(chunk), chunks.last(chunk) - chunks.first(chunk), selector, sink, simdLevel());
+            offsets[chunk + 1] = sink.kept;
+        };
+        runChunks(chunks.count, count);
+        for(std::size_t chunk = 0; chunk < chunks.count; ++chunk)
+            offsets[chunk + 1] += offsets[chunk];
+
+        auto pack = [&](std::size_t chunk)
+        {
+            compactCopy(in + chunks.first(chunk), chunks.last(chunk) - chunks.first(chunk),
+                        out + static_cast<std::iter_difference_t<OutIt>>(offsets[chunk]), makeSelector(in, chunks.first(chunk)));
+        };
+        runChunks(chunks.count, pack);
+        return out + static_cast<std::iter_difference_t<OutIt>>(offsets[chunks.count]);
+    }
+
+    template<typename V, typename T>
+    auto unequalSelector(const T& value)
+    {
+        if constexpr(std::same_as<T, V>)
+            return KeepUnequal<V>{value};
+        else
+            return KeepIf<EqualToValue<T>, false>{{value}};
+    }
+
+    template<typename V>
+    auto uniqueSelector(const V* data, std::size_t first)
+    {
+        return first ? KeepUnique<V>{data[first - 1], true} : KeepUnique<V>{};
+    }
+}
+
+//Sequential algorithms, same signatures and results as the std ones
+
+template<std::forward_iterator It, typename T>
+It remove(It first, It last, const T& value)
+{
+    if constexpr(detail::CompactInPlaceIterator<It>)
+        return first + static_cast<std::ptrdiff_t>(detail::compactInPlace(std::to_address(first), static_cast<std::size_t>(last - first),
+                                                                          detail::unequalSelector<std::iter_value_t<It>>(value)));
+    else
+        return std::remove(first, last, value);
+}
+
+template<std::forward_iterator It, typename Pred>
+It remove_if(It first, It last, Pred pred)
+{
+    if constexpr(detail::CompactInPlaceIterator<It>)
+        return first + static_cast<std::ptrdiff_t>(detail::compactInPlace(std::to_address(first), static_cast<std::size_t>(last - first),
+                                                                          detail::KeepIf<std::reference_wrapper<Pred>, false>{pred}));
+    else
+        return std::remove_if(first, last, pred);
+}
+
+template<std::input_iterator It, typename OutIt, typename T>
+OutIt remove_copy(It first, It last, OutIt d_first, const T& value)
+{
+    if constexpr(detail::CompactIterator<It>)
+        return detail::compactCopy(std::to_address(first), static_cast<std::size_t>(last - first), d_first,
+                                   detail::unequalSelector<std::iter_value_t<It>>(value));
+    else
+        return std::remove_copy(first, last, d_first, value);
+}
+
+template<std::input_iterator It, typename OutIt, typename Pred>
+OutIt remove_copy_if(It first, It last, OutIt d_first, Pred pred)
+{
+    if constexpr(detail::CompactIterator<It>)
+        return detail::compactCopy(std::to_address(first), static_cast<std::size_t>(last - first), d_first,
+                                   detail::KeepIf<std::reference_wrapper<Pred>, false>{pred});
+    else
+        return std::remove_copy_if(first, last, d_first, pred);
+}
+
+template<std::input_iterator It, typename OutIt, typename Pred>
+OutIt copy_if(It first, It last, OutIt d_first, Pred pred)
+{
+    if constexpr(detail::CompactIterator<It>)
+        return detail::compactCopy(std::to_address(first), static_cast<std::size_t>(last - first), d_first,
+                                   detail::KeepIf<std::reference_wrapper<Pred>, true>{pred});
+    else
+        return std::copy_if(first, last, d_first, pred);
+}
+
+template<std::forward_iterator It, typename BinaryPred = std::equal_to<>>
+It unique(It first, It last, BinaryPred pred = BinaryPred())
+{
+    if constexpr(detail::CompactInPlaceIterator<It> && detail::DefaultEqual<BinaryPred, std::iter_value_t<It>>)
+        return first + static_cast<std::ptrdiff_t>(detail::compactInPlace(std::to_address(first), static_cast<std::size_t>(last - first),
+                                                                          detail::KeepUnique<std::iter_value_t<It>>{}));
+    else
+        return std::unique(first, last, pred);
+}
+
+template<std::input_iterator It, typename OutIt, typename BinaryPred = std::equal_to<>>
+OutIt unique_copy(It first, It last, OutIt d_first, BinaryPred pred = BinaryPred())
+{
+    if constexpr(detail::CompactIterator<It> && detail::DefaultEqual<BinaryPred, std::iter_value_t<It>>)
+        return detail::compactCopy(std::to_address(first), static_cast<std::size_t>(last - first), d_first,
+                                   detail::KeepUnique<std::iter_value_t<It>>{});
+    else
+        return std::unique_copy(first, last, d_first, pred);
+}
+
+//Parallel modes, chunks of at least detail::minParallelCompactChunk elements (ParallelChunks.h)
+
+template<detail::CompactInPlaceIterator It, typename T>
+It parallel_remove(It first, It last, const T& value, unsigned threadCount)
+{
+    using V = std::iter_value_t<It>;
+    return first + static_cast<std::ptrdiff_t>(detail::parallelCompactInPlace(std::to_address(first), static_cast<std::size_t>(last - first), threadCount,
+                                                                              [&value](V*, std::size_t) { return detail::unequalSelector<V>(value); }));
+}
+
+template<detail::CompactInPlaceIterator It, typename Pred>
+It parallel_remove_if(It first, It last, Pred pred, unsigned threadCount)
+{
+    return first + static_cast<std::ptrdiff_t>(detail::parallelCompactInPlace(std::to_address(first), static_cast<std::size_t>(last - first), threadCount,
+                                                                              [&pred](auto*, std::size_t) { return detail::KeepIf<std::reference_wrapper<Pred>, false>{pred}; }));
+}
+
+template<detail::CompactIterator It, std::random_access_iterator OutIt, typename T>
+OutIt parallel_remove_copy(It first, It last, OutIt d_first, const T& value, unsigned threadCount)
+{
+    using V = std::iter_value_t<It>;
+    return detail::parallelCompactCopy(std::to_address(first), static_cast<std::size_t>(last - first), d_first, threadCount,
+                                       [&value](auto*, std::size_t) { return detail::unequalSelector<V>(value); });
+}
+
+template<detail::CompactIterator It, std::random_access_iterator OutIt, typename Pred>
+OutIt parallel_remove_copy_if(It first, It last, OutIt d_first, Pred pred, unsigned threadCount)
+{
+    return detail::parallelCompactCopy(std::to_address(first), static_cast<std::size_t>(last - first), d_first, threadCount,
+                                       [&pred](auto*, std::size_t) { return detail::KeepIf<std::reference_wrapper<Pred>, false>{pred}; });
+}
+
+template<detail::CompactIterator It, std::random_access_iterator OutIt, typename Pred>
+OutIt parallel_copy_if(It first, It last, OutIt d_first, Pred pred, unsigned threadCount)
+{
+    return detail::parallelCompactCopy(std::to_address(first), static_cast<std::size_t>(last - first), d_first, threadCount,
+                                       [&pred](auto*, std::size_t) { return detail::KeepIf<std::reference_wrapper<Pred>, true>{pred}; });
+}
+
+template<detail::CompactInPlaceIterator It>
+It parallel_unique(It first, It last, unsigned threadCount)
+{
+    using V = std::iter_value_t<It>;
+    return first + static_cast<std::ptrdiff_t>(detail::parallelCompactInPlace(std::to_address(first), static_cast<std::size_t>(last - first), threadCount,
+                                                                              [](const V* data, std::size_t chunkFirst) { return detail::uniqueSelector(data, chunkFirst); }));
+}
+
+template<detail::CompactIterator It, std::random_access_iterator OutIt>
+OutIt parallel_unique_copy(It first, It last, OutIt d_first, unsigned threadCount)
+{
+    using V = std::iter_value_t<It>;
+    return detail::parallelCompactCopy(std::to_address(first), static_cast<std::size_t>(last - first), d_first, threadCount,
+                                       [](const V* data, std::size_t chunkFirst) { return detail::uniqueSelector(data, chunkFirst); });
+}
+
+//Execution policy front ends
+
+template<detail::ExecutionPolicy Policy, std::forward_iterator It, typename T>
+It remove(Policy&& policy, It first, It last, const T& value)
+{
+    if constexpr(detail::CompactInPlaceIterator<It>)
+        return parallel_remove(first, last, value, detail::policyThreads<Policy>());
+    else
+        return std::remove(std::forward<Policy>(policy), first, last, value);
+}
+
+template<detail::ExecutionPolicy Policy, std::forward_iterator It, typename Pred>
+It remove_if(Policy&& policy, It first, It last, Pred pred)
+{
+    if constexpr(detail::CompactInPlaceIterator<It>)
+        return parallel_remove_if(first, last, pred, detail::policyThreads<Policy>());
+    else
+        return std::remove_if(std::forward<Policy>(policy), first, last, pred);
+}
+
+template<detail::ExecutionPolicy Policy, std::forward_iterator It, std::forward_iterator OutIt, typename T>
+OutIt remove_copy(Policy&& policy, It first, It last, OutIt d_first, const T& value)
+{
+    if constexpr(detail::CompactIterator<It> && std::random_access_iterator<OutIt>)
+        return parallel_remove_copy(first, last, d_first, value, detail::policyThreads<Policy>());
+    else
+        return std::remove_copy(std::forward<Policy>(policy), first, last, d_first, value);
+}
+
+template<detail::ExecutionPolicy Policy, std::forward_iterator It, std::forward_iterator OutIt, typename Pred>
+OutIt remove_copy_if(Policy&& policy, It first, It last, OutIt d_first, Pred pred)
+{
+    if constexpr(detail::CompactIterator<It> && std::random_access_iterator<OutIt>)
+        return parallel_remove_copy_if(first, last, d_first, pred, detail::policyThreads<Policy>());
+    else
+        return std::remove_copy_if(std::forward<Policy>(policy), first, last, d_first, pred);
+}
+
+template<detail::ExecutionPolicy Policy, std::forward_iterator It, std::forward_iterator OutIt, typename Pred>
+OutIt copy_if(Policy&& policy, It first, It last, OutIt d_first, Pred pred)
+{
+    if constexpr(detail::CompactIterator<It> && std::random_access_iterator<OutIt>)
+        return parallel_copy_if(first, last, d_first, pred, detail::policyThreads<Policy>());
+    else
+        return std::copy_if(std::forward<Policy>(policy), first, last, d_first, pred);
+}
+
+template<detail::ExecutionPolicy Policy, std::forward_iterator It, typename BinaryPred = std::equal_to<>>
+It unique(Policy&& policy, It first, It last, BinaryPred pred = BinaryPred())
+{
+    if constexpr(detail::CompactInPlaceIterator<It> && detail::DefaultEqual<BinaryPred, std::iter_value_t<It>>)
+        return parallel_unique(first, last, detail::policyThreads<Policy>());
+    else
+        return std::unique(std::forward<Policy>(policy), first, last, pred);
+}
+
+template<detail::ExecutionPolicy Policy, std::forward_iterator It, std::forward_iterator OutIt, typename BinaryPred = std::equal_to<>>
+OutIt unique_copy(Policy&& policy, It first, It last, OutIt d_first, BinaryPred pred = BinaryPred())
+{
+    if constexpr(detail::CompactIterator<It> && std::random_access_iterator<OutIt> && detail::DefaultEqual<BinaryPred, std::iter_value_t<It>>)
+        return parallel_unique_copy(first, last, d_first, detail::policyThreads<Policy>());
+    else
+        return std::unique_copy(std::forward<Policy>(policy), first, last, d_first, pred);
+}
+
+}
@@ -0,0 +1,364 @@
+//streaming_copy, streaming_copy_n, streaming_copy_backward, streaming_move, streaming_fill and streaming_fill_n for
+//contiguous ranges of trivially copyable types, for bulk buffers which should not displace the working set of the
+//rest of the process from the caches.
+//Below streaming_threshold() bytes written they are memmove/fill like the std algorithms. From the threshold on,
+//the destination is written with non-temporal stores (SSE2 or AVX2, picked at runtime like MinMaxElement.h):
+//whole 64 byte lines go straight to memory through the write combining buffers, without reading the line first
+//and without evicting anything from L1, L2 or L3. The few bytes before the first and after the last aligned
+//line of the destination use ordinary stores. Every kernel ends with an sfence, so the data is visible to other
+//threads once the call returns like with any other store.
+//The default threshold is 3/4 of the last level cache, as for the non-temporal memcpy of glibc: a buffer that
+//large would evict most of the cache anyway, and reading it back soon after gains little from having written
+//it through the cache. set_streaming_threshold changes it for the whole process.
+//The parallel mode (parallel_streaming_*, or the overloads taking std::execution::par/par_unseq) cuts the
+//destination in one chunk per thread, each chunk streams when the whole buffer is past the threshold.
+//Overlapping copies (copy to the left, copy_backward to the right, as the std algorithms allow) are one
+//sequential memmove. Other iterators and element types take the std algorithms.
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <execution>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include "ParallelChunks.h"
+#include "SimdDispatch.h"
+
+#if __has_include(<unistd.h>)
+#include <unistd.h>
+#endif
+
+#if PRACTISE_SIMD_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace practise
+{
+
+namespace detail
+{
+    inline constexpr std::size_t cacheLine = 64;
+
+    //One core streams several GB/s, a thread needs about a MiB of stores to pay for itself
+    inline constexpr std::size_t minParallelStreamingBytes = std::size_t{1} << 20;
+
+    template<typename It>
+    concept StreamableIterator = std::contiguous_iterator<It> && std::is_trivially_copyable_v<std::iter_value_t<It>>;
+
+    //Destinations the kernels write as bytes: same element type and not const
+    template<typename It, typename OutIt>
+    concept StreamableCopy = StreamableIterator<It> && std::contiguous_iterator<OutIt>
+                          && std::same_as<std::iter_value_t<It>, std::iter_value_t<OutIt>>
+                          && std::indirectly_writable<OutIt, std::iter_value_t<It>>;
+
+    template<typename OutIt, typename T>
+    concept StreamableFill = StreamableIterator<OutIt> && std::indirectly_writable<OutIt, std::iter_value_t<OutIt>>
+                          && std::convertible_to<const T&, std::iter_value_t<OutIt>>;
+
+    //Size of the last level cache, 32 MiB where the system does not tell
+    inline std::size_t lastLevelCacheBytes()
+    {
+        long bytes = 0;
+#ifdef _SC_LEVEL3_CACHE_SIZE
+        bytes = sysconf(_SC_LEVEL3_CACHE_SIZE);
+        if(bytes <= 0)
+            bytes = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+        return bytes > 0 ? static_cast<std::size_t>(bytes) : std::size_t{32} << 20;
+    }
+
+    inline std::atomic<std::size_t>& streamingThresholdBytes()
+    {
+        static std::atomic<std::size_t> bytes{lastLevelCacheBytes() / 4 * 3};
+        return bytes;
+    }
+
+#if PRACTISE_SIMD_DISPATCH
+    //Streams lines to a line aligned out. in advances by inStep bytes per line: a line for copies, 0 for a fill
+    //pattern
+    inline void streamLinesSse2(std::byte* out, const std::byte* in, std::size_t inStep, std::size_t lines)
+    {
+        for(; lines; --lines, out += cacheLine, in += inStep)
+        {
+            const auto* src = reinterpret_cast<const __m128i*>(in);
+            auto* dst = reinterpret_cast<__m128i*>(out);
+            const auto first = _mm_loadu_si128(src);
+            const auto second = _mm_loadu_si128(src + 1);
+            const auto third = _mm_loadu_si128(src + 2);
+            const auto fourth = _mm_loadu_si128(src + 3);
+            _mm_stream_si128(dst, first);
+            _mm_stream_si128(dst + 1, second);
+            _mm_stream_si128(dst + 2, third);
+            _mm_stream_si128(dst + 3, fourth);
+        }
+        _mm_sfence();
+    }
+
+    [[gnu::target("avx2")]] inline void streamLinesAvx2(std::byte* out, const std::byte* in, std::size_t inStep, std::size_t lines)
+    {
+        for(; lines; --lines, out += cacheLine, in += inStep)
+        {
+            const auto* src = reinterpret_cast<const __m256i*>(in);
+            auto* dst = reinterpret_cast<__m256i*>(out);
+            const auto low = _mm256_loadu_si256(src);
+            const auto high = _mm256_loadu_si256(src + 1);
+            _mm256_stream_si256(dst, low);
+            _mm256_stream_si256(dst + 1, high);
+        }
+        _mm_sfence();
+    }
+#endif
+
+    //Non-temporal stores of AVX2 or SSE2, the scalar level writes through the cache
+    inline void streamLines(std::byte* out, const std::byte* in, std::size_t inStep, std::size_t lines, SimdLevel level)
+    {
+#if PRACTISE_SIMD_DISPATCH
+        if(level >= SimdLevel::avx2)
+            return streamLinesAvx2(out, in, inStep, lines);
+        if(level >= SimdLevel::sse2)
+            return streamLinesSse2(out, in, inStep, lines);
+#endif
+        (void)level;
+        for(; lines; --lines, out += cacheLine, in += inStep)
+            std::memcpy(out, in, cacheLine);
+    }
+
+    //Copies bytes to a destination which does not overlap the source, the aligned lines of out with streaming
+    //stores
+    inline void streamCopyBytes(std::byte* out, const std::byte* in, std::size_t bytes, SimdLevel level = simdLevel())
+    {
+        const auto head = std::min(bytes, (cacheLine - reinterpret_cast<std::uintptr_t>(out) % cacheLine) % cacheLine);
+        std::memcpy(out, in, head);
+        const auto lines = (bytes - head) / cacheLine;
+        streamLines(out + head, in + head, cacheLine, lines, level);
+        const auto done = head + lines * cacheLine;
+        std::memcpy(out + done, in + done, bytes - done);
+    }
+
+    //Fills count elements, the aligned lines with streaming stores of a line of copies of value. The lines only
+    //hold whole elements for power of two sizes up to a line and elements at a multiple of their size, others
+    //are filled through the cache.
+    template<typename T>
+    void streamFill(T* first, std::size_t count, const T& value, SimdLevel level = simdLevel())
+    {
+        const auto address = reinterpret_cast<std::uintptr_t>(first);
+        if constexpr(std::has_single_bit(sizeof(T)) && sizeof(T) <= cacheLine)
+        {
+            if(address % sizeof(T) == 0)
+            {
+                const auto head = std::min(count, (cacheLine - address % cacheLine) % cacheLine / sizeof(T));
+                first = std::fill_n(first, head, value);
+                count -= head;
+
+                alignas(cacheLine) std::byte pattern[cacheLine];
+                for(std::size_t offset = 0; offset < cacheLine; offset += sizeof(T))
+                    std::memcpy(pattern + offset, std::addressof(value), sizeof(T));
+                const auto lines = count * sizeof(T) / cacheLine;
+                streamLines(reinterpret_cast<std::byte*>(first), pattern, 0, lines, level);
+                const auto streamed = lines * cacheLine / sizeof(T);
+                std::fill_n(first + streamed, count - streamed, value);
+                return;
+            }
+        }
+        (void)address;
+        (void)level;
+        std::fill_n(first, count, value);
+    }
+
+    //Destination cut in one chunk per thread, each at least minParallelStreamingBytes
+    template<typename T>
+    Chunks streamingChunks(std::size_t count, unsigned threadCount)
+    {
+        return Chunks(count, minParallelStreamingBytes / sizeof(T), threadCount);
+    }
+
+    //memmove below the threshold and for overlapping ranges, streaming stores on threadCount threads otherwise
+    template<typename T>
+    void copyElements(const T* in, std::size_t count, T* out, unsigned threadCount)
+    {
+        const auto bytes = count * sizeof(T);
+        if(bytes == 0)
+            return;
+        const auto* src = reinterpret_cast<const std::byte*>(in);
+        auto* dst = reinterpret_cast<std::byte*>(out);
+        const bool overlap = dst < src + bytes && src < dst + bytes;
+        const bool streaming = bytes >= streamingThresholdBytes().load(std::memory_order_relaxed);
+        if(overlap)
+        {
+            std::memmove(dst, src, bytes);
+            return;
+        }
+        const auto chunks = streamingChunks<T>(count, threadCount);
+        auto copy = [&](std::size_t chunk)
+        {
+            const auto first = chunks.first(chunk) * sizeof(T);
+            const auto chunkBytes = chunks.last(chunk) * sizeof(T) - first;
+            if(streaming)
+                streamCopyBytes(dst + first, src + first, chunkBytes);
+            else
+                std::memcpy(dst + first, src + first, chunkBytes);
+        };
+        runChunks(chunks.count, copy);
+    }
+
+    template<typename T>
+    void fillElements(T* first, std::size_t count, const T& value, unsigned threadCount)
+    {
+        const bool streaming = count * sizeof(T) >= streamingThresholdBytes().load(std::memory_order_relaxed);
+        const auto chunks = streamingChunks<T>(count, threadCount);
+        auto fill = [&](std::size_t chunk)
+        {
+            const auto chunkCount = chunks.last(chunk) - chunks.first(chunk);
+            if(streaming)
+                streamFill(first + chunks.first(chunk), chunkCount, value);
+            else
+                std::fill_n(first + chunks.first(chunk), chunkCount, value);
+        };
+        runChunks(chunks.count, fill);
+    }
+}
+
+//Bytes written from which the streaming algorithms bypass the caches
+inline std::size_t streaming_threshold()
+{
+    return detail::streamingThresholdBytes().load(std::memory_order_relaxed);
+}
+
+inline void set_streaming_threshold(std::size_t bytes)
+{
+    detail::streamingThresholdBytes().store(bytes, std::memory_order_relaxed);
+}
+
+//Sequential algorithms, same signatures and results as the std ones
+
+template<std::input_iterator It, std::weakly_incrementable OutIt>
+OutIt streaming_copy(It first, It last, OutIt d_first)
+{
+    if constexpr(detail::StreamableCopy<It, OutIt>)
+    {
+        const auto count = last - first;
+        detail::copyElements(std::to_address(first), static_cast<std::size_t>(count), std::to_address(d_first), 1);
+        return d_first + count;
+    }
+    else
+        return std::copy(first, last, d_first);
+}
+
+template<std::input_iterator It, std::integral Size, std::weakly_incrementable OutIt>
+OutIt streaming_copy_n(It first, Size count, OutIt d_first)
+{
+    if constexpr(detail::StreamableCopy<It, OutIt>)
+    {
+        if(count <= 0)
+            return d_first;
+        detail::copyElements(std::to_address(first), static_cast<std::size_t>(count), std::to_address(d_first), 1);
+        return d_first + static_cast<std::iter_difference_t<OutIt>>(count);
+    }
+    else
+        return std::copy_n(first, count, d_first);
+}
+
+template<std::bidirectional_iterator It, std::bidirectional_iterator OutIt>
+OutIt streaming_copy_backward(It first, It last, OutIt d_last)
+{
+    if constexpr(detail::StreamableCopy<It, OutIt>)
+    {
+        const auto count = last - first;
+        detail::copyElements(std::to_address(first), static_cast<std::size_t>(count), std::to_address(d_last) - count, 1);
+        return d_last - count;
+    }
+    else
+        return std::copy_backward(first, last, d_last);
+}
+
+//Moving a trivially copyable element is copying it
+template<std::input_iterator It, std::weakly_incrementable OutIt>
+OutIt streaming_move(It first, It last, OutIt d_first)
+{
+    if constexpr(detail::StreamableCopy<It, OutIt>)
+        return streaming_copy(first, last, d_first);
+    else
+        return std::move(first, last, d_first);
+}
+
+template<std::forward_iterator It, typename T>
+void streaming_fill(It first, It last, const T& value)
+{
+    if constexpr(detail::StreamableFill<It, T>)
+    {
+        const std::iter_value_t<It> converted = value;
+        detail::fillElements(std::to_address(first), static_cast<std::size_t>(last - first), converted, 1);
+    }
+    else
+        std::fill(first, last, value);
+}
+
+template<typename OutIt, std::integral Size, typename T>
+OutIt streaming_fill_n(OutIt first, Size count, const T& value)
+{
+    if constexpr(detail::StreamableFill<OutIt, T>)
+    {
+        if(count <= 0)
+            return first;
+        const std::iter_value_t<OutIt> converted = value;
+        detail::fillElements(std::to_address(first), static_cast<std::size_t>(count), converted, 1);
+        return first + static_cast<std::iter_difference_t<OutIt>>(count);
+    }
+    else
+        return std::fill_n(first, count, value);
+}
+
+//Parallel modes, chunks of at least detail::minParallelStreamingBytes (ParallelChunks.h)
+
+template<detail::StreamableIterator It, std::contiguous_iterator OutIt>
+    requires detail::StreamableCopy<It, OutIt>
+OutIt parallel_streaming_copy(It first, It last, OutIt d_first, unsigned threadCount)
+{
+    const auto count = last - first;
+    detail::copyElements(std::to_address(first), static_cast<std::size_t>(count), std::to_address(d_first), threadCount);
+    return d_first + count;
+}
+
+template<detail::StreamableIterator It, typename T>
+    requires detail::StreamableFill<It, T>
+void parallel_streaming_fill(It first, It last, const T& value, unsigned threadCount)
+{
+    const std::iter_value_t<It> converted = value;
+    detail::fillElements(std::to_address(first), static_cast<std::size_t>(last - first), converted, threadCount);
+}
+
+//Execution policy front ends
+
+template<detail::ExecutionPolicy Policy, std::forward_iterator It, std::forward_iterator OutIt>
+OutIt streaming_copy(Policy&& policy, It first, It last, OutIt d_first)
+{
+    if constexpr(detail::StreamableCopy<It, OutIt>)
+        return parallel_streaming_copy(first, last, d_first, detail::policyThreads<Policy>());
+    else
+        return std::copy(std::forward<Policy>(policy), first, last, d_first);
+}
+
+template<detail::ExecutionPolicy Policy, std::forward_iterator It, std::forward_iterator OutIt>
+OutIt streaming_move(Policy&& policy, It first, It last, OutIt d_first)
+{
+    if constexpr(detail::StreamableCopy<It, OutIt>)
+        return parallel_streaming_copy(first, last, d_first, detail::policyThreads<Policy>());
+    else
+        return std::move(std::forward<Policy>(policy), first, last, d_first);
+}
+
+template<detail::ExecutionPolicy Policy, std::forward_iterator It, typename T>
+void streaming_fill(Policy&& policy, It first, It last, const T& value)
+{
+    if constexpr(detail::StreamableFill<It, T>)
+        parallel_streaming_fill(first, last, value, detail::policyThreads<Policy>());
+    else
+        std::fill(std::forward<Policy>(policy), first, last, value);
+}
+
+}
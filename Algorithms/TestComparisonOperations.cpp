@@ -1,6 +1,15 @@
 #include <iostream>
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <list>
+#include <random>
+#include "ExecutionPolicyTest.h"
+#include "RangeCompare.h"
+#include "SimdLevelTest.h"
 
 TEST(ComparisionOperations, equal)
 {
@@ -42,6 +51,157 @@ TEST(ComparisionOperations, lexicographical_compare)
     EXPECT_TRUE(std::lexicographical_compare(v1.begin(),v1.end(),v2.begin(),v2.end(),compare));
 }
 
+//practise::equal, mismatch and lexicographical_compare against the std versions. Keys of every length up to a
+//few vector blocks, differing at every position, so each tail and block boundary of the kernels is hit
+template<typename T>
+class RangeCompareBytewise : public testing::Test {};
+using BytewiseTypes = testing::Types<char, signed char, unsigned char, std::byte, std::int16_t, std::uint32_t,
+                                     std::int64_t>;
+TYPED_TEST_SUITE(RangeCompareBytewise, BytewiseTypes);
+
+TYPED_TEST(RangeCompareBytewise, MatchesStd)
+{
+    std::mt19937 gen{7};
+    std::uniform_int_distribution<int> dist{-128, 127};
+    for(std::size_t size = 0; size <= 200; ++size)
+    {
+        std::vector<TypeParam> key(size);
+        for(auto& val : key)
+            val = static_cast<TypeParam>(dist(gen));
+        EXPECT_TRUE(practise::equal(key.begin(), key.end(), key.begin(), key.end()));
+        EXPECT_FALSE(practise::lexicographical_compare(key.begin(), key.end(), key.begin(), key.end()));
+
+        for(std::size_t pos = 0; pos < size; ++pos)
+        {
+            auto other = key;
+            other[pos] = static_cast<TypeParam>(dist(gen));
+            SCOPED_TRACE(testing::Message() << "size " << size << ", difference at " << pos);
+            EXPECT_EQ(practise::equal(key.begin(), key.end(), other.begin()), std::equal(key.begin(), key.end(), other.begin()));
+            EXPECT_EQ(practise::mismatch(key.begin(), key.end(), other.begin(), other.end()),
+                      std::mismatch(key.begin(), key.end(), other.begin(), other.end()));
+            EXPECT_EQ(practise::lexicographical_compare(key.begin(), key.end(), other.begin(), other.end()),
+                      std::lexicographical_compare(key.begin(), key.end(), other.begin(), other.end()));
+            EXPECT_EQ(practise::lexicographical_compare(other.begin(), other.end(), key.begin(), key.end()),
+                      std::lexicographical_compare(other.begin(), other.end(), key.begin(), key.end()));
+        }
+
+        //A prefix is smaller than the whole key
+        if(size > 0)
+        {
+            EXPECT_FALSE(practise::equal(key.begin(), key.end() - 1, key.begin(), key.end()));
+            EXPECT_TRUE(practise::lexicographical_compare(key.begin(), key.end() - 1, key.begin(), key.end()));
+            EXPECT_FALSE(practise::lexicographical_compare(key.begin(), key.end(), key.begin(), key.end() - 1));
+            EXPECT_EQ(practise::mismatch(key.begin(), key.end() - 1, key.begin(), key.end()).first, key.end() - 1);
+        }
+    }
+}
+
+TEST(RangeCompare, Kernels)
+{
+    using practise::detail::SimdLevel;
+    std::vector<unsigned char> lhs(1000, 'a'), rhs(1000, 'a');
+    for(auto level : supportedSimdLevels({SimdLevel::sse2, SimdLevel::avx2}))
+    {
+        for(std::size_t pos : {std::size_t{0}, std::size_t{15}, std::size_t{16}, std::size_t{31}, std::size_t{63},
+                               std::size_t{64}, std::size_t{500}, std::size_t{999}})
+        {
+            rhs[pos] = 'b';
+            EXPECT_EQ(practise::detail::mismatchBytes(lhs.data(), rhs.data(), lhs.size(), level), pos);
+            EXPECT_EQ(practise::detail::mismatchBytes(lhs.data(), rhs.data(), pos, level), pos);
+            rhs[pos] = 'a';
+        }
+        EXPECT_EQ(practise::detail::mismatchBytes(lhs.data(), rhs.data(), lhs.size(), level), lhs.size());
+    }
+}
+
+TEST(RangeCompare, GenericPath)
+{
+    std::vector<int> vec{1,2,3,4,5};
+    std::array<int,5> arr{1,2,3,4,5};
+    auto checkEqual = [](int a, int b){ return a == b;};
+    EXPECT_TRUE(practise::equal(vec.begin(), vec.end(), arr.begin(), checkEqual));
+    EXPECT_TRUE(practise::equal(vec.begin(), vec.end(), arr.begin(), arr.end(), std::equal_to<int>()));
+
+    std::list<int> lst{1,2,3,4,6};
+    EXPECT_EQ(*practise::mismatch(vec.begin(), vec.end(), lst.begin(), lst.end()).second, 6);
+    EXPECT_TRUE(practise::lexicographical_compare(vec.begin(), vec.end(), lst.begin(), lst.end()));
+
+    //Descending order through a custom comparator
+    EXPECT_FALSE(practise::lexicographical_compare(vec.begin(), vec.end(), arr.begin(), arr.end(), std::greater<>()));
+    arr[4] = 4;
+    EXPECT_TRUE(practise::lexicographical_compare(vec.begin(), vec.end(), arr.begin(), arr.end(), std::greater<>()));
+
+    //-0.0 equals 0.0 although the bytes differ, floating point is never compared bytewise
+    std::vector<double> zeros{0.0, -0.0}, others{-0.0, 0.0};
+    EXPECT_TRUE(practise::equal(zeros.begin(), zeros.end(), others.begin(), others.end()));
+
+    struct Employee
+    {
+        std::string firstName;
+        std::string lastName;
+    };
+    std::vector<Employee> v1{{"Alex","Don"}, {"John","Double Don"}};
+    std::vector<Employee> v2{{"Kumar","Don"}, {"Leo", "Double Don"}};
+    auto compare = [](const Employee&first, const Employee&second)
+    {
+        return (first.firstName < second.firstName);
+    };
+    EXPECT_TRUE(practise::lexicographical_compare(v1.begin(),v1.end(),v2.begin(),v2.end(),compare));
+}
+
+//equal and lexicographical_compare again with the execution policy overloads, once per policy
+template<typename Policy>
+class ComparisionOperationsPolicy : public ExecutionPolicyTest<Policy> {};
+TYPED_TEST_SUITE(ComparisionOperationsPolicy, ExecutionPolicies, ExecutionPolicyNames);
+
+TYPED_TEST(ComparisionOperationsPolicy, equal)
+{
+    const auto& policy = TestFixture::policy;
+    std::vector<int> vec{1,2,3,4,5};
+    std::array<int,5> arr{1,2,3,4,5};
+
+    EXPECT_TRUE(std::equal(policy,vec.begin(),vec.end(),arr.begin()));
+    EXPECT_TRUE(std::equal(policy,vec.begin(),vec.end(),arr.begin(),arr.end()));
+    EXPECT_TRUE(std::equal(policy,vec.begin(),vec.end(),arr.begin(),[](int a, int b){ return a == b;}));
+    EXPECT_FALSE(std::equal(policy,vec.begin(),vec.end(),arr.begin(),arr.end()-1));
+
+    auto large = TestFixture::largeInput();
+    auto other = large;
+    EXPECT_TRUE(std::equal(policy,large.begin(),large.end(),other.begin(),other.end()));
+    other[other.size() - 1] = -1;
+    EXPECT_FALSE(std::equal(policy,large.begin(),large.end(),other.begin(),other.end()));
+}
+
+TYPED_TEST(ComparisionOperationsPolicy, lexicographical_compare)
+{
+    const auto& policy = TestFixture::policy;
+    std::string s1{"Germany"};
+    std::string s2{"France"};
+    EXPECT_FALSE(std::lexicographical_compare(policy,s1.begin(),s1.end(),s2.begin(),s2.end()));
+    EXPECT_TRUE(std::lexicographical_compare(policy,s2.begin(),s2.end(),s1.begin(),s1.end()));
+
+    struct Employee
+    {
+        std::string firstName;
+        std::string lastName;
+    };
+
+    std::vector<Employee> v1{{"Alex","Don"}, {"John","Double Don"}};
+    std::vector<Employee> v2{{"Kumar","Don"}, {"Leo", "Double Don"}};
+    auto compare = [](const Employee&first, const Employee&second){ return (first.firstName < second.firstName);};
+    EXPECT_TRUE(std::lexicographical_compare(policy,v1.begin(),v1.end(),v2.begin(),v2.end(),compare));
+
+    //Decided by the first difference, which sits in a different chunk than a later one
+    auto large = TestFixture::largeInput();
+    auto other = large;
+    other[other.size() / 4] += 1;
+    other[other.size() - 1] = -1;
+    EXPECT_TRUE(std::lexicographical_compare(policy,large.begin(),large.end(),other.begin(),other.end()));
+    EXPECT_FALSE(std::lexicographical_compare(policy,other.begin(),other.end(),large.begin(),large.end()));
+    //A proper prefix compares less
+    EXPECT_TRUE(std::lexicographical_compare(policy,large.begin(),large.end()-1,large.begin(),large.end()));
+}
+
 int main(int argc, char* argv[])
 {       
     testing::InitGoogleTest(&argc, argv);
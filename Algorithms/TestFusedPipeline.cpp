@@ -0,0 +1,229 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <execution>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+#include "ExecutionPolicyTest.h"
+#include "FusedPipeline.h"
+#include "Utils/AllocationTracking.h"
+
+namespace fused = practise::fused;
+
+namespace
+{
+    //The ETL chain of the Mod-sequence tests, one std algorithm per pass into a vector of its own
+    std::vector<int> separatePasses(const std::vector<int>& input)
+    {
+        std::vector<int> scaled, kept, replaced, unique;
+        std::transform(input.begin(), input.end(), std::back_inserter(scaled), [](int num){ return num * 3 + 1; });
+        std::copy_if(scaled.begin(), scaled.end(), std::back_inserter(kept), [](int num){ return num % 4 != 0; });
+        std::replace_copy(kept.begin(), kept.end(), std::back_inserter(replaced), 7, -7);
+        std::unique_copy(replaced.begin(), replaced.end(), std::back_inserter(unique));
+        return unique;
+    }
+
+    auto etl()
+    {
+        return fused::transform([](int num){ return num * 3 + 1; })
+             | fused::filter([](int num){ return num % 4 != 0; })
+             | fused::replace(7, -7)
+             | fused::unique();
+    }
+
+    std::vector<int> randomInput(std::size_t size, int maxValue, unsigned seed = 42)
+    {
+        std::mt19937 gen{seed};
+        std::vector<int> values(size);
+        for(auto& val : values)
+            val = static_cast<int>(gen() % static_cast<unsigned>(maxValue + 1));
+        return values;
+    }
+}
+
+TEST(FusedPipeline, SameAsSeparatePasses)
+{
+    const std::vector<int> input{2,2,0,1,1,5,3,3,2,2,2,9,4,4};
+    std::vector<int> result;
+    fused::copy(input | etl(), std::back_inserter(result));
+    EXPECT_EQ(result, separatePasses(input));
+    EXPECT_EQ(result, (std::vector<int>{-7,1,10,-7,13}));
+
+    for(std::size_t size : {0, 1, 1000, 100000})
+    {
+        const auto large = randomInput(size, 5, static_cast<unsigned>(size));
+        result.clear();
+        fused::copy(large | etl(), std::back_inserter(result));
+        EXPECT_EQ(result, separatePasses(large)) << "size " << size;
+    }
+}
+
+TEST(FusedPipeline, Stages)
+{
+    std::vector<int> vec{1,2,3,4,5,6,7,8,9,10};
+    std::vector<int> out;
+    fused::copy(vec | fused::filter([](int &num){ return num % 2 == 0; }), std::back_inserter(out));
+    EXPECT_EQ(out, (std::vector<int>{2,4,6,8,10}));
+
+    out.clear();
+    fused::copy(vec | fused::replace_if([](int num){ return num > 5; }, 0), std::back_inserter(out));
+    EXPECT_EQ(out, (std::vector<int>{1,2,3,4,5,0,0,0,0,0}));
+
+    //unique with a predicate, as std::unique with removeConsecutive
+    std::string str("Hello");
+    std::string uniqueStr;
+    fused::copy(str | fused::unique([](char a, char b){ return a == b; }), std::back_inserter(uniqueStr));
+    EXPECT_EQ(uniqueStr, "Helo");
+
+    //Transforms change the value type of the stages after them
+    std::vector<std::string> words;
+    fused::copy(vec | fused::transform([](int num){ return std::string(static_cast<std::size_t>(num % 3 + 1), 'x'); })
+                    | fused::unique()
+                    | fused::replace(std::string("xxx"), "-"),
+                std::back_inserter(words));
+    EXPECT_EQ(words, (std::vector<std::string>{"xx","-","x","xx","-","x","xx","-","x","xx"}));
+
+    std::vector<double> halves;
+    fused::copy(vec | fused::transform([](int num){ return num / 2.0; }) | fused::filter([](double num){ return num < 2; }),
+                std::back_inserter(halves));
+    EXPECT_EQ(halves, (std::vector<double>{0.5, 1.0, 1.5}));
+}
+
+TEST(FusedPipeline, StageOrder)
+{
+    //unique before filter, two unique stages, and pipelines combined before they are applied
+    const std::vector<int> input{1,1,2,3,2,2,1,4,4,4,2};
+    std::vector<int> out;
+    fused::copy(input | fused::unique() | fused::filter([](int num){ return num != 3; }), std::back_inserter(out));
+    EXPECT_EQ(out, (std::vector<int>{1,2,2,1,4,2}));
+
+    out.clear();
+    const auto clean = fused::filter([](int num){ return num != 3; }) | fused::unique();
+    fused::copy(input | fused::unique() | clean, std::back_inserter(out));
+    EXPECT_EQ(out, (std::vector<int>{1,2,1,4,2}));
+
+    out.clear();
+    fused::copy(input | fused::transform([](int num){ return num / 2; }) | clean | fused::transform([](int num){ return num * 10; }),
+                std::back_inserter(out));
+    EXPECT_EQ(out, (std::vector<int>{0,10,0,20,10}));
+}
+
+TEST(FusedPipeline, Lazy)
+{
+    //Nothing runs before the view is copied or iterated, and then every element is transformed once
+    std::vector<int> input(100, 1);
+    int calls = 0;
+    auto view = input | fused::transform([&calls](int num){ ++calls; return num; }) | fused::unique();
+    EXPECT_EQ(calls, 0);
+    std::vector<int> out;
+    fused::copy(view, std::back_inserter(out));
+    EXPECT_EQ(calls, 100);
+    EXPECT_EQ(out, (std::vector<int>{1}));
+}
+
+TEST(FusedPipeline, View)
+{
+    //Pulled one element at a time by range-for and the std::ranges algorithms
+    const auto input = randomInput(5000, 9);
+    auto view = input | etl();
+    static_assert(std::ranges::input_range<decltype(view)>);
+    static_assert(std::ranges::view<decltype(view)>);
+    std::vector<int> pulled;
+    for(int value : view)
+        pulled.push_back(value);
+    EXPECT_EQ(pulled, separatePasses(input));
+
+    std::vector<int> copied;
+    std::ranges::copy(view, std::back_inserter(copied));
+    EXPECT_EQ(copied, pulled);
+
+    //Owning an rvalue input, and inputs without random access
+    std::vector<int> owned;
+    fused::copy(std::vector<int>{1,1,2} | fused::unique(), std::back_inserter(owned));
+    EXPECT_EQ(owned, (std::vector<int>{1,2}));
+    std::list<int> list(input.begin(), input.end());
+    std::vector<int> fromList;
+    fused::copy(std::execution::par, list | etl(), std::back_inserter(fromList));
+    EXPECT_EQ(fromList, pulled);
+}
+
+TEST(FusedPipeline, NoIntermediateBuffers)
+{
+    const auto input = randomInput(100000, 9);
+    std::vector<int> out(input.size());
+    {
+        utils::AllocationBudget budget(0);
+        out.erase(fused::copy(input | etl(), out.begin()), out.end());
+    }
+    EXPECT_EQ(out, separatePasses(input));
+}
+
+TEST(FusedPipeline, ParallelChunkBorders)
+{
+    //Runs of equal values across the chunk borders, and chunks where the filter keeps nothing, so the unique
+    //stages start from elements several chunks back
+    std::vector<int> input(1 << 18);
+    for(std::size_t i = 0; i < input.size(); ++i)
+        input[i] = static_cast<int>(i / 70000 % 2 ? 3 : i / 5000);
+    auto check = [&input](const auto& pipeline)
+    {
+        std::vector<int> expected;
+        fused::copy(input | pipeline, std::back_inserter(expected));
+        for(unsigned threads : {2u, 3u, 4u, 7u, 16u})
+        {
+            std::vector<int> result(input.size());
+            result.erase(fused::parallel_copy(input | pipeline, result.begin(), threads), result.end());
+            EXPECT_EQ(result, expected) << threads << " threads";
+
+            std::vector<int> appended;
+            fused::parallel_copy(input | pipeline, std::back_inserter(appended), threads);
+            EXPECT_EQ(appended, expected) << threads << " threads";
+        }
+    };
+    check(fused::filter([](int num){ return num != 3; }) | fused::transform([](int num){ return num / 4; })
+        | fused::unique());
+    check(fused::filter([](int num){ return num != 3; }) | fused::unique()
+        | fused::transform([](int num){ return num / 4; }) | fused::unique());
+
+    //The second unique stage only sees what the first one lets through: 12 is dropped by unique(tens), so
+    //the chunk starting inside the run of 22 must not be seeded with it
+    input.assign(16383, 11);
+    input.push_back(12);
+    input.insert(input.end(), 16384, 22);
+    const auto twoUniques = fused::unique([](int lhs, int rhs){ return lhs / 10 == rhs / 10; })
+                          | fused::unique([](int lhs, int rhs){ return lhs % 10 == rhs % 10; });
+    std::vector<int> sequential;
+    fused::copy(input | twoUniques, std::back_inserter(sequential));
+    EXPECT_EQ(sequential, (std::vector<int>{11, 22}));
+    std::vector<int> parallel;
+    fused::parallel_copy(input | twoUniques, std::back_inserter(parallel), 2);
+    EXPECT_EQ(parallel, sequential);
+
+    const auto random = randomInput(1 << 18, 3);
+    std::vector<int> result;
+    fused::parallel_copy(random | etl(), std::back_inserter(result), 4);
+    EXPECT_EQ(result, separatePasses(random));
+}
+
+//fused::copy with every execution policy against the separate passes
+template<typename Policy>
+class FusedPipelinePolicy : public ExecutionPolicyTest<Policy> {};
+TYPED_TEST_SUITE(FusedPipelinePolicy, ExecutionPolicies, ExecutionPolicyNames);
+
+TYPED_TEST(FusedPipelinePolicy, copy)
+{
+    const auto& policy = TestFixture::policy;
+    const auto large = TestFixture::largeInput(6);
+    std::vector<int> result(large.size());
+    result.erase(fused::copy(policy, large | etl(), result.begin()), result.end());
+    EXPECT_EQ(result, separatePasses(large));
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1,6 +1,15 @@
 #include <iostream>
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <cstdint>
+#include <execution>
+#include <limits>
+#include <list>
+#include "ExecutionPolicyTest.h"
+#include "MinMaxElement.h"
+#include "SimdLevelTest.h"
+
+using practise::detail::SimdLevel;
 
 TEST(MinMaxOperations, max)
 {
@@ -50,15 +59,13 @@ TEST(MinMaxOperations, min_element)
 
 TEST(MinMaxOperations, minmax)
 {
-    auto value = std::minmax(4,6);
-    //TODO:
-    //With gtest for some reason accessing first and then second gives undefined values
-    //to the second. so due to this i had to swap the checking for second value first 
-    // and then the first value like below.  Need to research the reason.
-    EXPECT_EQ(value.second, 6);
+    //minmax returns references to its arguments, with temporaries as arguments they dangle once the full
+    //expression ends, so the result is copied into a pair of values
+    std::pair<int,int> value = std::minmax(4,6);
     EXPECT_EQ(value.first, 4);
+    EXPECT_EQ(value.second, 6);
 
-    auto value2 = std::ranges::minmax(4,20);
+    std::ranges::minmax_result<int> value2 = std::ranges::minmax(4,20);
     EXPECT_EQ(value2.max, 20);
     EXPECT_EQ(value2.min, 4);
 }
@@ -77,6 +84,167 @@ TEST(MinMaxOperations, minmax_element)
 
 }
 
+//min_element, max_element and minmax_element again with the execution policy overloads, once per policy.
+//max, min and minmax compare values and have no policy overloads.
+template<typename Policy>
+class MinMaxOperationsPolicy : public ExecutionPolicyTest<Policy> {};
+TYPED_TEST_SUITE(MinMaxOperationsPolicy, ExecutionPolicies, ExecutionPolicyNames);
+
+TYPED_TEST(MinMaxOperationsPolicy, max_element)
+{
+    const auto& policy = TestFixture::policy;
+    std::vector<int> vec{1,2,3,44,5,6,7};
+    EXPECT_EQ(*std::max_element(policy,vec.begin(),vec.end()),44);
+    EXPECT_EQ(*std::max_element(policy,vec.begin(),vec.end(),std::greater<>()),1);
+
+    //With ties the first largest element is returned, whichever chunk sees it first
+    auto large = TestFixture::largeInput();
+    EXPECT_EQ(std::max_element(policy,large.begin(),large.end()),std::max_element(large.begin(),large.end()));
+}
+
+TYPED_TEST(MinMaxOperationsPolicy, min_element)
+{
+    const auto& policy = TestFixture::policy;
+    std::vector<int> vec{-1,-2,1,2,3,4,5};
+    EXPECT_EQ(*std::min_element(policy,vec.begin(),vec.end()),-2);
+
+    auto large = TestFixture::largeInput();
+    EXPECT_EQ(std::min_element(policy,large.begin(),large.end()),std::min_element(large.begin(),large.end()));
+}
+
+TYPED_TEST(MinMaxOperationsPolicy, minmax_element)
+{
+    const auto& policy = TestFixture::policy;
+    std::vector<int> vec{-4, -3, 1, 2, 5, 9};
+    auto value = std::minmax_element(policy,vec.begin(),vec.end());
+    EXPECT_EQ(*value.first, -4);
+    EXPECT_EQ(*value.second, 9);
+
+    //minmax_element returns the first smallest and the last largest element
+    auto large = TestFixture::largeInput();
+    EXPECT_EQ(std::minmax_element(policy,large.begin(),large.end()),std::minmax_element(large.begin(),large.end()));
+}
+
+//practise::min_element, max_element and minmax_element against the std versions, once per element type and
+//once per vector kernel the CPU supports
+template<typename T>
+class SimdMinMaxElement : public testing::Test
+{
+    protected:
+        //Few distinct values so every range is full of ties for the smallest and the largest value
+        static std::vector<T> input(std::size_t size, unsigned seed)
+        {
+            std::mt19937 gen{seed};
+            std::uniform_int_distribution<int> dist{-3, 3};
+            std::vector<T> values(size);
+            for(auto& val : values)
+                val = static_cast<T>(dist(gen));
+            return values;
+        }
+
+        //Every kernel has to give the positions of the std algorithms
+        static void expectSameAsStd(const std::vector<T>& values)
+        {
+            using practise::detail::MinMaxKind;
+            const auto first = values.data();
+            const auto count = values.size();
+            const auto min = static_cast<std::size_t>(std::min_element(values.begin(), values.end()) - values.begin());
+            const auto max = static_cast<std::size_t>(std::max_element(values.begin(), values.end()) - values.begin());
+            const auto minmax = std::minmax_element(values.begin(), values.end());
+            for(auto level : supportedSimdLevels({SimdLevel::sse2, SimdLevel::avx2, SimdLevel::avx512}))
+            {
+                SCOPED_TRACE(testing::Message() << "size " << count << ", level " << static_cast<int>(level));
+                EXPECT_EQ(practise::detail::minMaxIndex<MinMaxKind::min>(first, count, level).min, min);
+                EXPECT_EQ(practise::detail::minMaxIndex<MinMaxKind::max>(first, count, level).max, max);
+                const auto index = practise::detail::minMaxIndex<MinMaxKind::minmax>(first, count, level);
+                EXPECT_EQ(index.min, static_cast<std::size_t>(minmax.first - values.begin()));
+                EXPECT_EQ(index.max, static_cast<std::size_t>(minmax.second - values.begin()));
+            }
+            EXPECT_EQ(practise::min_element(values.begin(), values.end()), std::min_element(values.begin(), values.end()));
+            EXPECT_EQ(practise::max_element(values.begin(), values.end()), std::max_element(values.begin(), values.end()));
+            EXPECT_EQ(practise::minmax_element(values.begin(), values.end()), minmax);
+        }
+};
+using SimdMinMaxTypes = testing::Types<std::int8_t, std::uint8_t, std::int16_t, std::uint16_t, std::int32_t,
+                                       std::uint32_t, std::int64_t, std::uint64_t, float, double>;
+TYPED_TEST_SUITE(SimdMinMaxElement, SimdMinMaxTypes);
+
+TYPED_TEST(SimdMinMaxElement, Ties)
+{
+    //Sizes around the vector step, the 8 KiB block and several blocks with a tail
+    const auto block = 8192 / sizeof(TypeParam);
+    for(std::size_t size : {std::size_t{1}, std::size_t{2}, std::size_t{15}, std::size_t{64}, std::size_t{257},
+                            block - 1, block, block + 1, 3 * block + 77})
+        for(unsigned seed = 0; seed < 4; ++seed)
+            TestFixture::expectSameAsStd(TestFixture::input(size, seed));
+
+    EXPECT_EQ(practise::min_element(static_cast<TypeParam*>(nullptr), static_cast<TypeParam*>(nullptr)), nullptr);
+    std::vector<TypeParam> empty;
+    EXPECT_EQ(practise::minmax_element(empty.begin(), empty.end()), std::make_pair(empty.end(), empty.end()));
+}
+
+TYPED_TEST(SimdMinMaxElement, ExtremesAtTheEdges)
+{
+    using Limits = std::numeric_limits<TypeParam>;
+    const auto size = 3 * 8192 / sizeof(TypeParam) + 5;
+    for(std::size_t pos : {std::size_t{0}, std::size_t{1}, size / 2, size - 6, size - 5, size - 1})
+    {
+        auto values = TestFixture::input(size, static_cast<unsigned>(pos));
+        values[pos] = Limits::lowest();
+        values[size - 1 - pos] = Limits::max();
+        TestFixture::expectSameAsStd(values);
+        //A single block holding both extremes more than once
+        values[pos / 2] = Limits::lowest();
+        values[(size - 1 - pos) / 2] = Limits::max();
+        TestFixture::expectSameAsStd(values);
+    }
+    TestFixture::expectSameAsStd(std::vector<TypeParam>(size, Limits::max()));
+}
+
+TEST(SimdMinMaxElement, FloatingPointSpecials)
+{
+    using Limits = std::numeric_limits<double>;
+    const std::size_t size = 5000;
+    std::vector<double> values(size, 1.0);
+    values[10] = -0.0;
+    values[20] = 0.0;
+    values[4000] = 0.0;
+    values[30] = -Limits::infinity();
+    values[4500] = Limits::infinity();
+    values[4999] = Limits::infinity();
+    EXPECT_EQ(practise::min_element(values.begin(), values.end()) - values.begin(), 30);
+    EXPECT_EQ(practise::max_element(values.begin(), values.end()) - values.begin(), 4500);
+    auto minmax = practise::minmax_element(values.begin(), values.end());
+    EXPECT_EQ(minmax.first - values.begin(), 30);
+    EXPECT_EQ(minmax.second - values.begin(), 4999);
+
+    //-0.0 and 0.0 compare equal, the first of them is the smallest one
+    values[30] = 1.0;
+    EXPECT_EQ(practise::min_element(values.begin(), values.end()) - values.begin(), 10);
+
+    //With a NaN the result is the one of the std algorithm, wherever the NaN is
+    for(std::size_t pos : {std::size_t{0}, std::size_t{1}, std::size_t{2500}, size - 1})
+    {
+        auto withNaN = values;
+        withNaN[pos] = Limits::quiet_NaN();
+        EXPECT_EQ(practise::min_element(withNaN.begin(), withNaN.end()), std::min_element(withNaN.begin(), withNaN.end()));
+        EXPECT_EQ(practise::max_element(withNaN.begin(), withNaN.end()), std::max_element(withNaN.begin(), withNaN.end()));
+        EXPECT_EQ(practise::minmax_element(withNaN.begin(), withNaN.end()), std::minmax_element(withNaN.begin(), withNaN.end()));
+    }
+}
+
+TEST(SimdMinMaxElement, OtherIterators)
+{
+    //Not contiguous, or not a plain number: the std algorithms do the work
+    std::list<int> lst{3, 1, 4, 1, 5, 9, 2, 6, 5, 9};
+    EXPECT_EQ(*practise::min_element(lst.begin(), lst.end()), 1);
+    EXPECT_EQ(std::distance(lst.begin(), practise::minmax_element(lst.begin(), lst.end()).second), 9);
+
+    std::vector<std::string> words{"pear", "apple", "zucchini", "apple"};
+    EXPECT_EQ(practise::max_element(words.begin(), words.end()) - words.begin(), 2);
+    EXPECT_EQ(practise::minmax_element(words.begin(), words.end()).first - words.begin(), 1);
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
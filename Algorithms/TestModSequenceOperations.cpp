@@ -1,6 +1,23 @@
 #include <iostream>
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <execution>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include "ExecutionPolicyTest.h"
+#include "SimdLevelTest.h"
+#include "StreamCompaction.h"
+#include "StreamingStores.h"
+
+using practise::detail::SimdLevel;
 
 TEST(ModifyingSequeneOperationsAlgorithms, copy)
 {
@@ -398,6 +415,666 @@ TEST(ModifyingSequeneOperationsAlgorithms, unique_copy)
     EXPECT_TRUE(std::ranges::equal(copyVec,std::initializer_list<int>({1,2,3,4,5})));
 }
 
+//Every algorithm above again with the execution policy overloads, once per policy. copy_backward,
+//move_backward, shift_left and shift_right have no policy overloads in libstdc++ and are not repeated.
+//The policy overloads need forward iterators, so the outputs are sized up front instead of back_inserter.
+template<typename Policy>
+class ModifyingSequenceOperationsPolicy : public ExecutionPolicyTest<Policy> {};
+TYPED_TEST_SUITE(ModifyingSequenceOperationsPolicy, ExecutionPolicies, ExecutionPolicyNames);
+
+TYPED_TEST(ModifyingSequenceOperationsPolicy, copy)
+{
+    const auto& policy = TestFixture::policy;
+    std::vector<int> vec{1,2,3,4,5,6,7,8,9,10};
+    std::vector<int> copyVec(vec.size());
+
+    std::copy(policy,vec.begin(),vec.end(),copyVec.begin());
+    EXPECT_TRUE(std::ranges::equal(vec,copyVec));
+
+    std::ranges::fill(copyVec,0);
+    auto ret = std::copy_if(policy,vec.begin(),vec.end(),copyVec.begin(),[](int num){ return (num % 2 == 0);});
+    copyVec.erase(ret,copyVec.end());
+    EXPECT_TRUE(std::ranges::equal(copyVec,std::initializer_list<int>({2,4,6,8,10})));
+
+    std::string str("This is a string for copy_n testing");
+    std::string str2(7,' ');
+    std::copy_n(policy,str.begin(),7,str2.begin());
+    EXPECT_STREQ(str2.c_str(),"This is");
+
+    //copy_if has to keep the relative order of the selected elements across chunks
+    auto large = TestFixture::largeInput();
+    std::vector<int> expected, result(large.size());
+    auto isOdd = [](int num){ return num % 2 != 0;};
+    std::copy_if(large.begin(),large.end(),std::back_inserter(expected),isOdd);
+    result.erase(std::copy_if(policy,large.begin(),large.end(),result.begin(),isOdd),result.end());
+    EXPECT_EQ(result,expected);
+}
+
+TYPED_TEST(ModifyingSequenceOperationsPolicy, move)
+{
+    const auto& policy = TestFixture::policy;
+    std::vector<std::unique_ptr<int>> vec;
+    for(int i = 0; i < 5; ++i)
+        vec.push_back(std::make_unique<int>(i));
+    std::vector<std::unique_ptr<int>> moveVec(vec.size());
+
+    std::move(policy,vec.begin(),vec.end(),moveVec.begin());
+    EXPECT_TRUE(std::ranges::all_of(vec,[](auto &ptr){ return ptr == nullptr;}));
+    EXPECT_EQ(*moveVec.back(),4);
+}
+
+TYPED_TEST(ModifyingSequenceOperationsPolicy, fill)
+{
+    const auto& policy = TestFixture::policy;
+    std::string str("Testing");
+    std::fill(policy,str.begin(),str.end(),'s');
+    EXPECT_STREQ(str.c_str(),"sssssss");
+
+    std::fill_n(policy,str.begin(),3,'b');
+    EXPECT_STREQ(str.c_str(),"bbbssss");
+
+    std::vector<int> large(TestFixture::largeSize);
+    std::fill(policy,large.begin(),large.end(),7);
+    EXPECT_EQ(std::count(large.begin(),large.end(),7),static_cast<std::ptrdiff_t>(large.size()));
+}
+
+TYPED_TEST(ModifyingSequenceOperationsPolicy, transform)
+{
+    const auto& policy = TestFixture::policy;
+    std::vector<char> vec{'A','A','A','A','B','B','B','B','C','C','C','C'};
+    std::transform(policy,vec.begin()+1,vec.begin()+4,vec.begin()+1,[](char){ return '-';});
+    EXPECT_TRUE(std::ranges::equal(vec,std::initializer_list<char>({'A','-','-','-','B','B','B','B','C','C','C','C'})));
+
+    std::vector<int> vec1{1,2,3,4,5};
+    std::transform(policy,vec1.begin(),vec1.end(),vec1.begin(),vec1.begin(),std::plus<>());
+    EXPECT_TRUE(std::ranges::equal(vec1,std::initializer_list<int>({2,4,6,8,10})));
+
+    auto large = TestFixture::largeInput();
+    std::vector<int> expected(large.size()), result(large.size());
+    auto square = [](int num){ return num * num;};
+    std::transform(large.begin(),large.end(),expected.begin(),square);
+    std::transform(policy,large.begin(),large.end(),result.begin(),square);
+    EXPECT_EQ(result,expected);
+}
+
+TYPED_TEST(ModifyingSequenceOperationsPolicy, generate)
+{
+    const auto& policy = TestFixture::policy;
+    //The generator may be called concurrently, so unlike the sequential test it keeps no state
+    std::vector<int> vec(10);
+    std::generate(policy,vec.begin(),vec.end(),[]{ return 4;});
+    EXPECT_TRUE(std::ranges::all_of(vec,[](int num){ return num == 4;}));
+
+    std::generate_n(policy,vec.begin(),6,[]{ return 1;});
+    EXPECT_TRUE(std::ranges::equal(vec,std::initializer_list<int>({1,1,1,1,1,1,4,4,4,4})));
+}
+
+TYPED_TEST(ModifyingSequenceOperationsPolicy, remove)
+{
+    const auto& policy = TestFixture::policy;
+    std::string str("Hello world this is remove testing");
+    str.erase(std::remove(policy,str.begin(),str.end(),'o'),str.end());
+    EXPECT_STREQ(str.c_str(),"Hell wrld this is remve testing");
+
+    std::vector vec{1,2,3,4,5,6,7,8,9,10};
+    vec.erase(std::remove_if(policy,vec.begin(),vec.end(),[](int num){return num % 2 == 0;}),vec.end());
+    EXPECT_TRUE(std::ranges::equal(vec,std::initializer_list<int>({1,3,5,7,9})));
+
+    auto large = TestFixture::largeInput();
+    auto expected = large;
+    auto isMultipleOf3 = [](int num){ return num % 3 == 0;};
+    expected.erase(std::remove_if(expected.begin(),expected.end(),isMultipleOf3),expected.end());
+    large.erase(std::remove_if(policy,large.begin(),large.end(),isMultipleOf3),large.end());
+    EXPECT_EQ(large,expected);
+}
+
+TYPED_TEST(ModifyingSequenceOperationsPolicy, remove_copy)
+{
+    const auto& policy = TestFixture::policy;
+    //Input and output ranges may not overlap with a policy
+    std::string str("Testing The Remove_copy Api Now");
+    std::string str2(str.size(),' ');
+    str2.erase(std::remove_copy(policy,str.begin(),str.end(),str2.begin(),'e'),str2.end());
+    EXPECT_STREQ(str2.c_str(),"Tsting Th Rmov_copy Api Now");
+
+    std::string str3(str2.size(),' ');
+    str3.erase(std::remove_copy_if(policy,str2.begin(),str2.end(),str3.begin(),[](char ch){return islower(ch);}),str3.end());
+    EXPECT_STREQ(str3.c_str(),"T T R_ A N");
+}
+
+TYPED_TEST(ModifyingSequenceOperationsPolicy, replace)
+{
+    const auto& policy = TestFixture::policy;
+    std::vector<int> vec{1,2,3,4,5,6,7,8,9,10};
+    std::replace(policy,vec.begin(),vec.end(),2,22);
+    EXPECT_TRUE(std::ranges::equal(vec,std::initializer_list<int>({1,22,3,4,5,6,7,8,9,10})));
+
+    std::replace_if(policy,vec.begin(),vec.end(),[](int num){return num%2 == 0;},0);
+    EXPECT_TRUE(std::ranges::equal(vec,std::initializer_list<int>({1,0,3,0,5,0,7,0,9,0})));
+
+    auto large = TestFixture::largeInput();
+    auto expected = large;
+    std::replace(expected.begin(),expected.end(),5,-5);
+    std::replace(policy,large.begin(),large.end(),5,-5);
+    EXPECT_EQ(large,expected);
+}
+
+TYPED_TEST(ModifyingSequenceOperationsPolicy, replace_copy)
+{
+    const auto& policy = TestFixture::policy;
+    std::string str("Testing, With, The, Replace_copy, std::Api,");
+    std::string str2(str.length(),' ');
+
+    str2.erase(std::replace_copy(policy,str.begin(),str.end(),str2.begin(),',','_'),str2.end());
+    EXPECT_STREQ(str2.c_str(),"Testing_ With_ The_ Replace_copy_ std::Api_");
+
+    str2.assign(str.length(),' ');
+    auto replaceChar = [](char c){ return c == ',';};
+    str2.erase(std::replace_copy_if(policy,str.begin(),str.end(),str2.begin(),replaceChar,'-'),str2.end());
+    EXPECT_STREQ(str2.c_str(),"Testing- With- The- Replace_copy- std::Api-");
+}
+
+TYPED_TEST(ModifyingSequenceOperationsPolicy, reverse)
+{
+    const auto& policy = TestFixture::policy;
+    std::string str("This is the testing for reverse api");
+    std::reverse(policy,str.begin(),str.end());
+    EXPECT_STREQ(str.c_str(),"ipa esrever rof gnitset eht si sihT");
+
+    std::vector<int> vec{1,2,3,4,5};
+    std::vector<int> copyVec(vec.size());
+    std::reverse_copy(policy,vec.begin(),vec.end(),copyVec.begin());
+    EXPECT_TRUE(std::ranges::equal(copyVec,std::initializer_list<int>({5,4,3,2,1})));
+
+    auto large = TestFixture::largeInput();
+    auto expected = large;
+    std::reverse(expected.begin(),expected.end());
+    std::reverse(policy,large.begin(),large.end());
+    EXPECT_EQ(large,expected);
+}
+
+TYPED_TEST(ModifyingSequenceOperationsPolicy, rotate)
+{
+    const auto& policy = TestFixture::policy;
+    std::vector<int> vec{1,2,3,4,5,6,7,8,9,10};
+    std::rotate(policy,vec.begin(),vec.begin()+5,vec.end());
+    EXPECT_TRUE(std::ranges::equal(vec,std::initializer_list<int>({6,7,8,9,10,1,2,3,4,5})));
+
+    std::string str("RotateCopy");
+    std::string copyStr(str.size(),' ');
+    std::rotate_copy(policy,str.begin(),std::ranges::find(str,'e'),str.end(),copyStr.begin());
+    EXPECT_STREQ(copyStr.c_str(),"eCopyRotat");
+
+    auto large = TestFixture::largeInput();
+    auto expected = large;
+    const auto middle = static_cast<std::ptrdiff_t>(large.size() / 3);
+    std::rotate(expected.begin(),expected.begin()+middle,expected.end());
+    std::rotate(policy,large.begin(),large.begin()+middle,large.end());
+    EXPECT_EQ(large,expected);
+}
+
+TYPED_TEST(ModifyingSequenceOperationsPolicy, unique)
+{
+    const auto& policy = TestFixture::policy;
+    std::vector<int> vec{1,2,1,2,3,4,4,3,5};
+    vec.erase(std::unique(policy,vec.begin(),vec.end()),vec.end());
+    EXPECT_TRUE(std::ranges::equal(vec,std::initializer_list<int>({1,2,1,2,3,4,3,5})));
+
+    std::string str("Hello");
+    str.erase(std::unique(policy,str.begin(),str.end(),[](char a, char b){ return a == b;}),str.end());
+    EXPECT_STREQ(str.c_str(),"Helo");
+
+    std::vector<int> vec2{1,1,2,3,3,4,5,5};
+    std::vector<int> copyVec(vec2.size());
+    copyVec.erase(std::unique_copy(policy,vec2.begin(),vec2.end(),copyVec.begin()),copyVec.end());
+    EXPECT_TRUE(std::ranges::equal(copyVec,std::initializer_list<int>({1,2,3,4,5})));
+
+    auto large = TestFixture::largeInput(3);
+    auto expected = large;
+    expected.erase(std::unique(expected.begin(),expected.end()),expected.end());
+    large.erase(std::unique(policy,large.begin(),large.end()),large.end());
+    EXPECT_EQ(large,expected);
+}
+
+//practise:: stream compaction with the expectations of the std tests above
+TEST(StreamCompaction, remove)
+{
+    std::string str("Hello world this is remove testing");
+    str.erase(practise::remove(str.begin(),str.end(),'o'),str.end());
+    EXPECT_STREQ(str.c_str(),"Hell wrld this is remve testing");
+
+    std::vector vec{1,2,3,4,5,6,7,8,9,10};
+    vec.erase(practise::remove_if(vec.begin(),vec.end(),[](int &num){return num % 2 == 0;}),vec.end());
+    EXPECT_TRUE(std::ranges::equal(vec, std::initializer_list<int>({1,3,5,7,9})));
+
+    vec.erase(practise::remove_if(vec.begin(),vec.end(),[](int &num){return num % 3 == 0;}),vec.end());
+    EXPECT_TRUE(std::ranges::equal(vec, std::initializer_list<int>({1,5,7})));
+
+    //A value of another type compares through the predicate path
+    std::vector<double> doubles{1.5,2.0,2.0,3.5};
+    auto expected = doubles;
+    const auto expectedEnd = std::remove(expected.begin(),expected.end(),2);
+    const auto end = practise::remove(doubles.begin(),doubles.end(),2);
+    EXPECT_EQ(end - doubles.begin(),expectedEnd - expected.begin());
+    EXPECT_TRUE(std::equal(doubles.begin(),end,expected.begin()));
+}
+
+TEST(StreamCompaction, remove_copy)
+{
+    //Output over the input, as in the std test
+    std::string str("Testing The Remove_copy Api Now");
+    str.erase(practise::remove_copy(str.begin(),str.end(),str.begin(),'e'),str.end());
+    EXPECT_STREQ(str.c_str(),"Tsting Th Rmov_copy Api Now");
+
+    str.erase(practise::remove_copy_if(str.begin(),str.end(),str.begin(),[](char &ch){return islower(ch);}),str.end());
+    EXPECT_STREQ(str.c_str(),"T T R_ A N");
+
+    std::string str2;
+    const std::string commas("Testing, The, std::ranges, remove_copy,");
+    practise::remove_copy(commas.begin(),commas.end(),std::back_inserter(str2),',');
+    EXPECT_EQ(str2,"Testing The std::ranges remove_copy");
+}
+
+TEST(StreamCompaction, copy_if)
+{
+    std::vector<int> vec{1,2,3,4,5,6,7,8,9,10};
+    std::vector<int> copyVec;
+    practise::copy_if(vec.begin(),vec.end(),std::back_inserter(copyVec),[](int &num){ return (num % 2 == 0);});
+    EXPECT_TRUE(std::ranges::equal(copyVec,std::initializer_list<int>({2,4,6,8,10})));
+}
+
+TEST(StreamCompaction, unique)
+{
+    std::vector<int> vec{1,2,1,2,3,4,4,3,5};
+    vec.erase(practise::unique(vec.begin(),vec.end()),vec.end());
+    EXPECT_TRUE(std::ranges::equal(vec,std::initializer_list<int>({1,2,1,2,3,4,3,5})));
+
+    std::ranges::sort(vec);
+    vec.erase(practise::unique(vec.begin(),vec.end()),vec.end());
+    EXPECT_TRUE(std::ranges::equal(vec,std::initializer_list<int>({1,2,3,4,5})));
+
+    std::string str("There");
+    std::ranges::sort(str);
+    str.erase(practise::unique(str.begin(),str.end(),[](char a, char b){ return a == b;}),str.end());
+    EXPECT_STREQ(str.c_str(),"Tehr");
+
+    std::vector<int> vec2{1,1,2,3,3,4,5,5}, copyVec;
+    practise::unique_copy(vec2.begin(),vec2.end(),std::back_inserter(copyVec));
+    EXPECT_TRUE(std::ranges::equal(copyVec,std::initializer_list<int>({1,2,3,4,5})));
+}
+
+//Every kernel level and the parallel mode against the std algorithms, once per element type, with about
+//10%, 50% and 90% of the elements kept
+template<typename T>
+class StreamCompaction : public testing::Test
+{
+    protected:
+        //Values in [0, 10): remove drops the zeros, remove_if/copy_if test against a threshold
+        static std::vector<T> input(std::size_t size, unsigned seed, int runLength = 1)
+        {
+            std::mt19937 gen{seed};
+            std::vector<T> values(size);
+            for(std::size_t i = 0; i < size; ++i)
+                values[i] = i % static_cast<std::size_t>(runLength) == 0 || i == 0 ? static_cast<T>(gen() % 10) : values[i - 1];
+            return values;
+        }
+
+        template<typename Selector>
+        static void expectCompacted(const std::vector<T>& values, const std::vector<T>& expected, Selector selector)
+        {
+            for(auto level : supportedSimdLevels({SimdLevel::scalar, SimdLevel::avx2, SimdLevel::avx512}))
+            {
+                SCOPED_TRACE(testing::Message() << "size " << values.size() << ", level " << static_cast<int>(level));
+                auto inPlace = values;
+                inPlace.resize(practise::detail::compactInPlace(inPlace.data(), inPlace.size(), selector, level));
+                EXPECT_EQ(inPlace, expected);
+                std::vector<T> copy;
+                practise::detail::compactCopy(values.data(), values.size(), std::back_inserter(copy), selector, level);
+                EXPECT_EQ(copy, expected);
+            }
+        }
+
+        static void expectSameAsStd(const std::vector<T>& values, int threshold)
+        {
+            const auto below = [threshold](T value) { return value < static_cast<T>(threshold); };
+            std::vector<T> removed, kept, unique;
+            std::remove_copy(values.begin(), values.end(), std::back_inserter(removed), T(0));
+            std::remove_copy_if(values.begin(), values.end(), std::back_inserter(kept), below);
+            std::unique_copy(values.begin(), values.end(), std::back_inserter(unique));
+
+            expectCompacted(values, removed, practise::detail::KeepUnequal<T>{T(0)});
+            expectCompacted(values, kept, practise::detail::KeepIf<decltype(below), false>{below});
+            expectCompacted(values, unique, practise::detail::KeepUnique<T>{});
+
+            //Parallel in place and two pass copies, on more threads than the large inputs have chunks
+            auto inPlace = values;
+            inPlace.erase(practise::parallel_remove(inPlace.begin(), inPlace.end(), T(0), 3), inPlace.end());
+            EXPECT_EQ(inPlace, removed);
+            inPlace = values;
+            inPlace.erase(practise::parallel_remove_if(inPlace.begin(), inPlace.end(), below, 3), inPlace.end());
+            EXPECT_EQ(inPlace, kept);
+            inPlace = values;
+            inPlace.erase(practise::parallel_unique(inPlace.begin(), inPlace.end(), 3), inPlace.end());
+            EXPECT_EQ(inPlace, unique);
+
+            std::vector<T> copy(values.size());
+            copy.erase(practise::parallel_copy_if(values.begin(), values.end(), copy.begin(), std::not_fn(below), 3), copy.end());
+            EXPECT_EQ(copy, kept);
+            copy.assign(values.size(), T());
+            copy.erase(practise::parallel_remove_copy(values.begin(), values.end(), copy.begin(), T(0), 3), copy.end());
+            EXPECT_EQ(copy, removed);
+            copy.assign(values.size(), T());
+            copy.erase(practise::parallel_unique_copy(values.begin(), values.end(), copy.begin(), 3), copy.end());
+            EXPECT_EQ(copy, unique);
+        }
+};
+using StreamCompactionTypes = testing::Types<char, std::int8_t, std::uint8_t, std::int16_t, std::uint16_t, std::int32_t,
+                                             std::uint32_t, std::int64_t, std::uint64_t, float, double>;
+TYPED_TEST_SUITE(StreamCompaction, StreamCompactionTypes);
+
+TYPED_TEST(StreamCompaction, Selectivity)
+{
+    //Partial blocks and groups, and large enough for 3 parallel chunks
+    for(std::size_t size : {0, 1, 7, 31, 64, 65, 100, 1000, 3 << 16})
+        for(int threshold : {1, 5, 9})
+            TestFixture::expectSameAsStd(TestFixture::input(size, static_cast<unsigned>(size + threshold)), threshold);
+}
+
+TYPED_TEST(StreamCompaction, Runs)
+{
+    //Runs of equal values across block and chunk borders
+    for(int runLength : {2, 63, 100, 70000})
+        TestFixture::expectSameAsStd(TestFixture::input(250000, static_cast<unsigned>(runLength), runLength), 5);
+    TestFixture::expectSameAsStd(std::vector<TypeParam>(1000, TypeParam(0)), 5);
+}
+
+TEST(StreamCompaction, FloatingPoint)
+{
+    //NaN is never equal, -0.0 equals 0.0
+    const auto nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> values{0.0, -0.0, nan, nan, 1.0, 1.0, -0.0};
+    std::vector<double> unique;
+    practise::unique_copy(values.begin(), values.end(), std::back_inserter(unique));
+    ASSERT_EQ(unique.size(), 5u);
+    EXPECT_TRUE(std::isnan(unique[1]) && std::isnan(unique[2]));
+    values.erase(practise::remove(values.begin(), values.end(), 0.0), values.end());
+    ASSERT_EQ(values.size(), 4u);
+    EXPECT_EQ(values[3], 1.0);
+}
+
+TEST(StreamCompaction, Fallbacks)
+{
+    //Iterators and predicates without a fast path give the std results
+    std::list<int> list{1,1,2,3,3};
+    list.erase(practise::unique(list.begin(),list.end()),list.end());
+    EXPECT_EQ(list,(std::list<int>{1,2,3}));
+
+    std::vector<std::string> words{"a","bb","cc","d"};
+    words.erase(practise::unique(words.begin(),words.end(),[](auto& a, auto& b){ return a.size() == b.size(); }),words.end());
+    EXPECT_EQ(words,(std::vector<std::string>{"a","bb","d"}));
+
+    std::list<int> numbers{4,5,6,7};
+    std::vector<int> odd(numbers.size());
+    odd.erase(practise::copy_if(std::execution::par,numbers.begin(),numbers.end(),odd.begin(),[](int num){ return num % 2; }),odd.end());
+    EXPECT_EQ(odd,(std::vector<int>{5,7}));
+}
+
+//practise:: algorithms with the execution policy overloads
+template<typename Policy>
+class StreamCompactionPolicy : public ExecutionPolicyTest<Policy> {};
+TYPED_TEST_SUITE(StreamCompactionPolicy, ExecutionPolicies, ExecutionPolicyNames);
+
+TYPED_TEST(StreamCompactionPolicy, remove)
+{
+    const auto& policy = TestFixture::policy;
+    auto large = TestFixture::largeInput(9);
+    const auto isMultipleOf3 = [](int num){ return num % 3 == 0; };
+
+    auto expected = large;
+    expected.erase(std::remove(expected.begin(),expected.end(),4),expected.end());
+    auto result = large;
+    result.erase(practise::remove(policy,result.begin(),result.end(),4),result.end());
+    EXPECT_EQ(result,expected);
+
+    expected = large;
+    expected.erase(std::remove_if(expected.begin(),expected.end(),isMultipleOf3),expected.end());
+    result = large;
+    result.erase(practise::remove_if(policy,result.begin(),result.end(),isMultipleOf3),result.end());
+    EXPECT_EQ(result,expected);
+
+    std::vector<int> copy(large.size());
+    copy.erase(practise::remove_copy_if(policy,large.begin(),large.end(),copy.begin(),isMultipleOf3),copy.end());
+    EXPECT_EQ(copy,expected);
+
+    expected.clear();
+    std::remove_copy(large.begin(),large.end(),std::back_inserter(expected),4);
+    copy.assign(large.size(),0);
+    copy.erase(practise::remove_copy(policy,large.begin(),large.end(),copy.begin(),4),copy.end());
+    EXPECT_EQ(copy,expected);
+}
+
+TYPED_TEST(StreamCompactionPolicy, copy_if)
+{
+    const auto& policy = TestFixture::policy;
+    auto large = TestFixture::largeInput();
+    const auto isOdd = [](int num){ return num % 2 == 1; };
+    std::vector<int> expected;
+    std::copy_if(large.begin(),large.end(),std::back_inserter(expected),isOdd);
+    std::vector<int> result(large.size());
+    result.erase(practise::copy_if(policy,large.begin(),large.end(),result.begin(),isOdd),result.end());
+    EXPECT_EQ(result,expected);
+}
+
+TYPED_TEST(StreamCompactionPolicy, unique)
+{
+    const auto& policy = TestFixture::policy;
+    auto large = TestFixture::largeInput(3);
+    auto expected = large;
+    expected.erase(std::unique(expected.begin(),expected.end()),expected.end());
+
+    std::vector<int> copy(large.size());
+    copy.erase(practise::unique_copy(policy,large.begin(),large.end(),copy.begin()),copy.end());
+    EXPECT_EQ(copy,expected);
+    large.erase(practise::unique(policy,large.begin(),large.end()),large.end());
+    EXPECT_EQ(large,expected);
+}
+
+//practise:: streaming algorithms with the expectations of the std tests above, on the streaming stores path
+//whatever the size. StreamingThreshold sets the threshold for one test and restores it afterwards.
+class StreamingThreshold
+{
+    public:
+        explicit StreamingThreshold(std::size_t bytes) : mPrevious(practise::streaming_threshold()) { practise::set_streaming_threshold(bytes); }
+        ~StreamingThreshold() { practise::set_streaming_threshold(mPrevious); }
+
+    private:
+        std::size_t mPrevious;
+};
+
+TEST(StreamingStores, copy)
+{
+    StreamingThreshold threshold(0);
+    std::vector<int> vec{1,2,3,4,5,6,7,8,9,10};
+    std::vector<int> copyVec(vec.size());
+    EXPECT_EQ(practise::streaming_copy(vec.begin(),vec.end(),copyVec.begin()),copyVec.end());
+    EXPECT_EQ(vec,copyVec);
+
+    std::string str("This is a string for copy_n testing");
+    std::string str2(7,' ');
+    practise::streaming_copy_n(str.begin(),7,str2.begin());
+    EXPECT_STREQ(str2.c_str(),"This is");
+
+    std::vector<int> backward{1,3,7,95,3,83,34};
+    copyVec.assign(7,0);
+    EXPECT_EQ(practise::streaming_copy_backward(backward.begin(),backward.end(),copyVec.end()),copyVec.begin());
+    EXPECT_EQ(copyVec,backward);
+
+    //Overlapping ranges, in the directions the std algorithms allow
+    std::vector<int> large(100000);
+    std::iota(large.begin(),large.end(),0);
+    auto expected = large;
+    std::copy(expected.begin()+1000,expected.end(),expected.begin());
+    practise::streaming_copy(large.begin()+1000,large.end(),large.begin());
+    EXPECT_EQ(large,expected);
+    std::copy_backward(expected.begin(),expected.end()-77,expected.end());
+    practise::streaming_copy_backward(large.begin(),large.end()-77,large.end());
+    EXPECT_EQ(large,expected);
+
+    //Non trivially copyable elements and list iterators take the std algorithms
+    std::vector<std::unique_ptr<int>> ptrs;
+    for(int i = 0; i < 5; ++i)
+        ptrs.push_back(std::make_unique<int>(i));
+    std::vector<std::unique_ptr<int>> moved(ptrs.size());
+    practise::streaming_move(ptrs.begin(),ptrs.end(),moved.begin());
+    EXPECT_TRUE(std::ranges::all_of(ptrs,[](auto &ptr){ return ptr == nullptr;}));
+    EXPECT_EQ(*moved.back(),4);
+
+    std::list<int> list{1,2,3};
+    std::vector<int> fromList;
+    practise::streaming_copy(list.begin(),list.end(),std::back_inserter(fromList));
+    EXPECT_EQ(fromList,(std::vector<int>{1,2,3}));
+}
+
+TEST(StreamingStores, fill)
+{
+    StreamingThreshold threshold(0);
+    std::string str("Testing");
+    practise::streaming_fill(str.begin(),str.end(),'s');
+    EXPECT_STREQ(str.c_str(),"sssssss");
+
+    EXPECT_EQ(practise::streaming_fill_n(str.begin(),3,'b'),str.begin()+3);
+    EXPECT_STREQ(str.c_str(),"bbbssss");
+    EXPECT_EQ(practise::streaming_fill_n(str.begin(),-1,'c'),str.begin());
+
+    //A value of another type is converted once, as the std assignment would
+    std::vector<double> doubles(1000);
+    practise::streaming_fill(doubles.begin(),doubles.end(),3);
+    EXPECT_EQ(std::count(doubles.begin(),doubles.end(),3.0),1000);
+
+    std::list<int> list(3);
+    practise::streaming_fill(list.begin(),list.end(),4);
+    EXPECT_EQ(list,(std::list<int>{4,4,4}));
+}
+
+TEST(StreamingStores, CopyKernel)
+{
+    //Every alignment of source and destination around whole lines, nothing written outside the destination
+    std::vector<std::uint8_t> source(5000);
+    std::iota(source.begin(),source.end(),std::uint8_t{1});
+    for(auto level : supportedSimdLevels({SimdLevel::scalar, SimdLevel::sse2, SimdLevel::avx2}))
+    {
+        for(std::size_t inOffset : {0, 1, 33})
+            for(std::size_t outOffset : {0, 1, 17, 63})
+                for(std::size_t bytes : {0, 1, 63, 64, 65, 127, 200, 4099})
+                {
+                    SCOPED_TRACE(testing::Message() << "level " << static_cast<int>(level) << ", offsets " << inOffset << " " << outOffset << ", bytes " << bytes);
+                    std::vector<std::uint8_t> out(source.size(), 0);
+                    practise::detail::streamCopyBytes(reinterpret_cast<std::byte*>(out.data() + outOffset),
+                                                      reinterpret_cast<const std::byte*>(source.data() + inOffset), bytes, level);
+                    auto expected = std::vector<std::uint8_t>(source.size(), 0);
+                    std::copy_n(source.begin() + static_cast<std::ptrdiff_t>(inOffset), bytes, expected.begin() + static_cast<std::ptrdiff_t>(outOffset));
+                    EXPECT_EQ(out, expected);
+                }
+    }
+}
+
+//The fill kernel once per element size: the sizes which tile a line, and a 12 byte struct which does not
+struct Triple
+{
+    std::int32_t a, b, c;
+    friend bool operator==(const Triple&, const Triple&) = default;
+};
+
+template<typename T>
+class StreamingFill : public testing::Test
+{
+    protected:
+        static T value(int seed)
+        {
+            if constexpr(std::is_same_v<T, Triple>)
+                return {seed, -seed, 7};
+            else
+                return static_cast<T>(seed * 37 + 1);
+        }
+};
+using StreamingFillTypes = testing::Types<std::uint8_t, std::int16_t, std::uint32_t, double, std::int64_t, Triple>;
+TYPED_TEST_SUITE(StreamingFill, StreamingFillTypes);
+
+TYPED_TEST(StreamingFill, Kernel)
+{
+    for(auto level : supportedSimdLevels({SimdLevel::scalar, SimdLevel::sse2, SimdLevel::avx2}))
+    {
+        for(std::size_t offset : {0, 1, 3})
+            for(std::size_t count : {0, 1, 15, 16, 17, 100, 4000})
+            {
+                SCOPED_TRACE(testing::Message() << "level " << static_cast<int>(level) << ", offset " << offset << ", count " << count);
+                std::vector<TypeParam> values(5000, TestFixture::value(1));
+                auto expected = values;
+                std::fill_n(expected.begin() + static_cast<std::ptrdiff_t>(offset), count, TestFixture::value(2));
+                practise::detail::streamFill(values.data() + offset, count, TestFixture::value(2), level);
+                EXPECT_EQ(values, expected);
+            }
+    }
+}
+
+TEST(StreamingStores, Parallel)
+{
+    //Several chunks of at least a MiB, streaming and through the cache
+    std::vector<int> source(3 << 20);
+    std::iota(source.begin(),source.end(),0);
+    for(std::size_t bytes : {std::size_t{0}, std::numeric_limits<std::size_t>::max()})
+    {
+        StreamingThreshold threshold(bytes);
+        for(unsigned threads : {1u, 2u, 3u, 7u})
+        {
+            std::vector<int> copy(source.size() + 1, -1);
+            EXPECT_EQ(practise::parallel_streaming_copy(source.begin(),source.end(),copy.begin()+1,threads),copy.end());
+            EXPECT_EQ(copy.front(),-1);
+            EXPECT_TRUE(std::equal(source.begin(),source.end(),copy.begin()+1)) << threads << " threads";
+
+            practise::parallel_streaming_fill(copy.begin(),copy.end()-1,5,threads);
+            EXPECT_EQ(std::count(copy.begin(),copy.end(),5),static_cast<std::ptrdiff_t>(source.size())) << threads << " threads";
+            EXPECT_EQ(copy.back(),static_cast<int>(source.size()) - 1);
+        }
+    }
+}
+
+//practise:: streaming algorithms with the execution policy overloads
+template<typename Policy>
+class StreamingStoresPolicy : public ExecutionPolicyTest<Policy> {};
+TYPED_TEST_SUITE(StreamingStoresPolicy, ExecutionPolicies, ExecutionPolicyNames);
+
+TYPED_TEST(StreamingStoresPolicy, copy)
+{
+    const auto& policy = TestFixture::policy;
+    StreamingThreshold threshold(0);
+    const auto large = TestFixture::largeInput();
+    std::vector<int> copy(large.size());
+    EXPECT_EQ(practise::streaming_copy(policy,large.begin(),large.end(),copy.begin()),copy.end());
+    EXPECT_EQ(copy,large);
+
+    std::vector<std::unique_ptr<int>> vec;
+    for(int i = 0; i < 5; ++i)
+        vec.push_back(std::make_unique<int>(i));
+    std::vector<std::unique_ptr<int>> moveVec(vec.size());
+    practise::streaming_move(policy,vec.begin(),vec.end(),moveVec.begin());
+    EXPECT_TRUE(std::ranges::all_of(vec,[](auto &ptr){ return ptr == nullptr;}));
+    EXPECT_EQ(*moveVec.back(),4);
+}
+
+TYPED_TEST(StreamingStoresPolicy, fill)
+{
+    const auto& policy = TestFixture::policy;
+    StreamingThreshold threshold(0);
+    std::string str("Testing");
+    practise::streaming_fill(policy,str.begin(),str.end(),'s');
+    EXPECT_STREQ(str.c_str(),"sssssss");
+
+    std::vector<int> large(TestFixture::largeSize);
+    practise::streaming_fill(policy,large.begin(),large.end(),7);
+    EXPECT_EQ(std::count(large.begin(),large.end(),7),static_cast<std::ptrdiff_t>(large.size()));
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
@@ -1,7 +1,10 @@
 #include <iostream>
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <array>
 #include <execution>
+#include "ExecutionPolicyTest.h"
+#include "Utils/MappedFile.h"
 
 TEST(Algorithms, NonModifyingSequeneOperations)
 {
@@ -231,6 +234,219 @@ TEST(NonModifyingSequeneOperationsAlgorithms,search_n)
  
 }
 
+//search, search_n, find_end and adjacent_find over a mapped file of utils::largeInputBytes() of ints, skipped
+//unless PRACTISE_LARGE_INPUT_BYTES is set. The generated values are positive and never equal to their
+//neighbour, the negative patterns only occur where they are planted.
+TEST(NonModifyingSequeneOperationsAlgorithms, LargeInput)
+{
+    const auto count = utils::largeInputBytes() / sizeof(int);
+    if(count == 0)
+        GTEST_SKIP() << "set PRACTISE_LARGE_INPUT_BYTES to run";
+    const std::array<int, 4> pattern{-1, -2, -3, -4};
+    const std::array<int, 5> run{-7, -7, -7, -7, -7};
+    const std::array<int, 2> last{-5, -6};
+    const std::array<int, 2> pair{-9, -9};
+    const std::size_t patternAt = count / 2 - 2, runAt = count / 3, lastAt[] = {count / 5, count - 10}, pairAt = count - 100;
+    const auto file = utils::generatedFile<int>("algorithms-search", count, [&](std::span<int> chunk, std::size_t first)
+    {
+        for(std::size_t i = 0; i < chunk.size(); ++i)
+            chunk[i] = static_cast<int>((first + i) * 7919 % 1000003) + 1;
+        utils::placeAt(chunk, first, patternAt, std::span<const int>(pattern));
+        utils::placeAt(chunk, first, runAt, std::span<const int>(run));
+        utils::placeAt(chunk, first, lastAt[0], std::span<const int>(last));
+        utils::placeAt(chunk, first, lastAt[1], std::span<const int>(last));
+        utils::placeAt(chunk, first, pairAt, std::span<const int>(pair));
+    });
+    const auto values = file.span<int>();
+    ASSERT_EQ(values.size(), count);
+    const auto at = [&](auto it) { return static_cast<std::size_t>(it - values.begin()); };
+
+    EXPECT_EQ(at(std::search(values.begin(), values.end(), pattern.begin(), pattern.end())), patternAt);
+    EXPECT_EQ(at(std::search(std::execution::par, values.begin(), values.end(), pattern.begin(), pattern.end())), patternAt);
+    EXPECT_EQ(at(std::search(values.begin(), values.end(), pattern.begin() + 1, pattern.end())), patternAt + 1);
+
+    EXPECT_EQ(at(std::search_n(values.begin(), values.end(), 5, -7)), runAt);
+    EXPECT_EQ(at(std::search_n(values.begin(), values.end(), 6, -7)), count);
+    EXPECT_EQ(at(std::search_n(std::execution::par, values.begin(), values.end(), 3, -7)), runAt);
+
+    EXPECT_EQ(at(std::find_end(values.begin(), values.end(), last.begin(), last.end())), lastAt[1]);
+    EXPECT_EQ(at(std::find_end(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(lastAt[1]), last.begin(), last.end())), lastAt[0]);
+    EXPECT_EQ(at(std::find_end(std::execution::par, values.begin(), values.end(), last.begin(), last.end())), lastAt[1]);
+
+    EXPECT_EQ(at(std::adjacent_find(values.begin(), values.end())), runAt);
+    EXPECT_EQ(at(std::adjacent_find(values.begin() + static_cast<std::ptrdiff_t>(runAt + run.size()), values.end())), pairAt);
+    EXPECT_EQ(at(std::adjacent_find(std::execution::par, values.begin(), values.end())), runAt);
+}
+
+//Every algorithm above again with the execution policy overloads, once per policy
+template<typename Policy>
+class NonModifyingSequenceOperationsPolicy : public ExecutionPolicyTest<Policy> {};
+TYPED_TEST_SUITE(NonModifyingSequenceOperationsPolicy, ExecutionPolicies, ExecutionPolicyNames);
+
+TYPED_TEST(NonModifyingSequenceOperationsPolicy, all_any_none_of)
+{
+    const auto& policy = TestFixture::policy;
+    auto isEven = [](int num){ return (num % 2) == 0;};
+    auto isNegative = [](int num){ return num < 0;};
+
+    std::vector<int> vec{2,4,6,8,10};
+    EXPECT_TRUE(std::all_of(policy,vec.begin(),vec.end(),isEven));
+    EXPECT_TRUE(std::any_of(policy,vec.begin(),vec.end(),isEven));
+    EXPECT_TRUE(std::none_of(policy,vec.begin(),vec.end(),isNegative));
+
+    auto large = TestFixture::largeInput();
+    large.back() = -1;
+    EXPECT_EQ(std::all_of(policy,large.begin(),large.end(),isEven),std::all_of(large.begin(),large.end(),isEven));
+    EXPECT_TRUE(std::any_of(policy,large.begin(),large.end(),isNegative));
+    EXPECT_FALSE(std::none_of(policy,large.begin(),large.end(),isNegative));
+}
+
+TYPED_TEST(NonModifyingSequenceOperationsPolicy, for_each)
+{
+    const auto& policy = TestFixture::policy;
+    //The policy overloads return nothing and may run the function on several threads, so it only touches its own element
+    std::vector<int> vec{1,3,5,7,9,2,-1};
+    std::for_each(policy,vec.begin(),vec.end(),[](int &n){ n *= 3; });
+    EXPECT_TRUE(std::ranges::equal(vec,std::initializer_list<int>({3,9,15,21,27,6,-3})));
+
+    std::for_each_n(policy,vec.begin(),2,[](int &n){ n = 0; });
+    EXPECT_TRUE(std::ranges::equal(vec,std::initializer_list<int>({0,0,15,21,27,6,-3})));
+
+    auto large = TestFixture::largeInput();
+    auto expected = large;
+    std::for_each(expected.begin(),expected.end(),[](int &n){ n = n * 2 + 1; });
+    std::for_each(policy,large.begin(),large.end(),[](int &n){ n = n * 2 + 1; });
+    EXPECT_EQ(large,expected);
+}
+
+TYPED_TEST(NonModifyingSequenceOperationsPolicy, count)
+{
+    const auto& policy = TestFixture::policy;
+    std::vector<int> vec{1,3,4,6,7,9,4,10,4,12,2,2,34};
+    EXPECT_EQ(std::count(policy,vec.begin(),vec.end(),4),3);
+    EXPECT_EQ(std::count_if(policy,vec.begin(),vec.end(),[](int num){ return num % 2 == 0;}),9);
+
+    auto large = TestFixture::largeInput();
+    EXPECT_EQ(std::count(policy,large.begin(),large.end(),7),std::count(large.begin(),large.end(),7));
+    auto countOdd = [](int num){ return num % 2 != 0;};
+    EXPECT_EQ(std::count_if(policy,large.begin(),large.end(),countOdd),std::count_if(large.begin(),large.end(),countOdd));
+}
+
+TYPED_TEST(NonModifyingSequenceOperationsPolicy, mismatch)
+{
+    const auto& policy = TestFixture::policy;
+    std::string str1 = "Helpo";
+    std::string str2 = "Helso";
+    auto retVal = std::mismatch(policy,str1.begin(),str1.end(),str2.begin());
+    EXPECT_EQ(*retVal.first,'p');
+    EXPECT_EQ(*retVal.second,'s');
+
+    auto retVal2 = std::mismatch(policy,str1.begin(),str1.end(),str2.begin(),str2.end(),[](char a, char b){ return a == b;});
+    EXPECT_EQ(*retVal2.first,'p');
+
+    //The first mismatch has to be reported even when a later chunk finds one earlier in time
+    auto large = TestFixture::largeInput();
+    auto other = large;
+    other[other.size() / 3] = -1;
+    other[other.size() - 2] = -1;
+    auto ret = std::mismatch(policy,large.begin(),large.end(),other.begin());
+    EXPECT_EQ(std::distance(large.begin(),ret.first),static_cast<std::ptrdiff_t>(large.size() / 3));
+}
+
+TYPED_TEST(NonModifyingSequenceOperationsPolicy, find)
+{
+    const auto& policy = TestFixture::policy;
+    std::vector<int> vec{1,2,3,4,5,4,6};
+    auto isEven = [](int num){ return (num % 2 == 0);};
+    EXPECT_EQ(*std::find(policy,vec.begin(),vec.end(),2),2);
+    EXPECT_EQ(std::find(policy,vec.begin(),vec.end(),10),vec.end());
+    EXPECT_EQ(*std::find_if(policy,vec.begin(),vec.end(),isEven),2);
+    EXPECT_EQ(*std::find_if_not(policy,vec.begin(),vec.end(),isEven),1);
+
+    auto large = TestFixture::largeInput();
+    large[large.size() / 2] = -5;
+    large[large.size() - 1] = -5;
+    EXPECT_EQ(std::find(policy,large.begin(),large.end(),-5),large.begin() + static_cast<std::ptrdiff_t>(large.size() / 2));
+    EXPECT_EQ(std::find_if(policy,large.begin(),large.end(),isEven),std::find_if(large.begin(),large.end(),isEven));
+    EXPECT_EQ(std::find_if_not(policy,large.begin(),large.end(),isEven),std::find_if_not(large.begin(),large.end(),isEven));
+}
+
+TYPED_TEST(NonModifyingSequenceOperationsPolicy, find_end)
+{
+    const auto& policy = TestFixture::policy;
+    std::vector<int> vec{1,2,3,1,2,3,4,1,2,3,6};
+    std::vector<int> vec2{1,2,3};
+    EXPECT_EQ(std::distance(vec.begin(),std::find_end(policy,vec.begin(),vec.end(),vec2.begin(),vec2.end())),7);
+    EXPECT_EQ(std::distance(vec.begin(),std::find_end(policy,vec.begin(),vec.end(),vec2.begin(),vec2.end(),std::equal_to<>())),7);
+
+    auto large = TestFixture::largeInput(9);
+    std::vector<int> pattern{1,2,3};
+    EXPECT_EQ(std::find_end(policy,large.begin(),large.end(),pattern.begin(),pattern.end()),
+              std::find_end(large.begin(),large.end(),pattern.begin(),pattern.end()));
+}
+
+TYPED_TEST(NonModifyingSequenceOperationsPolicy, find_first_of)
+{
+    const auto& policy = TestFixture::policy;
+    std::string str("Hello World");
+    std::string compareStr("Good");
+    auto it = std::find_first_of(policy,str.begin(),str.end(),compareStr.begin(),compareStr.end());
+    EXPECT_EQ(std::distance(str.begin(),it),4);
+
+    auto it2 = std::find_first_of(policy,str.begin(),str.end(),compareStr.begin(),compareStr.end(),[](char a, char b){return (a == b);});
+    EXPECT_EQ(std::distance(str.begin(),it2),4);
+
+    auto large = TestFixture::largeInput();
+    std::vector<int> needles{1001,1002,500};
+    EXPECT_EQ(std::find_first_of(policy,large.begin(),large.end(),needles.begin(),needles.end()),
+              std::find_first_of(large.begin(),large.end(),needles.begin(),needles.end()));
+}
+
+TYPED_TEST(NonModifyingSequenceOperationsPolicy, adjacent_find)
+{
+    const auto& policy = TestFixture::policy;
+    std::array<int,10> arr{1,2,3,4,4,5,6,6,7,10};
+    EXPECT_EQ(std::distance(arr.begin(),std::adjacent_find(policy,arr.begin(),arr.end())),3);
+
+    std::array<int,10> arr2{1,2,3,-3,4,5,-5};
+    auto adjacentWithNegative = [](int num1, int num2){ return (num1 == -(num2));};
+    EXPECT_EQ(std::distance(arr2.begin(),std::adjacent_find(policy,arr2.begin(),arr2.end(),adjacentWithNegative)),2);
+
+    auto large = TestFixture::largeInput(100000);
+    EXPECT_EQ(std::adjacent_find(policy,large.begin(),large.end()),std::adjacent_find(large.begin(),large.end()));
+}
+
+TYPED_TEST(NonModifyingSequenceOperationsPolicy, search)
+{
+    const auto& policy = TestFixture::policy;
+    std::string str = "Hello world good people going to search substrings";
+    std::string subString = "oing";
+    auto it = std::search(policy,str.begin(),str.end(),subString.begin(),subString.end());
+    EXPECT_TRUE(std::equal(it,it+subString.length(),"oing"));
+
+    auto it2 = std::search(policy,str.begin(),str.end(),subString.begin(),subString.end(),[](char a, char b){ return (a == b);});
+    EXPECT_TRUE(std::equal(it2,it2+subString.length(),"oing"));
+
+    auto large = TestFixture::largeInput(9);
+    std::vector<int> pattern{4,5,6,7};
+    EXPECT_EQ(std::search(policy,large.begin(),large.end(),pattern.begin(),pattern.end()),
+              std::search(large.begin(),large.end(),pattern.begin(),pattern.end()));
+}
+
+TYPED_TEST(NonModifyingSequenceOperationsPolicy, search_n)
+{
+    const auto& policy = TestFixture::policy;
+    std::string str("Helllo wooorld");
+    auto it = std::search_n(policy,str.begin(),str.end(),3,'l');
+    EXPECT_TRUE(std::equal(it,it+3,"lll"));
+
+    auto it2 = std::search_n(policy,str.begin(),str.end(),3,'o',[](char a, char b){return a == b;});
+    EXPECT_TRUE(std::equal(it2,it2+3,"ooo"));
+
+    auto large = TestFixture::largeInput(3);
+    EXPECT_EQ(std::search_n(policy,large.begin(),large.end(),6,2),std::search_n(large.begin(),large.end(),6,2));
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
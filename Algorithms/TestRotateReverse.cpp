@@ -0,0 +1,186 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+#include "RotateReverse.h"
+#include "SimdLevelTest.h"
+
+using practise::detail::SimdLevel;
+
+//practise:: algorithms with the expectations of the std tests in TestModSequenceOperations.cpp
+TEST(RotateReverse, reverse)
+{
+    std::string str("This is the testing for reverse api");
+    practise::reverse(str.begin(), str.end());
+    EXPECT_STREQ(str.c_str(),"ipa esrever rof gnitset eht si sihT");
+
+    std::vector<int> vec{1,2,3,4,5};
+    std::vector<int> copyVec(vec.size());
+    practise::reverse_copy(vec.begin(), vec.end(),copyVec.begin());
+    EXPECT_EQ(copyVec,(std::vector<int>{5,4,3,2,1}));
+
+    std::string copyStr("Hello 1");
+    std::string reversed(copyStr.size(), ' ');
+    EXPECT_EQ(practise::reverse_copy(copyStr.begin(),copyStr.end(),reversed.begin()),reversed.end());
+    EXPECT_STREQ(reversed.c_str(),"1 olleH");
+}
+
+TEST(RotateReverse, rotate)
+{
+    std::vector<int> vec{1,2,3,4,5,6,7,8,9,10};
+    EXPECT_EQ(practise::rotate(vec.begin(), vec.begin()+5, vec.end()), vec.begin()+5);
+    EXPECT_EQ(vec,(std::vector<int>{6,7,8,9,10,1,2,3,4,5}));
+
+    std::ranges::sort(vec);
+    practise::rotate(vec.begin(), vec.begin()+7, vec.end());
+    EXPECT_EQ(vec,(std::vector<int>{8,9,10,1,2,3,4,5,6,7}));
+
+    //Reverse iterators are not contiguous and take std::rotate
+    std::ranges::sort(vec);
+    practise::rotate(vec.rbegin(), vec.rbegin()+3, vec.rend());
+    EXPECT_EQ(vec,(std::vector<int>{8,9,10,1,2,3,4,5,6,7}));
+
+    std::string str("RotateString");
+    practise::rotate(str.begin(),str.begin()+5,str.end());
+    EXPECT_STREQ(str.c_str(),"eStringRotat");
+
+    EXPECT_EQ(practise::rotate(vec.begin(), vec.begin(), vec.end()), vec.end());
+    EXPECT_EQ(practise::rotate(vec.begin(), vec.end(), vec.end()), vec.begin());
+
+    std::string src("RotateCopy");
+    std::string copyStr(src.size(), ' ');
+    practise::rotate_copy(src.begin(),std::ranges::find(src,'e'),src.end(),copyStr.begin());
+    EXPECT_STREQ(copyStr.c_str(),"eCopyRotat");
+}
+
+TEST(RotateReverse, shift)
+{
+    std::vector<int> vec{1,2,3,4,5,7};
+    EXPECT_EQ(practise::shift_left(vec.begin(),vec.end(),2), vec.begin()+4);
+    EXPECT_EQ(vec,(std::vector<int>{3,4,5,7,5,7}));
+
+    EXPECT_EQ(practise::shift_right(vec.begin(),vec.end(),2), vec.begin()+2);
+    EXPECT_EQ(vec,(std::vector<int>{3,4,3,4,5,7}));
+
+    EXPECT_EQ(practise::shift_left(vec.begin(),vec.end(),0), vec.end());
+    EXPECT_EQ(practise::shift_left(vec.begin(),vec.end(),6), vec.begin());
+    EXPECT_EQ(practise::shift_right(vec.begin(),vec.end(),0), vec.begin());
+    EXPECT_EQ(practise::shift_right(vec.begin(),vec.end(),9), vec.end());
+    EXPECT_EQ(vec,(std::vector<int>{3,4,3,4,5,7}));
+
+    std::list<int> list{1,2,3,4};
+    practise::shift_left(list.begin(),list.end(),1);
+    EXPECT_EQ(list,(std::list<int>{2,3,4,4}));
+}
+
+//Against the std algorithms once per element size, every size the vector reverse handles and a 12 byte struct
+struct Triple
+{
+    std::int32_t a, b, c;
+    friend bool operator==(const Triple&, const Triple&) = default;
+};
+
+struct Wide
+{
+    std::uint64_t low, high;
+    friend bool operator==(const Wide&, const Wide&) = default;
+};
+
+template<typename T>
+class RotateReverseTyped : public testing::Test
+{
+    protected:
+        static std::vector<T> input(std::size_t size)
+        {
+            std::vector<T> values(size);
+            for(std::size_t i = 0; i < size; ++i)
+            {
+                if constexpr(std::is_same_v<T, Triple>)
+                    values[i] = {static_cast<std::int32_t>(i), -static_cast<std::int32_t>(i), 7};
+                else if constexpr(std::is_same_v<T, Wide>)
+                    values[i] = {i, ~i};
+                else
+                    values[i] = static_cast<T>(i * 2654435761u);
+            }
+            return values;
+        }
+};
+using RotateReverseTypes = testing::Types<std::uint8_t, std::int16_t, std::uint32_t, double, Wide, Triple>;
+TYPED_TEST_SUITE(RotateReverseTyped, RotateReverseTypes);
+
+TYPED_TEST(RotateReverseTyped, reverse)
+{
+    //Around whole vectors from both ends and their remainders
+    for(std::size_t size : {0, 1, 2, 15, 16, 31, 32, 33, 63, 64, 65, 1000, 100003})
+    {
+        const auto values = TestFixture::input(size);
+        auto expected = values;
+        std::reverse(expected.begin(), expected.end());
+        for(auto level : supportedSimdLevels({SimdLevel::scalar, SimdLevel::avx2}))
+        {
+            SCOPED_TRACE(testing::Message() << "size " << size << ", level " << static_cast<int>(level));
+            auto reversed = values;
+            practise::detail::reverseElements(reversed.data(), reversed.data() + size, level);
+            EXPECT_EQ(reversed, expected);
+            std::vector<TypeParam> copy(size);
+            EXPECT_EQ(practise::detail::reverseCopyElements(values.data(), values.data() + size, copy.data(), level), copy.data() + size);
+            EXPECT_EQ(copy, expected);
+        }
+        auto reversed = values;
+        practise::reverse(reversed.begin(), reversed.end());
+        EXPECT_EQ(reversed, expected);
+        std::vector<TypeParam> copy(size);
+        EXPECT_EQ(practise::reverse_copy(values.begin(), values.end(), copy.begin()), copy.end());
+        EXPECT_EQ(copy, expected);
+    }
+}
+
+TYPED_TEST(RotateReverseTyped, rotate)
+{
+    //Small sides through the stack buffer, large ones through several block swaps
+    for(std::size_t size : {0, 1, 2, 100, 5000, 300007})
+        for(std::size_t middle : {std::size_t{0}, std::size_t{1}, size / 3, size / 2, size - std::min<std::size_t>(size, 1000), size})
+        {
+            if(middle > size)
+                continue;
+            SCOPED_TRACE(testing::Message() << "size " << size << ", middle " << middle);
+            const auto values = TestFixture::input(size);
+            auto expected = values;
+            std::rotate(expected.begin(), expected.begin() + static_cast<std::ptrdiff_t>(middle), expected.end());
+            auto rotated = values;
+            const auto it = practise::rotate(rotated.begin(), rotated.begin() + static_cast<std::ptrdiff_t>(middle), rotated.end());
+            EXPECT_EQ(it - rotated.begin(), static_cast<std::ptrdiff_t>(size - middle));
+            EXPECT_EQ(rotated, expected);
+
+            std::vector<TypeParam> copy(size);
+            practise::rotate_copy(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(middle), values.end(), copy.begin());
+            EXPECT_EQ(copy, expected);
+        }
+}
+
+TYPED_TEST(RotateReverseTyped, shift)
+{
+    const auto values = TestFixture::input(10000);
+    for(std::ptrdiff_t n : {1, 7, 4096, 9999})
+    {
+        auto expected = values;
+        auto shifted = values;
+        EXPECT_EQ(practise::shift_left(shifted.begin(), shifted.end(), n) - shifted.begin(),
+                  std::shift_left(expected.begin(), expected.end(), n) - expected.begin());
+        EXPECT_EQ(shifted, expected);
+        EXPECT_EQ(practise::shift_right(shifted.begin(), shifted.end(), n) - shifted.begin(),
+                  std::shift_right(expected.begin(), expected.end(), n) - expected.begin());
+        EXPECT_EQ(shifted, expected);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
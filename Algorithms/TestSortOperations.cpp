@@ -0,0 +1,298 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <execution>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "ExecutionPolicyTest.h"
+#include "RadixSort.h"
+
+TEST(SortOperations, sort)
+{
+    std::vector<int> vec{5,3,9,1,7,2};
+    std::sort(vec.begin(),vec.end());
+    EXPECT_EQ(vec,(std::vector<int>{1,2,3,5,7,9}));
+
+    std::sort(vec.begin(),vec.end(),std::greater<>());
+    EXPECT_EQ(vec,(std::vector<int>{9,7,5,3,2,1}));
+
+    std::ranges::sort(vec);
+    EXPECT_TRUE(std::ranges::is_sorted(vec));
+}
+
+TEST(SortOperations, stable_sort)
+{
+    std::vector<std::pair<int,std::string>> vec{{2,"b"},{1,"a"},{2,"a"},{1,"b"}};
+    std::stable_sort(vec.begin(),vec.end(),[](auto &a, auto &b){ return a.first < b.first; });
+    EXPECT_EQ(vec,(std::vector<std::pair<int,std::string>>{{1,"a"},{1,"b"},{2,"b"},{2,"a"}}));
+}
+
+TEST(SortOperations, partial_sort)
+{
+    std::vector<int> vec{5,3,9,1,7,2};
+    std::partial_sort(vec.begin(),vec.begin() + 3,vec.end());
+    EXPECT_EQ((std::vector<int>(vec.begin(),vec.begin() + 3)),(std::vector<int>{1,2,3}));
+
+    std::vector<int> out(2);
+    std::partial_sort_copy(vec.begin(),vec.end(),out.begin(),out.end(),std::greater<>());
+    EXPECT_EQ(out,(std::vector<int>{9,7}));
+}
+
+TEST(SortOperations, nth_element)
+{
+    std::vector<int> vec{5,3,9,1,7,2};
+    std::nth_element(vec.begin(),vec.begin() + 2,vec.end());
+    EXPECT_EQ(vec[2],3);
+    EXPECT_TRUE(std::all_of(vec.begin(),vec.begin() + 2,[](int val){ return val <= 3; }));
+}
+
+TEST(SortOperations, is_sorted)
+{
+    std::vector<int> vec{1,2,4,3,5};
+    EXPECT_FALSE(std::is_sorted(vec.begin(),vec.end()));
+    EXPECT_EQ(std::is_sorted_until(vec.begin(),vec.end()) - vec.begin(),3);
+}
+
+//sort and stable_sort with the execution policy overloads, once per policy
+template<typename Policy>
+class SortOperationsPolicy : public ExecutionPolicyTest<Policy> {};
+TYPED_TEST_SUITE(SortOperationsPolicy, ExecutionPolicies, ExecutionPolicyNames);
+
+TYPED_TEST(SortOperationsPolicy, sort)
+{
+    const auto& policy = TestFixture::policy;
+    auto large = TestFixture::largeInput();
+    auto expected = large;
+    std::sort(expected.begin(),expected.end());
+    std::sort(policy,large.begin(),large.end());
+    EXPECT_EQ(large,expected);
+}
+
+TYPED_TEST(SortOperationsPolicy, radix_sort)
+{
+    const auto& policy = TestFixture::policy;
+    auto large = TestFixture::largeInput(1 << 30);
+    auto expected = large;
+    std::sort(expected.begin(),expected.end());
+    practise::radix_sort(policy,large);
+    EXPECT_EQ(large,expected);
+
+    std::vector<int> values(large.size());
+    std::iota(values.begin(),values.end(),0);
+    std::shuffle(large.begin(),large.end(),std::mt19937{7});
+    auto keys = large;
+    practise::radix_sort_by_key(policy,keys.begin(),keys.end(),values.begin());
+    EXPECT_EQ(keys,expected);
+    for(std::size_t i = 0; i < keys.size(); ++i)
+        ASSERT_EQ(large[static_cast<std::size_t>(values[i])],keys[i]);
+}
+
+//practise::radix_sort against std::sort once per key type, sequential and parallel
+template<typename T>
+class RadixSort : public testing::Test
+{
+    protected:
+        static std::vector<T> input(std::size_t size, unsigned seed)
+        {
+            std::mt19937_64 gen{seed};
+            std::vector<T> values(size);
+            if constexpr(std::is_floating_point_v<T>)
+            {
+                std::uniform_real_distribution<T> dist{-1000, 1000};
+                for(auto& val : values)
+                    val = dist(gen);
+            }
+            else
+            {
+                using Wide = std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>;
+                std::uniform_int_distribution<Wide> dist{std::numeric_limits<T>::min(), std::numeric_limits<T>::max()};
+                for(auto& val : values)
+                    val = static_cast<T>(dist(gen));
+            }
+            return values;
+        }
+
+        static void expectSorted(std::vector<T> values)
+        {
+            auto expected = values;
+            std::sort(expected.begin(), expected.end());
+            auto parallel = values;
+            practise::radix_sort(values.begin(), values.end());
+            EXPECT_EQ(values, expected) << "size " << values.size();
+            practise::parallel_radix_sort(parallel.begin(), parallel.end(), 4);
+            EXPECT_EQ(parallel, expected) << "size " << values.size();
+        }
+};
+using RadixSortTypes = testing::Types<std::int8_t, std::uint8_t, std::int16_t, std::uint16_t, std::int32_t,
+                                      std::uint32_t, std::int64_t, std::uint64_t, float, double>;
+TYPED_TEST_SUITE(RadixSort, RadixSortTypes);
+
+TYPED_TEST(RadixSort, Random)
+{
+    //Around the insertion sort threshold, and large enough for 4 parallel chunks
+    for(std::size_t size : {0, 1, 2, 63, 64, 65, 1000, 1 << 19})
+        TestFixture::expectSorted(TestFixture::input(size, static_cast<unsigned>(size)));
+}
+
+TYPED_TEST(RadixSort, SkippedDigits)
+{
+    //Small values in a wide type, all high bytes equal, and a range where every key is the same
+    std::vector<TypeParam> small(100000);
+    std::mt19937 gen{3};
+    for(auto& val : small)
+        val = static_cast<TypeParam>(gen() % 100);
+    TestFixture::expectSorted(small);
+    TestFixture::expectSorted(std::vector<TypeParam>(100000, TypeParam(7)));
+
+    auto sorted = TestFixture::input(100000, 5);
+    std::sort(sorted.begin(), sorted.end());
+    TestFixture::expectSorted(sorted);
+    std::reverse(sorted.begin(), sorted.end());
+    TestFixture::expectSorted(sorted);
+}
+
+TYPED_TEST(RadixSort, Extremes)
+{
+    using Limits = std::numeric_limits<TypeParam>;
+    std::vector<TypeParam> values{Limits::max(), Limits::lowest(), TypeParam(0), TypeParam(1), Limits::min(), TypeParam(0)};
+    if constexpr(std::is_floating_point_v<TypeParam>)
+        values.insert(values.end(), {Limits::infinity(), -Limits::infinity(), Limits::denorm_min(), -Limits::denorm_min(), TypeParam(-1.5)});
+    else if constexpr(std::is_signed_v<TypeParam>)
+        values.insert(values.end(), {TypeParam(-1), TypeParam(Limits::min() + 1)});
+    for(int copies = 0; copies < 5; ++copies)
+    {
+        const auto copy = values;
+        values.insert(values.end(), copy.begin(), copy.end());
+    }
+    TestFixture::expectSorted(values);
+}
+
+TEST(RadixSort, FloatingPointZeroAndNaN)
+{
+    //-0.0 goes before 0.0, NaNs to the end by their sign bit
+    std::vector<double> values{0.0, -0.0, std::numeric_limits<double>::quiet_NaN(), 1.0, -0.0, -2.0};
+    practise::radix_sort(values);
+    EXPECT_TRUE(std::signbit(values[1]) && std::signbit(values[2]));
+    EXPECT_EQ(values[0], -2.0);
+    EXPECT_FALSE(std::signbit(values[3]));
+    EXPECT_EQ(values[4], 1.0);
+    EXPECT_TRUE(std::isnan(values[5]));
+}
+
+TEST(RadixSort, Containers)
+{
+    auto arr = std::to_array<std::int16_t>({300, -5, 12, -300, 0, 7});
+    practise::radix_sort(arr);
+    EXPECT_EQ(arr, (std::array<std::int16_t, 6>{-300, -5, 0, 7, 12, 300}));
+
+    unsigned plain[] = {9, 4, 1u << 31, 0};
+    practise::radix_sort(plain);
+    EXPECT_TRUE(std::is_sorted(std::begin(plain), std::end(plain)));
+
+    std::vector<float> vec{2.5f, -1.0f, 0.25f};
+    practise::radix_sort(std::execution::par, vec);
+    EXPECT_EQ(vec, (std::vector<float>{-1.0f, 0.25f, 2.5f}));
+}
+
+struct Record
+{
+    std::uint64_t id = 0;
+    std::int32_t score = 0;
+    float weight = 0;
+    friend bool operator==(const Record&, const Record&) = default;
+};
+
+TEST(RadixSort, KeyExtraction)
+{
+    //Few distinct scores, equal scores have to stay in id order
+    for(std::size_t size : {std::size_t{50}, std::size_t{300000}})
+    {
+        std::mt19937 gen{11};
+        std::vector<Record> records(size);
+        for(std::size_t i = 0; i < size; ++i)
+            records[i] = {i, static_cast<std::int32_t>(gen() % 50) - 25, static_cast<float>(gen() % 1000) / 7};
+        auto byScore = records;
+        std::stable_sort(byScore.begin(), byScore.end(), [](auto& a, auto& b) { return a.score < b.score; });
+        auto byWeight = records;
+        std::stable_sort(byWeight.begin(), byWeight.end(), [](auto& a, auto& b) { return a.weight < b.weight; });
+
+        auto sorted = records;
+        practise::radix_sort(sorted.begin(), sorted.end(), &Record::score);
+        EXPECT_EQ(sorted, byScore);
+        sorted = records;
+        practise::parallel_radix_sort(sorted.begin(), sorted.end(), 3, [](const Record& record) { return record.weight; });
+        EXPECT_EQ(sorted, byWeight);
+    }
+}
+
+TEST(RadixSort, KeyValue)
+{
+    for(std::size_t size : {std::size_t{40}, std::size_t{300000}})
+    {
+        std::mt19937 gen{13};
+        std::vector<std::uint16_t> keys(size);
+        std::vector<std::string> values(size);
+        for(std::size_t i = 0; i < size; ++i)
+        {
+            keys[i] = static_cast<std::uint16_t>(gen() % 500);
+            values[i] = std::to_string(i);
+        }
+        std::vector<std::pair<std::uint16_t, std::string>> expected;
+        for(std::size_t i = 0; i < size; ++i)
+            expected.emplace_back(keys[i], values[i]);
+        std::stable_sort(expected.begin(), expected.end(), [](auto& a, auto& b) { return a.first < b.first; });
+
+        auto parallelKeys = keys;
+        auto parallelValues = values;
+        practise::radix_sort_by_key(keys.begin(), keys.end(), values.begin());
+        practise::parallel_radix_sort_by_key(parallelKeys.begin(), parallelKeys.end(), parallelValues.begin(), 4);
+        for(std::size_t i = 0; i < size; ++i)
+        {
+            ASSERT_EQ(keys[i], expected[i].first);
+            ASSERT_EQ(values[i], expected[i].second);
+            ASSERT_EQ(parallelKeys[i], expected[i].first);
+            ASSERT_EQ(parallelValues[i], expected[i].second);
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(RadixSort, Partition)
+{
+    //Records bucketed on the low byte of their score, equal buckets have to stay in id order
+    for(std::size_t size : {std::size_t{0}, std::size_t{50}, std::size_t{300000}})
+    {
+        std::mt19937 gen{17};
+        std::vector<Record> records(size);
+        for(std::size_t i = 0; i < size; ++i)
+            records[i] = {i, static_cast<std::int32_t>(gen() % 100000) - 50000, 0};
+        auto bucket = [](const Record& record) { return record.score & 0xFF; };
+        auto expected = records;
+        std::stable_sort(expected.begin(), expected.end(), [&](auto& a, auto& b) { return bucket(a) < bucket(b); });
+
+        auto sequential = records;
+        const auto bounds = practise::radix_partition(sequential.begin(), sequential.end(), bucket);
+        EXPECT_EQ(sequential, expected);
+        auto parallel = records;
+        EXPECT_EQ(practise::parallel_radix_partition(parallel.begin(), parallel.end(), 4, bucket), bounds);
+        EXPECT_EQ(parallel, expected);
+        auto policy = records;
+        EXPECT_EQ(practise::radix_partition(std::execution::par, policy.begin(), policy.end(), bucket), bounds);
+        EXPECT_EQ(policy, expected);
+
+        EXPECT_EQ(bounds[0], 0u);
+        EXPECT_EQ(bounds[256], size);
+        for(int b = 0; b < 256; ++b)
+            for(auto i = bounds[b]; i < bounds[b + 1]; ++i)
+                ASSERT_EQ(bucket(sequential[i]), b);
+    }
+}
@@ -0,0 +1,1038 @@
+//btree_map : ordered unique-key map stored in a B+-tree, for lookups and range scans that std::map serves
+//with one cache miss per node it visits. Elements live only in the leaves. Each leaf holds as many
+//std::pair<Key, T> as fit into NodeBytes (a few cache lines), and the leaves are linked so an in-order walk
+//reads them one after the other. Inner nodes hold copies of keys to route the lookups, so Key has to be copy
+//constructible. Insert and erase shift elements inside a leaf and split or merge nodes, so, as for
+//flat_map, they invalidate iterators. Changing a key through an iterator breaks the ordering.
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "FlatTree.h"
+
+namespace practise
+{
+
+template<typename Key, typename T, typename Compare = std::less<Key>, std::size_t NodeBytes = 256>
+class btree_map
+{
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using key_compare = Compare;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    //Elements per leaf and keys per inner node. At least 4, so nodes of large elements still branch.
+    static constexpr size_type leaf_capacity = std::max<size_type>(4, (NodeBytes - 2 * sizeof(void*) - sizeof(size_type)) / sizeof(value_type));
+    static constexpr size_type inner_capacity = std::max<size_type>(4, (NodeBytes - 3 * sizeof(void*) - sizeof(Key)) / (sizeof(Key) + sizeof(void*)));
+
+private:
+    static constexpr size_type cacheLine = 64;
+    static constexpr size_type leafMin = leaf_capacity / 2;
+    static constexpr size_type innerMin = inner_capacity / 2;
+    //Every node but the root has at least 3 children or 2 elements, far fewer levels than this for any size_type
+    static constexpr size_type maxHeight = 64;
+
+    struct Node {};
+
+    struct alignas(cacheLine) Leaf : Node
+    {
+        Leaf* prev = nullptr;
+        Leaf* next = nullptr;
+        size_type count = 0;
+        alignas(value_type) std::byte storage[leaf_capacity * sizeof(value_type)];
+
+        value_type* values() noexcept { return reinterpret_cast<value_type*>(storage); }
+        ~Leaf() { std::destroy_n(values(), count); }
+    };
+
+    //count keys separate count + 1 children, keys[i] is not greater than any key under children[i + 1].
+    //One spare key and child: an insert overflows the node first and then splits it.
+    struct alignas(cacheLine) Inner : Node
+    {
+        size_type count = 0;
+        Node* children[inner_capacity + 2];
+        alignas(Key) std::byte storage[(inner_capacity + 1) * sizeof(Key)];
+
+        Key* keys() noexcept { return reinterpret_cast<Key*>(storage); }
+        ~Inner() { std::destroy_n(keys(), count); }
+    };
+
+    //Inner nodes from the root down to a leaf and the child taken in each
+    struct Path
+    {
+        Inner* nodes[maxHeight];
+        size_type children[maxHeight];
+    };
+
+    template<bool Const>
+    class Iterator
+    {
+        friend class btree_map;
+        friend class Iterator<!Const>;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = btree_map::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+
+        Iterator() = default;
+        template<bool OtherConst> requires (Const && !OtherConst)
+        Iterator(const Iterator<OtherConst>& other) : mLeaf(other.mLeaf), mIndex(other.mIndex) {}
+
+        reference operator*() const { return mLeaf->values()[mIndex]; }
+        pointer operator->() const { return mLeaf->values() + mIndex; }
+
+        //The end iterator is one past the last element of the last leaf
+        Iterator& operator++()
+        {
+            if(++mIndex == mLeaf->count && mLeaf->next)
+            {
+                mLeaf = mLeaf->next;
+                mIndex = 0;
+            }
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        Iterator& operator--()
+        {
+            if(mIndex == 0)
+            {
+                mLeaf = mLeaf->prev;
+                mIndex = mLeaf->count;
+            }
+            --mIndex;
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            auto copy = *this;
+            --*this;
+            return copy;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs) = default;
+
+    private:
+        Iterator(Leaf* leaf, size_type index) : mLeaf(leaf), mIndex(index) {}
+
+        Leaf* mLeaf = nullptr;
+        size_type mIndex = 0;
+    };
+
+public:
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    //Compares two elements by their keys
+    class value_compare
+    {
+    public:
+        bool operator()(const value_type& lhs, const value_type& rhs) const { return mComp(lhs.first, rhs.first); }
+
+    protected:
+        friend class btree_map;
+        explicit value_compare(Compare comp) : mComp(comp) {}
+        Compare mComp;
+    };
+
+    //The element is moved out of its leaf into the handle
+    class node_type
+    {
+        template<typename, typename, typename, std::size_t>
+        friend class btree_map;
+
+    public:
+        node_type() = default;
+
+        [[nodiscard]] bool empty() const { return !mValue.has_value(); }
+        explicit operator bool() const { return mValue.has_value(); }
+
+        Key& key() const { return mValue->first; }
+        T& mapped() const { return mValue->second; }
+
+    private:
+        mutable std::optional<value_type> mValue;
+    };
+
+    struct insert_return_type
+    {
+        iterator position;
+        bool inserted;
+        node_type node;
+    };
+
+    //constructors
+    btree_map() = default;
+
+    explicit btree_map(const Compare& comp) : mComp(comp) {}
+
+    template<std::input_iterator InputIt>
+    btree_map(InputIt first, InputIt last, const Compare& comp = Compare())
+        : mComp(comp)
+    {
+        insert(first, last);
+    }
+
+    btree_map(std::initializer_list<value_type> init, const Compare& comp = Compare())
+        : btree_map(init.begin(), init.end(), comp) {}
+
+    //Bulk load from input already sorted by comp without equivalent keys, no sorting pass at all
+    template<std::input_iterator InputIt>
+    btree_map(sorted_unique_t, InputIt first, InputIt last, const Compare& comp = Compare())
+        : mComp(comp)
+    {
+        insert(sorted_unique, first, last);
+    }
+
+    btree_map(const btree_map& other)
+        : mComp(other.mComp)
+    {
+        bulkLoad(other.begin(), other.size());
+    }
+
+    btree_map(btree_map&& other) noexcept
+        : mRoot(std::exchange(other.mRoot, nullptr)), mFirst(std::exchange(other.mFirst, nullptr)),
+          mLast(std::exchange(other.mLast, nullptr)), mHeight(std::exchange(other.mHeight, 0)),
+          mSize(std::exchange(other.mSize, 0)), mComp(other.mComp) {}
+
+    btree_map& operator=(btree_map other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    btree_map& operator=(std::initializer_list<value_type> init)
+    {
+        clear();
+        insert(init.begin(), init.end());
+        return *this;
+    }
+
+    ~btree_map()
+    {
+        clear();
+    }
+
+    //element access
+    T& at(const Key& key)
+    {
+        auto it = find(key);
+        if(it == end())
+            throw std::out_of_range("btree_map::at");
+        return it->second;
+    }
+
+    const T& at(const Key& key) const
+    {
+        auto it = find(key);
+        if(it == end())
+            throw std::out_of_range("btree_map::at");
+        return it->second;
+    }
+
+    T& operator[](const Key& key) { return try_emplace(key).first->second; }
+    T& operator[](Key&& key) { return try_emplace(std::move(key)).first->second; }
+
+    //iterators
+    iterator begin() noexcept { return mFirst ? iterator(mFirst, 0) : iterator(); }
+    const_iterator begin() const noexcept { return const_cast<btree_map*>(this)->begin(); }
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    iterator end() noexcept { return mLast ? iterator(mLast, mLast->count) : iterator(); }
+    const_iterator end() const noexcept { return const_cast<btree_map*>(this)->end(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(cend()); }
+
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const noexcept { return const_reverse_iterator(cbegin()); }
+
+    //capacity
+    [[nodiscard]] bool empty() const noexcept { return mSize == 0; }
+    size_type size() const noexcept { return mSize; }
+    size_type max_size() const noexcept { return std::numeric_limits<difference_type>::max() / sizeof(value_type); }
+
+    //Levels from the root down to the leaves, 0 when empty
+    size_type depth() const noexcept { return mRoot ? mHeight + 1 : 0; }
+
+    //modifiers
+    void clear() noexcept
+    {
+        if(mRoot)
+            destroy(mRoot, mHeight);
+        mRoot = nullptr;
+        mFirst = mLast = nullptr;
+        mHeight = 0;
+        mSize = 0;
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value) { return emplace(value); }
+    std::pair<iterator, bool> insert(value_type&& value) { return emplace(std::move(value)); }
+
+    template<typename P> requires std::is_constructible_v<value_type, P&&>
+    std::pair<iterator, bool> insert(P&& value) { return emplace(std::forward<P>(value)); }
+
+    //Every insert descends from the root, the hint is not used
+    iterator insert(const_iterator, const value_type& value) { return emplace(value).first; }
+    iterator insert(const_iterator, value_type&& value) { return emplace(std::move(value)).first; }
+
+    template<typename P> requires std::is_constructible_v<value_type, P&&>
+    iterator insert(const_iterator, P&& value) { return emplace(std::forward<P>(value)).first; }
+
+    //Into an empty map the range is sorted once and bulk loaded, the first of equivalent keys wins
+    //as it would with one insert after the other
+    template<std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        if(!empty())
+        {
+            for(; first != last; ++first)
+                emplace(*first);
+            return;
+        }
+        std::vector<value_type> values(first, last);
+        std::stable_sort(values.begin(), values.end(), value_comp());
+        values.erase(std::unique(values.begin(), values.end(), [&](const value_type& lhs, const value_type& rhs){
+            return !mComp(lhs.first, rhs.first);
+        }), values.end());
+        bulkLoad(std::make_move_iterator(values.begin()), values.size());
+    }
+
+    template<std::input_iterator InputIt>
+    void insert(sorted_unique_t, InputIt first, InputIt last)
+    {
+        if(!empty())
+        {
+            insert(first, last);
+        }
+        else if constexpr(std::forward_iterator<InputIt>)
+        {
+            bulkLoad(first, static_cast<size_type>(std::distance(first, last)));
+        }
+        else
+        {
+            std::vector<value_type> values(first, last);
+            bulkLoad(std::make_move_iterator(values.begin()), values.size());
+        }
+    }
+
+    void insert(std::initializer_list<value_type> init) { insert(init.begin(), init.end()); }
+
+    insert_return_type insert(node_type&& node)
+    {
+        if(node.empty())
+            return {end(), false, node_type()};
+        Path path;
+        const auto slot = locate(node.key(), path);
+        if(slot.found)
+            return {iterator(slot.leaf, slot.index), false, std::move(node)};
+        auto it = insertAt(path, slot, std::move(*node.mValue));
+        node.mValue.reset();
+        return {it, true, node_type()};
+    }
+
+    iterator insert(const_iterator, node_type&& node) { return insert(std::move(node)).position; }
+
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        value_type value(std::forward<Args>(args)...);
+        Path path;
+        const auto slot = locate(value.first, path);
+        if(slot.found)
+            return {iterator(slot.leaf, slot.index), false};
+        return {insertAt(path, slot, std::move(value)), true};
+    }
+
+    template<typename... Args>
+    iterator emplace_hint(const_iterator, Args&&... args)
+    {
+        return emplace(std::forward<Args>(args)...).first;
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        return tryEmplace(key, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args)
+    {
+        return tryEmplace(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    iterator try_emplace(const_iterator, const Key& key, Args&&... args)
+    {
+        return tryEmplace(key, std::forward<Args>(args)...).first;
+    }
+
+    template<typename... Args>
+    iterator try_emplace(const_iterator, Key&& key, Args&&... args)
+    {
+        return tryEmplace(std::move(key), std::forward<Args>(args)...).first;
+    }
+
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj)
+    {
+        auto [it, inserted] = tryEmplace(key, std::forward<M>(obj));
+        if(!inserted)
+            it->second = std::forward<M>(obj);
+        return {it, inserted};
+    }
+
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(Key&& key, M&& obj)
+    {
+        auto [it, inserted] = tryEmplace(std::move(key), std::forward<M>(obj));
+        if(!inserted)
+            it->second = std::forward<M>(obj);
+        return {it, inserted};
+    }
+
+    template<typename M>
+    iterator insert_or_assign(const_iterator, const Key& key, M&& obj)
+    {
+        return insert_or_assign(key, std::forward<M>(obj)).first;
+    }
+
+    template<typename M>
+    iterator insert_or_assign(const_iterator, Key&& key, M&& obj)
+    {
+        return insert_or_assign(std::move(key), std::forward<M>(obj)).first;
+    }
+
+    iterator erase(iterator pos) { return erase(const_iterator(pos)); }
+
+    iterator erase(const_iterator pos)
+    {
+        auto path = pathTo(pos.mLeaf, pos.mIndex);
+        return eraseAt(path, pos.mLeaf, pos.mIndex);
+    }
+
+    //Every erase can move the elements after it, so the range is erased by count from its first element
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        iterator it(first.mLeaf, first.mIndex);
+        for(auto count = std::distance(first, last); count > 0; --count)
+            it = erase(it);
+        return it;
+    }
+
+    size_type erase(const Key& key)
+    {
+        auto it = find(key);
+        if(it == end())
+            return 0;
+        erase(it);
+        return 1;
+    }
+
+    void swap(btree_map& other) noexcept
+    {
+        using std::swap;
+        swap(mRoot, other.mRoot);
+        swap(mFirst, other.mFirst);
+        swap(mLast, other.mLast);
+        swap(mHeight, other.mHeight);
+        swap(mSize, other.mSize);
+        swap(mComp, other.mComp);
+    }
+
+    node_type extract(const_iterator pos)
+    {
+        return extractAt(pos).first;
+    }
+
+    node_type extract(const Key& key)
+    {
+        auto it = find(key);
+        return it == end() ? node_type() : extract(const_iterator(it));
+    }
+
+    //Moves every element whose key is not in the map yet out of source
+    template<typename Compare2, std::size_t NodeBytes2>
+    void merge(btree_map<Key, T, Compare2, NodeBytes2>& source)
+    {
+        for(auto it = source.begin(); it != source.end();)
+        {
+            Path path;
+            const auto slot = locate(it->first, path);
+            if(slot.found)
+            {
+                ++it;
+                continue;
+            }
+            auto [node, next] = source.extractAt(it);
+            insertAt(path, slot, std::move(*node.mValue));
+            it = next;
+        }
+    }
+
+    template<typename Compare2, std::size_t NodeBytes2>
+    void merge(btree_map<Key, T, Compare2, NodeBytes2>&& source)
+    {
+        merge(source);
+    }
+
+    //lookup
+    size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+    iterator find(const Key& key)
+    {
+        auto it = lower_bound(key);
+        return (it != end() && !mComp(key, it->first)) ? it : end();
+    }
+
+    const_iterator find(const Key& key) const { return const_cast<btree_map*>(this)->find(key); }
+
+    bool contains(const Key& key) const { return find(key) != end(); }
+
+    iterator lower_bound(const Key& key)
+    {
+        if(!mRoot)
+            return end();
+        Leaf* leaf = findLeaf(key, nullptr);
+        return normalize(leaf, leafLowerBound(leaf, key));
+    }
+
+    const_iterator lower_bound(const Key& key) const { return const_cast<btree_map*>(this)->lower_bound(key); }
+
+    iterator upper_bound(const Key& key)
+    {
+        if(!mRoot)
+            return end();
+        Leaf* leaf = findLeaf(key, nullptr);
+        const auto* values = leaf->values();
+        const auto index = std::partition_point(values, values + leaf->count, [&](const value_type& value){ return !mComp(key, value.first); }) - values;
+        return normalize(leaf, static_cast<size_type>(index));
+    }
+
+    const_iterator upper_bound(const Key& key) const { return const_cast<btree_map*>(this)->upper_bound(key); }
+
+    std::pair<iterator, iterator> equal_range(const Key& key)
+    {
+        auto first = lower_bound(key);
+        return {first, (first != end() && !mComp(key, first->first)) ? std::next(first) : first};
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+    {
+        return const_cast<btree_map*>(this)->equal_range(key);
+    }
+
+    //observers
+    key_compare key_comp() const { return mComp; }
+    value_compare value_comp() const { return value_compare(mComp); }
+
+    //non member functions
+    friend bool operator==(const btree_map& lhs, const btree_map& rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    friend auto operator<=>(const btree_map& lhs, const btree_map& rhs)
+    {
+        return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend void swap(btree_map& lhs, btree_map& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    //std::erase_if counterpart, found through ADL
+    template<typename Pred>
+    friend size_type erase_if(btree_map& map, Pred pred)
+    {
+        const auto oldSize = map.size();
+        for(auto it = map.begin(); it != map.end();)
+            it = pred(*it) ? map.erase(it) : std::next(it);
+        return oldSize - map.size();
+    }
+
+private:
+    template<typename, typename, typename, std::size_t>
+    friend class btree_map;
+
+    //Where a key is, or where it goes when it is not in the map
+    struct Slot
+    {
+        Leaf* leaf;
+        size_type index;
+        bool found;
+    };
+
+    //Slot helpers over uninitialized storage, [0, count) holds live objects
+    template<typename U>
+    static void insertSlot(U* data, size_type count, size_type pos, U&& value)
+    {
+        if(pos == count)
+        {
+            std::construct_at(data + count, std::move(value));
+            return;
+        }
+        std::construct_at(data + count, std::move(data[count - 1]));
+        std::move_backward(data + pos, data + count - 1, data + count);
+        data[pos] = std::move(value);
+    }
+
+    template<typename U>
+    static void eraseSlot(U* data, size_type count, size_type pos)
+    {
+        std::move(data + pos + 1, data + count, data + pos);
+        std::destroy_at(data + count - 1);
+    }
+
+    template<typename U>
+    static void moveSlots(U* from, size_type count, U* to)
+    {
+        std::uninitialized_move(from, from + count, to);
+        std::destroy_n(from, count);
+    }
+
+    static void destroy(Node* node, size_type height) noexcept
+    {
+        if(height == 0)
+        {
+            delete static_cast<Leaf*>(node);
+            return;
+        }
+        auto* inner = static_cast<Inner*>(node);
+        for(size_type child = 0; child <= inner->count; ++child)
+            destroy(inner->children[child], height - 1);
+        delete inner;
+    }
+
+    //In inner nodes the child is the number of separators not greater than key, so every key before that
+    //child is smaller and every key after it is greater
+    Leaf* findLeaf(const Key& key, Path* path) const
+    {
+        Node* node = mRoot;
+        for(size_type depth = 0; depth < mHeight; ++depth)
+        {
+            auto* inner = static_cast<Inner*>(node);
+            const Key* keys = inner->keys();
+            const auto child = static_cast<size_type>(std::partition_point(keys, keys + inner->count, [&](const Key& separator){ return !mComp(key, separator); }) - keys);
+            if(path)
+            {
+                path->nodes[depth] = inner;
+                path->children[depth] = child;
+            }
+            node = inner->children[child];
+        }
+        return static_cast<Leaf*>(node);
+    }
+
+    size_type leafLowerBound(Leaf* leaf, const Key& key) const
+    {
+        const auto* values = leaf->values();
+        return static_cast<size_type>(std::partition_point(values, values + leaf->count, [&](const value_type& value){ return mComp(value.first, key); }) - values);
+    }
+
+    //Past the last element of a leaf is the first element of the next one, only the last leaf keeps it as end()
+    static iterator normalize(Leaf* leaf, size_type index)
+    {
+        if(index == leaf->count && leaf->next)
+            return iterator(leaf->next, 0);
+        return iterator(leaf, index);
+    }
+
+    Slot locate(const Key& key, Path& path) const
+    {
+        if(!mRoot)
+            return {nullptr, 0, false};
+        Leaf* leaf = findLeaf(key, &path);
+        const auto index = leafLowerBound(leaf, key);
+        return {leaf, index, index < leaf->count && !mComp(key, leaf->values()[index].first)};
+    }
+
+    Path pathTo(Leaf* leaf, size_type index) const
+    {
+        Path path;
+        findLeaf(leaf->values()[index].first, &path);
+        return path;
+    }
+
+    template<typename K, typename... Args>
+    std::pair<iterator, bool> tryEmplace(K&& key, Args&&... args)
+    {
+        Path path;
+        const auto slot = locate(key, path);
+        if(slot.found)
+            return {iterator(slot.leaf, slot.index), false};
+        value_type value(std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)),
+                         std::forward_as_tuple(std::forward<Args>(args)...));
+        return {insertAt(path, slot, std::move(value)), true};
+    }
+
+    //Nodes a leaf split needs: the right leaf, a sibling for every full inner node the separator goes up
+    //through and a new root when that is every node of the path
+    struct SplitNodes
+    {
+        std::unique_ptr<Leaf> leaf;
+        std::unique_ptr<Inner> inners[maxHeight + 1];
+        size_type innerCount = 0;
+
+        Inner* takeInner() { return inners[--innerCount].release(); }
+    };
+
+    SplitNodes allocateSplit(const Path& path) const
+    {
+        SplitNodes nodes;
+        nodes.leaf = std::make_unique_for_overwrite<Leaf>();
+        size_type depth = mHeight;
+        for(; depth > 0 && path.nodes[depth - 1]->count == inner_capacity; --depth)
+            nodes.inners[nodes.innerCount++] = std::make_unique_for_overwrite<Inner>();
+        if(depth == 0)
+            nodes.inners[nodes.innerCount++] = std::make_unique_for_overwrite<Inner>();
+        return nodes;
+    }
+
+    //A full leaf is split in halves and the first key of the right half goes up as separator. The separator
+    //and every node the split needs are made before anything changes, so an exception leaves the tree as it was.
+    iterator insertAt(Path& path, Slot slot, value_type&& value)
+    {
+        Leaf* leaf = slot.leaf;
+        if(!leaf)
+        {
+            leaf = new Leaf;
+            mRoot = mFirst = mLast = leaf;
+        }
+        if(leaf->count < leaf_capacity)
+        {
+            insertSlot(leaf->values(), leaf->count, slot.index, std::move(value));
+            ++leaf->count;
+            ++mSize;
+            return iterator(leaf, slot.index);
+        }
+
+        constexpr size_type mid = leaf_capacity / 2;
+        const size_type from = slot.index <= mid ? mid : mid + 1;
+        Key separator(slot.index == mid + 1 ? value.first : leaf->values()[from].first);
+        auto nodes = allocateSplit(path);
+
+        auto* right = nodes.leaf.release();
+        right->prev = leaf;
+        right->next = leaf->next;
+        (leaf->next ? leaf->next->prev : mLast) = right;
+        leaf->next = right;
+
+        moveSlots(leaf->values() + from, leaf->count - from, right->values());
+        right->count = leaf->count - from;
+        leaf->count = from;
+
+        Leaf* target = slot.index <= mid ? leaf : right;
+        const size_type index = slot.index <= mid ? slot.index : slot.index - from;
+        insertSlot(target->values(), target->count, index, std::move(value));
+        ++target->count;
+        ++mSize;
+        insertSeparator(path, std::move(separator), right, nodes);
+        return iterator(target, index);
+    }
+
+    //Adds right after the child the path took, splitting the inner nodes that overflow up to the root
+    void insertSeparator(Path& path, Key separator, Node* right, SplitNodes& nodes)
+    {
+        for(size_type depth = mHeight; depth-- > 0;)
+        {
+            Inner* parent = path.nodes[depth];
+            const size_type index = path.children[depth];
+            insertSlot(parent->keys(), parent->count, index, std::move(separator));
+            std::move_backward(parent->children + index + 1, parent->children + parent->count + 1, parent->children + parent->count + 2);
+            parent->children[index + 1] = right;
+            if(++parent->count <= inner_capacity)
+                return;
+
+            //Overfull by one: the middle key moves up, the keys and children after it to a new node
+            auto* sibling = nodes.takeInner();
+            const size_type mid = parent->count / 2;
+            separator = std::move(parent->keys()[mid]);
+            moveSlots(parent->keys() + mid + 1, parent->count - mid - 1, sibling->keys());
+            std::copy(parent->children + mid + 1, parent->children + parent->count + 1, sibling->children);
+            sibling->count = parent->count - mid - 1;
+            std::destroy_at(parent->keys() + mid);
+            parent->count = mid;
+            right = sibling;
+        }
+        auto* root = nodes.takeInner();
+        std::construct_at(root->keys(), std::move(separator));
+        root->children[0] = mRoot;
+        root->children[1] = right;
+        root->count = 1;
+        mRoot = root;
+        ++mHeight;
+    }
+
+    std::pair<node_type, iterator> extractAt(const_iterator pos)
+    {
+        //The path is found by key, before the key is moved out
+        auto path = pathTo(pos.mLeaf, pos.mIndex);
+        node_type node;
+        node.mValue.emplace(std::move(pos.mLeaf->values()[pos.mIndex]));
+        return {std::move(node), eraseAt(path, pos.mLeaf, pos.mIndex)};
+    }
+
+    iterator eraseAt(Path& path, Leaf* leaf, size_type index)
+    {
+        eraseSlot(leaf->values(), leaf->count, index);
+        --leaf->count;
+        --mSize;
+        iterator next(leaf, index);
+        rebalanceLeaf(path, next);
+        return next.mLeaf ? normalize(next.mLeaf, next.mIndex) : end();
+    }
+
+    //A leaf under half full borrows an element from a sibling or merges with it. next follows the element
+    //after the erased one through the moves.
+    void rebalanceLeaf(Path& path, iterator& next)
+    {
+        Leaf* leaf = next.mLeaf;
+        if(mHeight == 0)
+        {
+            if(leaf->count == 0)
+            {
+                delete leaf;
+                mRoot = nullptr;
+                mFirst = mLast = nullptr;
+                next = iterator();
+            }
+            return;
+        }
+        if(leaf->count >= leafMin)
+            return;
+
+        Inner* parent = path.nodes[mHeight - 1];
+        const size_type index = path.children[mHeight - 1];
+        if(index > 0)
+        {
+            auto* left = static_cast<Leaf*>(parent->children[index - 1]);
+            if(left->count > leafMin)
+            {
+                insertSlot(leaf->values(), leaf->count, 0, std::move(left->values()[left->count - 1]));
+                std::destroy_at(left->values() + --left->count);
+                ++leaf->count;
+                ++next.mIndex;
+                parent->keys()[index - 1] = leaf->values()[0].first;
+                return;
+            }
+            next = iterator(left, left->count + next.mIndex);
+            mergeLeaves(left, leaf);
+            removeChild(parent, index - 1);
+        }
+        else
+        {
+            auto* right = static_cast<Leaf*>(parent->children[1]);
+            if(right->count > leafMin)
+            {
+                std::construct_at(leaf->values() + leaf->count, std::move(right->values()[0]));
+                ++leaf->count;
+                eraseSlot(right->values(), right->count, 0);
+                --right->count;
+                parent->keys()[0] = right->values()[0].first;
+                return;
+            }
+            mergeLeaves(leaf, right);
+            removeChild(parent, 0);
+        }
+        rebalanceInner(path, mHeight - 1);
+    }
+
+    //Same for the inner nodes on the path, the separator in the parent rotates through. An empty root
+    //hands its only child the root.
+    void rebalanceInner(Path& path, size_type depth)
+    {
+        for(; depth > 0; --depth)
+        {
+            Inner* node = path.nodes[depth];
+            if(node->count >= innerMin)
+                return;
+            Inner* parent = path.nodes[depth - 1];
+            const size_type index = path.children[depth - 1];
+            if(index > 0)
+            {
+                auto* left = static_cast<Inner*>(parent->children[index - 1]);
+                if(left->count > innerMin)
+                {
+                    insertSlot(node->keys(), node->count, 0, std::move(parent->keys()[index - 1]));
+                    std::move_backward(node->children, node->children + node->count + 1, node->children + node->count + 2);
+                    node->children[0] = left->children[left->count];
+                    ++node->count;
+                    parent->keys()[index - 1] = std::move(left->keys()[left->count - 1]);
+                    std::destroy_at(left->keys() + --left->count);
+                    return;
+                }
+                mergeInner(left, parent->keys()[index - 1], node);
+                removeChild(parent, index - 1);
+            }
+            else
+            {
+                auto* right = static_cast<Inner*>(parent->children[1]);
+                if(right->count > innerMin)
+                {
+                    std::construct_at(node->keys() + node->count, std::move(parent->keys()[0]));
+                    node->children[node->count + 1] = right->children[0];
+                    ++node->count;
+                    parent->keys()[0] = std::move(right->keys()[0]);
+                    eraseSlot(right->keys(), right->count, 0);
+                    std::copy(right->children + 1, right->children + right->count + 1, right->children);
+                    --right->count;
+                    return;
+                }
+                mergeInner(node, parent->keys()[0], right);
+                removeChild(parent, 0);
+            }
+        }
+        Inner* root = path.nodes[0];
+        if(root->count == 0)
+        {
+            mRoot = root->children[0];
+            --mHeight;
+            delete root;
+        }
+    }
+
+    void mergeLeaves(Leaf* left, Leaf* right)
+    {
+        moveSlots(right->values(), right->count, left->values() + left->count);
+        left->count += right->count;
+        right->count = 0;
+        left->next = right->next;
+        (right->next ? right->next->prev : mLast) = left;
+        delete right;
+    }
+
+    void mergeInner(Inner* left, Key& separator, Inner* right)
+    {
+        std::construct_at(left->keys() + left->count, std::move(separator));
+        moveSlots(right->keys(), right->count, left->keys() + left->count + 1);
+        std::copy(right->children, right->children + right->count + 1, left->children + left->count + 1);
+        left->count += right->count + 1;
+        right->count = 0;
+        delete right;
+    }
+
+    //Drops keys[index] and children[index + 1]
+    static void removeChild(Inner* node, size_type index)
+    {
+        eraseSlot(node->keys(), node->count, index);
+        std::copy(node->children + index + 2, node->children + node->count + 1, node->children + index + 1);
+        --node->count;
+    }
+
+    //Builds the tree bottom up from count sorted unique elements: leaves filled evenly and linked, then
+    //every level of inner nodes over the one below with the first key of each child as separator
+    template<typename It>
+    void bulkLoad(It first, size_type count)
+    {
+        if(count == 0)
+            return;
+        std::vector<Inner*> inners;
+        try
+        {
+            const size_type leaves = (count + leaf_capacity - 1) / leaf_capacity;
+            std::vector<Node*> level;
+            std::vector<const Key*> minimums;
+            level.reserve(leaves);
+            minimums.reserve(leaves);
+            for(size_type i = 0; i < leaves; ++i)
+            {
+                auto* leaf = new Leaf;
+                leaf->prev = mLast;
+                (mLast ? mLast->next : mFirst) = leaf;
+                mLast = leaf;
+                for(const size_type fill = count / leaves + (i < count % leaves); leaf->count < fill; ++first)
+                {
+                    std::construct_at(leaf->values() + leaf->count, *first);
+                    ++leaf->count;
+                }
+                level.push_back(leaf);
+                minimums.push_back(&leaf->values()[0].first);
+            }
+
+            size_type height = 0;
+            while(level.size() > 1)
+            {
+                const size_type parents = (level.size() + inner_capacity) / (inner_capacity + 1);
+                std::vector<Node*> up;
+                std::vector<const Key*> upMinimums;
+                inners.reserve(inners.size() + parents);
+                for(size_type parent = 0, child = 0; parent < parents; ++parent)
+                {
+                    auto* inner = new Inner;
+                    inners.push_back(inner);
+                    const size_type children = level.size() / parents + (parent < level.size() % parents);
+                    inner->children[0] = level[child];
+                    up.push_back(inner);
+                    upMinimums.push_back(minimums[child]);
+                    for(size_type c = 1; c < children; ++c)
+                    {
+                        std::construct_at(inner->keys() + inner->count, *minimums[child + c]);
+                        inner->children[c] = level[child + c];
+                        ++inner->count;
+                    }
+                    child += children;
+                }
+                level = std::move(up);
+                minimums = std::move(upMinimums);
+                ++height;
+            }
+            mRoot = level.front();
+            mHeight = height;
+            mSize = count;
+        }
+        catch(...)
+        {
+            for(auto* inner : inners)
+                delete inner;
+            for(Leaf* leaf = mFirst; leaf;)
+                delete std::exchange(leaf, leaf->next);
+            mRoot = nullptr;
+            mFirst = mLast = nullptr;
+            throw;
+        }
+    }
+
+    Node* mRoot = nullptr;
+    Leaf* mFirst = nullptr;
+    Leaf* mLast = nullptr;
+    size_type mHeight = 0;
+    size_type mSize = 0;
+    [[no_unique_address]] Compare mComp{};
+};
+
+}
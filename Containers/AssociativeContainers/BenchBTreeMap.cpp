@@ -0,0 +1,157 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <map>
+#include <random>
+#include <vector>
+#include "BTreeMap.h"
+#include "Utils/BenchmarkUtils.h"
+
+//Point lookups and range scans of btree_map against the node based std::map. Building from sorted input
+//is the bulk load for btree_map and hinted inserts at the end for std::map.
+template<typename Map>
+static Map buildMap(const std::vector<int>& keys)
+{
+    std::vector<std::pair<int, int>> values;
+    values.reserve(keys.size());
+    for(auto key : keys)
+        values.emplace_back(key, key);
+    return Map(values.begin(), values.end());
+}
+
+template<typename Map>
+static void BM_InsertRandom(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        Map map;
+        for(auto key : keys)
+            map.emplace(key, key);
+        benchmark::DoNotOptimize(map.size());
+    }
+    bench::reportPerOp(state, count, sizeof(typename Map::value_type));
+}
+BENCHMARK_TEMPLATE(BM_InsertRandom, std::map<int, int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_InsertRandom, practise::btree_map<int, int>)->Apply(bench::elementSweep);
+
+template<typename Map>
+static void BM_BuildSorted(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    std::vector<std::pair<int, int>> values;
+    for(int key = 0; key < count; ++key)
+        values.emplace_back(key, key);
+    for(auto _ : state)
+    {
+        Map map(values.begin(), values.end());
+        benchmark::DoNotOptimize(map.size());
+    }
+    bench::reportPerOp(state, count, sizeof(typename Map::value_type));
+}
+BENCHMARK_TEMPLATE(BM_BuildSorted, std::map<int, int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_BuildSorted, practise::btree_map<int, int>)->Apply(bench::elementSweep);
+
+template<typename Map>
+static void BM_Find(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    auto map = buildMap<Map>(keys);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937{7});
+    for(auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for(auto key : keys)
+            sum += map.find(key)->second;
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::reportPerOp(state, count, sizeof(typename Map::value_type));
+}
+BENCHMARK_TEMPLATE(BM_Find, std::map<int, int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_Find, practise::btree_map<int, int>)->Apply(bench::elementSweep);
+
+template<typename Map>
+static void BM_LowerBound(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto map = buildMap<Map>(bench::randomInts(count));
+    //Probes mostly fall between two keys
+    auto probes = bench::randomInts(count);
+    std::reverse(probes.begin(), probes.end());
+    for(auto _ : state)
+    {
+        std::size_t found = 0;
+        for(auto key : probes)
+            found += (map.lower_bound(key) != map.end());
+        benchmark::DoNotOptimize(found);
+    }
+    bench::reportPerOp(state, count, sizeof(typename Map::value_type));
+}
+BENCHMARK_TEMPLATE(BM_LowerBound, std::map<int, int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_LowerBound, practise::btree_map<int, int>)->Apply(bench::elementSweep);
+
+//Index shaped queries: lower_bound of a random key, then the next 100 elements in order
+template<typename Map>
+static void BM_RangeScan(benchmark::State& state)
+{
+    constexpr int scanLength = 100;
+    const auto count = state.range(0);
+    auto map = buildMap<Map>(bench::randomInts(count));
+    auto probes = bench::randomInts(std::max<std::int64_t>(count / scanLength, 1));
+    for(auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for(auto key : probes)
+        {
+            auto it = map.lower_bound(key);
+            for(int i = 0; i < scanLength && it != map.end(); ++i, ++it)
+                sum += it->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(probes.size()) * scanLength, sizeof(typename Map::value_type));
+}
+BENCHMARK_TEMPLATE(BM_RangeScan, std::map<int, int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_RangeScan, practise::btree_map<int, int>)->Apply(bench::elementSweep);
+
+template<typename Map>
+static void BM_Iterate(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto map = buildMap<Map>(bench::randomInts(count));
+    for(auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for(auto &value : map)
+            sum += value.second;
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(map.size()), sizeof(typename Map::value_type));
+}
+BENCHMARK_TEMPLATE(BM_Iterate, std::map<int, int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_Iterate, practise::btree_map<int, int>)->Apply(bench::elementSweep);
+
+//Erase half of the keys in random order, the leaves borrow and merge on the way
+template<typename Map>
+static void BM_EraseRandom(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    const auto built = buildMap<Map>(keys);
+    keys.resize(keys.size() / 2);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        auto map = built;
+        state.ResumeTiming();
+        for(auto key : keys)
+            map.erase(key);
+        benchmark::DoNotOptimize(map.size());
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(keys.size()), sizeof(typename Map::value_type));
+}
+BENCHMARK_TEMPLATE(BM_EraseRandom, std::map<int, int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_EraseRandom, practise::btree_map<int, int>)->Apply(bench::elementSweep);
+
+BENCHMARK_MAIN();
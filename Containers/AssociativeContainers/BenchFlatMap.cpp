@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+#include <map>
+#include "FlatMap.h"
+#include "Utils/BenchmarkUtils.h"
+
+//Read-heavy shapes where the contiguous layout of flat_map should beat the node based std::map.
+//Single element inserts are O(n) for flat_map, so building is measured as one bulk range insert.
+template<typename Map>
+static Map buildMap(const std::vector<int>& keys)
+{
+    std::vector<std::pair<int, int>> values;
+    values.reserve(keys.size());
+    for(auto key : keys)
+        values.emplace_back(key, key);
+    return Map(values.begin(), values.end());
+}
+
+template<typename Map>
+static void BM_BulkBuild(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        auto map = buildMap<Map>(keys);
+        benchmark::DoNotOptimize(map.size());
+    }
+    bench::reportPerOp(state, count, sizeof(typename Map::value_type));
+}
+BENCHMARK_TEMPLATE(BM_BulkBuild, std::map<int, int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_BulkBuild, practise::flat_map<int, int>)->Apply(bench::elementSweep);
+
+template<typename Map>
+static void BM_Find(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    auto map = buildMap<Map>(keys);
+    for(auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for(auto key : keys)
+            sum += map.find(key)->second;
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::reportPerOp(state, count, sizeof(typename Map::value_type));
+}
+BENCHMARK_TEMPLATE(BM_Find, std::map<int, int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_Find, practise::flat_map<int, int>)->Apply(bench::elementSweep);
+
+template<typename Map>
+static void BM_LowerBound(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto map = buildMap<Map>(bench::randomInts(count));
+    //Probes mostly fall between two keys
+    auto probes = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        std::size_t found = 0;
+        for(auto key : probes)
+            found += (map.lower_bound(key) != map.end());
+        benchmark::DoNotOptimize(found);
+    }
+    bench::reportPerOp(state, count, sizeof(typename Map::value_type));
+}
+BENCHMARK_TEMPLATE(BM_LowerBound, std::map<int, int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_LowerBound, practise::flat_map<int, int>)->Apply(bench::elementSweep);
+
+template<typename Map>
+static void BM_EqualRange(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    auto map = buildMap<Map>(keys);
+    for(auto _ : state)
+    {
+        std::size_t found = 0;
+        for(auto key : keys)
+        {
+            auto [first, last] = map.equal_range(key);
+            found += (first != last);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    bench::reportPerOp(state, count, sizeof(typename Map::value_type));
+}
+BENCHMARK_TEMPLATE(BM_EqualRange, std::map<int, int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_EqualRange, practise::flat_map<int, int>)->Apply(bench::elementSweep);
+
+template<typename Map>
+static void BM_Iterate(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto map = buildMap<Map>(bench::randomInts(count));
+    for(auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for(auto &value : map)
+            sum += value.second;
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(map.size()), sizeof(typename Map::value_type));
+}
+BENCHMARK_TEMPLATE(BM_Iterate, std::map<int, int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_Iterate, practise::flat_map<int, int>)->Apply(bench::elementSweep);
+
+BENCHMARK_MAIN();
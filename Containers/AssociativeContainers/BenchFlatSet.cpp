@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+#include <set>
+#include "FlatSet.h"
+#include "Utils/BenchmarkUtils.h"
+
+//Same read-heavy shapes as BenchFlatMap.cpp for flat_set against std::set
+template<typename Set>
+static void BM_BulkBuild(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        Set set(keys.begin(), keys.end());
+        benchmark::DoNotOptimize(set.size());
+    }
+    bench::reportPerOp(state, count, sizeof(typename Set::value_type));
+}
+BENCHMARK_TEMPLATE(BM_BulkBuild, std::set<int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_BulkBuild, practise::flat_set<int>)->Apply(bench::elementSweep);
+
+template<typename Set>
+static void BM_Contains(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    Set set(keys.begin(), keys.end());
+    for(auto _ : state)
+    {
+        std::size_t hits = 0;
+        for(auto key : keys)
+            hits += set.contains(key);
+        benchmark::DoNotOptimize(hits);
+    }
+    bench::reportPerOp(state, count, sizeof(typename Set::value_type));
+}
+BENCHMARK_TEMPLATE(BM_Contains, std::set<int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_Contains, practise::flat_set<int>)->Apply(bench::elementSweep);
+
+template<typename Set>
+static void BM_LowerBound(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    Set set(keys.begin(), keys.end());
+    auto probes = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        std::size_t found = 0;
+        for(auto key : probes)
+            found += (set.lower_bound(key) != set.end());
+        benchmark::DoNotOptimize(found);
+    }
+    bench::reportPerOp(state, count, sizeof(typename Set::value_type));
+}
+BENCHMARK_TEMPLATE(BM_LowerBound, std::set<int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_LowerBound, practise::flat_set<int>)->Apply(bench::elementSweep);
+
+template<typename Set>
+static void BM_Iterate(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    Set set(keys.begin(), keys.end());
+    for(auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for(auto value : set)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(set.size()), sizeof(typename Set::value_type));
+}
+BENCHMARK_TEMPLATE(BM_Iterate, std::set<int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_Iterate, practise::flat_set<int>)->Apply(bench::elementSweep);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+#include <map>
+#include "Utils/BenchmarkUtils.h"
+#include "Utils/MemoryResourceBenchmarkUtils.h"
+
+using Container = std::multimap<int, int>;
+
+static void BM_MultiMapInsert(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        Container container;
+        for(auto key : keys)
+            container.emplace(key, key);
+        benchmark::DoNotOptimize(container.size());
+    }
+    bench::reportPerOp(state, count, sizeof(Container::value_type));
+}
+BENCHMARK(BM_MultiMapInsert)->Apply(bench::elementSweep);
+
+static void BM_MultiMapFind(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    Container container;
+    for(auto key : keys)
+        container.emplace(key, key);
+    for(auto _ : state)
+    {
+        std::size_t hits = 0;
+        for(auto key : keys)
+            hits += container.contains(key);
+        benchmark::DoNotOptimize(hits);
+    }
+    bench::reportPerOp(state, count, sizeof(Container::value_type));
+}
+BENCHMARK(BM_MultiMapFind)->Apply(bench::elementSweep);
+
+//LookUp test shape: lower_bound/upper_bound/equal_range
+static void BM_MultiMapEqualRange(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    Container container;
+    for(auto key : keys)
+        container.emplace(key, key);
+    for(auto _ : state)
+    {
+        std::size_t found = 0;
+        for(auto key : keys)
+        {
+            auto [first, last] = container.equal_range(key);
+            found += (first != last);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    bench::reportPerOp(state, count, sizeof(Container::value_type));
+}
+BENCHMARK(BM_MultiMapEqualRange)->Apply(bench::elementSweep);
+
+static void BM_MultiMapIterate(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    Container container;
+    for(auto key : keys)
+        container.emplace(key, key);
+    for(auto _ : state)
+    {
+        std::size_t visited = 0;
+        for(auto &value : container)
+        {
+            benchmark::DoNotOptimize(&value);
+            ++visited;
+        }
+        benchmark::DoNotOptimize(visited);
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(container.size()), sizeof(Container::value_type));
+}
+BENCHMARK(BM_MultiMapIterate)->Apply(bench::elementSweep);
+
+static void BM_MultiMapEraseIf(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        Container container;
+        for(auto key : keys)
+            container.emplace(key, key);
+        state.ResumeTiming();
+        std::erase_if(container, [](auto &value){return (value.first % 2) == 0;});
+        benchmark::DoNotOptimize(container.size());
+    }
+    bench::reportPerOp(state, count, sizeof(Container::value_type));
+}
+BENCHMARK(BM_MultiMapEraseIf)->Apply(bench::elementSweep);
+
+//Insert/erase churn with std::allocator, monotonic, pool and the thread arena, see bench::insertEraseChurn
+template<typename Resource>
+static void BM_MultiMapInsertEraseResource(benchmark::State& state)
+{
+    using MultiMap = std::multimap<int, int, std::less<int>, typename Resource::template allocator_type<std::pair<const int, int>>>;
+    bench::insertEraseChurn<MultiMap, Resource>(state, [](MultiMap& map, int val) { map.emplace(val, val); });
+}
+BENCHMARK_MEMORY_RESOURCES(BM_MultiMapInsertEraseResource);
+
+BENCHMARK_MAIN();
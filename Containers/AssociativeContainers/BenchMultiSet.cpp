@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+#include <set>
+#include "Utils/BenchmarkUtils.h"
+#include "Utils/MemoryResourceBenchmarkUtils.h"
+
+using Container = std::multiset<int>;
+
+static void BM_MultiSetInsert(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        Container container;
+        for(auto key : keys)
+            container.insert(key);
+        benchmark::DoNotOptimize(container.size());
+    }
+    bench::reportPerOp(state, count, sizeof(Container::value_type));
+}
+BENCHMARK(BM_MultiSetInsert)->Apply(bench::elementSweep);
+
+static void BM_MultiSetFind(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    Container container;
+    for(auto key : keys)
+        container.insert(key);
+    for(auto _ : state)
+    {
+        std::size_t hits = 0;
+        for(auto key : keys)
+            hits += container.contains(key);
+        benchmark::DoNotOptimize(hits);
+    }
+    bench::reportPerOp(state, count, sizeof(Container::value_type));
+}
+BENCHMARK(BM_MultiSetFind)->Apply(bench::elementSweep);
+
+//LookUp test shape: lower_bound/upper_bound/equal_range
+static void BM_MultiSetEqualRange(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    Container container;
+    for(auto key : keys)
+        container.insert(key);
+    for(auto _ : state)
+    {
+        std::size_t found = 0;
+        for(auto key : keys)
+        {
+            auto [first, last] = container.equal_range(key);
+            found += (first != last);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    bench::reportPerOp(state, count, sizeof(Container::value_type));
+}
+BENCHMARK(BM_MultiSetEqualRange)->Apply(bench::elementSweep);
+
+static void BM_MultiSetIterate(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    Container container;
+    for(auto key : keys)
+        container.insert(key);
+    for(auto _ : state)
+    {
+        std::size_t visited = 0;
+        for(auto &value : container)
+        {
+            benchmark::DoNotOptimize(&value);
+            ++visited;
+        }
+        benchmark::DoNotOptimize(visited);
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(container.size()), sizeof(Container::value_type));
+}
+BENCHMARK(BM_MultiSetIterate)->Apply(bench::elementSweep);
+
+static void BM_MultiSetEraseIf(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        Container container;
+        for(auto key : keys)
+            container.insert(key);
+        state.ResumeTiming();
+        std::erase_if(container, [](auto &value){return (value % 2) == 0;});
+        benchmark::DoNotOptimize(container.size());
+    }
+    bench::reportPerOp(state, count, sizeof(Container::value_type));
+}
+BENCHMARK(BM_MultiSetEraseIf)->Apply(bench::elementSweep);
+
+//Insert/erase churn with std::allocator, monotonic, pool and the thread arena, see bench::insertEraseChurn
+template<typename Resource>
+static void BM_MultiSetInsertEraseResource(benchmark::State& state)
+{
+    using MultiSet = std::multiset<int, std::less<int>, typename Resource::template allocator_type<int>>;
+    bench::insertEraseChurn<MultiSet, Resource>(state, [](MultiSet& set, int val) { set.insert(val); });
+}
+BENCHMARK_MEMORY_RESOURCES(BM_MultiSetInsertEraseResource);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,128 @@
+//flat_map / flat_multimap : sorted vector maps in the style of C++23 <flat_map>.
+//Keys and values are stored together as std::pair<Key, T> in one std::vector, so an in-order walk
+//touches both with a single stream. Changing a key through an iterator breaks the ordering.
+#pragma once
+
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include "FlatTree.h"
+
+namespace practise
+{
+
+template<typename Key, typename T, typename Compare = std::less<Key>>
+class flat_map : public detail::flat_tree<Key, std::pair<Key, T>, detail::SelectFirst, Compare, false>
+{
+    using Base = detail::flat_tree<Key, std::pair<Key, T>, detail::SelectFirst, Compare, false>;
+
+public:
+    using mapped_type = T;
+    using typename Base::iterator;
+    using typename Base::const_iterator;
+
+    using Base::Base;
+    using Base::operator=;
+
+    //element access
+    T& at(const Key& key)
+    {
+        auto it = this->find(key);
+        if(it == this->end())
+            throw std::out_of_range("flat_map::at");
+        return it->second;
+    }
+
+    const T& at(const Key& key) const
+    {
+        auto it = this->find(key);
+        if(it == this->end())
+            throw std::out_of_range("flat_map::at");
+        return it->second;
+    }
+
+    T& operator[](const Key& key) { return try_emplace(key).first->second; }
+    T& operator[](Key&& key) { return try_emplace(std::move(key)).first->second; }
+
+    //modifiers
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        return tryEmplaceAt(this->lowerBound(key), key, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args)
+    {
+        return tryEmplaceAt(this->lowerBound(key), std::move(key), std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    iterator try_emplace(const_iterator, const Key& key, Args&&... args)
+    {
+        return try_emplace(key, std::forward<Args>(args)...).first;
+    }
+
+    template<typename... Args>
+    iterator try_emplace(const_iterator, Key&& key, Args&&... args)
+    {
+        return try_emplace(std::move(key), std::forward<Args>(args)...).first;
+    }
+
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj)
+    {
+        auto [it, inserted] = try_emplace(key, std::forward<M>(obj));
+        if(!inserted)
+            it->second = std::forward<M>(obj);
+        return {it, inserted};
+    }
+
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(Key&& key, M&& obj)
+    {
+        auto [it, inserted] = try_emplace(std::move(key), std::forward<M>(obj));
+        if(!inserted)
+            it->second = std::forward<M>(obj);
+        return {it, inserted};
+    }
+
+    template<typename M>
+    iterator insert_or_assign(const_iterator, const Key& key, M&& obj)
+    {
+        return insert_or_assign(key, std::forward<M>(obj)).first;
+    }
+
+    template<typename M>
+    iterator insert_or_assign(const_iterator, Key&& key, M&& obj)
+    {
+        return insert_or_assign(std::move(key), std::forward<M>(obj)).first;
+    }
+
+private:
+    template<typename K, typename... Args>
+    std::pair<iterator, bool> tryEmplaceAt(iterator pos, K&& key, Args&&... args)
+    {
+        if(pos != this->end() && !this->mComp(key, pos->first))
+            return {pos, false};
+        auto it = this->mData.emplace(pos, std::piecewise_construct,
+                                      std::forward_as_tuple(std::forward<K>(key)),
+                                      std::forward_as_tuple(std::forward<Args>(args)...));
+        return {it, true};
+    }
+};
+
+template<typename Key, typename T, typename Compare = std::less<Key>>
+class flat_multimap : public detail::flat_tree<Key, std::pair<Key, T>, detail::SelectFirst, Compare, true>
+{
+    using Base = detail::flat_tree<Key, std::pair<Key, T>, detail::SelectFirst, Compare, true>;
+
+public:
+    using mapped_type = T;
+
+    using Base::Base;
+    using Base::operator=;
+};
+
+}
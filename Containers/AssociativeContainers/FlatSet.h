@@ -0,0 +1,31 @@
+//flat_set / flat_multiset : sorted vector sets in the style of C++23 <flat_set>.
+//Iterators are always const, the elements are the keys which keep the vector sorted.
+#pragma once
+
+#include <functional>
+#include "FlatTree.h"
+
+namespace practise
+{
+
+template<typename Key, typename Compare = std::less<Key>>
+class flat_set : public detail::flat_tree<Key, Key, detail::Identity, Compare, false>
+{
+    using Base = detail::flat_tree<Key, Key, detail::Identity, Compare, false>;
+
+public:
+    using Base::Base;
+    using Base::operator=;
+};
+
+template<typename Key, typename Compare = std::less<Key>>
+class flat_multiset : public detail::flat_tree<Key, Key, detail::Identity, Compare, true>
+{
+    using Base = detail::flat_tree<Key, Key, detail::Identity, Compare, true>;
+
+public:
+    using Base::Base;
+    using Base::operator=;
+};
+
+}
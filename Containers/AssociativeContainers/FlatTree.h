@@ -0,0 +1,487 @@
+//Sorted vector engine shared by flat_map, flat_multimap, flat_set and flat_multiset.
+//The elements are kept sorted in one contiguous std::vector, lookups are binary searches and
+//iteration is a linear walk over memory, which is what read mostly tables want. Insert and erase
+//shift the tail, so they are O(n) and every iterator is invalidated by them.
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace practise
+{
+
+//Tags for the bulk constructors/insert which take input that is already sorted (as in C++23 <flat_map>)
+struct sorted_unique_t { explicit sorted_unique_t() = default; };
+inline constexpr sorted_unique_t sorted_unique{};
+
+struct sorted_equivalent_t { explicit sorted_equivalent_t() = default; };
+inline constexpr sorted_equivalent_t sorted_equivalent{};
+
+namespace detail
+{
+    struct Identity
+    {
+        template<typename T>
+        const T& operator()(const T& value) const { return value; }
+    };
+
+    struct SelectFirst
+    {
+        template<typename Pair>
+        const auto& operator()(const Pair& value) const { return value.first; }
+    };
+
+    //Multi selects the multimap/multiset behaviour, sets (Key == Value) only hand out const iterators
+    template<typename Key, typename Value, typename KeyOfValue, typename Compare, bool Multi>
+    class flat_tree
+    {
+        static constexpr bool isSet = std::is_same_v<Key, Value>;
+        using sorted_tag = std::conditional_t<Multi, sorted_equivalent_t, sorted_unique_t>;
+
+    public:
+        using key_type = Key;
+        using value_type = Value;
+        using key_compare = Compare;
+        using container_type = std::vector<Value>;
+        using size_type = typename container_type::size_type;
+        using difference_type = typename container_type::difference_type;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using const_iterator = typename container_type::const_iterator;
+        using iterator = std::conditional_t<isSet, const_iterator, typename container_type::iterator>;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        //Compares two elements by their keys
+        class value_compare
+        {
+        public:
+            bool operator()(const Value& lhs, const Value& rhs) const { return mComp(KeyOfValue()(lhs), KeyOfValue()(rhs)); }
+
+        protected:
+            friend class flat_tree;
+            explicit value_compare(Compare comp) : mComp(comp) {}
+            Compare mComp;
+        };
+
+        //The element is moved out of the vector into the handle
+        class node_type
+        {
+            friend class flat_tree;
+
+        public:
+            node_type() = default;
+
+            [[nodiscard]] bool empty() const { return !mValue.has_value(); }
+            explicit operator bool() const { return mValue.has_value(); }
+
+            Value& value() const requires isSet { return *mValue; }
+            auto& key() const requires (!isSet) { return mValue->first; }
+            auto& mapped() const requires (!isSet) { return mValue->second; }
+
+        private:
+            mutable std::optional<Value> mValue;
+        };
+
+        struct insert_return_type
+        {
+            iterator position;
+            bool inserted;
+            node_type node;
+        };
+
+        //constructors
+        flat_tree() = default;
+
+        explicit flat_tree(const Compare& comp) : mComp(comp) {}
+
+        template<std::input_iterator InputIt>
+        flat_tree(InputIt first, InputIt last, const Compare& comp = Compare())
+            : mData(first, last), mComp(comp)
+        {
+            sortAndDeduplicate(0);
+        }
+
+        flat_tree(std::initializer_list<Value> init, const Compare& comp = Compare())
+            : mData(init), mComp(comp)
+        {
+            sortAndDeduplicate(0);
+        }
+
+        //Takes over the container, sorting (and for unique keys deduplicating) it once
+        explicit flat_tree(container_type values, const Compare& comp = Compare())
+            : mData(std::move(values)), mComp(comp)
+        {
+            sortAndDeduplicate(0);
+        }
+
+        //Bulk load from input which is already sorted by comp, no sorting pass at all
+        flat_tree(sorted_tag, container_type values, const Compare& comp = Compare())
+            : mData(std::move(values)), mComp(comp) {}
+
+        template<std::input_iterator InputIt>
+        flat_tree(sorted_tag, InputIt first, InputIt last, const Compare& comp = Compare())
+            : mData(first, last), mComp(comp) {}
+
+        flat_tree& operator=(std::initializer_list<Value> init)
+        {
+            mData.clear();
+            insert(init.begin(), init.end());
+            return *this;
+        }
+
+        //iterators
+        iterator begin() noexcept { return mData.begin(); }
+        const_iterator begin() const noexcept { return mData.begin(); }
+        const_iterator cbegin() const noexcept { return mData.cbegin(); }
+
+        iterator end() noexcept { return mData.end(); }
+        const_iterator end() const noexcept { return mData.end(); }
+        const_iterator cend() const noexcept { return mData.cend(); }
+
+        reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(cend()); }
+
+        reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+        const_reverse_iterator crend() const noexcept { return const_reverse_iterator(cbegin()); }
+
+        //capacity
+        [[nodiscard]] bool empty() const noexcept { return mData.empty(); }
+        size_type size() const noexcept { return mData.size(); }
+        size_type max_size() const noexcept { return mData.max_size(); }
+        size_type capacity() const noexcept { return mData.capacity(); }
+        void reserve(size_type count) { mData.reserve(count); }
+        void shrink_to_fit() { mData.shrink_to_fit(); }
+
+        //modifiers
+        void clear() noexcept { mData.clear(); }
+
+        auto insert(const Value& value) { return emplace(value); }
+        auto insert(Value&& value) { return emplace(std::move(value)); }
+
+        template<typename P> requires (!isSet && std::is_constructible_v<Value, P&&>)
+        auto insert(P&& value) { return emplace(std::forward<P>(value)); }
+
+        iterator insert(const_iterator hint, const Value& value) { return emplace_hint(hint, value); }
+        iterator insert(const_iterator hint, Value&& value) { return emplace_hint(hint, std::move(value)); }
+
+        template<typename P> requires (!isSet && std::is_constructible_v<Value, P&&>)
+        iterator insert(const_iterator hint, P&& value) { return emplace_hint(hint, std::forward<P>(value)); }
+
+        //Bulk insert: append, sort only the new tail and merge it in, instead of one shift per element
+        template<std::input_iterator InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            const auto oldSize = mData.size();
+            mData.insert(mData.end(), first, last);
+            sortAndDeduplicate(oldSize);
+        }
+
+        template<std::input_iterator InputIt>
+        void insert(sorted_tag, InputIt first, InputIt last)
+        {
+            const auto oldSize = mData.size();
+            mData.insert(mData.end(), first, last);
+            mergeAndDeduplicate(oldSize);
+        }
+
+        void insert(std::initializer_list<Value> init) { insert(init.begin(), init.end()); }
+
+        auto insert(node_type&& node)
+        {
+            if constexpr(Multi)
+            {
+                if(node.empty())
+                    return end();
+                auto it = emplace(std::move(*node.mValue));
+                node.mValue.reset();
+                return it;
+            }
+            else
+            {
+                if(node.empty())
+                    return insert_return_type{end(), false, node_type()};
+                auto pos = lowerBound(keyOf(*node.mValue));
+                if(pos != mData.end() && !mComp(keyOf(*node.mValue), keyOf(*pos)))
+                    return insert_return_type{pos, false, std::move(node)};
+                auto it = mData.insert(pos, std::move(*node.mValue));
+                node.mValue.reset();
+                return insert_return_type{it, true, node_type()};
+            }
+        }
+
+        iterator insert(const_iterator, node_type&& node)
+        {
+            if constexpr(Multi)
+                return insert(std::move(node));
+            else
+                return insert(std::move(node)).position;
+        }
+
+        //multi: returns iterator, unique: returns pair<iterator, bool>
+        template<typename... Args>
+        auto emplace(Args&&... args)
+        {
+            Value value(std::forward<Args>(args)...);
+            if constexpr(Multi)
+            {
+                return iterator(mData.insert(upperBound(keyOf(value)), std::move(value)));
+            }
+            else
+            {
+                auto pos = lowerBound(keyOf(value));
+                if(pos != mData.end() && !mComp(keyOf(value), keyOf(*pos)))
+                    return std::pair<iterator, bool>(pos, false);
+                return std::pair<iterator, bool>(mData.insert(pos, std::move(value)), true);
+            }
+        }
+
+        //A correct hint (value goes right before hint) saves the binary search
+        template<typename... Args>
+        iterator emplace_hint(const_iterator hint, Args&&... args)
+        {
+            Value value(std::forward<Args>(args)...);
+            const auto& key = keyOf(value);
+            const bool afterPrev = hint == mData.cbegin() || (Multi ? !mComp(key, keyOf(*std::prev(hint)))
+                                                                    : mComp(keyOf(*std::prev(hint)), key));
+            const bool beforeHint = hint == mData.cend() || (Multi ? !mComp(keyOf(*hint), key)
+                                                                   : mComp(key, keyOf(*hint)));
+            if(afterPrev && beforeHint)
+                return mData.insert(hint, std::move(value));
+            if constexpr(Multi)
+                return emplace(std::move(value));
+            else
+                return emplace(std::move(value)).first;
+        }
+
+        iterator erase(iterator pos) { return mData.erase(pos); }
+
+        iterator erase(const_iterator pos) requires (!isSet) { return mData.erase(pos); }
+
+        iterator erase(const_iterator first, const_iterator last) { return mData.erase(first, last); }
+
+        size_type erase(const Key& key)
+        {
+            auto [first, last] = equal_range(key);
+            const auto count = static_cast<size_type>(std::distance(first, last));
+            mData.erase(first, last);
+            return count;
+        }
+
+        void swap(flat_tree& other) noexcept
+        {
+            using std::swap;
+            swap(mData, other.mData);
+            swap(mComp, other.mComp);
+        }
+
+        node_type extract(const_iterator pos)
+        {
+            node_type node;
+            auto it = mData.begin() + (pos - mData.cbegin());
+            node.mValue.emplace(std::move(*it));
+            mData.erase(it);
+            return node;
+        }
+
+        node_type extract(const Key& key)
+        {
+            auto it = find(key);
+            return it == end() ? node_type() : extract(const_iterator(it));
+        }
+
+        //Hands the whole sorted container out, the flat_tree is left empty (C++23 flat_map::extract)
+        container_type extract() &&
+        {
+            return std::exchange(mData, container_type());
+        }
+
+        //Replaces the elements with a container which must already be sorted (and unique for maps/sets)
+        void replace(container_type&& values)
+        {
+            mData = std::move(values);
+        }
+
+        //Moves every element that can be inserted out of source, one merge pass over both vectors. For unique
+        //keys the source is visited in key order (stably, so the first of equivalent source elements wins) and an
+        //element stays in source when its key is already here or was taken from an earlier source element.
+        template<typename Compare2, bool Multi2>
+        void merge(flat_tree<Key, Value, KeyOfValue, Compare2, Multi2>& source)
+        {
+            const auto oldSize = mData.size();
+            if constexpr(Multi)
+            {
+                std::move(source.mData.begin(), source.mData.end(), std::back_inserter(mData));
+                source.mData.clear();
+                sortAndDeduplicate(oldSize);
+            }
+            else
+            {
+                auto& values = source.mData;
+                std::vector<size_type> order(values.size());
+                std::iota(order.begin(), order.end(), size_type{0});
+                std::stable_sort(order.begin(), order.end(), [&](size_type lhs, size_type rhs){
+                    return mComp(keyOf(values[lhs]), keyOf(values[rhs]));
+                });
+
+                const auto oldEnd = mData.begin() + static_cast<difference_type>(oldSize);
+                std::vector<bool> taken(values.size());
+                for(size_type i = 0; i < order.size(); ++i)
+                {
+                    const auto& value = values[order[i]];
+                    if(i > 0 && !mComp(keyOf(values[order[i - 1]]), keyOf(value)))
+                        continue;
+                    auto pos = std::lower_bound(mData.begin(), oldEnd, value, value_comp());
+                    taken[order[i]] = pos == oldEnd || mComp(keyOf(value), keyOf(*pos));
+                }
+
+                //Taken elements are appended in key order, so one inplace_merge sorts them in
+                for(auto index : order)
+                    if(taken[index])
+                        mData.push_back(std::move(values[index]));
+                typename flat_tree<Key, Value, KeyOfValue, Compare2, Multi2>::container_type leftOver;
+                for(size_type i = 0; i < values.size(); ++i)
+                    if(!taken[i])
+                        leftOver.push_back(std::move(values[i]));
+                values = std::move(leftOver);
+                mergeAndDeduplicate(oldSize);
+            }
+        }
+
+        template<typename Compare2, bool Multi2>
+        void merge(flat_tree<Key, Value, KeyOfValue, Compare2, Multi2>&& source)
+        {
+            merge(source);
+        }
+
+        //lookup
+        size_type count(const Key& key) const
+        {
+            if constexpr(Multi)
+            {
+                auto [first, last] = equal_range(key);
+                return static_cast<size_type>(std::distance(first, last));
+            }
+            else
+            {
+                return contains(key) ? 1 : 0;
+            }
+        }
+
+        iterator find(const Key& key)
+        {
+            auto it = lowerBound(key);
+            return (it != mData.end() && !mComp(key, keyOf(*it))) ? iterator(it) : end();
+        }
+
+        const_iterator find(const Key& key) const
+        {
+            return const_cast<flat_tree*>(this)->find(key);
+        }
+
+        bool contains(const Key& key) const { return find(key) != end(); }
+
+        iterator lower_bound(const Key& key) { return lowerBound(key); }
+        const_iterator lower_bound(const Key& key) const { return const_cast<flat_tree*>(this)->lowerBound(key); }
+
+        iterator upper_bound(const Key& key) { return upperBound(key); }
+        const_iterator upper_bound(const Key& key) const { return const_cast<flat_tree*>(this)->upperBound(key); }
+
+        std::pair<iterator, iterator> equal_range(const Key& key)
+        {
+            auto first = lowerBound(key);
+            if constexpr(Multi)
+                return {first, std::partition_point(first, mData.end(), [&](const Value& value){ return !mComp(key, keyOf(value)); })};
+            else
+                return {first, (first != mData.end() && !mComp(key, keyOf(*first))) ? std::next(first) : first};
+        }
+
+        std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+        {
+            return const_cast<flat_tree*>(this)->equal_range(key);
+        }
+
+        //observers
+        key_compare key_comp() const { return mComp; }
+        value_compare value_comp() const { return value_compare(mComp); }
+
+        //non member functions
+        friend bool operator==(const flat_tree& lhs, const flat_tree& rhs)
+        {
+            return lhs.mData == rhs.mData;
+        }
+
+        friend auto operator<=>(const flat_tree& lhs, const flat_tree& rhs)
+        {
+            return std::lexicographical_compare_three_way(lhs.mData.begin(), lhs.mData.end(),
+                                                          rhs.mData.begin(), rhs.mData.end());
+        }
+
+        friend void swap(flat_tree& lhs, flat_tree& rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+        //std::erase_if counterpart, found through ADL
+        template<typename Pred>
+        friend size_type erase_if(flat_tree& tree, Pred pred)
+        {
+            const auto oldSize = tree.mData.size();
+            tree.mData.erase(std::remove_if(tree.mData.begin(), tree.mData.end(), pred), tree.mData.end());
+            return oldSize - tree.mData.size();
+        }
+
+    protected:
+        template<typename, typename, typename, typename, bool>
+        friend class flat_tree;
+
+        static const Key& keyOf(const Value& value) { return KeyOfValue()(value); }
+
+        typename container_type::iterator lowerBound(const Key& key)
+        {
+            return std::partition_point(mData.begin(), mData.end(), [&](const Value& value){ return mComp(keyOf(value), key); });
+        }
+
+        typename container_type::iterator upperBound(const Key& key)
+        {
+            return std::partition_point(mData.begin(), mData.end(), [&](const Value& value){ return !mComp(key, keyOf(value)); });
+        }
+
+        //[0, sortedSize) is sorted, the tail is not. Stable sorting keeps the insertion order of equivalent
+        //keys and makes the already present element win over a new duplicate.
+        void sortAndDeduplicate(size_type sortedSize)
+        {
+            std::stable_sort(mData.begin() + static_cast<difference_type>(sortedSize), mData.end(), value_comp());
+            mergeAndDeduplicate(sortedSize);
+        }
+
+        void mergeAndDeduplicate(size_type sortedSize)
+        {
+            std::inplace_merge(mData.begin(), mData.begin() + static_cast<difference_type>(sortedSize), mData.end(), value_comp());
+            if constexpr(!Multi)
+            {
+                auto newEnd = std::unique(mData.begin(), mData.end(), [&](const Value& lhs, const Value& rhs){
+                    return !mComp(keyOf(lhs), keyOf(rhs));
+                });
+                mData.erase(newEnd, mData.end());
+            }
+        }
+
+        container_type mData;
+        [[no_unique_address]] Compare mComp{};
+    };
+}
+
+}
@@ -0,0 +1,517 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <array>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include "BTreeMap.h"
+
+//Same scenarios as TestMap.cpp run against the B+-tree btree_map, plus bulk loading, range scans and
+//random operations checked against std::map on trees small enough nodes to be several levels deep
+
+//btree_map stores pair<Key,T> while std::map stores pair<const Key,T>, and the two pairs are not comparable with ==
+struct SameEntry
+{
+    template<typename Lhs, typename Rhs>
+    bool operator()(const Lhs& lhs, const Rhs& rhs) const { return lhs.first == rhs.first && lhs.second == rhs.second; }
+};
+
+template<typename Range1, typename Range2, typename Pred = SameEntry>
+bool sameElements(const Range1& lhs, const Range2& rhs, Pred pred = {})
+{
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), pred);
+}
+
+//64 byte nodes: 5 pairs of ints per leaf and 4 keys per inner node
+template<typename Key, typename T>
+using SmallNodeMap = practise::btree_map<Key, T, std::less<Key>, 64>;
+
+TEST(BTreeMap, MemberFunctions)
+{
+    practise::btree_map<int, std::string> map;
+    EXPECT_TRUE(map.empty());
+
+    auto cmp = [](const int a, const int b) { return a > b; };
+    practise::btree_map<int,std::string,decltype(cmp)> map1;
+    EXPECT_TRUE(map1.empty());
+
+    std::array<std::pair<int,std::string>, 4> initialValues{{{49,"Germany"},{91,"India"},{36,"Hungary"},{33,"France"}}};
+    practise::btree_map<int, std::string> map2(initialValues.begin(), initialValues.end());
+    EXPECT_EQ(map2.size(),4);
+
+    std::map<int, std::string> expected{{49,"Germany"},{91,"India"},{36,"Hungary"},{33,"France"}};
+    EXPECT_TRUE(sameElements(map2,expected));
+
+    practise::btree_map<int, std::string> map3(map2);
+    EXPECT_TRUE(sameElements(map3,expected));
+    practise::btree_map<int, std::string> map4(std::move(map3));
+    EXPECT_TRUE(sameElements(map4,expected));
+
+    practise::btree_map<int, std::string> map5{{12,"John"},{22,"Sven"},{33,"White"}};
+    EXPECT_TRUE(sameElements(map5,(std::map<int,std::string>{{12,"John"},{22,"Sven"},{33,"White"}})));
+
+    //use custom comparator to sort keys in descending order
+    practise::btree_map<int,std::string,decltype(cmp)> map6{{1,"are"},{-2,"you"},{20,"Hi"},{11,"how"}};
+    EXPECT_TRUE(sameElements(map6,(std::map<int,std::string,decltype(cmp)>{{20,"Hi"},{11,"how"},{1,"are"},{-2,"you"}})));
+
+    //= operator
+    map = map2;
+    EXPECT_TRUE(sameElements(map,expected));
+
+    map1 = std::move(map6);
+    EXPECT_TRUE(sameElements(map1,(std::map<int,std::string,decltype(cmp)>{{20,"Hi"},{11,"how"},{1,"are"},{-2,"you"}})));
+
+    const auto initList = { std::pair<const int, int>{4,4}, {5,5}, {6,6}, {7,7} };
+    practise::btree_map<int, int> map7(initList.begin(), initList.end());
+    EXPECT_TRUE(sameElements(map7,(std::map<const int, int>{{4,4}, {5,5}, {6,6}, {7,7}})));
+}
+
+TEST(BTreeMap, BulkLoad)
+{
+    //Unsorted input with duplicates: sorted once, the first of the duplicate keys is kept
+    std::vector<std::pair<int,char>> values{{3,'c'},{1,'a'},{2,'b'},{1,'z'}};
+    practise::btree_map<int,char> map(values.begin(), values.end());
+    EXPECT_TRUE(sameElements(map,(std::map<int,char>{{1,'a'},{2,'b'},{3,'c'}})));
+
+    //Sorted input fills the leaves in one pass, at every size the levels stay balanced
+    for(int count : {0, 1, 5, 6, 25, 26, 1000, 12345})
+    {
+        std::vector<std::pair<int,int>> sortedValues;
+        for(int i = 0; i < count; ++i)
+            sortedValues.emplace_back(2 * i, i);
+        SmallNodeMap<int,int> sortedMap(practise::sorted_unique, sortedValues.begin(), sortedValues.end());
+        ASSERT_EQ(sortedMap.size(),static_cast<std::size_t>(count));
+        ASSERT_TRUE(sameElements(sortedMap,sortedValues));
+        for(int i = 0; i < count; ++i)
+        {
+            ASSERT_EQ(sortedMap.at(2 * i),i);
+            ASSERT_FALSE(sortedMap.contains(2 * i + 1));
+        }
+
+        //Inserts and erases keep working on the packed leaves
+        for(int i = 0; i < count; i += 3)
+            sortedMap.insert({2 * i + 1, -i});
+        for(int i = 0; i < count; i += 2)
+            sortedMap.erase(2 * i);
+        std::map<int,int> expected;
+        for(int i = 0; i < count; ++i)
+        {
+            if(i % 3 == 0)
+                expected.emplace(2 * i + 1, -i);
+            if(i % 2 != 0)
+                expected.emplace(2 * i, i);
+        }
+        ASSERT_TRUE(sameElements(sortedMap,expected)) << count;
+    }
+
+    //Depth grows with the log of the size
+    SmallNodeMap<int,int> deep;
+    for(int i = 0; i < 10000; ++i)
+        deep.emplace(i, i);
+    EXPECT_GE(deep.depth(),5);
+    EXPECT_LE(deep.depth(),9);
+    deep.clear();
+    EXPECT_EQ(deep.depth(),0);
+}
+
+TEST(BTreeMap, ElementAccess)
+{
+    practise::btree_map<int, char> map{{1,'a'},{4,'b'},{2,'c'},{3,'d'}};
+
+    EXPECT_EQ(map.at(4),'b');
+    EXPECT_EQ(map.at(2),'c');
+    EXPECT_THROW(map.at(9), std::out_of_range);
+
+    EXPECT_EQ(map[1],'a');
+    EXPECT_EQ(map[3],'d');
+
+    map[1] = 'e';
+    map[3] = 'f';
+
+    EXPECT_EQ(map[1],'e');
+    EXPECT_EQ(map[3],'f');
+}
+
+TEST(BTreeMap, Iterators)
+{
+    practise::btree_map<int, char> map{{1,'a'},{4,'b'},{2,'c'},{3,'d'}};
+
+    //The map after sorting would look like {1,'a'},{2,'c'},{3,'d'},{4,'b'}
+    EXPECT_EQ(map.begin()->second,'a');
+    EXPECT_EQ((--map.end())->second,'b');
+
+    auto it = map.begin();
+    std::advance(it, 2);
+    EXPECT_EQ(it->first,3);
+    EXPECT_EQ(it->second,'d');
+    it++;
+    EXPECT_EQ(it->first,4);
+    EXPECT_EQ(it->second,'b');
+
+    EXPECT_EQ(map.rbegin()->first,4);
+    EXPECT_EQ(map.rbegin()->second,'b');
+
+    EXPECT_EQ((--map.rend())->first,1);
+    EXPECT_EQ((--map.rend())->second,'a');
+
+    auto it2 = map.rend();
+    std::advance(it2,-3);
+    EXPECT_EQ(it2->first,3);
+    EXPECT_EQ(it2->second,'d');
+
+    //Across many leaves, both directions
+    SmallNodeMap<int,int> large;
+    for(int i = 999; i >= 0; --i)
+        large.emplace(i, i);
+    int expected = 0;
+    for(auto cit = large.cbegin(); cit != large.cend(); ++cit)
+        EXPECT_EQ(cit->first,expected++);
+    for(auto rit = large.rbegin(); rit != large.rend(); ++rit)
+        EXPECT_EQ(rit->first,--expected);
+    EXPECT_EQ(std::distance(large.begin(),large.end()),1000);
+}
+
+TEST(BTreeMap, Capacity)
+{
+    practise::btree_map<std::string, std::vector<int>> map;
+    EXPECT_TRUE(map.empty());
+
+    map = {{"First",{1,2,3}},{"Second",{2,3,4}}};
+    EXPECT_EQ(map.size(),2);
+}
+
+TEST(BTreeMap, Modifiers)
+{
+    practise::btree_map<int, std::vector<int>> map{{1,{1,2,3}},{3,{2,3,4}}};
+    EXPECT_EQ(map.size(),2);
+    EXPECT_FALSE(map.empty());
+
+    map.clear();
+    EXPECT_EQ(map.size(),0);
+    EXPECT_TRUE(map.empty());
+
+    //rvalue
+    map.insert({2,{1,4,5}});
+    map.insert({1,{1,2,3}});
+    map.insert({3,{2,3,4}});
+    std::map<int, std::vector<int>> expectedMap{{1,{1,2,3}},{2,{1,4,5}},{3,{2,3,4}}};
+    EXPECT_TRUE(sameElements(map,expectedMap));
+
+    //lvalue
+    std::pair<int,std::vector<int>> val{5,{2,4,5}};
+    map.insert(val);
+    std::map<int, std::vector<int>> expectedMap1{{1,{1,2,3}},{2,{1,4,5}},{3,{2,3,4}},{5,{2,4,5}}};
+    EXPECT_TRUE(sameElements(map,expectedMap1));
+
+    //rvalue with emplace
+    map.insert(std::pair<int,std::vector<int>>{7,{2,4,5}});
+    std::map<int, std::vector<int>> expectedMap2{{1,{1,2,3}},{2,{1,4,5}},{3,{2,3,4}},{5,{2,4,5}},{7,{2,4,5}}};
+    EXPECT_TRUE(sameElements(map,expectedMap2));
+
+    //Same lvalue, rvalue and emplace with position insertion
+    practise::btree_map<int,char> map1{{1,'a'},{4,'b'}};
+    map1.insert(++map1.begin(),{2,'c'});
+
+    auto it = map1.begin();
+    it++;
+    map1.insert(it, std::pair<int,char>{7,'e'});
+
+    it = map1.find(4);
+    std::pair<int,char> val2{3,'f'};
+    map1.insert(it,val2);
+    std::map<int,char> expectedMap3{{1,'a'},{2,'c'},{3,'f'},{4,'b'},{7,'e'}};
+    EXPECT_TRUE(sameElements(map1,expectedMap3));
+
+    //range insertion
+    practise::btree_map<int,char> map2;
+    map2.insert(map1.find(2),map1.find(4));
+    std::map<int,char> expectedMap4{{2,'c'},{3,'f'}};
+    EXPECT_TRUE(sameElements(map2,expectedMap4));
+
+    map2.insert({{1,'a'},{5,'o'}});
+    std::map<int,char> expectedMap5{{1,'a'},{2,'c'},{3,'f'},{5,'o'}};
+    EXPECT_TRUE(sameElements(map2,expectedMap5));
+
+    //node_type insertion
+    auto it1 = map1.begin();
+    std::advance(it1,3);
+    auto node = map1.extract(it1);
+    map2.insert(std::move(node));
+    map2.insert(map1.extract(7));
+    std::map<int,char> expectedMap6{{1,'a'},{2,'c'},{3,'f'},{4,'b'},{5,'o'},{7,'e'}};
+    EXPECT_TRUE(sameElements(map2,expectedMap6));
+
+    //A node with a key already present is handed back
+    auto duplicate = map1.extract(1);
+    auto result = map2.insert(std::move(duplicate));
+    EXPECT_FALSE(result.inserted);
+    EXPECT_EQ(result.node.key(),1);
+    EXPECT_EQ(result.position->second,'a');
+
+    //insert_or_assign
+    map2.insert_or_assign(1,'s');
+    map2.insert_or_assign(++map2.begin(),2,'h');
+    std::map<int,char> expectedMap7{{1,'s'},{2,'h'},{3,'f'},{4,'b'},{5,'o'},{7,'e'}};
+    EXPECT_TRUE(sameElements(map2,expectedMap7));
+
+    //emplace
+    class TestConstructor
+    {
+        public:
+            TestConstructor(int val): m_Value(val){};
+            ~TestConstructor() = default;
+
+            int getValue () const{return m_Value;}
+        protected:
+            int m_Value = 0;
+    };
+
+    practise::btree_map<int, TestConstructor> cMap;
+    cMap.emplace(1,11);
+    cMap.emplace(2,22);
+    cMap.emplace(3,33);
+
+    auto compare = [](const auto &obj1, const auto &obj2){ return (obj1.first == obj2.first) && (obj1.second.getValue() == obj2.second.getValue());};
+    std::map<int,TestConstructor> expectedMap8{{1,11},{2,22},{3,33}};
+    EXPECT_TRUE(sameElements(cMap,expectedMap8,compare));
+
+    //Just inserts to the nearest possible iterator position
+    cMap.emplace_hint(cMap.begin(),4,44);
+    cMap.emplace_hint(cMap.begin(),-1,-11);
+    std::map<int,TestConstructor> expectedMap9{{-1,-11},{1,11},{2,22},{3,33},{4,44}};
+    EXPECT_TRUE(sameElements(cMap,expectedMap9,compare));
+
+    //try_emplace does nothing if the key is already present.
+    cMap.try_emplace(3,33);
+    cMap.try_emplace(7,77);
+    cMap.try_emplace(cMap.end(),8,88);
+    std::map<int,TestConstructor> expectedMap10{{-1,-11},{1,11},{2,22},{3,33},{4,44},{7,77},{8,88}};
+    EXPECT_TRUE(sameElements(cMap,expectedMap10,compare));
+
+    cMap.erase(cMap.begin());
+    std::map<int,TestConstructor> expectedMap11{{1,11},{2,22},{3,33},{4,44},{7,77},{8,88}};
+    EXPECT_TRUE(sameElements(cMap,expectedMap11,compare));
+
+    auto cIt = cMap.begin();
+    std::advance(cIt,3);
+    cMap.erase(cMap.begin(),cIt);
+    std::map<int,TestConstructor> expectedMap12{{4,44},{7,77},{8,88}};
+    EXPECT_TRUE(sameElements(cMap,expectedMap12,compare));
+
+    //swap
+    practise::btree_map<int, TestConstructor> cMap1{{-1,11},{-2,22}};
+    cMap1.swap(cMap);
+    std::map<int,TestConstructor> expectedMap13{{-2,22},{-1,11}};
+    EXPECT_TRUE(sameElements(cMap1,expectedMap12,compare));
+    EXPECT_TRUE(sameElements(cMap,expectedMap13,compare));
+
+    //extract
+    auto node2 = cMap1.extract(4);
+    node2.key() = 5;
+    node2.mapped() = 33;
+    cMap1.insert(std::move(node2));
+    std::map<int,TestConstructor> expectedMap14{{5,33},{7,77},{8,88}};
+    EXPECT_TRUE(sameElements(cMap1,expectedMap14,compare));
+
+    //merge
+    cMap1.merge(cMap);
+    std::map<int,TestConstructor> expectedMap15{{-2,22},{-1,11},{5,33},{7,77},{8,88}};
+    EXPECT_TRUE(sameElements(cMap1,expectedMap15,compare));
+    EXPECT_TRUE(cMap.empty());
+
+    //merge leaves the keys already present in the source, also between node sizes
+    SmallNodeMap<int,char> source{{1,'x'},{2,'y'},{9,'z'}};
+    practise::btree_map<int,char> target{{1,'a'},{3,'c'}};
+    target.merge(source);
+    EXPECT_TRUE(sameElements(target,(std::map<int,char>{{1,'a'},{2,'y'},{3,'c'},{9,'z'}})));
+    EXPECT_TRUE(sameElements(source,(std::map<int,char>{{1,'x'}})));
+}
+
+TEST(BTreeMap, LookUp)
+{
+    practise::btree_map<int,char> map;
+    map.insert({{1,'a'},{3,'b'},{2,'c'}});
+    EXPECT_EQ(map.count(3),1);
+
+    auto foundElement = map.find(2);
+    EXPECT_EQ(foundElement->first,2);
+    EXPECT_EQ(foundElement->second,'c');
+
+    EXPECT_TRUE(map.contains(1));
+    EXPECT_FALSE(map.contains(7));
+
+    map.insert({4,'d'});
+    auto [it1,it2] = map.equal_range(2);
+    EXPECT_EQ(it1->first,2);
+    EXPECT_EQ(it1->second,'c');
+    EXPECT_EQ(it2->first,3);
+    EXPECT_EQ(it2->second,'b');
+
+    auto lIt = map.lower_bound(1);
+    EXPECT_EQ(lIt->first,1);
+    EXPECT_EQ(lIt->second,'a');
+
+    map.insert({8,'f'});
+    auto uIt = map.upper_bound(4);
+    EXPECT_EQ(uIt->first,8);
+    EXPECT_EQ(uIt->second,'f');
+
+    EXPECT_EQ(map.lower_bound(9),map.end());
+    EXPECT_EQ(map.upper_bound(8),map.end());
+}
+
+//lower_bound/upper_bound/equal_range against std::map on a deep tree, then walking the range in between
+TEST(BTreeMap, RangeScan)
+{
+    std::mt19937 gen{5};
+    std::map<int,int> expected;
+    SmallNodeMap<int,int> map;
+    for(int i = 0; i < 5000; ++i)
+    {
+        const int key = static_cast<int>(gen() % 20000);
+        expected.emplace(key, i);
+        map.emplace(key, i);
+    }
+    for(int round = 0; round < 2000; ++round)
+    {
+        int low = static_cast<int>(gen() % 20100) - 50;
+        int high = low + static_cast<int>(gen() % 200);
+        auto first = map.lower_bound(low);
+        auto last = map.upper_bound(high);
+        ASSERT_TRUE(std::equal(first, last, expected.lower_bound(low), expected.upper_bound(high), SameEntry()));
+
+        auto [rangeFirst, rangeLast] = map.equal_range(low);
+        ASSERT_EQ(std::distance(rangeFirst, rangeLast),static_cast<std::ptrdiff_t>(expected.count(low)));
+        ASSERT_EQ(rangeFirst == map.end(),expected.lower_bound(low) == expected.end());
+    }
+}
+
+//Random inserts, erases, extracts and lookups with std::string keys compared against std::map
+TEST(BTreeMap, MatchesStdMap)
+{
+    std::mt19937 gen{17};
+    std::map<std::string,int> expected;
+    SmallNodeMap<std::string,int> map;
+    auto key = [&]{ return "key" + std::to_string(gen() % 3000); };
+    for(int round = 0; round < 60000; ++round)
+    {
+        const auto k = key();
+        switch(gen() % 6)
+        {
+            case 0:
+            case 1:
+                ASSERT_EQ(map.try_emplace(k, round).second,expected.try_emplace(k, round).second);
+                break;
+            case 2:
+                ASSERT_EQ(map.erase(k),expected.erase(k));
+                break;
+            case 3:
+            {
+                //Erase through an iterator, the returned iterator is the next element
+                auto it = map.lower_bound(k);
+                auto expectedIt = expected.lower_bound(k);
+                ASSERT_EQ(it == map.end(),expectedIt == expected.end());
+                if(it == map.end())
+                    break;
+                it = map.erase(it);
+                expectedIt = expected.erase(expectedIt);
+                ASSERT_EQ(it == map.end(),expectedIt == expected.end());
+                if(it != map.end())
+                {
+                    ASSERT_EQ(it->first,expectedIt->first);
+                }
+                break;
+            }
+            case 4:
+            {
+                auto node = map.extract(k);
+                ASSERT_EQ(static_cast<bool>(node),expected.erase(k) == 1);
+                break;
+            }
+            default:
+            {
+                auto it = map.find(k);
+                auto expectedIt = expected.find(k);
+                ASSERT_EQ(it == map.end(),expectedIt == expected.end());
+                if(it != map.end())
+                {
+                    ASSERT_EQ(it->second,expectedIt->second);
+                }
+                break;
+            }
+        }
+        ASSERT_EQ(map.size(),expected.size());
+        if(round % 5000 == 0)
+        {
+            ASSERT_TRUE(sameElements(map,expected));
+        }
+    }
+    ASSERT_TRUE(sameElements(map,expected));
+
+    //Range erase down to nothing and back
+    auto first = map.lower_bound("key1");
+    auto last = map.lower_bound("key2");
+    map.erase(first, last);
+    expected.erase(expected.lower_bound("key1"), expected.lower_bound("key2"));
+    ASSERT_TRUE(sameElements(map,expected));
+    map.erase(map.begin(), map.end());
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(),map.end());
+    map.emplace("again", 1);
+    EXPECT_EQ(map.size(),1);
+}
+
+TEST(BTreeMap, Observers)
+{
+    practise::btree_map<int,char> map{{1,'a'},{2,'b'},{4,'c'},{5,'e'}};
+
+    auto keyCompFunc = map.key_comp();
+
+    EXPECT_TRUE(keyCompFunc(1,4));
+    EXPECT_FALSE(keyCompFunc(4,1));
+
+    auto valueCompareFunc = map.value_comp();
+    const std::pair<int,char> p1 = {2,'b'};
+    const std::pair<int,char> p2 = {-1,'e'};
+
+    auto it = map.begin();
+    EXPECT_TRUE(valueCompareFunc(*it,p1));
+    EXPECT_FALSE(valueCompareFunc(*it,p2));
+}
+
+TEST(BTreeMap, NonMemberFunctions)
+{
+    practise::btree_map<int,char> map1{{1,'a'},{2,'b'},{3,'c'},{4,'d'}};
+    practise::btree_map<int,char> map2{{1,'a'},{2,'b'},{3,'c'},{4,'d'},{5,'f'}};
+    practise::btree_map<int,char> map3{{1,'a'},{2,'b'},{3,'c'},{4,'d'}};
+
+    EXPECT_TRUE(map1==map3);
+    EXPECT_FALSE(map1==map2);
+
+    EXPECT_TRUE(map1 < map2);
+    EXPECT_TRUE(map2 > map1);
+
+    EXPECT_TRUE(map1 <= map2);
+    EXPECT_TRUE(map2 >= map1);
+
+    std::swap(map1, map2);
+    std::map<int,char> expected1{{1,'a'},{2,'b'},{3,'c'},{4,'d'},{5,'f'}};
+    std::map<int,char> expected2{{1,'a'},{2,'b'},{3,'c'},{4,'d'}};
+
+    EXPECT_TRUE(sameElements(map1,expected1));
+    EXPECT_TRUE(sameElements(map2,expected2));
+
+    //The map3 would have values of {1,'a'},{2,'b'},{3,'c'},{4,'d'}
+    //Now delete all keys with even numbers by using predicate
+    std::map<int,char> expected3{{1,'a'},{3,'c'}};
+    auto deleteEvenKeysNode = [](const std::pair<int,char>& key){return (key.first % 2 ) == 0;};
+    EXPECT_EQ(erase_if(map3, deleteEvenKeysNode),2);
+    EXPECT_TRUE(sameElements(map3,expected3));
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,546 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+#include "FlatMap.h"
+
+//Same scenarios as TestMap.cpp and TestMultiMap.cpp, run against the sorted vector flat_map/flat_multimap
+
+//flat maps store pair<Key,T> while std::map stores pair<const Key,T>, and the two pairs are not comparable with ==
+struct SameEntry
+{
+    template<typename Lhs, typename Rhs>
+    bool operator()(const Lhs& lhs, const Rhs& rhs) const { return lhs.first == rhs.first && lhs.second == rhs.second; }
+};
+
+template<typename Range1, typename Range2, typename Pred = SameEntry>
+bool sameElements(const Range1& lhs, const Range2& rhs, Pred pred = {})
+{
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), pred);
+}
+
+TEST(FlatMap, MemberFunctions)
+{
+    practise::flat_map<int, std::string> map;
+    EXPECT_TRUE(map.empty());
+
+    auto cmp = [](const int a, const int b) { return a > b; };
+    practise::flat_map<int,std::string,decltype(cmp)> map1;
+    EXPECT_TRUE(map1.empty());
+
+    std::array<std::pair<int,std::string>, 4> initialValues{{{49,"Germany"},{91,"India"},{36,"Hungary"},{33,"France"}}};
+    practise::flat_map<int, std::string> map2(initialValues.begin(), initialValues.end());
+    EXPECT_EQ(map2.size(),4);
+
+    std::map<int, std::string> expected{{49,"Germany"},{91,"India"},{36,"Hungary"},{33,"France"}};
+    EXPECT_TRUE(sameElements(map2,expected));
+
+    practise::flat_map<int, std::string> map3(map2);
+    EXPECT_TRUE(sameElements(map3,expected));
+    practise::flat_map<int, std::string> map4(std::move(map3));
+    EXPECT_TRUE(sameElements(map4,expected));
+
+    practise::flat_map<int, std::string> map5{{12,"John"},{22,"Sven"},{33,"White"}};
+    EXPECT_TRUE(sameElements(map5,(std::map<int,std::string>{{12,"John"},{22,"Sven"},{33,"White"}})));
+
+    //use custom comparator to sort keys in descending order
+    practise::flat_map<int,std::string,decltype(cmp)> map6{{1,"are"},{-2,"you"},{20,"Hi"},{11,"how"}};
+    EXPECT_TRUE(sameElements(map6,(std::map<int,std::string,decltype(cmp)>{{20,"Hi"},{11,"how"},{1,"are"},{-2,"you"}})));
+
+    //= operator
+    map = map2;
+    EXPECT_TRUE(sameElements(map,expected));
+
+    map1 = std::move(map6);
+    EXPECT_TRUE(sameElements(map1,(std::map<int,std::string,decltype(cmp)>{{20,"Hi"},{11,"how"},{1,"are"},{-2,"you"}})));
+
+    const auto initList = { std::pair<const int, int>{4,4}, {5,5}, {6,6}, {7,7} };
+    practise::flat_map<int, int> map7(initList.begin(), initList.end());
+    EXPECT_TRUE(sameElements(map7,(std::map<const int, int>{{4,4}, {5,5}, {6,6}, {7,7}})));
+}
+
+TEST(FlatMap, BulkConstruction)
+{
+    //Unsorted container with duplicates: sorted once, the first of the duplicate keys is kept
+    std::vector<std::pair<int,char>> values{{3,'c'},{1,'a'},{2,'b'},{1,'z'}};
+    practise::flat_map<int,char> map(std::move(values));
+    EXPECT_TRUE(sameElements(map,(std::map<int,char>{{1,'a'},{2,'b'},{3,'c'}})));
+
+    //Input that is already sorted is taken over as it is
+    std::vector<std::pair<int,char>> sortedValues{{1,'a'},{2,'b'},{3,'c'},{4,'d'}};
+    practise::flat_map<int,char> sortedMap(practise::sorted_unique, sortedValues);
+    EXPECT_EQ(sortedMap.size(),4);
+    EXPECT_EQ(sortedMap.at(4),'d');
+
+    sortedMap.insert(practise::sorted_unique, sortedValues.begin(), sortedValues.end());
+    EXPECT_EQ(sortedMap.size(),4);
+
+    //extract hands the vector out, replace puts a sorted one back
+    auto data = std::move(sortedMap).extract();
+    EXPECT_EQ(data.size(),4);
+    EXPECT_TRUE(sortedMap.empty());
+    data.pop_back();
+    sortedMap.replace(std::move(data));
+    EXPECT_EQ(sortedMap.size(),3);
+}
+
+TEST(FlatMap, ElementAccess)
+{
+    practise::flat_map<int, char> map{{1,'a'},{4,'b'},{2,'c'},{3,'d'}};
+
+    EXPECT_EQ(map.at(4),'b');
+    EXPECT_EQ(map.at(2),'c');
+    EXPECT_THROW(map.at(9), std::out_of_range);
+
+    EXPECT_EQ(map[1],'a');
+    EXPECT_EQ(map[3],'d');
+
+    map[1] = 'e';
+    map[3] = 'f';
+
+    EXPECT_EQ(map[1],'e');
+    EXPECT_EQ(map[3],'f');
+}
+
+TEST(FlatMap, Iterators)
+{
+    practise::flat_map<int, char> map{{1,'a'},{4,'b'},{2,'c'},{3,'d'}};
+
+    //The map after sorting would look like {1,'a'},{2,'c'},{3,'d'},{4,'b'}
+    EXPECT_EQ(map.begin()->second,'a');
+    EXPECT_EQ((--map.end())->second,'b');
+
+    auto it = map.begin();
+    std::advance(it, 2);
+    EXPECT_EQ(it->first,3);
+    EXPECT_EQ(it->second,'d');
+    it++;
+    EXPECT_EQ(it->first,4);
+    EXPECT_EQ(it->second,'b');
+
+    EXPECT_EQ(map.rbegin()->first,4);
+    EXPECT_EQ(map.rbegin()->second,'b');
+
+    EXPECT_EQ((--map.rend())->first,1);
+    EXPECT_EQ((--map.rend())->second,'a');
+
+    auto it2 = map.rend();
+    std::advance(it2,-3);
+    EXPECT_EQ(it2->first,3);
+    EXPECT_EQ(it2->second,'d');
+}
+
+TEST(FlatMap, Capacity)
+{
+    practise::flat_map<std::string, std::vector<int>> map;
+    EXPECT_TRUE(map.empty());
+
+    map = {{"First",{1,2,3}},{"Second",{2,3,4}}};
+    EXPECT_EQ(map.size(),2);
+}
+
+TEST(FlatMap, Modifiers)
+{
+    practise::flat_map<int, std::vector<int>> map{{1,{1,2,3}},{3,{2,3,4}}};
+    EXPECT_EQ(map.size(),2);
+    EXPECT_FALSE(map.empty());
+
+    map.clear();
+    EXPECT_EQ(map.size(),0);
+    EXPECT_TRUE(map.empty());
+
+    //rvalue
+    map.insert({2,{1,4,5}});
+    map.insert({1,{1,2,3}});
+    map.insert({3,{2,3,4}});
+    std::map<int, std::vector<int>> expectedMap{{1,{1,2,3}},{2,{1,4,5}},{3,{2,3,4}}};
+    EXPECT_TRUE(sameElements(map,expectedMap));
+
+    //lvalue
+    std::pair<int,std::vector<int>> val{5,{2,4,5}};
+    map.insert(val);
+    std::map<int, std::vector<int>> expectedMap1{{1,{1,2,3}},{2,{1,4,5}},{3,{2,3,4}},{5,{2,4,5}}};
+    EXPECT_TRUE(sameElements(map,expectedMap1));
+
+    //rvalue with emplace
+    map.insert(std::pair<int,std::vector<int>>{7,{2,4,5}});
+    std::map<int, std::vector<int>> expectedMap2{{1,{1,2,3}},{2,{1,4,5}},{3,{2,3,4}},{5,{2,4,5}},{7,{2,4,5}}};
+    EXPECT_TRUE(sameElements(map,expectedMap2));
+
+    //Same lvalue, rvalue and emplace with position insertion
+    practise::flat_map<int,char> map1{{1,'a'},{4,'b'}};
+    map1.insert(++map1.begin(),{2,'c'});
+
+    //insertion invalidates the iterators of a flat map, so they are taken again
+    auto it = map1.begin();
+    it++;
+    map1.insert(it, std::pair<int,char>{7,'e'});
+
+    it = map1.begin() + 2;
+    std::pair<int,char> val2{3,'f'};
+    map1.insert(it,val2);
+    std::map<int,char> expectedMap3{{1,'a'},{2,'c'},{3,'f'},{4,'b'},{7,'e'}};
+    EXPECT_TRUE(sameElements(map1,expectedMap3));
+
+    //range insertion
+    practise::flat_map<int,char> map2;
+    map2.insert(map1.find(2),map1.find(4));
+    std::map<int,char> expectedMap4{{2,'c'},{3,'f'}};
+    EXPECT_TRUE(sameElements(map2,expectedMap4));
+
+    map2.insert({{1,'a'},{5,'o'}});
+    std::map<int,char> expectedMap5{{1,'a'},{2,'c'},{3,'f'},{5,'o'}};
+    EXPECT_TRUE(sameElements(map2,expectedMap5));
+
+    //node_type insertion
+    auto it1 = map1.begin();
+    std::advance(it1,3);
+    auto node = map1.extract(it1);
+    map2.insert(std::move(node));
+    map2.insert(map1.extract(7));
+    std::map<int,char> expectedMap6{{1,'a'},{2,'c'},{3,'f'},{4,'b'},{5,'o'},{7,'e'}};
+    EXPECT_TRUE(sameElements(map2,expectedMap6));
+
+    //insert_or_assign
+    map2.insert_or_assign(1,'s');
+    map2.insert_or_assign(++map2.begin(),2,'h');
+    std::map<int,char> expectedMap7{{1,'s'},{2,'h'},{3,'f'},{4,'b'},{5,'o'},{7,'e'}};
+    EXPECT_TRUE(sameElements(map2,expectedMap7));
+
+    //emplace
+    class TestConstructor
+    {
+        public:
+            TestConstructor(int val): m_Value(val){};
+            ~TestConstructor() = default;
+
+            int getValue () const{return m_Value;}
+        protected:
+            int m_Value = 0;
+    };
+
+    practise::flat_map<int, TestConstructor> cMap;
+    cMap.emplace(1,11);
+    cMap.emplace(2,22);
+    cMap.emplace(3,33);
+
+    auto compare = [](const std::pair<int, TestConstructor>  &obj1, const std::pair<int, TestConstructor>  &obj2){ return (obj1.first == obj2.first) && (obj1.second.getValue() == obj2.second.getValue());};
+    std::map<int,TestConstructor> expectedMap8{{1,11},{2,22},{3,33}};
+    EXPECT_TRUE(sameElements(cMap,expectedMap8,compare));
+
+    //Just inserts to the nearest possible iterator position
+    cMap.emplace_hint(cMap.begin(),4,44);
+    cMap.emplace_hint(cMap.begin(),-1,-11);
+    std::map<int,TestConstructor> expectedMap9{{-1,-11},{1,11},{2,22},{3,33},{4,44}};
+    EXPECT_TRUE(sameElements(cMap,expectedMap9,compare));
+
+    //try_emplace does nothing if the key is already present.
+    cMap.try_emplace(3,33);
+    cMap.try_emplace(7,77);
+    cMap.try_emplace(cMap.end(),8,88);
+    std::map<int,TestConstructor> expectedMap10{{-1,-11},{1,11},{2,22},{3,33},{4,44},{7,77},{8,88}};
+    EXPECT_TRUE(sameElements(cMap,expectedMap10,compare));
+
+    cMap.erase(cMap.begin());
+    std::map<int,TestConstructor> expectedMap11{{1,11},{2,22},{3,33},{4,44},{7,77},{8,88}};
+    EXPECT_TRUE(sameElements(cMap,expectedMap11,compare));
+
+    auto cIt = cMap.begin();
+    std::advance(cIt,3);
+    cMap.erase(cMap.begin(),cIt);
+    std::map<int,TestConstructor> expectedMap12{{4,44},{7,77},{8,88}};
+    EXPECT_TRUE(sameElements(cMap,expectedMap12,compare));
+
+    //swap
+    practise::flat_map<int, TestConstructor> cMap1{{-1,11},{-2,22}};
+    cMap1.swap(cMap);
+    std::map<int,TestConstructor> expectedMap13{{-2,22},{-1,11}};
+    EXPECT_TRUE(sameElements(cMap1,expectedMap12,compare));
+    EXPECT_TRUE(sameElements(cMap,expectedMap13,compare));
+
+    //extract
+    auto node2 = cMap1.extract(4);
+    node2.key() = 5;
+    node2.mapped() = 33;
+    cMap1.insert(std::move(node2));
+    std::map<int,TestConstructor> expectedMap14{{5,33},{7,77},{8,88}};
+    EXPECT_TRUE(sameElements(cMap1,expectedMap14,compare));
+
+    //merge
+    cMap1.merge(cMap);
+    std::map<int,TestConstructor> expectedMap15{{-2,22},{-1,11},{5,33},{7,77},{8,88}};
+    EXPECT_TRUE(sameElements(cMap1,expectedMap15,compare));
+    EXPECT_TRUE(cMap.empty());
+}
+
+TEST(FlatMap, LookUp)
+{
+    practise::flat_map<int,char> map;
+    map.insert({{1,'a'},{3,'b'},{2,'c'}});
+    EXPECT_EQ(map.count(3),1);
+
+    auto foundElement = map.find(2);
+    EXPECT_EQ(foundElement->first,2);
+    EXPECT_EQ(foundElement->second,'c');
+
+    EXPECT_TRUE(map.contains(1));
+    EXPECT_FALSE(map.contains(7));
+
+    map.insert({4,'d'});
+    auto [it1,it2] = map.equal_range(2);
+    EXPECT_EQ(it1->first,2);
+    EXPECT_EQ(it1->second,'c');
+    EXPECT_EQ(it2->first,3);
+    EXPECT_EQ(it2->second,'b');
+
+    auto lIt = map.lower_bound(1);
+    EXPECT_EQ(lIt->first,1);
+    EXPECT_EQ(lIt->second,'a');
+
+    map.insert({8,'f'});
+    auto uIt = map.upper_bound(4);
+    EXPECT_EQ(uIt->first,8);
+    EXPECT_EQ(uIt->second,'f');
+}
+
+TEST(FlatMap, Observers)
+{
+    practise::flat_map<int,char> map{{1,'a'},{2,'b'},{4,'c'},{5,'e'}};
+
+    auto keyCompFunc = map.key_comp();
+
+    EXPECT_TRUE(keyCompFunc(1,4));
+    EXPECT_FALSE(keyCompFunc(4,1));
+
+    auto valueCompareFunc = map.value_comp();
+    const std::pair<int,char> p1 = {2,'b'};
+    const std::pair<const int,char> p2 = {-1,'e'};
+
+    auto it = map.begin();
+    EXPECT_TRUE(valueCompareFunc(*it,p1));
+    EXPECT_FALSE(valueCompareFunc(*it,p2));
+}
+
+TEST(FlatMap, NonMemberFunctions)
+{
+    practise::flat_map<int,char> map1{{1,'a'},{2,'b'},{3,'c'},{4,'d'}};
+    practise::flat_map<int,char> map2{{1,'a'},{2,'b'},{3,'c'},{4,'d'},{5,'f'}};
+    practise::flat_map<int,char> map3{{1,'a'},{2,'b'},{3,'c'},{4,'d'}};
+
+    EXPECT_TRUE(map1==map3);
+    EXPECT_FALSE(map1==map2);
+
+    EXPECT_TRUE(map1 < map2);
+    EXPECT_TRUE(map2 > map1);
+
+    EXPECT_TRUE(map1 <= map2);
+    EXPECT_TRUE(map2 >= map1);
+
+    std::swap(map1, map2);
+    std::map<int,char> expected1{{1,'a'},{2,'b'},{3,'c'},{4,'d'},{5,'f'}};
+    std::map<int,char> expected2{{1,'a'},{2,'b'},{3,'c'},{4,'d'}};
+
+    EXPECT_TRUE(sameElements(map1,expected1));
+    EXPECT_TRUE(sameElements(map2,expected2));
+
+    //The map3 would have values of {1,'a'},{2,'b'},{3,'c'},{4,'d'}
+    //Now delete all keys with even numbers by using predicate
+    std::map<int,char> expected3{{1,'a'},{3,'c'}};
+    auto deleteEvenKeysNode = [](const std::pair<int,char>& key){return (key.first % 2 ) == 0;};
+    erase_if(map3, deleteEvenKeysNode);
+    EXPECT_TRUE(sameElements(map3,expected3));
+}
+
+TEST(FlatMultiMap, MemberFunctions)
+{
+    practise::flat_multimap<int, std::string> mMap;
+    EXPECT_TRUE(mMap.empty());
+
+    auto cmp = [](const int a, const int b) { return a > b; };
+    practise::flat_multimap<int,std::string,decltype(cmp)> mMap1;
+    EXPECT_TRUE(mMap1.empty());
+
+    std::array<std::pair<int,std::string>, 5> initialValues{{{49,"TestMultipleKey"},{49,"Germany"},{91,"India"},{36,"Hungary"},{33,"France"}}};
+    practise::flat_multimap<int, std::string> mMap2(initialValues.begin(), initialValues.end());
+    EXPECT_EQ(mMap2.size(),5);
+
+    std::multimap<int, std::string> expected{{49,"TestMultipleKey"},{49,"Germany"},{91,"India"},{36,"Hungary"},{33,"France"}};
+    EXPECT_TRUE(sameElements(mMap2,expected));
+
+    practise::flat_multimap<int, std::string> mMap3(mMap2);
+    EXPECT_TRUE(sameElements(mMap3,expected));
+    practise::flat_multimap<int, std::string> mMap4(std::move(mMap3));
+    EXPECT_TRUE(sameElements(mMap4,expected));
+
+    practise::flat_multimap<int, std::string> mMap5{{22,"TestMultiKey"},{12,"John"},{22,"Sven"},{33,"White"}};
+    EXPECT_TRUE(sameElements(mMap5,(std::multimap<int,std::string>{{12,"John"},{22,"TestMultiKey"},{22,"Sven"},{33,"White"}})));
+
+    //use custom comparator to sort keys in descending order
+    practise::flat_multimap<int,std::string,decltype(cmp)> mMap6{{1,"are"},{-2,"you"},{20,"Hi"},{11,"how"},{-2,"doing"}};
+    EXPECT_TRUE(sameElements(mMap6,(std::multimap<int,std::string,decltype(cmp)>{{20,"Hi"},{11,"how"},{1,"are"},{-2,"you"},{-2,"doing"}})));
+
+    //= operator
+    mMap = mMap2;
+    EXPECT_TRUE(sameElements(mMap,expected));
+
+    mMap1 = std::move(mMap6);
+    EXPECT_TRUE(sameElements(mMap1,(std::multimap<int,std::string,decltype(cmp)>{{20,"Hi"},{11,"how"},{1,"are"},{-2,"you"},{-2,"doing"}})));
+}
+
+TEST(FlatMultiMap, Iterators)
+{
+    practise::flat_multimap<int, char> mMap{{1,'a'},{4,'b'},{2,'c'},{3,'d'},{2,'e'}};
+
+    //The map after sorting would look like {1,'a'},{2,'c'}{2,'e'},{3,'d'},{4,'b'}
+    EXPECT_EQ(mMap.begin()->second,'a');
+    EXPECT_EQ((--mMap.end())->second,'b');
+
+    auto it = mMap.begin();
+    std::advance(it, 2);
+    EXPECT_EQ(it->first,2);
+    EXPECT_EQ(it->second,'e');
+    it++;
+    EXPECT_EQ(it->first,3);
+    EXPECT_EQ(it->second,'d');
+
+    EXPECT_EQ(mMap.rbegin()->first,4);
+    EXPECT_EQ(mMap.rbegin()->second,'b');
+
+    EXPECT_EQ((--mMap.rend())->first,1);
+    EXPECT_EQ((--mMap.rend())->second,'a');
+
+    auto it2 = mMap.rend();
+    std::advance(it2,-3);
+    EXPECT_EQ(it2->first,2);
+    EXPECT_EQ(it2->second,'e');
+}
+
+TEST(FlatMultiMap, Modifiers)
+{
+    practise::flat_multimap<int, std::vector<int>> mMap{{1,{1,2,3}},{3,{2,3,4}}};
+    EXPECT_EQ(mMap.size(),2);
+
+    mMap.clear();
+    EXPECT_TRUE(mMap.empty());
+
+    //rvalue
+    mMap.insert({2,{1,4,5}});
+    mMap.insert({1,{1,2,3}});
+    mMap.insert({3,{2,3,4}});
+    mMap.insert({3,{2,3,4}});
+
+    std::multimap<int, std::vector<int>> expectedMap{{1,{1,2,3}},{2,{1,4,5}},{3,{2,3,4}},{3,{2,3,4}}};
+    EXPECT_TRUE(sameElements(mMap,expectedMap));
+
+    //range insertion
+    practise::flat_multimap<int,char> mMap1{{1,'a'},{2,'c'},{3,'f'},{4,'b'},{7,'e'}};
+    practise::flat_multimap<int,char> mMap2;
+    mMap2.insert(mMap1.find(2),mMap1.find(4));
+    mMap2.insert({{1,'a'},{1,'b'},{5,'o'}});
+    std::multimap<int,char> expectedMap5{{1,'a'},{1,'b'},{2,'c'},{3,'f'},{5,'o'}};
+    EXPECT_TRUE(sameElements(mMap2,expectedMap5));
+
+    //node_type insertion
+    auto it1 = mMap1.begin();
+    std::advance(it1,3);
+    auto node = mMap1.extract(it1);
+    mMap2.insert(std::move(node));
+    mMap2.insert(mMap1.extract(7));
+    std::multimap<int,char> expectedMap6{{1,'a'},{1,'b'},{2,'c'},{3,'f'},{4,'b'},{5,'o'},{7,'e'}};
+    EXPECT_TRUE(sameElements(mMap2,expectedMap6));
+
+    //equal keys are kept in insertion order, the hint only helps when it is the right position
+    practise::flat_multimap<int,int> cMap;
+    cMap.emplace(1,11);
+    cMap.emplace(2,22);
+    cMap.emplace(3,33);
+    cMap.emplace_hint(cMap.begin(),4,44);
+    cMap.emplace_hint(cMap.begin(),-1,-11);
+    cMap.emplace_hint(cMap.begin(),-1,-12);
+    std::multimap<int,int> expectedMap9{{-1,-12},{-1,-11},{1,11},{2,22},{3,33},{4,44}};
+    EXPECT_TRUE(sameElements(cMap,expectedMap9));
+
+    EXPECT_EQ(cMap.erase(-1),2);
+    auto cIt = cMap.begin();
+    std::advance(cIt,2);
+    cMap.erase(cMap.begin(),cIt);
+    std::multimap<int,int> expectedMap12{{3,33},{4,44}};
+    EXPECT_TRUE(sameElements(cMap,expectedMap12));
+
+    //merge from a multimap moves everything
+    practise::flat_multimap<int,int> cMap1{{-1,11},{3,22}};
+    cMap.merge(cMap1);
+    std::multimap<int,int> expectedMap15{{-1,11},{3,33},{3,22},{4,44}};
+    EXPECT_TRUE(sameElements(cMap,expectedMap15));
+    EXPECT_TRUE(cMap1.empty());
+
+    //merge from a multimap into a map takes the first of each key and leaves the rest in the source
+    practise::flat_map<int,int> uMap{{2,20}};
+    practise::flat_multimap<int,int> mSource{{1,10},{1,11},{2,21},{3,30},{3,31}};
+    uMap.merge(mSource);
+    std::map<int,int> expectedMap16{{1,10},{2,20},{3,30}};
+    std::multimap<int,int> expectedMap17{{1,11},{2,21},{3,31}};
+    EXPECT_TRUE(sameElements(uMap,expectedMap16));
+    EXPECT_TRUE(sameElements(mSource,expectedMap17));
+}
+
+TEST(FlatMultiMap, LookUp)
+{
+    practise::flat_multimap<int,char> mMap;
+    mMap.insert({{1,'a'},{3,'b'},{3,'o'},{2,'c'},{2,'f'}});
+    EXPECT_EQ(mMap.count(3),2);
+
+    auto foundElement = mMap.find(2);
+    EXPECT_EQ(foundElement->first,2);
+    EXPECT_EQ(foundElement->second,'c');
+
+    EXPECT_TRUE(mMap.contains(1));
+    EXPECT_FALSE(mMap.contains(7));
+
+    mMap.insert({4,'d'});
+    auto [it1,it2] = mMap.equal_range(2);
+    EXPECT_EQ(it1->first,2);
+    EXPECT_EQ(it1->second,'c');
+    EXPECT_EQ(std::distance(it1,it2),2);
+    EXPECT_EQ(it2->first,3);
+    EXPECT_EQ(it2->second,'b');
+
+    auto lIt = mMap.lower_bound(1);
+    EXPECT_EQ(lIt->first,1);
+    EXPECT_EQ(lIt->second,'a');
+
+    mMap.insert({8,'f'});
+    auto uIt = mMap.upper_bound(4);
+    EXPECT_EQ(uIt->first,8);
+    EXPECT_EQ(uIt->second,'f');
+}
+
+TEST(FlatMultiMap, NonMemberFunctions)
+{
+    practise::flat_multimap<int,char> mMap1{{1,'a'},{2,'b'},{2,'f'},{3,'c'},{4,'d'}};
+    practise::flat_multimap<int,char> mMap2{{1,'a'},{2,'b'},{2,'f'},{3,'c'},{4,'d'},{5,'f'}};
+    practise::flat_multimap<int,char> mMap3{{1,'a'},{2,'b'},{2,'f'},{3,'c'},{4,'d'}};
+
+    EXPECT_TRUE(mMap1==mMap3);
+    EXPECT_FALSE(mMap1==mMap2);
+
+    EXPECT_TRUE(mMap1 < mMap2);
+    EXPECT_TRUE(mMap2 > mMap1);
+
+    std::swap(mMap1, mMap2);
+    EXPECT_EQ(mMap1.size(),6);
+    EXPECT_EQ(mMap2.size(),5);
+
+    std::multimap<int,char> expected3{{1,'a'},{3,'c'}};
+    auto deleteEvenKeysNode = [](const std::pair<int,char>& key){return (key.first % 2 ) == 0;};
+    EXPECT_EQ(erase_if(mMap3, deleteEvenKeysNode),3);
+    EXPECT_TRUE(sameElements(mMap3,expected3));
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
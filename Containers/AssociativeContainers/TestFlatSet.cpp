@@ -0,0 +1,563 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <array>
+#include <set>
+#include <vector>
+#include "FlatSet.h"
+
+//Same scenarios as TestSet.cpp and TestMultiSet.cpp, run against the sorted vector flat_set/flat_multiset
+
+TEST(FlatSet, MemberFunctions)
+{
+    practise::flat_set<int> set;
+    EXPECT_TRUE(set.empty());
+
+    std::array<int, 5> arr{1,2,3,4,5};
+    practise::flat_set<int> set2(arr.begin(), arr.end());
+
+    EXPECT_EQ(set2.size(),5);
+    EXPECT_TRUE(std::ranges::equal(set2,std::initializer_list<int>({1,2,3,4,5})));
+
+    std::array<int, 5> arr1{6,8,12,1,0};
+    practise::flat_set<int> set3(arr1.begin(), arr1.end());
+
+    EXPECT_EQ(set3.size(),5);
+    EXPECT_TRUE(std::ranges::equal(set3,std::initializer_list<int>({0,1,6,8,12})));
+
+    //use the custom comparator
+    auto cmp = [](const int a, const int b) { return a > b; };
+    practise::flat_set<int,decltype(cmp)> set4(arr1.begin(), arr1.end(),cmp);
+    EXPECT_EQ(set4.size(),5);
+    EXPECT_TRUE(std::ranges::equal(set4,std::initializer_list<int>({12,8,6,1,0})));
+
+    practise::flat_set<int,decltype(cmp)> set5(set4);
+    EXPECT_EQ(set5.size(),5);
+    EXPECT_TRUE(std::ranges::equal(set5,std::initializer_list<int>({12,8,6,1,0})));
+
+    //passing rvalue
+    using iSet = practise::flat_set<int>;
+    practise::flat_set<int> set6(iSet{1,2,3,4,5});
+    EXPECT_EQ(set6.size(),5);
+    EXPECT_TRUE(std::ranges::equal(set6,std::initializer_list<int>({1,2,3,4,5})));
+
+    practise::flat_set<int> set7{11,33,55,88};
+    EXPECT_EQ(set7.size(),4);
+    EXPECT_TRUE(std::ranges::equal(set7,std::initializer_list<int>({11,33,55,88})));
+
+    //operator = 
+    practise::flat_set<int> set8 = set7;
+    EXPECT_EQ(set8.size(),4);
+    EXPECT_TRUE(std::ranges::equal(set8,std::initializer_list<int>({11,33,55,88})));
+
+    practise::flat_set<int> set9 = std::move(set8);
+    EXPECT_EQ(set9.size(),4);
+    EXPECT_TRUE(std::ranges::equal(set9,std::initializer_list<int>({11,33,55,88})));
+
+    practise::flat_set<int> set10 = {0,7,2,6};
+    EXPECT_EQ(set10.size(),4);
+    EXPECT_TRUE(std::ranges::equal(set10,std::initializer_list<int>({0,2,6,7})));
+}
+
+TEST(FlatSet, BulkConstruction)
+{
+    //Unsorted container with duplicates is sorted once and the duplicates are dropped
+    practise::flat_set<int> set(std::vector<int>{5,1,4,1,3,5});
+    EXPECT_TRUE(std::ranges::equal(set,std::initializer_list<int>({1,3,4,5})));
+
+    //Input that is already sorted is taken over as it is
+    std::vector<int> sortedValues{1,2,3,4,5,6};
+    practise::flat_set<int> sortedSet(practise::sorted_unique, sortedValues);
+    EXPECT_TRUE(std::ranges::equal(sortedSet,sortedValues));
+
+    practise::flat_multiset<int> mSet(practise::sorted_equivalent, std::vector<int>{1,1,2,2});
+    mSet.insert({2,0});
+    EXPECT_TRUE(std::ranges::equal(mSet,std::initializer_list<int>({0,1,1,2,2,2})));
+
+    //extract hands the vector out, the set is left empty
+    auto data = std::move(mSet).extract();
+    EXPECT_EQ(data.size(),6);
+    EXPECT_TRUE(mSet.empty());
+}
+
+TEST(FlatSet, Iterators)
+{
+    practise::flat_set<int> set{1,3,5,6,8,9,0};
+    //The set after sorting would look like {0,1,3,5,6,8,9}
+    EXPECT_EQ(*set.begin(),0);
+    EXPECT_EQ(*--set.end(),9);
+
+    auto it = set.begin();
+    std::advance(it, 3);
+    EXPECT_EQ(*it,5);
+    it++;
+    EXPECT_EQ(*it,6);
+
+    EXPECT_EQ(*set.rbegin(),9);
+    EXPECT_EQ(*--set.rend(),0);
+
+    auto it2 = set.rend();
+    std::advance(it2,-3);
+    EXPECT_EQ(*it2,3);
+}
+
+TEST(FlatSet, Capacity)
+{
+    practise::flat_set<int> set;
+    EXPECT_TRUE(set.empty());
+
+    set.insert(1);
+    set.insert(2);
+
+    EXPECT_FALSE(set.empty());
+
+    EXPECT_EQ(set.size(),2);
+}
+
+TEST(FlatSet, Modifiers)
+{
+    practise::flat_set<int> set{1,3,0,4};
+    EXPECT_EQ(set.size(),4);
+    set.clear();
+    EXPECT_EQ(set.size(),0);
+
+    //insert
+    set.insert(0);
+    set.insert(1);
+    set.insert(2);
+    EXPECT_EQ(set.size(),3);
+    EXPECT_TRUE(std::ranges::equal(set,std::initializer_list<int>({0,1,2})));
+
+    //Even though we specify the postion, the insertion happens to nearest possible position
+    //and then the container is sorted. so we can expect the output as 0,1,2,4
+    auto it = set.begin();
+    std::advance(it, 1);
+    set.insert(it,4);
+    EXPECT_TRUE(std::ranges::equal(set,std::initializer_list<int>({0,1,2,4})));
+
+    auto arr = {1,2,4,7,8};
+    set.insert(arr.begin(),arr.end());
+    EXPECT_TRUE(std::ranges::equal(set,std::initializer_list<int>({0,1,2,4,7,8})));
+
+    //Extract the node and insert
+    practise::flat_set<int> set1;
+    set1.insert(set.extract(2));
+    set1.insert(set.extract(4));
+    EXPECT_TRUE(std::ranges::equal(set1,std::initializer_list<int>({2,4})));
+
+    //emplace
+    class TestConstructor
+    {
+        public:
+            //We can also implement all other constructors like copy, move and assignment operators
+            TestConstructor(int val): m_Value(val){};
+            ~TestConstructor() = default; 
+            
+            int getValue () const{return m_Value;}
+ 
+            bool operator<(const TestConstructor &other) const
+            {
+              if (m_Value < other.m_Value)
+                return true;
+              
+              return false;
+            }
+        protected:
+            int m_Value = 0;
+    };
+
+    practise::flat_set<TestConstructor> cSet;
+    cSet.emplace(1);
+    cSet.emplace(2);
+    cSet.emplace(3);
+
+    auto compare = [](const TestConstructor &obj, const int &val){ return obj.getValue() == val;};
+    EXPECT_TRUE(std::ranges::equal(cSet,std::initializer_list<int>({1,2,3}),compare));
+
+    //emplace_hint give the best position to insert directly. Bit faster  when compared with emplace
+    cSet.emplace_hint(cSet.end(),0);
+    cSet.emplace_hint(cSet.begin(),-1);
+    cSet.emplace_hint(cSet.begin(),-2);
+    EXPECT_TRUE(std::ranges::equal(cSet,std::initializer_list<int>({-2,-1,0,1,2,3}),compare));
+
+    //erase
+    cSet.erase(cSet.begin());
+    EXPECT_TRUE(std::ranges::equal(cSet,std::initializer_list<int>({-1,0,1,2,3}),compare));
+    auto startIt = cSet.begin();
+    std::advance(startIt,1);
+
+    auto endIt = cSet.end();
+    std::advance(endIt, -2);
+    cSet.erase(startIt,endIt);
+    EXPECT_TRUE(std::ranges::equal(cSet,std::initializer_list<int>({-1,2,3}),compare));
+
+    cSet.erase(2);
+    EXPECT_TRUE(std::ranges::equal(cSet,std::initializer_list<int>({-1,3}),compare));
+
+    //swap
+    practise::flat_set<TestConstructor> cSet2;
+    cSet2.emplace(5);
+    cSet2.emplace(7);
+    cSet2.emplace(1);
+    cSet2.emplace(3);
+
+    cSet2.swap(cSet);
+    EXPECT_TRUE(std::ranges::equal(cSet2,std::initializer_list<int>({-1,3}),compare));
+    EXPECT_TRUE(std::ranges::equal(cSet,std::initializer_list<int>({1,3,5,7}),compare));
+
+    //merge
+    cSet2.merge(cSet);
+    EXPECT_TRUE(std::ranges::equal(cSet2,std::initializer_list<int>({-1,1,3,5,7}),compare));
+
+    //extract
+    auto eIt = cSet2.begin();
+    eIt++;
+    auto node = cSet2.extract(eIt);
+    EXPECT_TRUE(std::ranges::equal(cSet2,std::initializer_list<int>({-1,3,5,7}),compare));
+    EXPECT_EQ(node.value().getValue(),1);
+
+    auto node2 = cSet2.extract(5);
+    EXPECT_TRUE(std::ranges::equal(cSet2,std::initializer_list<int>({-1,3,7}),compare));
+    EXPECT_EQ(node2.value().getValue(),5);
+
+    node2.value() = TestConstructor(9);
+    cSet2.insert(std::move(node2));
+    EXPECT_TRUE(std::ranges::equal(cSet2,std::initializer_list<int>({-1,3,7,9}),compare));
+}
+
+TEST(FlatSet, LookUp)
+{
+    practise::flat_set<int> set{1,0,2,1,2,3,5,7,12,45};
+    EXPECT_EQ(set.count(9),0);
+    EXPECT_EQ(set.count(1),1);
+
+    auto it = set.find(2);
+    EXPECT_EQ(*it,2);
+    it = set.find(10);
+    EXPECT_EQ(it,set.end());
+
+    EXPECT_TRUE(set.contains(3));
+    EXPECT_FALSE(set.contains(10));
+
+    //returns the iterator for first element not equal to key and greater than key 
+    auto [itr1, itr2] = set.equal_range(5);
+    EXPECT_EQ(*itr1,5);
+    EXPECT_EQ(*itr2,7);
+
+    auto lItr = set.lower_bound(12);
+    auto uItr = set.upper_bound(12);
+    EXPECT_EQ(*lItr,12);
+    EXPECT_EQ(*uItr,45);
+
+}
+
+TEST(FlatSet,Observers)
+{
+    practise::flat_set<int> set{1,2,0,3,5,4};
+    auto key_comp = set.key_comp();
+    //Returns the default comparator used in set. std::less<<>> is the standard comparator
+    EXPECT_TRUE(key_comp(1,2));
+    EXPECT_FALSE(key_comp(2,1));
+
+    auto value_comp = set.value_comp();
+    EXPECT_TRUE(value_comp(1,2));
+    EXPECT_FALSE(value_comp(2,1));
+}
+
+TEST(FlatSet, NonMemberFunctions)
+{
+    practise::flat_set<int> set1{1,2,3,4};
+    practise::flat_set<int> set2{1,2,3,4,5};
+    practise::flat_set<int> set3{1,2,3,4};
+
+    EXPECT_TRUE(set1==set3);
+    EXPECT_FALSE(set1==set2);
+
+    EXPECT_TRUE(set1 < set2);
+    EXPECT_TRUE(set2 > set1);
+
+    EXPECT_TRUE(set1 <= set2);
+    EXPECT_TRUE(set2 >= set1);
+
+    std::swap(set1, set2);
+    EXPECT_TRUE(std::equal(set1.begin(), set1.end(), std::begin({1,2,3,4,5})));
+    EXPECT_TRUE(std::equal(set2.begin(), set2.end(), std::begin({1,2,3,4})));
+
+    //The set3 would have values of {1,2,3,4}
+    // Now delete all even numbers by using predicate
+    auto deleteEvenNumbers = [](int num){return (num % 2 ) == 0;};
+    erase_if(set3, deleteEvenNumbers);
+    EXPECT_TRUE(std::equal(set3.begin(), set3.end(), std::begin({1,3})));
+}
+
+TEST(FlatMultiSet, MemberFunctions)
+{
+    practise::flat_multiset<int> mSet;
+    EXPECT_TRUE(mSet.empty());
+
+    std::array<int, 5> arr{1,2,3,4,5};
+    practise::flat_multiset<int> mSet2(arr.begin(), arr.end());
+
+    EXPECT_EQ(mSet2.size(),5);
+    EXPECT_TRUE(std::ranges::equal(mSet2,std::initializer_list<int>({1,2,3,4,5})));
+
+    std::array<int, 5> arr1{6,8,12,1,0};
+    practise::flat_multiset<int> mSet3(arr1.begin(), arr1.end());
+
+    EXPECT_EQ(mSet3.size(),5);
+    EXPECT_TRUE(std::ranges::equal(mSet3,std::initializer_list<int>({0,1,6,8,12})));
+
+    //use the custom comparator
+    auto cmp = [](const int a, const int b) { return a > b; };
+    practise::flat_multiset<int,decltype(cmp)> mSet4(arr1.begin(), arr1.end(),cmp);
+    EXPECT_EQ(mSet4.size(),5);
+    EXPECT_TRUE(std::ranges::equal(mSet4,std::initializer_list<int>({12,8,6,1,0})));
+
+    practise::flat_multiset<int,decltype(cmp)> mSet5(mSet4);
+    EXPECT_EQ(mSet5.size(),5);
+    EXPECT_TRUE(std::ranges::equal(mSet5,std::initializer_list<int>({12,8,6,1,0})));
+
+    //passing rvalue
+    using iSet = practise::flat_multiset<int>;
+    practise::flat_multiset<int> mSet6(iSet{1,2,3,4,5});
+    EXPECT_EQ(mSet6.size(),5);
+    EXPECT_TRUE(std::ranges::equal(mSet6,std::initializer_list<int>({1,2,3,4,5})));
+
+    practise::flat_multiset<int> mSet7{11,33,55,88};
+    EXPECT_EQ(mSet7.size(),4);
+    EXPECT_TRUE(std::ranges::equal(mSet7,std::initializer_list<int>({11,33,55,88})));
+
+    //operator = 
+    practise::flat_multiset<int> mSet8 = mSet7;
+    EXPECT_EQ(mSet8.size(),4);
+    EXPECT_TRUE(std::ranges::equal(mSet8,std::initializer_list<int>({11,33,55,88})));
+
+    practise::flat_multiset<int> mSet9 = std::move(mSet8);
+    EXPECT_EQ(mSet9.size(),4);
+    EXPECT_TRUE(std::ranges::equal(mSet9,std::initializer_list<int>({11,33,55,88})));
+
+    practise::flat_multiset<int> mSet10 = {0,7,2,6,0,7};
+    EXPECT_EQ(mSet10.size(),6);
+    EXPECT_TRUE(std::ranges::equal(mSet10,std::initializer_list<int>({0,0,2,6,7,7})));
+}
+
+TEST(FlatMultiSet, Iterators)
+{
+    practise::flat_multiset<int> mSet{1,3,5,6,8,9,0,3};
+    //The set after sorting would look like {0,1,3,3,5,6,8,9}
+    EXPECT_EQ(*mSet.begin(),0);
+    EXPECT_EQ(*--mSet.end(),9);
+
+    auto it = mSet.begin();
+    std::advance(it, 3);
+    EXPECT_EQ(*it,3);
+    it++;
+    EXPECT_EQ(*it,5);
+
+    EXPECT_EQ(*mSet.rbegin(),9);
+    EXPECT_EQ(*--mSet.rend(),0);
+
+    auto it2 = mSet.rend();
+    std::advance(it2,-3);
+    EXPECT_EQ(*it2,3);
+}
+
+TEST(FlatMultiSet, Capacity)
+{
+    practise::flat_multiset<int> mSet;
+    EXPECT_TRUE(mSet.empty());
+
+    mSet.insert(1);
+    mSet.insert(2);
+    mSet.insert(2);
+
+    EXPECT_FALSE(mSet.empty());
+
+    EXPECT_EQ(mSet.size(),3);
+}
+
+TEST(FlatMultiSet, Modifiers)
+{
+    practise::flat_multiset<int> mSet{1,3,0,4,4};
+    EXPECT_EQ(mSet.size(),5);
+    mSet.clear();
+    EXPECT_EQ(mSet.size(),0);
+
+    //insert
+    mSet.insert(0);
+    mSet.insert(1);
+    mSet.insert(2);
+    EXPECT_EQ(mSet.size(),3);
+    EXPECT_TRUE(std::ranges::equal(mSet,std::initializer_list<int>({0,1,2})));
+
+    //Even though we specify the postion, the insertion happens to nearest possible position
+    //and then the container is sorted. so we can expect the output as 0,1,2,4
+    auto it = mSet.begin();
+    std::advance(it, 1);
+    mSet.insert(it,2);
+    EXPECT_TRUE(std::ranges::equal(mSet,std::initializer_list<int>({0,1,2,2})));
+
+    auto arr = {1,2,4,7,8};
+    mSet.insert(arr.begin(),arr.end());
+    EXPECT_TRUE(std::ranges::equal(mSet,std::initializer_list<int>({0,1,1,2,2,2,4,7,8})));
+
+    //Extract the node and insert
+    practise::flat_multiset<int> mSet1;
+    mSet1.insert(mSet.extract(2));
+    mSet1.insert(mSet.extract(4));
+    EXPECT_TRUE(std::ranges::equal(mSet1,std::initializer_list<int>({2,4})));
+
+    //emplace
+    class TestConstructor
+    {
+        public:
+            //We can also implement all other constructors like copy, move and assignment operators
+            TestConstructor(int val): m_Value(val){};
+            ~TestConstructor() = default; 
+            
+            int getValue () const{return m_Value;}
+ 
+            bool operator<(const TestConstructor &other) const
+            {
+              if (m_Value < other.m_Value)
+                return true;
+              
+              return false;
+            }
+        protected:
+            int m_Value = 0;
+    };
+
+    practise::flat_multiset<TestConstructor> cMSet;
+    cMSet.emplace(1);
+    cMSet.emplace(2);
+    cMSet.emplace(3);
+
+    auto compare = [](const TestConstructor &obj, const int &val){ return obj.getValue() == val;};
+    EXPECT_TRUE(std::ranges::equal(cMSet,std::initializer_list<int>({1,2,3}),compare));
+
+    //emplace_hint give the best position to insert directly. Bit faster  when compared with emplace
+    cMSet.emplace_hint(cMSet.end(),0);
+    cMSet.emplace_hint(cMSet.begin(),-1);
+    cMSet.emplace_hint(cMSet.begin(),-2);
+    cMSet.emplace_hint(cMSet.begin(),0);
+    EXPECT_TRUE(std::ranges::equal(cMSet,std::initializer_list<int>({-2,-1,0,0,1,2,3}),compare));
+
+    //erase
+    cMSet.erase(cMSet.begin());
+    EXPECT_TRUE(std::ranges::equal(cMSet,std::initializer_list<int>({-1,0,0,1,2,3}),compare));
+    
+    auto startIt = cMSet.begin();
+    std::advance(startIt,1);
+    auto endIt = cMSet.end();
+    std::advance(endIt, -2);
+
+    cMSet.erase(startIt,endIt);
+    EXPECT_TRUE(std::ranges::equal(cMSet,std::initializer_list<int>({-1,2,3}),compare));
+
+    cMSet.erase(2);
+    EXPECT_TRUE(std::ranges::equal(cMSet,std::initializer_list<int>({-1,3}),compare));
+
+    //swap
+    practise::flat_multiset<TestConstructor> cMSet2;
+    cMSet2.emplace(5);
+    cMSet2.emplace(7);
+    cMSet2.emplace(1);
+    cMSet2.emplace(3);
+    cMSet2.emplace(3);
+
+    cMSet2.swap(cMSet);
+    EXPECT_TRUE(std::ranges::equal(cMSet2,std::initializer_list<int>({-1,3}),compare));
+    EXPECT_TRUE(std::ranges::equal(cMSet,std::initializer_list<int>({1,3,3,5,7}),compare));
+
+    //merge
+    cMSet2.merge(cMSet);
+    EXPECT_TRUE(std::ranges::equal(cMSet2,std::initializer_list<int>({-1,1,3,3,3,5,7}),compare));
+
+    //extract
+    auto eIt = cMSet2.begin();
+    eIt++;
+    auto node = cMSet2.extract(eIt);
+    EXPECT_TRUE(std::ranges::equal(cMSet2,std::initializer_list<int>({-1,3,3,3,5,7}),compare));
+    EXPECT_EQ(node.value().getValue(),1);
+
+    auto node2 = cMSet2.extract(5);
+    EXPECT_TRUE(std::ranges::equal(cMSet2,std::initializer_list<int>({-1,3,3,3,7}),compare));
+    EXPECT_EQ(node2.value().getValue(),5);
+
+    node2.value() = TestConstructor(9);
+    cMSet2.insert(std::move(node2));
+    EXPECT_TRUE(std::ranges::equal(cMSet2,std::initializer_list<int>({-1,3,3,3,7,9}),compare));
+}
+
+TEST(FlatMultiSet, LookUp)
+{
+    practise::flat_multiset<int> mSet{1,0,2,1,2,3,5,7,12,45};
+    EXPECT_EQ(mSet.count(9),0);
+    EXPECT_EQ(mSet.count(1),2);
+
+    auto it = mSet.find(2);
+    EXPECT_EQ(*it,2);
+    it++;
+    EXPECT_EQ(*it,2);
+    it = mSet.find(10);
+    EXPECT_EQ(it,mSet.end());
+
+    EXPECT_TRUE(mSet.contains(3));
+    EXPECT_FALSE(mSet.contains(10));
+
+    //returns the iterator for first element not equal to key and greater than key 
+    auto [itr1, itr2] = mSet.equal_range(2);
+    EXPECT_EQ(*itr1,2);
+    EXPECT_EQ(*itr2,3);
+
+    auto lItr = mSet.lower_bound(12);
+    auto uItr = mSet.upper_bound(12);
+    EXPECT_EQ(*lItr,12);
+    EXPECT_EQ(*uItr,45);
+
+}
+
+TEST(FlatMultiSet,Observers)
+{
+    practise::flat_multiset<int> mSet{1,2,0,3,5,4};
+    auto key_comp = mSet.key_comp();
+    //Returns the default comparator used in set. std::less<<>> is the standard comparator
+    EXPECT_TRUE(key_comp(1,2));
+    EXPECT_FALSE(key_comp(2,1));
+
+    auto value_comp = mSet.value_comp();
+    EXPECT_TRUE(value_comp(1,2));
+    EXPECT_FALSE(value_comp(2,1));
+}
+
+TEST(FlatMultiSet, NonMemberFunctions)
+{
+    practise::flat_multiset<int> mSet1{1,2,3,3,4};
+    practise::flat_multiset<int> mSet2{1,2,3,4,5};
+    practise::flat_multiset<int> mSet3{1,2,3,3,4};
+
+    EXPECT_TRUE(mSet1==mSet3);
+    EXPECT_FALSE(mSet1==mSet2);
+
+    EXPECT_TRUE(mSet1 < mSet2);
+    EXPECT_TRUE(mSet2 > mSet1);
+
+    EXPECT_TRUE(mSet1 <= mSet2);
+    EXPECT_TRUE(mSet2 >= mSet1);
+
+    std::swap(mSet1, mSet2);
+    EXPECT_TRUE(std::equal(mSet1.begin(), mSet1.end(), std::begin({1,2,3,4,5})));
+    EXPECT_TRUE(std::equal(mSet2.begin(), mSet2.end(), std::begin({1,2,3,3,4})));
+
+    //The set3 would have values of {1,2,3,4}
+    // Now delete all even numbers by using predicate
+    auto deleteEvenNumbers = [](int num){return (num % 2 ) == 0;};
+    erase_if(mSet3, deleteEvenNumbers);
+    EXPECT_TRUE(std::equal(mSet3.begin(), mSet3.end(), std::begin({1,3,3})));
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
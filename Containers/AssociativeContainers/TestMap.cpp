@@ -1,6 +1,10 @@
 #include <iostream>
 #include <gtest/gtest.h>
 #include <map>
+#include <memory_resource>
+#include <random>
+#include <ranges>
+#include "Containers/MemoryResourceTest.h"
 
 TEST(Map, MemberFunctions)
 {
@@ -316,6 +320,148 @@ TEST(Map, NonMemberFunctions)
     EXPECT_TRUE(std::equal(map3.begin(), map3.end(), expected3.begin()));
 }
 
+//Same scenarios over std::pmr::map, once per memory resource
+template<typename Resource>
+class PmrMap : public MemoryResourceTest<Resource> {};
+TYPED_TEST_SUITE(PmrMap, MemoryResources, MemoryResourceNames);
+
+TYPED_TEST(PmrMap, MemberFunctions)
+{
+    std::pmr::map<int, std::pmr::string> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.get_allocator().resource(), this->resource());
+
+    std::array<std::pair<int,std::string_view>, 4> initialValues{{{49,"Germany"},{91,"India"},{36,"Hungary"},{33,"France"}}};
+    std::pmr::map<int, std::pmr::string> map2(initialValues.begin(), initialValues.end());
+    EXPECT_EQ(map2.size(),4);
+    EXPECT_EQ(map2.begin()->second,"France");
+    EXPECT_EQ(map2.begin()->second.get_allocator().resource(), this->resource());
+
+    std::pmr::map<int, std::pmr::string> map3(map2);
+    EXPECT_EQ(map3, map2);
+    EXPECT_EQ(map3.get_allocator().resource(), this->resource());
+
+    std::pmr::map<int, std::pmr::string> map4(std::move(map3));
+    EXPECT_EQ(map4, map2);
+
+    auto cmp = [](const int a, const int b) { return a > b; };
+    std::pmr::map<int,char,decltype(cmp)> map5{{1,'a'},{-2,'y'},{20,'h'},{11,'o'}};
+    EXPECT_TRUE(std::ranges::equal(map5 | std::views::keys, std::initializer_list<int>{20,11,1,-2}));
+
+    map = map2;
+    EXPECT_EQ(map, map2);
+
+    std::pmr::unsynchronized_pool_resource other{std::pmr::new_delete_resource()};
+    std::pmr::map<int, std::pmr::string> map6(&other);
+    map6 = map2;
+    //polymorphic_allocator does not propagate on copy assignment, the elements are copied into the other resource
+    EXPECT_EQ(map6.get_allocator().resource(), &other);
+    EXPECT_EQ(map6.begin()->second.get_allocator().resource(), &other);
+    EXPECT_EQ(map6, map2);
+}
+
+TYPED_TEST(PmrMap, ElementAccess)
+{
+    std::pmr::map<int, char> map{{1,'a'},{4,'b'},{2,'c'},{3,'d'}};
+    EXPECT_EQ(map.at(4),'b');
+    EXPECT_EQ(map[1],'a');
+    map[1] = 'e';
+    map[7] = 'g';
+    EXPECT_EQ(map[1],'e');
+    EXPECT_EQ(map.at(7),'g');
+    EXPECT_THROW(map.at(8), std::out_of_range);
+}
+
+TYPED_TEST(PmrMap, Modifiers)
+{
+    std::pmr::map<int,char> map1{{1,'a'},{4,'b'}};
+    map1.insert({2,'c'});
+    map1.insert(map1.begin(), std::pair<int,char>{7,'e'});
+    map1.insert({{3,'f'},{5,'o'}});
+    EXPECT_EQ(map1, (std::pmr::map<int,char>{{1,'a'},{2,'c'},{3,'f'},{4,'b'},{5,'o'},{7,'e'}}));
+
+    //Nodes move between maps on the same resource without reallocation
+    std::pmr::map<int,char> map2;
+    auto node = map1.extract(4);
+    const auto* address = &node.mapped();
+    map2.insert(std::move(node));
+    EXPECT_EQ(&map2.at(4), address);
+
+    map2.insert_or_assign(4,'s');
+    map2.try_emplace(4,'x');
+    map2.try_emplace(6,'y');
+    map2.emplace(8,'z');
+    map2.emplace_hint(map2.begin(),0,'w');
+    EXPECT_EQ(map2, (std::pmr::map<int,char>{{0,'w'},{4,'s'},{6,'y'},{8,'z'}}));
+
+    map2.erase(map2.begin());
+    map2.erase(6);
+    EXPECT_EQ(map2, (std::pmr::map<int,char>{{4,'s'},{8,'z'}}));
+
+    map1.merge(map2);
+    EXPECT_EQ(map1, (std::pmr::map<int,char>{{1,'a'},{2,'c'},{3,'f'},{4,'s'},{5,'o'},{7,'e'},{8,'z'}}));
+    EXPECT_TRUE(map2.empty());
+
+    map1.swap(map2);
+    EXPECT_TRUE(map1.empty());
+    EXPECT_EQ(map2.size(),7);
+
+    map2.clear();
+    EXPECT_TRUE(map2.empty());
+}
+
+TYPED_TEST(PmrMap, LookUp)
+{
+    std::pmr::map<int,char> map{{1,'a'},{3,'b'},{2,'c'},{4,'d'},{8,'f'}};
+    EXPECT_EQ(map.count(3),1);
+    EXPECT_EQ(map.find(2)->second,'c');
+    EXPECT_TRUE(map.contains(1));
+    EXPECT_FALSE(map.contains(7));
+
+    auto [it1,it2] = map.equal_range(2);
+    EXPECT_EQ(it1->first,2);
+    EXPECT_EQ(it2->first,3);
+    EXPECT_EQ(map.lower_bound(5)->first,8);
+    EXPECT_EQ(map.upper_bound(4)->first,8);
+}
+
+TYPED_TEST(PmrMap, NonMemberFunctions)
+{
+    std::pmr::map<int,char> map1{{1,'a'},{2,'b'},{3,'c'},{4,'d'}};
+    std::pmr::map<int,char> map2{{1,'a'},{2,'b'},{3,'c'},{4,'d'},{5,'f'}};
+    std::pmr::map<int,char> map3{{1,'a'},{2,'b'},{3,'c'},{4,'d'}};
+
+    EXPECT_TRUE(map1==map3);
+    EXPECT_TRUE(map1 < map2);
+
+    std::swap(map1, map2);
+    EXPECT_EQ(map1.size(),5);
+    EXPECT_EQ(map2.size(),4);
+
+    std::erase_if(map3, [](const auto& key){return (key.first % 2 ) == 0;});
+    EXPECT_EQ(map3, (std::pmr::map<int,char>{{1,'a'},{3,'c'}}));
+}
+
+//Random inserts and erases checked against a map with the default allocator
+TYPED_TEST(PmrMap, InsertEraseChurn)
+{
+    std::mt19937 gen{42};
+    std::pmr::map<int,int> map;
+    std::map<int,int> expected;
+    for(int round = 0; round < 20000; ++round)
+    {
+        const int key = static_cast<int>(gen() % 2000);
+        if(gen() % 3 != 0)
+        {
+            map.insert_or_assign(key, round);
+            expected.insert_or_assign(key, round);
+        }
+        else
+            EXPECT_EQ(map.erase(key), expected.erase(key));
+    }
+    EXPECT_TRUE(std::ranges::equal(map, expected));
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
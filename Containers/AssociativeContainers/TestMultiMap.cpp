@@ -1,6 +1,9 @@
 #include <iostream>
 #include <gtest/gtest.h>
 #include <map>
+#include <memory_resource>
+#include <random>
+#include "Containers/MemoryResourceTest.h"
 
 TEST(MultiMap, MemberFunctions)
 {
@@ -288,6 +291,106 @@ TEST(MultiMap, NonMemberFunctions)
     EXPECT_TRUE(std::equal(mMap3.begin(), mMap3.end(), expected3.begin()));
 }
 
+//Same scenarios over std::pmr::multimap, once per memory resource
+template<typename Resource>
+class PmrMultiMap : public MemoryResourceTest<Resource> {};
+TYPED_TEST_SUITE(PmrMultiMap, MemoryResources, MemoryResourceNames);
+
+TYPED_TEST(PmrMultiMap, MemberFunctions)
+{
+    std::pmr::multimap<int, std::pmr::string> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.get_allocator().resource(), this->resource());
+
+    std::array<std::pair<int,std::string_view>, 4> initialValues{{{49,"Germany"},{91,"India"},{49,"Berlin"},{33,"France"}}};
+    std::pmr::multimap<int, std::pmr::string> map2(initialValues.begin(), initialValues.end());
+    EXPECT_EQ(map2.size(),4);
+    EXPECT_EQ(map2.count(49),2);
+    EXPECT_EQ(map2.find(49)->second.get_allocator().resource(), this->resource());
+
+    std::pmr::multimap<int, std::pmr::string> map3(map2);
+    EXPECT_EQ(map3, map2);
+
+    map = std::move(map3);
+    EXPECT_EQ(map, map2);
+}
+
+TYPED_TEST(PmrMultiMap, Modifiers)
+{
+    std::pmr::multimap<int,char> map1{{1,'a'},{4,'b'}};
+    map1.insert({1,'c'});
+    map1.insert(map1.end(), std::pair<int,char>{7,'e'});
+    map1.insert({{4,'f'},{5,'o'}});
+    map1.emplace(7,'g');
+    map1.emplace_hint(map1.begin(),0,'w');
+    EXPECT_EQ(map1, (std::pmr::multimap<int,char>{{0,'w'},{1,'a'},{1,'c'},{4,'b'},{4,'f'},{5,'o'},{7,'e'},{7,'g'}}));
+
+    std::pmr::multimap<int,char> map2{{4,'x'}};
+    map2.insert(map1.extract(4));
+    EXPECT_EQ(map2, (std::pmr::multimap<int,char>{{4,'x'},{4,'b'}}));
+
+    map1.erase(map1.begin());
+    EXPECT_EQ(map1.erase(7),2);
+    EXPECT_EQ(map1, (std::pmr::multimap<int,char>{{1,'a'},{1,'c'},{4,'f'},{5,'o'}}));
+
+    map1.merge(map2);
+    EXPECT_EQ(map1.count(4),3);
+    EXPECT_TRUE(map2.empty());
+
+    map1.swap(map2);
+    EXPECT_EQ(map2.size(),6);
+    map2.clear();
+    EXPECT_TRUE(map2.empty());
+}
+
+TYPED_TEST(PmrMultiMap, LookUp)
+{
+    std::pmr::multimap<int,char> map{{1,'a'},{3,'b'},{2,'c'},{2,'d'},{8,'f'}};
+    EXPECT_EQ(map.count(2),2);
+    EXPECT_TRUE(map.contains(8));
+    EXPECT_FALSE(map.contains(7));
+
+    auto [it1,it2] = map.equal_range(2);
+    EXPECT_EQ(std::distance(it1,it2),2);
+    EXPECT_EQ(it2->first,3);
+    EXPECT_EQ(map.lower_bound(4)->first,8);
+    EXPECT_EQ(map.upper_bound(2)->first,3);
+}
+
+TYPED_TEST(PmrMultiMap, NonMemberFunctions)
+{
+    std::pmr::multimap<int,char> map1{{1,'a'},{1,'b'},{3,'c'}};
+    std::pmr::multimap<int,char> map2{{1,'a'},{1,'b'},{3,'c'},{3,'d'}};
+    EXPECT_TRUE(map1 < map2);
+    EXPECT_FALSE(map1 == map2);
+
+    std::swap(map1, map2);
+    EXPECT_EQ(map1.size(),4);
+
+    std::erase_if(map1, [](const auto& key){return key.first == 3;});
+    EXPECT_EQ(map1, (std::pmr::multimap<int,char>{{1,'a'},{1,'b'}}));
+}
+
+//Random inserts and erases of duplicated keys checked against a multimap with the default allocator
+TYPED_TEST(PmrMultiMap, InsertEraseChurn)
+{
+    std::mt19937 gen{42};
+    std::pmr::multimap<int,int> map;
+    std::multimap<int,int> expected;
+    for(int round = 0; round < 20000; ++round)
+    {
+        const int key = static_cast<int>(gen() % 500);
+        if(gen() % 3 != 0)
+        {
+            map.emplace(key, round);
+            expected.emplace(key, round);
+        }
+        else
+            EXPECT_EQ(map.erase(key), expected.erase(key));
+    }
+    EXPECT_TRUE(std::ranges::equal(map, expected));
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
@@ -1,6 +1,9 @@
 #include <iostream>
 #include <gtest/gtest.h>
 #include <set>
+#include <memory_resource>
+#include <random>
+#include "Containers/MemoryResourceTest.h"
 
 TEST(MultiSet, MemberFunctions)
 {
@@ -269,6 +272,108 @@ TEST(MultiSet, NonMemberFunctions)
     EXPECT_TRUE(std::equal(mSet3.begin(), mSet3.end(), std::begin({1,3,3})));
 }
 
+//Same scenarios over std::pmr::multiset, once per memory resource
+template<typename Resource>
+class PmrMultiSet : public MemoryResourceTest<Resource> {};
+TYPED_TEST_SUITE(PmrMultiSet, MemoryResources, MemoryResourceNames);
+
+TYPED_TEST(PmrMultiSet, MemberFunctions)
+{
+    std::pmr::multiset<int> set;
+    EXPECT_TRUE(set.empty());
+    EXPECT_EQ(set.get_allocator().resource(), this->resource());
+
+    std::array<int,5> values{5,1,4,1,3};
+    std::pmr::multiset<int> set1(values.begin(), values.end());
+    EXPECT_TRUE(std::ranges::equal(set1, std::initializer_list<int>{1,1,3,4,5}));
+
+    std::pmr::multiset<int> set2(set1);
+    EXPECT_EQ(set2, set1);
+    EXPECT_EQ(set2.get_allocator().resource(), this->resource());
+
+    set = std::move(set2);
+    EXPECT_EQ(set, set1);
+
+    std::pmr::multiset<int,std::greater<int>> set3{1,-2,20,1};
+    EXPECT_TRUE(std::ranges::equal(set3, std::initializer_list<int>{20,1,1,-2}));
+}
+
+TYPED_TEST(PmrMultiSet, Modifiers)
+{
+    std::pmr::multiset<int> set{1,4};
+    set.insert(4);
+    set.insert(set.begin(),1);
+    set.insert({3,5,5});
+    set.emplace(8);
+    set.emplace_hint(set.begin(),0);
+    EXPECT_TRUE(std::ranges::equal(set, std::initializer_list<int>{0,1,1,3,4,4,5,5,8}));
+
+    std::pmr::multiset<int> set2{4};
+    set2.insert(set.extract(4));
+    EXPECT_TRUE(std::ranges::equal(set2, std::initializer_list<int>{4,4}));
+
+    set.erase(set.begin());
+    EXPECT_EQ(set.erase(5),2);
+    EXPECT_TRUE(std::ranges::equal(set, std::initializer_list<int>{1,1,3,4,8}));
+
+    set.merge(set2);
+    EXPECT_EQ(set.count(4),3);
+    EXPECT_TRUE(set2.empty());
+
+    set.swap(set2);
+    EXPECT_EQ(set2.size(),7);
+    set2.clear();
+    EXPECT_TRUE(set2.empty());
+}
+
+TYPED_TEST(PmrMultiSet, LookUp)
+{
+    std::pmr::multiset<int> set{1,3,2,2,8};
+    EXPECT_EQ(set.count(2),2);
+    EXPECT_TRUE(set.contains(8));
+    EXPECT_FALSE(set.contains(7));
+
+    auto [it1,it2] = set.equal_range(2);
+    EXPECT_EQ(std::distance(it1,it2),2);
+    EXPECT_EQ(*it2,3);
+    EXPECT_EQ(*set.lower_bound(4),8);
+    EXPECT_EQ(*set.upper_bound(2),3);
+}
+
+TYPED_TEST(PmrMultiSet, NonMemberFunctions)
+{
+    std::pmr::multiset<int> set1{1,1,3};
+    std::pmr::multiset<int> set2{1,1,3,3};
+    EXPECT_TRUE(set1 < set2);
+    EXPECT_FALSE(set1 == set2);
+
+    std::swap(set1, set2);
+    EXPECT_EQ(set1.size(),4);
+
+    std::erase_if(set1, [](int key){return key == 3;});
+    EXPECT_TRUE(std::ranges::equal(set1, std::initializer_list<int>{1,1}));
+}
+
+//Random inserts and erases of duplicated keys checked against a multiset with the default allocator
+TYPED_TEST(PmrMultiSet, InsertEraseChurn)
+{
+    std::mt19937 gen{42};
+    std::pmr::multiset<int> set;
+    std::multiset<int> expected;
+    for(int round = 0; round < 20000; ++round)
+    {
+        const int key = static_cast<int>(gen() % 500);
+        if(gen() % 3 != 0)
+        {
+            set.insert(key);
+            expected.insert(key);
+        }
+        else
+            EXPECT_EQ(set.erase(key), expected.erase(key));
+    }
+    EXPECT_TRUE(std::ranges::equal(set, expected));
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
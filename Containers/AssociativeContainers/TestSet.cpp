@@ -1,6 +1,9 @@
 #include <iostream>
 #include <gtest/gtest.h>
 #include <set>
+#include <memory_resource>
+#include <random>
+#include "Containers/MemoryResourceTest.h"
 
 TEST(Set, MemberFunctions)
 {
@@ -263,6 +266,114 @@ TEST(Set, NonMemberFunctions)
     EXPECT_TRUE(std::equal(set3.begin(), set3.end(), std::begin({1,3})));
 }
 
+//Same scenarios over std::pmr::set, once per memory resource
+template<typename Resource>
+class PmrSet : public MemoryResourceTest<Resource> {};
+TYPED_TEST_SUITE(PmrSet, MemoryResources, MemoryResourceNames);
+
+TYPED_TEST(PmrSet, MemberFunctions)
+{
+    std::pmr::set<int> set;
+    EXPECT_TRUE(set.empty());
+    EXPECT_EQ(set.get_allocator().resource(), this->resource());
+
+    std::array<int,5> values{5,1,4,1,3};
+    std::pmr::set<int> set1(values.begin(), values.end());
+    EXPECT_TRUE(std::ranges::equal(set1, std::initializer_list<int>{1,3,4,5}));
+
+    std::pmr::set<int> set2(set1);
+    EXPECT_EQ(set2, set1);
+    EXPECT_EQ(set2.get_allocator().resource(), this->resource());
+
+    set = std::move(set2);
+    EXPECT_EQ(set, set1);
+
+    std::pmr::set<int,std::greater<int>> set3{1,-2,20,11};
+    EXPECT_TRUE(std::ranges::equal(set3, std::initializer_list<int>{20,11,1,-2}));
+
+    std::pmr::set<std::pmr::string> strings{"Hello","World"};
+    EXPECT_EQ(strings.begin()->get_allocator().resource(), this->resource());
+}
+
+TYPED_TEST(PmrSet, Modifiers)
+{
+    std::pmr::set<int> set{1,4};
+    set.insert(2);
+    set.insert(set.begin(),7);
+    set.insert({3,5,5});
+    set.emplace(8);
+    set.emplace_hint(set.begin(),0);
+    EXPECT_TRUE(std::ranges::equal(set, std::initializer_list<int>{0,1,2,3,4,5,7,8}));
+    EXPECT_FALSE(set.insert(4).second);
+
+    std::pmr::set<int> set2;
+    auto node = set.extract(4);
+    node.value() = 40;
+    set2.insert(std::move(node));
+    EXPECT_TRUE(std::ranges::equal(set2, std::initializer_list<int>{40}));
+
+    set.erase(set.begin());
+    EXPECT_EQ(set.erase(7),1);
+    EXPECT_TRUE(std::ranges::equal(set, std::initializer_list<int>{1,2,3,5,8}));
+
+    set2.insert(5);
+    set.merge(set2);
+    EXPECT_TRUE(std::ranges::equal(set, std::initializer_list<int>{1,2,3,5,8,40}));
+    //The duplicate stays behind
+    EXPECT_TRUE(std::ranges::equal(set2, std::initializer_list<int>{5}));
+
+    set.swap(set2);
+    EXPECT_EQ(set2.size(),6);
+    set2.clear();
+    EXPECT_TRUE(set2.empty());
+}
+
+TYPED_TEST(PmrSet, LookUp)
+{
+    std::pmr::set<int> set{1,3,2,4,8};
+    EXPECT_EQ(set.count(3),1);
+    EXPECT_EQ(*set.find(2),2);
+    EXPECT_TRUE(set.contains(1));
+    EXPECT_FALSE(set.contains(7));
+
+    auto [it1,it2] = set.equal_range(2);
+    EXPECT_EQ(*it1,2);
+    EXPECT_EQ(*it2,3);
+    EXPECT_EQ(*set.lower_bound(5),8);
+    EXPECT_EQ(*set.upper_bound(4),8);
+}
+
+TYPED_TEST(PmrSet, NonMemberFunctions)
+{
+    std::pmr::set<int> set1{1,2,3,4};
+    std::pmr::set<int> set2{1,2,3,4,5};
+    EXPECT_TRUE(set1 < set2);
+    EXPECT_FALSE(set1 == set2);
+
+    std::swap(set1, set2);
+    EXPECT_EQ(set1.size(),5);
+
+    std::erase_if(set1, [](int key){return (key % 2 ) == 0;});
+    EXPECT_TRUE(std::ranges::equal(set1, std::initializer_list<int>{1,3,5}));
+}
+
+//Random inserts and erases checked against a set with the default allocator
+TYPED_TEST(PmrSet, InsertEraseChurn)
+{
+    std::mt19937 gen{42};
+    std::pmr::set<int> set;
+    std::set<int> expected;
+    for(int round = 0; round < 20000; ++round)
+    {
+        const int key = static_cast<int>(gen() % 2000);
+        if(gen() % 3 != 0)
+            EXPECT_EQ(set.insert(key).second, expected.insert(key).second);
+        else
+            EXPECT_EQ(set.erase(key), expected.erase(key));
+    }
+    EXPECT_TRUE(std::ranges::equal(set, expected));
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <unordered_map>
+#include "ConcurrentHashMap.h"
+#include "Utils/BenchmarkUtils.h"
+
+//Read/write mix throughput: every benchmark thread runs lookups and updates on one shared map. The argument
+//is the percentage of reads (100/0, 90/10, 50/50), google benchmark runs the body on 1, 2, 4 ... 64 threads
+static constexpr int keyCount = 1 << 16;
+static constexpr int opsPerIteration = 64;
+
+//The std::unordered_map guarded by a single reader/writer lock the sharded map replaces
+class LockedUnorderedMap
+{
+public:
+    bool contains(int key) const
+    {
+        std::shared_lock lock(mMutex);
+        return mMap.contains(key);
+    }
+
+    void insert_or_assign(int key, int value)
+    {
+        std::unique_lock lock(mMutex);
+        mMap.insert_or_assign(key, value);
+    }
+
+    void reserve(std::size_t count) { mMap.reserve(count); }
+
+private:
+    mutable std::shared_mutex mMutex;
+    std::unordered_map<int, int> mMap;
+};
+
+template<typename Map>
+static Map& sharedMap()
+{
+    //Half of the keys are present, so reads hit and miss and writes both insert and assign
+    static Map map;
+    static std::once_flag filled;
+    std::call_once(filled, []
+    {
+        map.reserve(keyCount);
+        for(int key = 0; key < keyCount; key += 2)
+            map.insert_or_assign(key, key);
+    });
+    return map;
+}
+
+template<typename Map>
+static void readWriteMix(benchmark::State& state)
+{
+    auto& map = sharedMap<Map>();
+    const auto readPercent = state.range(0);
+    std::mt19937 gen(static_cast<unsigned>(state.thread_index()));
+    std::uniform_int_distribution<int> keys{0, keyCount - 1};
+    std::uniform_int_distribution<int> percent{0, 99};
+    long long hits = 0;
+    for(auto _ : state)
+    {
+        for(int i = 0; i < opsPerIteration; ++i)
+        {
+            const int key = keys(gen);
+            if(percent(gen) < readPercent)
+                hits += map.contains(key);
+            else
+                map.insert_or_assign(key, i);
+        }
+    }
+    benchmark::DoNotOptimize(hits);
+    bench::reportPerOp(state, opsPerIteration, sizeof(int));
+}
+
+static void BM_SharedMutexUnorderedMapReadWrite(benchmark::State& state)
+{
+    readWriteMix<LockedUnorderedMap>(state);
+}
+BENCHMARK(BM_SharedMutexUnorderedMapReadWrite)->ArgName("read%")->Arg(100)->Arg(90)->Arg(50)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_ConcurrentHashMapReadWrite(benchmark::State& state)
+{
+    readWriteMix<practise::concurrent_hash_map<int, int>>(state);
+}
+BENCHMARK(BM_ConcurrentHashMapReadWrite)->ArgName("read%")->Arg(100)->Arg(90)->Arg(50)->ThreadRange(1, 64)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include "MpmcQueue.h"
+#include "Utils/BenchmarkUtils.h"
+
+//Work queue contention: every benchmark thread pushes an element and pops one, so all threads are producer
+//and consumer at the same time. google benchmark runs the body on 1, 2, 4 ... 64 threads sharing one queue
+static constexpr std::size_t queueCapacity = 1024;
+static constexpr int opsPerIteration = 64;
+
+//The std::deque guarded by a mutex the lock-free queue replaces, bounded to the same capacity
+class MutexDeque
+{
+public:
+    bool try_push_back(int value)
+    {
+        std::lock_guard lock(mMutex);
+        if(mDeque.size() == queueCapacity)
+            return false;
+        mDeque.push_back(value);
+        return true;
+    }
+
+    std::optional<int> try_pop_front()
+    {
+        std::lock_guard lock(mMutex);
+        if(mDeque.empty())
+            return std::nullopt;
+        auto value = mDeque.front();
+        mDeque.pop_front();
+        return value;
+    }
+
+private:
+    std::mutex mMutex;
+    std::deque<int> mDeque;
+};
+
+static void BM_MutexDequeContention(benchmark::State& state)
+{
+    static MutexDeque queue;
+    long long sum = 0;
+    for(auto _ : state)
+    {
+        for(int i = 0; i < opsPerIteration; ++i)
+        {
+            while(!queue.try_push_back(i))
+                ;
+            //Other threads may have taken the element, the push of this thread guarantees one is coming
+            std::optional<int> value;
+            while(!(value = queue.try_pop_front()))
+                ;
+            sum += *value;
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    bench::reportPerOp(state, 2 * opsPerIteration, sizeof(int));
+}
+BENCHMARK(BM_MutexDequeContention)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_MpmcQueueContention(benchmark::State& state)
+{
+    static practise::mpmc_queue<int> queue(queueCapacity);
+    long long sum = 0;
+    for(auto _ : state)
+    {
+        for(int i = 0; i < opsPerIteration; ++i)
+        {
+            queue.push_back(i);
+            sum += queue.pop_front();
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    bench::reportPerOp(state, 2 * opsPerIteration, sizeof(int));
+}
+BENCHMARK(BM_MpmcQueueContention)->ThreadRange(1, 64)->UseRealTime();
+
+//Separate producer and consumer threads: even thread indices only push, odd ones only pop. Nobody waits,
+//a try on a full or empty queue counts as an op for both queues
+static void BM_MutexDequeProducerConsumer(benchmark::State& state)
+{
+    static MutexDeque queue;
+    const bool producer = state.thread_index() % 2 == 0;
+    long long sum = 0;
+    for(auto _ : state)
+    {
+        for(int i = 0; i < opsPerIteration; ++i)
+        {
+            if(producer)
+                queue.try_push_back(i);
+            else if(auto value = queue.try_pop_front())
+                sum += *value;
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    bench::reportPerOp(state, opsPerIteration, sizeof(int));
+}
+BENCHMARK(BM_MutexDequeProducerConsumer)->ThreadRange(2, 64)->UseRealTime();
+
+static void BM_MpmcQueueProducerConsumer(benchmark::State& state)
+{
+    static practise::mpmc_queue<int> queue(queueCapacity);
+    const bool producer = state.thread_index() % 2 == 0;
+    long long sum = 0;
+    for(auto _ : state)
+    {
+        for(int i = 0; i < opsPerIteration; ++i)
+        {
+            int value = 0;
+            if(producer)
+                queue.try_push_back(i);
+            else if(queue.try_pop_front(value))
+                sum += value;
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    bench::reportPerOp(state, opsPerIteration, sizeof(int));
+}
+BENCHMARK(BM_MpmcQueueProducerConsumer)->ThreadRange(2, 64)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,289 @@
+//concurrent_hash_map<Key, T, Hash, KeyEqual> : hash map shared between threads. The keys are spread over a
+//power of two number of shards, each shard is a flat_hash_map behind its own reader/writer lock on its own
+//cache line, so threads only contend when they hit the same shard.
+//There are no iterators or references into the map, they would outlive the lock. Elements are read and
+//changed through visitors which run while the shard is locked, and whole map views (snapshot, for_each,
+//size) lock every shard at once so they see a single point in time.
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "Containers/UnorderedAssociativeContainers/FlatHashMap.h"
+
+namespace practise
+{
+
+template<typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class concurrent_hash_map
+{
+    using shard_map = flat_hash_map<Key, T, Hash, KeyEqual>;
+
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+    //Four shards per hardware thread keeps the chance of two threads hitting the same shard low
+    static size_type defaultShardCount()
+    {
+        return std::bit_ceil(std::max<size_type>(1, std::thread::hardware_concurrency()) * 4);
+    }
+
+    //The shard count is rounded up to a power of two
+    explicit concurrent_hash_map(size_type shardCount = defaultShardCount(), const Hash& hash = Hash(),
+                                 const KeyEqual& equal = KeyEqual())
+        : mHash(hash)
+    {
+        if(shardCount == 0)
+            throw std::invalid_argument("concurrent_hash_map needs at least one shard");
+        shardCount = std::bit_ceil(shardCount);
+        mShardBits = static_cast<unsigned>(std::countr_zero(shardCount));
+        mShards.reserve(shardCount);
+        for(size_type i = 0; i < shardCount; ++i)
+            mShards.push_back(std::make_unique<Shard>(hash, equal));
+    }
+
+    concurrent_hash_map(const concurrent_hash_map&) = delete;
+    concurrent_hash_map& operator=(const concurrent_hash_map&) = delete;
+
+    //Modifiers, the return value tells whether a new element was inserted
+    template<typename... Args>
+    bool try_emplace(const Key& key, Args&&... args)
+    {
+        auto& shard = shardOf(key);
+        std::unique_lock lock(shard.mutex);
+        return shard.map.try_emplace(key, std::forward<Args>(args)...).second;
+    }
+
+    template<typename... Args>
+    bool try_emplace(Key&& key, Args&&... args)
+    {
+        auto& shard = shardOf(key);
+        std::unique_lock lock(shard.mutex);
+        return shard.map.try_emplace(std::move(key), std::forward<Args>(args)...).second;
+    }
+
+    bool insert(const value_type& value) { return try_emplace(value.first, value.second); }
+
+    template<typename M>
+    bool insert_or_assign(const Key& key, M&& obj)
+    {
+        auto& shard = shardOf(key);
+        std::unique_lock lock(shard.mutex);
+        return shard.map.insert_or_assign(key, std::forward<M>(obj)).second;
+    }
+
+    template<typename M>
+    bool insert_or_assign(Key&& key, M&& obj)
+    {
+        auto& shard = shardOf(key);
+        std::unique_lock lock(shard.mutex);
+        return shard.map.insert_or_assign(std::move(key), std::forward<M>(obj)).second;
+    }
+
+    size_type erase(const Key& key)
+    {
+        auto& shard = shardOf(key);
+        std::unique_lock lock(shard.mutex);
+        return shard.map.erase(key);
+    }
+
+    //Erases the element of key only if pred(const value_type&) holds, a compare and erase on one element
+    template<typename Pred>
+    bool erase_if(const Key& key, Pred pred)
+    {
+        auto& shard = shardOf(key);
+        std::unique_lock lock(shard.mutex);
+        auto it = shard.map.find(key);
+        if(it == shard.map.end() || !std::invoke(pred, std::as_const(*it)))
+            return false;
+        shard.map.erase(it);
+        return true;
+    }
+
+    //Erases every element for which pred(const value_type&) holds. The shards are locked one after the
+    //other, so elements inserted concurrently may or may not be looked at
+    template<typename Pred>
+    size_type erase_if(Pred pred)
+    {
+        size_type erased = 0;
+        for(auto& shard : mShards)
+        {
+            std::unique_lock lock(shard->mutex);
+            for(auto it = shard->map.begin(); it != shard->map.end();)
+            {
+                if(std::invoke(pred, std::as_const(*it)))
+                {
+                    it = shard->map.erase(it);
+                    ++erased;
+                }
+                else
+                    ++it;
+            }
+        }
+        return erased;
+    }
+
+    void clear()
+    {
+        for(auto& shard : mShards)
+        {
+            std::unique_lock lock(shard->mutex);
+            shard->map.clear();
+        }
+    }
+
+    //Spreads count elements over the shards
+    void reserve(size_type count)
+    {
+        const auto perShard = count / mShards.size() + 1;
+        for(auto& shard : mShards)
+        {
+            std::unique_lock lock(shard->mutex);
+            shard->map.reserve(perShard);
+        }
+    }
+
+    //Lookup. visit calls f(value_type&) with the shard locked for writing, cvisit calls f(const value_type&)
+    //with the shard locked for reading. Both return whether the key was found. The visitor must not call
+    //back into the map
+    template<typename F>
+    bool visit(const Key& key, F&& f)
+    {
+        auto& shard = shardOf(key);
+        std::unique_lock lock(shard.mutex);
+        auto it = shard.map.find(key);
+        if(it == shard.map.end())
+            return false;
+        std::invoke(std::forward<F>(f), *it);
+        return true;
+    }
+
+    template<typename F>
+    bool cvisit(const Key& key, F&& f) const
+    {
+        const auto& shard = shardOf(key);
+        std::shared_lock lock(shard.mutex);
+        auto it = shard.map.find(key);
+        if(it == shard.map.end())
+            return false;
+        std::invoke(std::forward<F>(f), std::as_const(*it));
+        return true;
+    }
+
+    //Inserts T(args...) when the key is missing, then calls f(value_type&) on the element in both cases
+    template<typename F, typename... Args>
+    bool try_emplace_and_visit(const Key& key, F&& f, Args&&... args)
+    {
+        auto& shard = shardOf(key);
+        std::unique_lock lock(shard.mutex);
+        auto [it, inserted] = shard.map.try_emplace(key, std::forward<Args>(args)...);
+        std::invoke(std::forward<F>(f), *it);
+        return inserted;
+    }
+
+    //Copy of the mapped value
+    std::optional<T> find(const Key& key) const
+    {
+        std::optional<T> result;
+        cvisit(key, [&result](const value_type& value) { result.emplace(value.second); });
+        return result;
+    }
+
+    bool contains(const Key& key) const
+    {
+        const auto& shard = shardOf(key);
+        std::shared_lock lock(shard.mutex);
+        return shard.map.contains(key);
+    }
+
+    size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+    //Whole map views, every shard is locked for reading (always in the same order) for the duration
+    template<typename F>
+    void for_each(F&& f) const
+    {
+        auto locks = lockAll();
+        for(const auto& shard : mShards)
+            for(const auto& value : shard->map)
+                std::invoke(f, value);
+    }
+
+    std::vector<std::pair<Key, T>> snapshot() const
+    {
+        auto locks = lockAll();
+        std::vector<std::pair<Key, T>> values;
+        size_type total = 0;
+        for(const auto& shard : mShards)
+            total += shard->map.size();
+        values.reserve(total);
+        for(const auto& shard : mShards)
+            for(const auto& value : shard->map)
+                values.emplace_back(value.first, value.second);
+        return values;
+    }
+
+    size_type size() const
+    {
+        auto locks = lockAll();
+        size_type total = 0;
+        for(const auto& shard : mShards)
+            total += shard->map.size();
+        return total;
+    }
+
+    [[nodiscard]] bool empty() const { return size() == 0; }
+
+    size_type shard_count() const noexcept { return mShards.size(); }
+
+    //Observers
+    hasher hash_function() const { return mHash; }
+
+private:
+    struct alignas(64) Shard
+    {
+        Shard(const Hash& hash, const KeyEqual& equal) : map(0, hash, equal) {}
+
+        mutable std::shared_mutex mutex;
+        shard_map map;
+    };
+
+    //The top bits of the mixed hash pick the shard, the flat_hash_map inside uses the low ones
+    size_type shardIndex(const Key& key) const
+    {
+        if(mShardBits == 0)
+            return 0;
+        return detail::mixHash(mHash(key)) >> (sizeof(size_type) * 8 - mShardBits);
+    }
+
+    Shard& shardOf(const Key& key) { return *mShards[shardIndex(key)]; }
+    const Shard& shardOf(const Key& key) const { return *mShards[shardIndex(key)]; }
+
+    std::vector<std::shared_lock<std::shared_mutex>> lockAll() const
+    {
+        std::vector<std::shared_lock<std::shared_mutex>> locks;
+        locks.reserve(mShards.size());
+        for(const auto& shard : mShards)
+            locks.emplace_back(shard->mutex);
+        return locks;
+    }
+
+    Hash mHash;
+    unsigned mShardBits = 0;
+    std::vector<std::unique_ptr<Shard>> mShards;
+};
+
+} // namespace practise
@@ -0,0 +1,240 @@
+//mpmc_queue<T> : bounded multi-producer multi-consumer FIFO following Dmitry Vyukov's ring buffer design.
+//Every slot carries a sequence number which tells producers and consumers whether the slot is theirs for
+//the current lap, so a push or pop is one CAS on the shared position plus one store to the slot, no locks.
+//Replaces a std::deque guarded by a mutex as work queue, the deque style names are kept where they fit:
+//push_back/emplace_back block while the queue is full, pop_front blocks while it is empty and the try_
+//versions return false instead of waiting.
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace practise
+{
+
+namespace detail
+{
+    //Fixed instead of std::hardware_destructive_interference_size, which GCC warns about in headers
+    //because its value depends on the -mtune flags of each translation unit
+    inline constexpr std::size_t cacheLineSize = 64;
+
+    //Spins a few rounds and then gives the core away, waiting threads may be more than the cores
+    class Backoff
+    {
+    public:
+        void pause() noexcept
+        {
+            if(mSpins < maxSpinRounds)
+            {
+                for(unsigned i = 0; i < (1u << mSpins); ++i)
+                    spinHint();
+                ++mSpins;
+            }
+            else
+                std::this_thread::yield();
+        }
+
+    private:
+        static void spinHint() noexcept
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#endif
+        }
+
+        static constexpr unsigned maxSpinRounds = 6;
+        unsigned mSpins = 0;
+    };
+}
+
+template<typename T>
+class mpmc_queue
+{
+    static_assert(std::is_nothrow_destructible_v<T>, "mpmc_queue elements must have a noexcept destructor");
+    static_assert(std::is_nothrow_move_constructible_v<T>, "mpmc_queue moves the elements out in pop_front");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    //The capacity is rounded up to a power of two so the slot index is a mask of the position. At least two
+    //slots, with a single one the filled sequence pos + 1 equals the free one of the next lap pos + capacity
+    explicit mpmc_queue(size_type capacity)
+        : mMask(roundUpCapacity(capacity) - 1), mSlots(std::make_unique<Slot[]>(mMask + 1))
+    {
+        for(size_type i = 0; i <= mMask; ++i)
+            mSlots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    mpmc_queue(const mpmc_queue&) = delete;
+    mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+    //Must not race with any other member function
+    ~mpmc_queue()
+    {
+        if constexpr(!std::is_trivially_destructible_v<T>)
+        {
+            const auto end = mEnqueuePos.load(std::memory_order_relaxed);
+            for(auto pos = mDequeuePos.load(std::memory_order_relaxed); pos != end; ++pos)
+                element(mSlots[pos & mMask])->~T();
+        }
+    }
+
+    //Modifiers
+    bool try_push_back(const T& value) { return try_emplace_back(value); }
+    bool try_push_back(T&& value) { return try_emplace_back(std::move(value)); }
+
+    template<typename... Args>
+    bool try_emplace_back(Args&&... args)
+    {
+        //A throwing constructor must not leave a claimed slot behind which consumers would wait on forever,
+        //such elements are built first and moved (noexcept) into the slot
+        if constexpr(std::is_nothrow_constructible_v<T, Args...>)
+        {
+            size_type pos;
+            Slot* slot = claimPush(pos);
+            if(!slot)
+                return false;
+            ::new(static_cast<void*>(slot->storage)) T(std::forward<Args>(args)...);
+            slot->sequence.store(pos + 1, std::memory_order_release);
+        }
+        else
+        {
+            T value(std::forward<Args>(args)...);
+            size_type pos;
+            Slot* slot = claimPush(pos);
+            if(!slot)
+                return false;
+            ::new(static_cast<void*>(slot->storage)) T(std::move(value));
+            slot->sequence.store(pos + 1, std::memory_order_release);
+        }
+        return true;
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template<typename... Args>
+    void emplace_back(Args&&... args)
+    {
+        T value(std::forward<Args>(args)...);
+        detail::Backoff backoff;
+        while(!try_emplace_back(std::move(value)))
+            backoff.pause();
+    }
+
+    bool try_pop_front(T& value)
+    {
+        size_type pos;
+        Slot* slot = claimPop(pos);
+        if(!slot)
+            return false;
+        value = std::move(*element(*slot));
+        element(*slot)->~T();
+        slot->sequence.store(pos + mMask + 1, std::memory_order_release);
+        return true;
+    }
+
+    T pop_front()
+    {
+        size_type pos;
+        Slot* slot = nullptr;
+        detail::Backoff backoff;
+        while(!(slot = claimPop(pos)))
+            backoff.pause();
+        T value(std::move(*element(*slot)));
+        element(*slot)->~T();
+        slot->sequence.store(pos + mMask + 1, std::memory_order_release);
+        return value;
+    }
+
+    //Capacity, size() and empty() are snapshots which may be outdated once they return
+    size_type capacity() const noexcept { return mMask + 1; }
+
+    size_type size() const noexcept
+    {
+        const auto dequeued = mDequeuePos.load(std::memory_order_acquire);
+        const auto enqueued = mEnqueuePos.load(std::memory_order_acquire);
+        return enqueued > dequeued ? enqueued - dequeued : 0;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+private:
+    //Each slot on its own cache line, neighbouring producers and consumers do not invalidate each other
+    struct alignas(detail::cacheLineSize) Slot
+    {
+        std::atomic<size_type> sequence;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    static size_type roundUpCapacity(size_type capacity)
+    {
+        if(capacity == 0)
+            throw std::invalid_argument("mpmc_queue needs a capacity of at least one element");
+        size_type rounded = 2;
+        while(rounded < capacity)
+            rounded <<= 1;
+        return rounded;
+    }
+
+    static T* element(Slot& slot) noexcept { return std::launder(reinterpret_cast<T*>(slot.storage)); }
+
+    //A slot is free for the producer at position pos when its sequence is pos, filled for the consumer at
+    //pos when it is pos + 1 and free again for the producer of the next lap when it is pos + capacity.
+    //The claim functions return the slot together with its position, nullptr when the queue is full/empty
+    Slot* claimPush(size_type& pos) noexcept
+    {
+        pos = mEnqueuePos.load(std::memory_order_relaxed);
+        for(;;)
+        {
+            Slot& slot = mSlots[pos & mMask];
+            const auto seq = slot.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if(diff == 0)
+            {
+                if(mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    return &slot;
+            }
+            else if(diff < 0)
+                return nullptr;
+            else
+                pos = mEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    Slot* claimPop(size_type& pos) noexcept
+    {
+        pos = mDequeuePos.load(std::memory_order_relaxed);
+        for(;;)
+        {
+            Slot& slot = mSlots[pos & mMask];
+            const auto seq = slot.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if(diff == 0)
+            {
+                if(mDequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    return &slot;
+            }
+            else if(diff < 0)
+                return nullptr;
+            else
+                pos = mDequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    const size_type mMask;
+    std::unique_ptr<Slot[]> mSlots;
+    alignas(detail::cacheLineSize) std::atomic<size_type> mEnqueuePos{0};
+    alignas(detail::cacheLineSize) std::atomic<size_type> mDequeuePos{0};
+};
+
+} // namespace practise
@@ -0,0 +1,298 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "ConcurrentHashMap.h"
+
+using ConcurrentMap = practise::concurrent_hash_map<int, int>;
+
+static std::map<int,int> sorted(const std::vector<std::pair<int,int>>& values)
+{
+    return std::map<int,int>(values.begin(), values.end());
+}
+
+//Single threaded, same steps as UnorderedMap.Modifiers with the calls the concurrent map offers
+TEST(ConcurrentHashMap, Modifiers)
+{
+    practise::concurrent_hash_map<int, std::string> map(4);
+    EXPECT_EQ(map.shard_count(), 4);
+    EXPECT_TRUE(map.empty());
+
+    //try_emplace does nothing if the key is already present
+    EXPECT_TRUE(map.try_emplace(1, "one"));
+    EXPECT_TRUE(map.try_emplace(2, 3, 'b'));
+    EXPECT_FALSE(map.try_emplace(1, "uno"));
+    EXPECT_EQ(map.find(1), "one");
+    EXPECT_EQ(map.find(2), "bbb");
+
+    //insert_or_assign overwrites
+    EXPECT_FALSE(map.insert_or_assign(1, "uno"));
+    EXPECT_TRUE(map.insert_or_assign(3, "tres"));
+    EXPECT_TRUE(map.insert({4, "four"}));
+    EXPECT_FALSE(map.insert({4, "vier"}));
+    EXPECT_EQ(map.find(1), "uno");
+    EXPECT_EQ(map.size(), 4);
+
+    //visit changes the element in place
+    EXPECT_TRUE(map.visit(3, [](auto& value) { value.second += "!"; }));
+    EXPECT_FALSE(map.visit(7, [](auto& value) { value.second = "never"; }));
+    EXPECT_EQ(map.find(3), "tres!");
+
+    EXPECT_TRUE(map.try_emplace_and_visit(5, [](auto& value) { value.second += "5"; }, "five"));
+    EXPECT_FALSE(map.try_emplace_and_visit(5, [](auto& value) { value.second += "5"; }, "ignored"));
+    EXPECT_EQ(map.find(5), "five55");
+
+    //erase and erase_if
+    EXPECT_EQ(map.erase(2), 1);
+    EXPECT_EQ(map.erase(2), 0);
+    EXPECT_FALSE(map.erase_if(1, [](const auto& value) { return value.second == "one"; }));
+    EXPECT_TRUE(map.erase_if(1, [](const auto& value) { return value.second == "uno"; }));
+    EXPECT_EQ(map.erase_if([](const auto& value) { return value.first % 2 == 1; }), 2);
+
+    auto values = map.snapshot();
+    ASSERT_EQ(values.size(), 1);
+    EXPECT_EQ(values[0].first, 4);
+    EXPECT_EQ(values[0].second, "four");
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_THROW(ConcurrentMap(0), std::invalid_argument);
+}
+
+//Single threaded, same steps as UnorderedMap.LookUp
+TEST(ConcurrentHashMap, LookUp)
+{
+    practise::concurrent_hash_map<int, char> map;
+    map.insert({1,'a'});
+    map.insert({3,'b'});
+    map.insert({2,'c'});
+    EXPECT_EQ(map.count(3), 1);
+    EXPECT_EQ(map.count(7), 0);
+
+    EXPECT_EQ(map.find(2), 'c');
+    EXPECT_EQ(map.find(7), std::nullopt);
+
+    EXPECT_TRUE(map.contains(1));
+    EXPECT_FALSE(map.contains(7));
+
+    char found = 0;
+    EXPECT_TRUE(map.cvisit(3, [&found](const auto& value) { found = value.second; }));
+    EXPECT_EQ(found, 'b');
+
+    int sum = 0;
+    map.for_each([&sum](const auto& value) { sum += value.first; });
+    EXPECT_EQ(sum, 6);
+
+    //Every key ends up in exactly one shard, enough of them to fill every shard
+    ConcurrentMap big(8);
+    big.reserve(10000);
+    for(int i = 0; i < 10000; ++i)
+        big.try_emplace(i, i * 2);
+    EXPECT_EQ(big.size(), 10000);
+    for(int i = 0; i < 10000; ++i)
+        ASSERT_EQ(big.find(i), i * 2);
+}
+
+//Every thread tries to insert the same keys, exactly one try_emplace per key may win
+TEST(ConcurrentHashMap, ConcurrentTryEmplace)
+{
+    constexpr int threadCount = 8;
+    constexpr int keys = 5000;
+    ConcurrentMap map;
+    std::atomic<int> inserted{0};
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < threadCount; ++t)
+        threads.emplace_back([&, t]
+        {
+            for(int key = 0; key < keys; ++key)
+                if(map.try_emplace(key, t))
+                    inserted.fetch_add(1, std::memory_order_relaxed);
+        });
+    for(auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(inserted.load(), keys);
+    EXPECT_EQ(map.size(), keys);
+}
+
+//Visitors run under the shard lock, so concurrent read-modify-write of the same elements loses nothing
+TEST(ConcurrentHashMap, ConcurrentVisitUpdate)
+{
+    constexpr int threadCount = 8;
+    constexpr int keys = 64;
+    constexpr int rounds = 2048;
+    ConcurrentMap map;
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < threadCount; ++t)
+        threads.emplace_back([&]
+        {
+            for(int round = 0; round < rounds; ++round)
+                map.try_emplace_and_visit(round % keys, [](auto& value) { ++value.second; }, 0);
+        });
+    for(auto& thread : threads)
+        thread.join();
+
+    for(int key = 0; key < keys; ++key)
+        EXPECT_EQ(map.find(key), threadCount * rounds / keys);
+}
+
+//Each writer inserts its keys in increasing order. A snapshot holds all shard locks at once, so if it sees
+//a key of a writer it also sees every earlier key of that writer
+TEST(ConcurrentHashMap, SnapshotIsConsistent)
+{
+    constexpr int writers = 4;
+    constexpr int perWriter = 20000;
+    ConcurrentMap map;
+    std::atomic<bool> done{false};
+    std::atomic<int> inconsistent{0};
+
+    std::thread reader([&]
+    {
+        while(!done.load())
+        {
+            std::vector<int> counts(writers, 0), highest(writers, -1);
+            for(const auto& [key, value] : map.snapshot())
+            {
+                ++counts[key / perWriter];
+                highest[key / perWriter] = std::max(highest[key / perWriter], key % perWriter);
+            }
+            for(int w = 0; w < writers; ++w)
+                if(counts[w] != highest[w] + 1)
+                    inconsistent.fetch_add(1);
+        }
+    });
+
+    std::vector<std::thread> threads;
+    for(int w = 0; w < writers; ++w)
+        threads.emplace_back([&, w]
+        {
+            for(int i = 0; i < perWriter; ++i)
+                map.try_emplace(w * perWriter + i, i);
+        });
+    for(auto& thread : threads)
+        thread.join();
+    done = true;
+    reader.join();
+
+    EXPECT_EQ(inconsistent.load(), 0);
+    EXPECT_EQ(map.size(), writers * perWriter);
+}
+
+//Erasing with a predicate while other threads insert, every key is either erased or still there exactly once
+TEST(ConcurrentHashMap, ConcurrentEraseIf)
+{
+    constexpr int keys = 50000;
+    ConcurrentMap map;
+    std::thread writer([&]
+    {
+        for(int key = 0; key < keys; ++key)
+            map.insert_or_assign(key, key);
+    });
+    std::size_t erased = 0;
+    for(int round = 0; round < 20; ++round)
+        erased += map.erase_if([](const auto& value) { return value.second % 3 == 0; });
+    writer.join();
+    erased += map.erase_if([](const auto& value) { return value.second % 3 == 0; });
+
+    EXPECT_EQ(erased, (keys + 2) / 3);
+    EXPECT_EQ(map.size(), keys - erased);
+    map.for_each([](const auto& value) { EXPECT_NE(value.second % 3, 0); });
+}
+
+//Stress suite over the read percentage: 100/0, 90/10 and 50/50 reads/writes. Reads (find, cvisit, contains)
+//go over all keys, every writer (insert_or_assign, visit update, erase) owns a key range, so its final state
+//can be checked against a std::unordered_map the writer keeps on the side
+class ConcurrentHashMapStress : public testing::TestWithParam<int> {};
+
+TEST_P(ConcurrentHashMapStress, ReadWriteMix)
+{
+    const int readPercent = GetParam();
+    constexpr int threadCount = 8;
+    constexpr int keysPerThread = 1000;
+    constexpr int opsPerThread = 50000;
+
+    ConcurrentMap map;
+    for(int key = 0; key < threadCount * keysPerThread; ++key)
+        map.try_emplace(key, key);
+
+    std::vector<std::unordered_map<int,int>> expected(threadCount);
+    std::atomic<long long> hits{0};
+    std::vector<std::thread> threads;
+    for(int t = 0; t < threadCount; ++t)
+        threads.emplace_back([&, t]
+        {
+            auto& mine = expected[t];
+            for(int key = t * keysPerThread; key < (t + 1) * keysPerThread; ++key)
+                mine.emplace(key, key);
+
+            std::mt19937 gen(t);
+            std::uniform_int_distribution<int> percent{0, 99};
+            std::uniform_int_distribution<int> anyKey{0, threadCount * keysPerThread - 1};
+            std::uniform_int_distribution<int> ownKey{t * keysPerThread, (t + 1) * keysPerThread - 1};
+            long long localHits = 0;
+            for(int op = 0; op < opsPerThread; ++op)
+            {
+                const int choice = percent(gen);
+                if(choice < readPercent)
+                {
+                    const int key = anyKey(gen);
+                    switch(op % 3)
+                    {
+                        case 0: localHits += map.find(key).has_value(); break;
+                        case 1: localHits += map.cvisit(key, [](const auto&) {}); break;
+                        default: localHits += map.contains(key); break;
+                    }
+                    continue;
+                }
+                const int key = ownKey(gen);
+                switch(op % 3)
+                {
+                    case 0:
+                        map.insert_or_assign(key, op);
+                        mine.insert_or_assign(key, op);
+                        break;
+                    case 1:
+                        if(map.visit(key, [](auto& value) { value.second += 1; }))
+                            ++mine.at(key);
+                        else
+                            EXPECT_FALSE(mine.contains(key));
+                        break;
+                    default:
+                        EXPECT_EQ(map.erase(key), mine.erase(key));
+                        break;
+                }
+            }
+            hits.fetch_add(localHits);
+        });
+    for(auto& thread : threads)
+        thread.join();
+
+    std::map<int,int> merged;
+    for(const auto& mine : expected)
+        merged.insert(mine.begin(), mine.end());
+    EXPECT_EQ(sorted(map.snapshot()), merged);
+    if(readPercent == 100)
+    {
+        EXPECT_EQ(hits.load(), static_cast<long long>(threadCount) * opsPerThread);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ReadPercent, ConcurrentHashMapStress, testing::Values(100, 90, 50),
+                         [](const testing::TestParamInfo<int>& info)
+                         {
+                             return "Read" + std::to_string(info.param) + "Write" + std::to_string(100 - info.param);
+                         });
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
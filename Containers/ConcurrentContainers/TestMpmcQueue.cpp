@@ -0,0 +1,169 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "MpmcQueue.h"
+
+//push_back/emplace_back/pop_front as TestDeque.cpp uses them, single threaded
+TEST(MpmcQueue, MemberFunctions)
+{
+    practise::mpmc_queue<int> queue(5);
+    EXPECT_EQ(queue.capacity(), 8);
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.size(), 0);
+
+    practise::mpmc_queue<int> smallest(1);
+    EXPECT_EQ(smallest.capacity(), 2);
+    EXPECT_TRUE(smallest.try_push_back(1));
+    EXPECT_TRUE(smallest.try_push_back(2));
+    EXPECT_FALSE(smallest.try_push_back(3));
+    EXPECT_EQ(smallest.pop_front(), 1);
+    EXPECT_TRUE(smallest.try_push_back(3));
+    EXPECT_EQ(smallest.pop_front(), 2);
+    EXPECT_EQ(smallest.pop_front(), 3);
+
+    EXPECT_THROW(practise::mpmc_queue<int>(0), std::invalid_argument);
+}
+
+TEST(MpmcQueue, Modifiers)
+{
+    practise::mpmc_queue<std::string> queue(4);
+
+    //push_back
+    queue.push_back("Hello");
+    std::string world = "World";
+    queue.push_back(world);
+    EXPECT_EQ(queue.size(), 2);
+
+    //emplace_back constructs in place from the arguments
+    queue.emplace_back(3, 'a');
+    EXPECT_TRUE(queue.try_emplace_back("Full"));
+    EXPECT_FALSE(queue.try_emplace_back("Overflow"));
+    EXPECT_FALSE(queue.try_push_back("Overflow"));
+    EXPECT_EQ(queue.size(), 4);
+
+    //pop_front keeps the FIFO order
+    EXPECT_EQ(queue.pop_front(), "Hello");
+    std::string value;
+    EXPECT_TRUE(queue.try_pop_front(value));
+    EXPECT_EQ(value, "World");
+    EXPECT_EQ(queue.pop_front(), "aaa");
+    EXPECT_EQ(queue.pop_front(), "Full");
+    EXPECT_FALSE(queue.try_pop_front(value));
+    EXPECT_TRUE(queue.empty());
+
+    //Positions wrap around the ring several times
+    for(int lap = 0; lap < 10; ++lap)
+    {
+        for(int i = 0; i < 3; ++i)
+            queue.push_back(std::to_string(lap * 3 + i));
+        for(int i = 0; i < 3; ++i)
+            EXPECT_EQ(queue.pop_front(), std::to_string(lap * 3 + i));
+    }
+}
+
+TEST(MpmcQueue, MoveOnlyElements)
+{
+    practise::mpmc_queue<std::unique_ptr<int>> queue(2);
+    queue.push_back(std::make_unique<int>(1));
+    queue.emplace_back(new int(2));
+    EXPECT_EQ(*queue.pop_front(), 1);
+    EXPECT_EQ(*queue.pop_front(), 2);
+}
+
+//Elements left in the queue are destroyed with it
+TEST(MpmcQueue, Destructor)
+{
+    auto shared = std::make_shared<int>(7);
+    {
+        practise::mpmc_queue<std::shared_ptr<int>> queue(8);
+        for(int i = 0; i < 5; ++i)
+            queue.push_back(shared);
+        queue.pop_front();
+        EXPECT_EQ(shared.use_count(), 5);
+    }
+    EXPECT_EQ(shared.use_count(), 1);
+}
+
+//A throwing constructor leaves the queue usable
+TEST(MpmcQueue, ThrowingConstructor)
+{
+    struct Throwing
+    {
+        explicit Throwing(int val) : value(val) { if(val < 0) throw std::runtime_error("negative"); }
+        Throwing(Throwing&&) noexcept = default;
+        Throwing& operator=(Throwing&&) noexcept = default;
+        int value;
+    };
+
+    practise::mpmc_queue<Throwing> queue(2);
+    EXPECT_THROW(queue.emplace_back(-1), std::runtime_error);
+    EXPECT_THROW(queue.try_emplace_back(-1), std::runtime_error);
+    EXPECT_TRUE(queue.empty());
+    queue.emplace_back(1);
+    EXPECT_EQ(queue.pop_front().value, 1);
+}
+
+//Every producer pushes its own range of values through a small queue, so producers and consumers keep
+//overtaking each other. Each value has to come out exactly once and the values of one producer have to
+//come out in the order they went in for every consumer
+TEST(MpmcQueue, ProducersConsumers)
+{
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr int perProducer = 20000;
+
+    practise::mpmc_queue<int> queue(64);
+    std::vector<std::atomic<int>> seen(producers * perProducer);
+    std::atomic<int> outOfOrder{0};
+
+    std::vector<std::thread> threads;
+    for(int p = 0; p < producers; ++p)
+        threads.emplace_back([&queue, p]
+        {
+            for(int i = 0; i < perProducer; ++i)
+            {
+                if(i % 2 == 0)
+                    queue.push_back(p * perProducer + i);
+                else
+                    queue.emplace_back(p * perProducer + i);
+            }
+        });
+
+    for(int c = 0; c < consumers; ++c)
+        threads.emplace_back([&]
+        {
+            std::vector<int> last(producers, -1);
+            for(int i = 0; i < producers * perProducer / consumers; ++i)
+            {
+                int value = 0;
+                if(i % 2 == 0)
+                    value = queue.pop_front();
+                else
+                    while(!queue.try_pop_front(value))
+                        std::this_thread::yield();
+                seen[value].fetch_add(1, std::memory_order_relaxed);
+                auto& previous = last[value / perProducer];
+                if(value <= previous)
+                    outOfOrder.fetch_add(1, std::memory_order_relaxed);
+                previous = value;
+            }
+        });
+
+    for(auto& thread : threads)
+        thread.join();
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(outOfOrder.load(), 0);
+    for(std::size_t i = 0; i < seen.size(); ++i)
+        ASSERT_EQ(seen[i].load(), 1) << "value " << i;
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
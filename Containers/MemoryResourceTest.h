@@ -0,0 +1,35 @@
+//Typed fixture which runs a node based container test once per memory resource (monotonic, pool, arena)
+#pragma once
+
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <string>
+#include "Utils/MemoryResources.h"
+
+using MemoryResources = testing::Types<utils::MonotonicResource,
+                                       utils::PoolResource,
+                                       utils::ThreadArenaResource>;
+
+//Prints the tests as <Suite>/pool.<Test> instead of <Suite>/1.<Test>
+struct MemoryResourceNames
+{
+    template<typename Resource>
+    static std::string GetName(int) { return std::string(Resource::name); }
+};
+
+//The resource is installed as the default resource for the duration of the test, so every std::pmr
+//container the test creates without an explicit allocator (including copies) allocates from it
+template<typename Resource>
+class MemoryResourceTest : public testing::Test
+{
+    protected:
+        MemoryResourceTest() : mPrevious(std::pmr::set_default_resource(mResource.get())) {}
+
+        ~MemoryResourceTest() override { std::pmr::set_default_resource(mPrevious); }
+
+        std::pmr::memory_resource* resource() { return mResource.get(); }
+
+        //Every container of the test has to be destroyed before the resource, they are locals of the test body
+        Resource mResource;
+        std::pmr::memory_resource* mPrevious;
+};
@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <numeric>
+#include "Utils/BenchmarkUtils.h"
+
+//std::array size is a compile time constant, so the sweep is done over fixed instantiations
+//and the storage is heap allocated to keep the large ones off the stack
+template<std::size_t N>
+static void BM_ArrayFill(benchmark::State& state)
+{
+    auto arr = std::make_unique<std::array<int, N>>();
+    for(auto _ : state)
+    {
+        arr->fill(5);
+        benchmark::DoNotOptimize(arr->data());
+    }
+    bench::reportPerOp(state, N, sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_ArrayFill, 1'000);
+BENCHMARK_TEMPLATE(BM_ArrayFill, 100'000);
+BENCHMARK_TEMPLATE(BM_ArrayFill, 10'000'000);
+
+template<std::size_t N>
+static void BM_ArrayIterate(benchmark::State& state)
+{
+    auto arr = std::make_unique<std::array<int, N>>();
+    std::iota(arr->begin(), arr->end(), 0);
+    for(auto _ : state)
+    {
+        long long sum = 0;
+        for(auto val : *arr)
+            sum += val;
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::reportPerOp(state, N, sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_ArrayIterate, 1'000);
+BENCHMARK_TEMPLATE(BM_ArrayIterate, 100'000);
+BENCHMARK_TEMPLATE(BM_ArrayIterate, 10'000'000);
+
+template<std::size_t N>
+static void BM_ArraySwap(benchmark::State& state)
+{
+    auto arr1 = std::make_unique<std::array<int, N>>();
+    auto arr2 = std::make_unique<std::array<int, N>>();
+    for(auto _ : state)
+    {
+        arr1->swap(*arr2);
+        benchmark::DoNotOptimize(arr1->data());
+    }
+    bench::reportPerOp(state, N, 2 * sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_ArraySwap, 1'000);
+BENCHMARK_TEMPLATE(BM_ArraySwap, 100'000);
+BENCHMARK_TEMPLATE(BM_ArraySwap, 10'000'000);
+
+template<std::size_t N>
+static void BM_ArrayCompare(benchmark::State& state)
+{
+    auto arr1 = std::make_unique<std::array<int, N>>();
+    auto arr2 = std::make_unique<std::array<int, N>>();
+    for(auto _ : state)
+    {
+        bool less = *arr1 < *arr2;
+        benchmark::DoNotOptimize(less);
+    }
+    bench::reportPerOp(state, N, 2 * sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_ArrayCompare, 1'000);
+BENCHMARK_TEMPLATE(BM_ArrayCompare, 100'000);
+BENCHMARK_TEMPLATE(BM_ArrayCompare, 10'000'000);
+
+BENCHMARK_MAIN();
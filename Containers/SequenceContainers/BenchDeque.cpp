@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+#include <deque>
+#include "Utils/BenchmarkUtils.h"
+
+static void BM_DequePushBack(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    for(auto _ : state)
+    {
+        std::deque<int> deq;
+        for(int i = 0; i < count; ++i)
+            deq.push_back(i);
+        benchmark::DoNotOptimize(deq.back());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_DequePushBack)->Apply(bench::elementSweep);
+
+static void BM_DequePushFront(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    for(auto _ : state)
+    {
+        std::deque<int> deq;
+        for(int i = 0; i < count; ++i)
+            deq.push_front(i);
+        benchmark::DoNotOptimize(deq.front());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_DequePushFront)->Apply(bench::elementSweep);
+
+//Work queue pattern: everything pushed at the back is popped from the front
+static void BM_DequeFifo(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    std::deque<int> deq;
+    for(auto _ : state)
+    {
+        for(int i = 0; i < count; ++i)
+            deq.emplace_back(i);
+        while(!deq.empty())
+            deq.pop_front();
+    }
+    bench::reportPerOp(state, 2 * count, sizeof(int));
+}
+BENCHMARK(BM_DequeFifo)->Apply(bench::elementSweep);
+
+static void BM_DequeRandomAccess(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto values = bench::iotaInts(count);
+    std::deque<int> deq(values.begin(), values.end());
+    for(auto _ : state)
+    {
+        long long sum = 0;
+        for(std::size_t i = 0; i < deq.size(); ++i)
+            sum += deq[i];
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_DequeRandomAccess)->Apply(bench::elementSweep);
+
+BENCHMARK_MAIN();
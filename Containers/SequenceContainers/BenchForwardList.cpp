@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+#include <forward_list>
+#include "ListSort.h"
+#include "Utils/BenchmarkUtils.h"
+#include "Utils/MemoryResourceBenchmarkUtils.h"
+#include "Utils/ParallelBenchmarkUtils.h"
+
+static void BM_ForwardListPushFront(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    for(auto _ : state)
+    {
+        std::forward_list<int> lst;
+        for(int i = 0; i < count; ++i)
+            lst.push_front(i);
+        benchmark::DoNotOptimize(lst.front());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_ForwardListPushFront)->Apply(bench::elementSweep);
+
+static void BM_ForwardListIterate(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto values = bench::iotaInts(count);
+    std::forward_list<int> lst(values.begin(), values.end());
+    for(auto _ : state)
+    {
+        long long sum = 0;
+        for(auto val : lst)
+            sum += val;
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_ForwardListIterate)->Apply(bench::elementSweep);
+
+static void BM_ForwardListSort(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto values = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        std::forward_list<int> lst(values.begin(), values.end());
+        state.ResumeTiming();
+        lst.sort();
+        benchmark::DoNotOptimize(lst.front());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_ForwardListSort)->Apply(bench::elementSweep);
+
+//practise::list_sort, the bottom-up bin merge sort without recursion
+static void BM_ForwardListSortBins(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto values = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        std::forward_list<int> lst(values.begin(), values.end());
+        state.ResumeTiming();
+        practise::list_sort(lst);
+        benchmark::DoNotOptimize(lst.front());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_ForwardListSortBins)->Apply(bench::elementSweep);
+
+//practise::parallel_list_sort on 16M nodes from 1 thread up to the hardware thread count
+static void BM_ForwardListSortParallel(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto threads = static_cast<unsigned>(state.range(1));
+    auto values = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        std::forward_list<int> lst(values.begin(), values.end());
+        state.ResumeTiming();
+        practise::parallel_list_sort(lst, threads);
+        benchmark::DoNotOptimize(lst.front());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_ForwardListSortParallel)->Apply(bench::threadSweep<std::execution::parallel_policy>);
+
+static void BM_ForwardListRemoveIf(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto values = bench::iotaInts(count);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        std::forward_list<int> lst(values.begin(), values.end());
+        state.ResumeTiming();
+        lst.remove_if([](int num){return (num % 2) == 0;});
+        benchmark::DoNotOptimize(lst.front());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_ForwardListRemoveIf)->Apply(bench::elementSweep);
+
+//Insert/erase churn with std::allocator, monotonic, pool and the thread arena, see bench::insertEraseChurn
+template<typename Resource>
+static void BM_ForwardListInsertEraseResource(benchmark::State& state)
+{
+    using ForwardList = std::forward_list<int, typename Resource::template allocator_type<int>>;
+    bench::insertEraseChurn<ForwardList, Resource>(state, [](ForwardList& lst, int val) { lst.push_front(val); });
+}
+BENCHMARK_MEMORY_RESOURCES(BM_ForwardListInsertEraseResource);
+
+BENCHMARK_MAIN();
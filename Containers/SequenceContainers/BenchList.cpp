@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+#include <list>
+#include "ListSort.h"
+#include "Utils/BenchmarkUtils.h"
+#include "Utils/MemoryResourceBenchmarkUtils.h"
+#include "Utils/ParallelBenchmarkUtils.h"
+
+static void BM_ListPushBack(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    for(auto _ : state)
+    {
+        std::list<int> lst;
+        for(int i = 0; i < count; ++i)
+            lst.push_back(i);
+        benchmark::DoNotOptimize(lst.back());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_ListPushBack)->Apply(bench::elementSweep);
+
+static void BM_ListIterate(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto values = bench::iotaInts(count);
+    std::list<int> lst(values.begin(), values.end());
+    for(auto _ : state)
+    {
+        long long sum = 0;
+        for(auto val : lst)
+            sum += val;
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_ListIterate)->Apply(bench::elementSweep);
+
+static void BM_ListSort(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto values = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        std::list<int> lst(values.begin(), values.end());
+        state.ResumeTiming();
+        lst.sort();
+        benchmark::DoNotOptimize(lst.front());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_ListSort)->Apply(bench::elementSweep);
+
+//practise::list_sort, the bottom-up bin merge sort without recursion
+static void BM_ListSortBins(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto values = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        std::list<int> lst(values.begin(), values.end());
+        state.ResumeTiming();
+        practise::list_sort(lst);
+        benchmark::DoNotOptimize(lst.front());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_ListSortBins)->Apply(bench::elementSweep);
+
+//practise::parallel_list_sort on 16M nodes from 1 thread up to the hardware thread count
+static void BM_ListSortParallel(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto threads = static_cast<unsigned>(state.range(1));
+    auto values = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        std::list<int> lst(values.begin(), values.end());
+        state.ResumeTiming();
+        practise::parallel_list_sort(lst, threads);
+        benchmark::DoNotOptimize(lst.front());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_ListSortParallel)->Apply(bench::threadSweep<std::execution::parallel_policy>);
+
+static void BM_ListMerge(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto values = bench::iotaInts(count);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        std::list<int> lst1(values.begin(), values.end());
+        std::list<int> lst2(values.begin(), values.end());
+        state.ResumeTiming();
+        lst1.merge(lst2);
+        benchmark::DoNotOptimize(lst1.front());
+    }
+    bench::reportPerOp(state, 2 * count, sizeof(int));
+}
+BENCHMARK(BM_ListMerge)->Apply(bench::elementSweep);
+
+static void BM_ListUnique(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto values = bench::randomInts(count, 4);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        std::list<int> lst(values.begin(), values.end());
+        state.ResumeTiming();
+        lst.unique();
+        benchmark::DoNotOptimize(lst.front());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_ListUnique)->Apply(bench::elementSweep);
+
+//Insert/erase churn with std::allocator, monotonic, pool and the thread arena, see bench::insertEraseChurn
+template<typename Resource>
+static void BM_ListInsertEraseResource(benchmark::State& state)
+{
+    using List = std::list<int, typename Resource::template allocator_type<int>>;
+    bench::insertEraseChurn<List, Resource>(state, [](List& lst, int val) { lst.push_back(val); });
+}
+BENCHMARK_MEMORY_RESOURCES(BM_ListInsertEraseResource);
+
+BENCHMARK_MAIN();
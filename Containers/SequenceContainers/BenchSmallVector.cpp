@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <vector>
+#include "SmallVector.h"
+#include "Utils/AllocationTracking.h"
+#include "Utils/BenchmarkUtils.h"
+
+//Heap allocations of the process come from the allocationTracking replacement of operator new, read before
+//and after the timed loop
+static std::size_t allocationCount() { return utils::allocationCounters().count; }
+
+//Builds a short lived vector of state.range(0) elements per op, which is the common pattern
+//small_vector is meant for. allocs/op shows the heap traffic next to the latency.
+template<typename Vector>
+static void BM_BuildShortVector(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    const auto allocationsBefore = allocationCount();
+    for(auto _ : state)
+    {
+        Vector vec;
+        for(int i = 0; i < count; ++i)
+            vec.push_back(i);
+        benchmark::DoNotOptimize(vec.data());
+        benchmark::ClobberMemory();
+    }
+    state.counters["allocs/op"] = benchmark::Counter(static_cast<double>(allocationCount() - allocationsBefore),
+                                                     benchmark::Counter::kAvgIterations);
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_BuildShortVector, std::vector<int>)->DenseRange(2, 32, 6)->Arg(64);
+BENCHMARK_TEMPLATE(BM_BuildShortVector, practise::small_vector<int, 16>)->DenseRange(2, 32, 6)->Arg(64);
+
+//Copying the vectors around, e.g. returning them by value out of a lookup
+template<typename Vector>
+static void BM_CopyShortVector(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+    Vector source;
+    for(int i = 0; i < count; ++i)
+        source.push_back(i);
+    const auto allocationsBefore = allocationCount();
+    for(auto _ : state)
+    {
+        Vector copy(source);
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.counters["allocs/op"] = benchmark::Counter(static_cast<double>(allocationCount() - allocationsBefore),
+                                                     benchmark::Counter::kAvgIterations);
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_CopyShortVector, std::vector<int>)->DenseRange(2, 32, 6)->Arg(64);
+BENCHMARK_TEMPLATE(BM_CopyShortVector, practise::small_vector<int, 16>)->DenseRange(2, 32, 6)->Arg(64);
+
+//Large sizes, where small_vector must not be slower than std::vector once it lives on the heap
+template<typename Vector>
+static void BM_PushBackLarge(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    for(auto _ : state)
+    {
+        Vector vec;
+        for(int i = 0; i < count; ++i)
+            vec.push_back(i);
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_PushBackLarge, std::vector<int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_PushBackLarge, practise::small_vector<int, 16>)->Apply(bench::elementSweep);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+#include <list>
+#include "UnrolledList.h"
+#include "Utils/BenchmarkUtils.h"
+
+//std::list against practise::unrolled_list on the operations an ordered event stream needs, from 1e3 up to
+//BENCH_MAX_ELEMENTS elements (run with --benchmark_filter=/10000000 for the 1e7 comparison)
+template<typename List>
+static void BM_Iterate(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto values = bench::iotaInts(count);
+    List lst(values.begin(), values.end());
+    for(auto _ : state)
+    {
+        long long sum = 0;
+        for(auto val : lst)
+            sum += val;
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_Iterate, std::list<int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_Iterate, practise::unrolled_list<int>)->Apply(bench::elementSweep);
+
+//Keeps inserting in front of the same element in the middle of the list, the position is found once
+template<typename List>
+static void BM_MidInsert(benchmark::State& state)
+{
+    constexpr int insertsPerIteration = 1024;
+    const auto count = state.range(0);
+    auto values = bench::iotaInts(count);
+    List lst(values.begin(), values.end());
+    auto it = std::next(lst.begin(), count / 2);
+    for(auto _ : state)
+    {
+        for(int i = 0; i < insertsPerIteration; ++i)
+            it = lst.insert(it, i);
+        benchmark::DoNotOptimize(*it);
+    }
+    bench::reportPerOp(state, insertsPerIteration, sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_MidInsert, std::list<int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_MidInsert, practise::unrolled_list<int>)->Apply(bench::elementSweep);
+
+template<typename List>
+static void BM_Sort(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto values = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        List lst(values.begin(), values.end());
+        state.ResumeTiming();
+        lst.sort();
+        benchmark::DoNotOptimize(lst.front());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_Sort, std::list<int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_Sort, practise::unrolled_list<int>)->Apply(bench::elementSweep);
+
+//Moves the middle half of one list to the front of another and back
+template<typename List>
+static void BM_SpliceRange(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto values = bench::iotaInts(count);
+    List source(values.begin(), values.end());
+    List target{-1};
+    for(auto _ : state)
+    {
+        target.splice(target.begin(), source, std::next(source.begin(), count / 4), std::next(source.begin(), 3 * count / 4));
+        source.splice(std::next(source.begin(), count / 4), target, target.begin(), std::prev(target.end()));
+        benchmark::DoNotOptimize(source.front());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK_TEMPLATE(BM_SpliceRange, std::list<int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_SpliceRange, practise::unrolled_list<int>)->Apply(bench::elementSweep);
+
+BENCHMARK_MAIN();
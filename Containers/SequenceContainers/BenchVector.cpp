@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "Utils/BenchmarkUtils.h"
+
+static void BM_VectorPushBack(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    for(auto _ : state)
+    {
+        std::vector<int> vec;
+        for(int i = 0; i < count; ++i)
+            vec.push_back(i);
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_VectorPushBack)->Apply(bench::elementSweep);
+
+static void BM_VectorPushBackReserved(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    for(auto _ : state)
+    {
+        std::vector<int> vec;
+        vec.reserve(count);
+        for(int i = 0; i < count; ++i)
+            vec.push_back(i);
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_VectorPushBackReserved)->Apply(bench::elementSweep);
+
+static void BM_VectorAssign(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    std::vector<int> vec;
+    for(auto _ : state)
+    {
+        vec.assign(count, 5);
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_VectorAssign)->Apply(bench::elementSweep);
+
+static void BM_VectorElementsAccess(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto vec = bench::iotaInts(count);
+    for(auto _ : state)
+    {
+        long long sum = 0;
+        for(std::size_t i = 0; i < vec.size(); ++i)
+            sum += vec[i];
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_VectorElementsAccess)->Apply(bench::elementSweep);
+
+//Same shape as the Modifiers test: insert a whole range in front of the second element
+static void BM_VectorInsertRange(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto source = bench::iotaInts(count);
+    for(auto _ : state)
+    {
+        std::vector<int> vec1{11,22,33};
+        vec1.insert(vec1.begin()+1, source.begin(), source.end());
+        benchmark::DoNotOptimize(vec1.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_VectorInsertRange)->Apply(bench::elementSweep);
+
+static void BM_VectorEraseIf(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto source = bench::iotaInts(count);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        auto vec = source;
+        state.ResumeTiming();
+        std::erase_if(vec, [](int num){return (num % 2) == 0;});
+        benchmark::DoNotOptimize(vec.data());
+    }
+    bench::reportPerOp(state, count, sizeof(int));
+}
+BENCHMARK(BM_VectorEraseIf)->Apply(bench::elementSweep);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,188 @@
+//list_sort : node sorting engine for std::list and std::forward_list (any list with merge, swap and splice).
+//The sequential mode is an in place bottom-up merge sort over a fixed array of 64 bins, bin i holding a
+//sorted run of 2^i nodes: every node is spliced into a carry list which is merged upwards through the full
+//bins, no recursion and no allocation besides the empty bin lists.
+//The parallel mode cuts the list into one run per thread, sorts the runs with the sequential mode on worker
+//threads and merges neighbouring runs pairwise, again on worker threads, until one list is left. Nodes are
+//only ever relinked, never copied. Both modes are stable, comp has to be safe to call from several threads.
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Algorithms/ParallelChunks.h"
+
+namespace practise
+{
+
+namespace detail
+{
+    template<typename List>
+    concept SortableList = requires(List& lst) { lst.merge(lst); lst.swap(lst); lst.get_allocator(); };
+
+    template<typename List>
+    concept ForwardList = SortableList<List> && requires(List& lst) { lst.splice_after(lst.before_begin(), lst); };
+
+    //Nodes per run: every node is a cache miss, so runs pay for their thread well below the
+    //minParallelChunk of the Algorithms headers
+    inline constexpr std::size_t minParallelRun = 1 << 12;
+
+    //Moves the first node of src to the front of dst
+    template<typename List>
+    void moveFront(List& dst, List& src)
+    {
+        if constexpr(ForwardList<List>)
+            dst.splice_after(dst.before_begin(), src, src.before_begin());
+        else
+            dst.splice(dst.begin(), src, src.begin());
+    }
+
+    //Moves the first count nodes of src to the end of the empty list dst
+    template<typename List>
+    void takeFront(List& dst, List& src, std::size_t count)
+    {
+        const auto last = std::next(src.begin(), static_cast<std::ptrdiff_t>(count));
+        if constexpr(ForwardList<List>)
+            dst.splice_after(dst.before_begin(), src, src.before_begin(), last);
+        else
+            dst.splice(dst.end(), src, src.begin(), last);
+    }
+
+    //Moves all nodes of src into dst, order between the two is not kept
+    template<typename List>
+    void moveAll(List& dst, List& src)
+    {
+        if constexpr(ForwardList<List>)
+            dst.splice_after(dst.before_begin(), src);
+        else
+            dst.splice(dst.end(), src);
+    }
+
+    template<typename List>
+    std::size_t listSize(const List& lst)
+    {
+        if constexpr(ForwardList<List>)
+            return static_cast<std::size_t>(std::distance(lst.begin(), lst.end()));
+        else
+            return lst.size();
+    }
+
+    //The bins share the allocator of the list, splicing between lists with different pmr resources is undefined
+    template<typename List, std::size_t... Index>
+    std::array<List, sizeof...(Index)> makeBins(const typename List::allocator_type& alloc, std::index_sequence<Index...>)
+    {
+        return {((void)Index, List(alloc))...};
+    }
+
+    template<typename List, typename Compare>
+    void binMergeSort(List& lst, Compare& comp)
+    {
+        if(lst.empty() || std::next(lst.begin()) == lst.end())
+            return;
+
+        //Bin i holds 2^i nodes once full, 64 bins cover any list that fits in memory
+        constexpr std::size_t binCount = 64;
+        auto bins = makeBins<List>(lst.get_allocator(), std::make_index_sequence<binCount>{});
+        List carry(lst.get_allocator());
+        std::size_t fill = 0;
+        try
+        {
+            while(!lst.empty())
+            {
+                moveFront(carry, lst);
+                std::size_t bin = 0;
+                //The bins hold the older nodes, merging carry into them keeps equal elements in order
+                for(; bin < fill && !bins[bin].empty(); ++bin)
+                {
+                    bins[bin].merge(carry, std::ref(comp));
+                    carry.swap(bins[bin]);
+                }
+                carry.swap(bins[bin]);
+                if(bin == fill)
+                    ++fill;
+            }
+            for(std::size_t bin = 1; bin < fill; ++bin)
+                bins[bin].merge(bins[bin - 1], std::ref(comp));
+        }
+        catch(...)
+        {
+            //A throwing comp leaves all nodes in lst, in an unspecified order
+            moveAll(lst, carry);
+            for(auto& bin : bins)
+                moveAll(lst, bin);
+            throw;
+        }
+        lst.swap(bins[fill - 1]);
+    }
+}
+
+//Sequential mode
+template<detail::SortableList List, typename Compare = std::less<>>
+void list_sort(List& lst, Compare comp = Compare())
+{
+    detail::binMergeSort(lst, comp);
+}
+
+//Parallel mode as in Algorithms/ParallelChunks.h, runs of at least detail::minParallelRun nodes
+template<detail::SortableList List, typename Compare = std::less<>>
+void parallel_list_sort(List& lst, unsigned threadCount, Compare comp = Compare())
+{
+    const detail::Chunks chunks(detail::listSize(lst), detail::minParallelRun, threadCount);
+    if(chunks.count == 1)
+    {
+        detail::binMergeSort(lst, comp);
+        return;
+    }
+
+    std::vector<List> runs;
+    runs.reserve(chunks.count);
+    for(std::size_t run = 0; run < chunks.count; ++run)
+    {
+        runs.emplace_back(lst.get_allocator());
+        detail::takeFront(runs.back(), lst, chunks.last(run) - chunks.first(run));
+    }
+
+    //Every task compares through its own copy of comp
+    try
+    {
+        auto sortRun = [&runs, &comp](std::size_t run)
+        {
+            auto runComp = comp;
+            detail::binMergeSort(runs[run], runComp);
+        };
+        detail::runChunks(chunks.count, sortRun);
+
+        //Round k merges run i + 2^k into run i, the earlier run keeps its nodes first for equal elements
+        for(std::size_t step = 1; step < chunks.count; step *= 2)
+        {
+            auto mergePair = [&runs, &comp, step](std::size_t pair)
+            {
+                const auto run = 2 * step * pair;
+                runs[run].merge(runs[run + step], comp);
+            };
+            detail::runChunks((chunks.count + step - 1) / (2 * step), mergePair);
+        }
+    }
+    catch(...)
+    {
+        for(auto& run : runs)
+            detail::moveAll(lst, run);
+        throw;
+    }
+    lst.swap(runs[0]);
+}
+
+//Execution policy front end
+template<typename Policy, detail::SortableList List, typename Compare = std::less<>>
+    requires std::is_execution_policy_v<std::remove_cvref_t<Policy>>
+void list_sort(Policy&&, List& lst, Compare comp = Compare())
+{
+    parallel_list_sort(lst, detail::policyThreads<Policy>(), comp);
+}
+
+}
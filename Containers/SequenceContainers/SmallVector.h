@@ -0,0 +1,462 @@
+//small_vector<T, N> : std::vector like container which keeps the first N elements inline
+//and only goes to the heap once the size grows past N.
+//Most of the vectors in the code base hold a handful of elements, for them push_back never allocates.
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace practise
+{
+
+template<typename T, std::size_t N>
+class small_vector
+{
+    static_assert(N > 0, "small_vector needs at least one inline element, use std::vector otherwise");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type inline_capacity = N;
+
+    //constructors
+    small_vector() noexcept = default;
+
+    small_vector(size_type count, const T& value)
+    {
+        assign(count, value);
+    }
+
+    explicit small_vector(size_type count)
+    {
+        resize(count);
+    }
+
+    template<std::input_iterator InputIt>
+    small_vector(InputIt first, InputIt last)
+    {
+        assign(first, last);
+    }
+
+    small_vector(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    small_vector(const small_vector& other)
+    {
+        assign(other.begin(), other.end());
+    }
+
+    small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        moveFrom(std::move(other));
+    }
+
+    ~small_vector()
+    {
+        clear();
+        releaseHeap();
+    }
+
+    // = operator
+    small_vector& operator=(const small_vector& other)
+    {
+        if(this != &other)
+            assign(other.begin(), other.end());
+        return *this;
+    }
+
+    small_vector& operator=(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if(this != &other)
+        {
+            clear();
+            releaseHeap();
+            moveFrom(std::move(other));
+        }
+        return *this;
+    }
+
+    small_vector& operator=(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+        return *this;
+    }
+
+    //assign
+    void assign(size_type count, const T& value)
+    {
+        T copy(value);
+        clear();
+        reserve(count);
+        std::uninitialized_fill_n(mData, count, copy);
+        mSize = count;
+    }
+
+    template<std::input_iterator InputIt>
+    void assign(InputIt first, InputIt last)
+    {
+        clear();
+        if constexpr(std::forward_iterator<InputIt>)
+        {
+            const auto count = static_cast<size_type>(std::distance(first, last));
+            reserve(count);
+            std::uninitialized_copy(first, last, mData);
+            mSize = count;
+        }
+        else
+        {
+            for(; first != last; ++first)
+                emplace_back(*first);
+        }
+    }
+
+    void assign(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    //element access
+    reference at(size_type pos)
+    {
+        if(pos >= mSize)
+            throw std::out_of_range("small_vector::at");
+        return mData[pos];
+    }
+
+    const_reference at(size_type pos) const
+    {
+        if(pos >= mSize)
+            throw std::out_of_range("small_vector::at");
+        return mData[pos];
+    }
+
+    reference operator[](size_type pos) { return mData[pos]; }
+    const_reference operator[](size_type pos) const { return mData[pos]; }
+
+    reference front() { return mData[0]; }
+    const_reference front() const { return mData[0]; }
+
+    reference back() { return mData[mSize - 1]; }
+    const_reference back() const { return mData[mSize - 1]; }
+
+    T* data() noexcept { return mData; }
+    const T* data() const noexcept { return mData; }
+
+    //iterators
+    iterator begin() noexcept { return mData; }
+    const_iterator begin() const noexcept { return mData; }
+    const_iterator cbegin() const noexcept { return mData; }
+
+    iterator end() noexcept { return mData + mSize; }
+    const_iterator end() const noexcept { return mData + mSize; }
+    const_iterator cend() const noexcept { return mData + mSize; }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+    //capacity
+    [[nodiscard]] bool empty() const noexcept { return mSize == 0; }
+    size_type size() const noexcept { return mSize; }
+    size_type max_size() const noexcept { return static_cast<size_type>(-1) / sizeof(T); }
+    size_type capacity() const noexcept { return mCapacity; }
+
+    //true as long as the elements still live in the inline buffer
+    bool is_inline() const noexcept { return mData == inlineData(); }
+
+    void reserve(size_type newCapacity)
+    {
+        if(newCapacity > mCapacity)
+            reallocate(newCapacity);
+    }
+
+    //Goes back to the inline buffer when the elements fit, otherwise trims the heap block to size()
+    void shrink_to_fit()
+    {
+        if(is_inline() || mSize == mCapacity)
+            return;
+        reallocate(std::max(mSize, N));
+    }
+
+    //modifiers
+    void clear() noexcept
+    {
+        std::destroy(mData, mData + mSize);
+        mSize = 0;
+    }
+
+    iterator insert(const_iterator pos, const T& value)
+    {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value)
+    {
+        return emplace(pos, std::move(value));
+    }
+
+    iterator insert(const_iterator pos, size_type count, const T& value)
+    {
+        const auto index = static_cast<size_type>(pos - cbegin());
+        T copy(value);
+        reserve(mSize + count);
+        std::uninitialized_fill_n(mData + mSize, count, copy);
+        mSize += count;
+        return rotateIntoPlace(index, mSize - count);
+    }
+
+    template<std::input_iterator InputIt>
+    iterator insert(const_iterator pos, InputIt first, InputIt last)
+    {
+        const auto index = static_cast<size_type>(pos - cbegin());
+        const auto oldSize = mSize;
+        if constexpr(std::forward_iterator<InputIt>)
+        {
+            const auto count = static_cast<size_type>(std::distance(first, last));
+            reserve(mSize + count);
+            std::uninitialized_copy(first, last, mData + mSize);
+            mSize += count;
+        }
+        else
+        {
+            for(; first != last; ++first)
+                emplace_back(*first);
+        }
+        return rotateIntoPlace(index, oldSize);
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<T> init)
+    {
+        return insert(pos, init.begin(), init.end());
+    }
+
+    template<typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args)
+    {
+        const auto index = static_cast<size_type>(pos - cbegin());
+        emplace_back(std::forward<Args>(args)...);
+        return rotateIntoPlace(index, mSize - 1);
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        auto dst = mData + (first - cbegin());
+        auto src = mData + (last - cbegin());
+        if(dst != src)
+        {
+            auto newEnd = std::move(src, end(), dst);
+            std::destroy(newEnd, end());
+            mSize = static_cast<size_type>(newEnd - mData);
+        }
+        return dst;
+    }
+
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    template<typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        if(mSize == mCapacity)
+            return growAndEmplaceBack(std::forward<Args>(args)...);
+        auto element = std::construct_at(mData + mSize, std::forward<Args>(args)...);
+        ++mSize;
+        return *element;
+    }
+
+    void pop_back()
+    {
+        --mSize;
+        std::destroy_at(mData + mSize);
+    }
+
+    void resize(size_type count)
+    {
+        if(count < mSize)
+        {
+            std::destroy(mData + count, end());
+            mSize = count;
+            return;
+        }
+        reserve(count);
+        std::uninitialized_value_construct(mData + mSize, mData + count);
+        mSize = count;
+    }
+
+    void resize(size_type count, const value_type& value)
+    {
+        if(count < mSize)
+        {
+            std::destroy(mData + count, end());
+            mSize = count;
+            return;
+        }
+        insert(cend(), count - mSize, value);
+    }
+
+    void swap(small_vector& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        small_vector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    //non member functions
+    friend bool operator==(const small_vector& lhs, const small_vector& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend auto operator<=>(const small_vector& lhs, const small_vector& rhs)
+    {
+        return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend void swap(small_vector& lhs, small_vector& rhs) noexcept(noexcept(lhs.swap(rhs)))
+    {
+        lhs.swap(rhs);
+    }
+
+private:
+    T* inlineData() noexcept { return std::launder(reinterpret_cast<T*>(mBuffer)); }
+    const T* inlineData() const noexcept { return std::launder(reinterpret_cast<const T*>(mBuffer)); }
+
+    static size_type grownCapacity(size_type capacity, size_type required)
+    {
+        return std::max(capacity * 2, required);
+    }
+
+    void releaseHeap() noexcept
+    {
+        if(!is_inline())
+            ::operator delete(mData, std::align_val_t{alignof(T)});
+        mData = inlineData();
+        mCapacity = N;
+    }
+
+    //Takes over the heap block of other, or moves its inline elements one by one
+    void moveFrom(small_vector&& other)
+    {
+        if(other.is_inline())
+        {
+            std::uninitialized_move(other.begin(), other.end(), mData);
+            mSize = other.mSize;
+            other.clear();
+            return;
+        }
+        mData = other.mData;
+        mSize = other.mSize;
+        mCapacity = other.mCapacity;
+        other.mData = other.inlineData();
+        other.mSize = 0;
+        other.mCapacity = N;
+    }
+
+    //Moves the elements into a block of newCapacity, which is the inline buffer if newCapacity <= N
+    void reallocate(size_type newCapacity)
+    {
+        T* newData = newCapacity <= N ? inlineData()
+                   : static_cast<T*>(::operator new(newCapacity * sizeof(T), std::align_val_t{alignof(T)}));
+        if(newData == mData)
+            return;
+        std::uninitialized_move(begin(), end(), newData);
+        std::destroy(begin(), end());
+        if(!is_inline())
+            ::operator delete(mData, std::align_val_t{alignof(T)});
+        mData = newData;
+        mCapacity = std::max(newCapacity, N);
+    }
+
+    //The new element is built before the old ones are moved, so emplace_back(v[0]) stays valid
+    template<typename... Args>
+    reference growAndEmplaceBack(Args&&... args)
+    {
+        const auto newCapacity = grownCapacity(mCapacity, mSize + 1);
+        auto newData = static_cast<T*>(::operator new(newCapacity * sizeof(T), std::align_val_t{alignof(T)}));
+        try
+        {
+            std::construct_at(newData + mSize, std::forward<Args>(args)...);
+        }
+        catch(...)
+        {
+            ::operator delete(newData, std::align_val_t{alignof(T)});
+            throw;
+        }
+        std::uninitialized_move(begin(), end(), newData);
+        std::destroy(begin(), end());
+        if(!is_inline())
+            ::operator delete(mData, std::align_val_t{alignof(T)});
+        mData = newData;
+        mCapacity = newCapacity;
+        return mData[mSize++];
+    }
+
+    //Elements appended at [tail, end) are rotated into position index
+    iterator rotateIntoPlace(size_type index, size_type tail)
+    {
+        std::rotate(mData + index, mData + tail, end());
+        return mData + index;
+    }
+
+    T* mData = inlineData();
+    size_type mSize = 0;
+    size_type mCapacity = N;
+    alignas(T) unsigned char mBuffer[N * sizeof(T)];
+};
+
+//std::erase/std::erase_if counterparts, found through ADL
+template<typename T, std::size_t N, typename U>
+typename small_vector<T, N>::size_type erase(small_vector<T, N>& vec, const U& value)
+{
+    auto newEnd = std::remove(vec.begin(), vec.end(), value);
+    auto removed = static_cast<typename small_vector<T, N>::size_type>(vec.end() - newEnd);
+    vec.erase(newEnd, vec.end());
+    return removed;
+}
+
+template<typename T, std::size_t N, typename Pred>
+typename small_vector<T, N>::size_type erase_if(small_vector<T, N>& vec, Pred pred)
+{
+    auto newEnd = std::remove_if(vec.begin(), vec.end(), pred);
+    auto removed = static_cast<typename small_vector<T, N>::size_type>(vec.end() - newEnd);
+    vec.erase(newEnd, vec.end());
+    return removed;
+}
+
+}
@@ -1,6 +1,16 @@
 #include <iostream>
 #include <gtest/gtest.h>
+#include <atomic>
 #include <forward_list>
+#include <memory_resource>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+#include "Algorithms/ExecutionPolicyTest.h"
+#include "Containers/MemoryResourceTest.h"
+#include "ListSort.h"
 
 TEST(F_List, MemberFunctions)
 {
@@ -264,6 +274,240 @@ TEST(F_List, NonMemberFunctions)
     EXPECT_TRUE(std::equal(lst3.begin(), lst3.end(), std::begin({1,3,3,5})));
 }
 
+//Same scenarios over std::pmr::forward_list, once per memory resource
+template<typename Resource>
+class PmrForwardList : public MemoryResourceTest<Resource> {};
+TYPED_TEST_SUITE(PmrForwardList, MemoryResources, MemoryResourceNames);
+
+TYPED_TEST(PmrForwardList, MemberFunctions)
+{
+    std::pmr::forward_list<int> lst;
+    EXPECT_TRUE(lst.empty());
+    EXPECT_EQ(lst.get_allocator().resource(), this->resource());
+
+    std::pmr::forward_list<int> lst1(3,4);
+    EXPECT_TRUE(std::ranges::equal(lst1, std::initializer_list<int>{4,4,4}));
+
+    std::pmr::forward_list<int> lst2(lst1);
+    EXPECT_TRUE(std::ranges::equal(lst2, lst1));
+    EXPECT_EQ(lst2.get_allocator().resource(), this->resource());
+
+    std::pmr::forward_list<int> lst3{1,2,3,4,5};
+    lst2 = lst3;
+    EXPECT_TRUE(std::ranges::equal(lst2, std::initializer_list<int>{1,2,3,4,5}));
+
+    std::pmr::forward_list<int> lst4;
+    lst4 = std::move(lst2);
+    EXPECT_TRUE(std::ranges::equal(lst4, std::initializer_list<int>{1,2,3,4,5}));
+
+    std::pmr::monotonic_buffer_resource other{std::pmr::new_delete_resource()};
+    std::pmr::forward_list<int> lst5({11,22,33}, &other);
+    EXPECT_EQ(lst5.get_allocator().resource(), &other);
+
+    lst4.assign(5,4);
+    EXPECT_TRUE(std::ranges::equal(lst4, std::initializer_list<int>{4,4,4,4,4}));
+    lst4.assign({11,22,33,44,55});
+    EXPECT_TRUE(std::ranges::equal(lst4, std::initializer_list<int>{11,22,33,44,55}));
+}
+
+TYPED_TEST(PmrForwardList, Modifiers)
+{
+    std::pmr::forward_list<std::pmr::string> lst{"This", "Is", "Forward", "List"};
+    EXPECT_EQ(lst.front().get_allocator().resource(), this->resource());
+
+    lst.insert_after(lst.begin(),"Testing");
+    lst.insert_after(std::next(lst.begin()),2,"->");
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string_view>{"This","Testing","->","->","Is","Forward","List"}));
+
+    lst.erase_after(lst.begin());
+    lst.erase_after(lst.begin(),std::next(lst.begin(),3));
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string_view>{"This","Is","Forward","List"}));
+
+    lst.emplace_after(lst.begin(),"Still");
+    lst.emplace_front("STL");
+    lst.push_front("Base");
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string_view>{"Base","STL","This","Still","Is","Forward","List"}));
+
+    lst.pop_front();
+    lst.resize(3);
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string_view>{"STL","This","Still"}));
+
+    std::pmr::forward_list<std::pmr::string> lst2{"Great", "C++"};
+    lst2.swap(lst);
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string_view>{"Great","C++"}));
+    EXPECT_TRUE(std::ranges::equal(lst2, std::initializer_list<std::string_view>{"STL","This","Still"}));
+
+    lst.clear();
+    EXPECT_TRUE(lst.empty());
+}
+
+TYPED_TEST(PmrForwardList, Operations)
+{
+    std::pmr::forward_list<int> lst1 = {1,4,3};
+    std::pmr::forward_list<int> lst2 = {2,6,5};
+    lst1.sort();
+    lst2.sort();
+    lst1.merge(lst2);
+    EXPECT_TRUE(std::ranges::equal(lst1, std::initializer_list<int>{1,2,3,4,5,6}));
+
+    std::pmr::forward_list<int> lst3{11,22,33};
+    lst3.splice_after(std::next(lst3.begin(),1),lst1);
+    EXPECT_TRUE(std::ranges::equal(lst3, std::initializer_list<int>{11,22,1,2,3,4,5,6,33}));
+
+    std::pmr::forward_list<int> lst4{111,222,333};
+    lst3.splice_after(std::next(lst3.begin()),lst4,std::next(lst4.begin(),1));
+    EXPECT_TRUE(std::ranges::equal(lst3, std::initializer_list<int>{11,22,333,1,2,3,4,5,6,33}));
+
+    lst3.remove(33);
+    lst3.remove_if([](int num){ return num%2 == 0;});
+    EXPECT_TRUE(std::ranges::equal(lst3, std::initializer_list<int>{11,333,1,3,5}));
+
+    lst3.reverse();
+    EXPECT_TRUE(std::ranges::equal(lst3, std::initializer_list<int>{5,3,1,333,11}));
+
+    std::pmr::forward_list<int> uList{1,22,22,5,6,6,77,88};
+    uList.unique();
+    EXPECT_TRUE(std::ranges::equal(uList, std::initializer_list<int>{1,22,5,6,77,88}));
+
+    uList.assign({1,4,6,8,9,0,10});
+    uList.sort();
+    EXPECT_TRUE(std::ranges::equal(uList, std::initializer_list<int>{0,1,4,6,8,9,10}));
+}
+
+TYPED_TEST(PmrForwardList, NonMemberFunctions)
+{
+    std::pmr::forward_list<int> lst1{1,2,3,4};
+    std::pmr::forward_list<int> lst2{1,2,3,4,5};
+    std::pmr::forward_list<int> lst3{1,2,3,4};
+
+    EXPECT_TRUE(lst1==lst3);
+    EXPECT_FALSE(lst1==lst2);
+    EXPECT_TRUE(lst1 < lst2);
+
+    std::swap(lst1, lst2);
+    EXPECT_TRUE(std::ranges::equal(lst1, std::initializer_list<int>{1,2,3,4,5}));
+
+    std::erase(lst3,4);
+    EXPECT_TRUE(std::ranges::equal(lst3, std::initializer_list<int>{1,2,3}));
+    std::erase_if(lst3, [](int num){return (num % 2 ) == 0;});
+    EXPECT_TRUE(std::ranges::equal(lst3, std::initializer_list<int>{1,3}));
+}
+
+//Random inserts and erases checked against a forward_list with the default allocator
+TYPED_TEST(PmrForwardList, InsertEraseChurn)
+{
+    std::mt19937 gen{42};
+    std::pmr::forward_list<int> lst;
+    std::forward_list<int> expected;
+    std::size_t size = 0;
+    for(int round = 0; round < 5000; ++round)
+    {
+        const auto pos = gen() % (size + 1);
+        if(gen() % 3 != 0 || size < 2)
+        {
+            lst.insert_after(std::next(lst.before_begin(), pos), round);
+            expected.insert_after(std::next(expected.before_begin(), pos), round);
+            ++size;
+        }
+        else
+        {
+            const auto erasePos = pos % (size - 1);
+            lst.erase_after(std::next(lst.before_begin(), erasePos));
+            expected.erase_after(std::next(expected.before_begin(), erasePos));
+            --size;
+        }
+    }
+    EXPECT_TRUE(std::ranges::equal(lst, expected));
+}
+
+//The sort and merge steps of the Operations test through practise::list_sort, once per execution policy
+template<typename Policy>
+class ForwardListSort : public ExecutionPolicyTest<Policy> {};
+TYPED_TEST_SUITE(ForwardListSort, ExecutionPolicies, ExecutionPolicyNames);
+
+TYPED_TEST(ForwardListSort, Operations)
+{
+    std::forward_list<int> lst1 = {1,4,3};
+    std::forward_list<int> lst2 = {2,6,5};
+
+    practise::list_sort(this->policy, lst1);
+    practise::list_sort(this->policy, lst2);
+
+    lst1.merge(lst2);
+    EXPECT_TRUE(std::ranges::equal(lst1, std::initializer_list<int>{1,2,3,4,5,6}));
+
+    std::forward_list<int> uList{1,4,6,8,9,0,10};
+    practise::list_sort(this->policy, uList);
+    EXPECT_TRUE(std::ranges::equal(uList, std::initializer_list<int>{0,1,4,6,8,9,10}));
+
+    practise::list_sort(this->policy, uList, std::greater<>());
+    EXPECT_TRUE(std::ranges::equal(uList, std::initializer_list<int>{10,9,8,6,4,1,0}));
+
+    std::forward_list<int> empty, single{7};
+    practise::list_sort(this->policy, empty);
+    practise::list_sort(this->policy, single);
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(single.front(), 7);
+}
+
+//Many equal keys, the original positions have to stay in order like with std::stable_sort
+TYPED_TEST(ForwardListSort, LargeInputIsStable)
+{
+    const auto values = this->largeInput();
+    std::vector<std::pair<int,int>> expected;
+    for(int i = 0; i < static_cast<int>(values.size()); ++i)
+        expected.emplace_back(values[i], i);
+    std::forward_list<std::pair<int,int>> lst(expected.begin(), expected.end());
+
+    auto byKey = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+    std::ranges::stable_sort(expected, byKey);
+    practise::list_sort(this->policy, lst, byKey);
+    EXPECT_TRUE(std::ranges::equal(lst, expected));
+}
+
+//The parallel mode with a fixed thread count, whatever the hardware has, odd counts leave a run unpaired
+TEST(ForwardListSort, ParallelRuns)
+{
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<int> dist{0, 500};
+    std::vector<std::pair<int,int>> expected;
+    for(int i = 0; i < 100000; ++i)
+        expected.emplace_back(dist(gen), i);
+    auto byKey = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+    auto sorted = expected;
+    std::ranges::stable_sort(sorted, byKey);
+
+    for(unsigned threads : {1u, 2u, 3u, 4u, 7u, 16u})
+    {
+        std::forward_list<std::pair<int,int>> lst(expected.begin(), expected.end());
+        practise::parallel_list_sort(lst, threads, byKey);
+        EXPECT_TRUE(std::ranges::equal(lst, sorted)) << threads << " threads";
+    }
+}
+
+//A throwing comparison keeps every node in the list
+TEST(ForwardListSort, ThrowingCompare)
+{
+    std::vector<int> values(20000);
+    std::iota(values.begin(), values.end(), 0);
+    std::ranges::shuffle(values, std::mt19937{42});
+    for(unsigned threads : {1u, 4u})
+    {
+        std::forward_list<int> lst(values.begin(), values.end());
+        std::atomic<int> calls{0};
+        auto throwing = [&calls](int lhs, int rhs)
+        {
+            if(calls.fetch_add(1) == 50000)
+                throw std::runtime_error("compare");
+            return lhs < rhs;
+        };
+        EXPECT_THROW(practise::parallel_list_sort(lst, threads, throwing), std::runtime_error);
+        std::vector<int> left(lst.begin(), lst.end());
+        std::ranges::sort(left);
+        EXPECT_TRUE(std::ranges::equal(left, std::views::iota(0, 20000)));
+    }
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
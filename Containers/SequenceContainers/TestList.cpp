@@ -1,6 +1,16 @@
 #include <iostream>
 #include <gtest/gtest.h>
+#include <atomic>
 #include <list>
+#include <memory_resource>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+#include "Algorithms/ExecutionPolicyTest.h"
+#include "Containers/MemoryResourceTest.h"
+#include "ListSort.h"
 
 TEST(List, MemberFunctions)
 {
@@ -321,6 +331,289 @@ TEST(F_List, NonMemberFunctions)
     EXPECT_TRUE(std::equal(lst3.begin(), lst3.end(), std::begin({1,3})));
 }
 
+//Same scenarios over std::pmr::list, once per memory resource
+template<typename Resource>
+class PmrList : public MemoryResourceTest<Resource> {};
+TYPED_TEST_SUITE(PmrList, MemoryResources, MemoryResourceNames);
+
+TYPED_TEST(PmrList, MemberFunctions)
+{
+    std::pmr::list<int> lst;
+    EXPECT_TRUE(lst.empty());
+    EXPECT_EQ(lst.get_allocator().resource(), this->resource());
+
+    std::pmr::list<int> lst1(3,4);
+    EXPECT_TRUE(std::ranges::equal(lst1, std::initializer_list<int>{4,4,4}));
+
+    std::pmr::list<int> lst2(lst1.begin(), lst1.end());
+    EXPECT_TRUE(std::ranges::equal(lst2, lst1));
+
+    //Copies ask select_on_container_copy_construction, which gives the default resource again
+    std::pmr::list<int> lst3(lst2);
+    EXPECT_TRUE(std::ranges::equal(lst3, lst1));
+    EXPECT_EQ(lst3.get_allocator().resource(), this->resource());
+
+    std::pmr::list<int> lst4{1,2,3,4,5};
+    std::pmr::list<int> lst5;
+    lst5 = lst4;
+    EXPECT_TRUE(std::ranges::equal(lst5, std::initializer_list<int>{1,2,3,4,5}));
+
+    std::pmr::list<int> lst6;
+    lst6 = std::move(lst5);
+    EXPECT_TRUE(std::ranges::equal(lst6, std::initializer_list<int>{1,2,3,4,5}));
+
+    //An explicit resource wins over the default one and is kept by moves
+    std::pmr::unsynchronized_pool_resource other{std::pmr::new_delete_resource()};
+    std::pmr::list<int> lst7({11,22,33}, &other);
+    EXPECT_EQ(lst7.get_allocator().resource(), &other);
+    std::pmr::list<int> lst8(std::move(lst7));
+    EXPECT_EQ(lst8.get_allocator().resource(), &other);
+    EXPECT_TRUE(std::ranges::equal(lst8, std::initializer_list<int>{11,22,33}));
+
+    lst6.assign(5,4);
+    EXPECT_TRUE(std::ranges::equal(lst6, std::initializer_list<int>{4,4,4,4,4}));
+    lst6.assign({11,22,33,44,55});
+    EXPECT_TRUE(std::ranges::equal(lst6, std::initializer_list<int>{11,22,33,44,55}));
+}
+
+TYPED_TEST(PmrList, Modifiers)
+{
+    std::pmr::list<std::pmr::string> lst{"Have", "Fun", "With", "List"};
+    lst.insert(lst.begin(),"Testing");
+    lst.insert(std::next(lst.begin(),2),2,"->");
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string_view>{"Testing","Have","->","->","Fun","With","List"}));
+
+    //The strings get the list's resource through uses-allocator construction
+    EXPECT_EQ(lst.front().get_allocator().resource(), this->resource());
+
+    lst.erase(lst.begin());
+    lst.erase(std::next(lst.begin()), std::next(lst.begin(),3));
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string_view>{"Have","Fun","With","List"}));
+
+    lst.emplace(std::next(lst.begin()),"More");
+    lst.emplace_back("Please");
+    lst.emplace_front("Go");
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string_view>{"Go","Have","More","Fun","With","List","Please"}));
+
+    lst.pop_back();
+    lst.pop_front();
+    lst.push_back("Later");
+    lst.push_front("Now");
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string_view>{"Now","Have","More","Fun","With","List","Later"}));
+
+    lst.resize(3);
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string_view>{"Now","Have","More"}));
+
+    std::pmr::list<std::pmr::string> lst2{"We", "Are", "Swapped"};
+    lst2.swap(lst);
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string_view>{"We","Are","Swapped"}));
+    EXPECT_TRUE(std::ranges::equal(lst2, std::initializer_list<std::string_view>{"Now","Have","More"}));
+
+    lst.clear();
+    EXPECT_TRUE(lst.empty());
+}
+
+TYPED_TEST(PmrList, Operations)
+{
+    std::pmr::list<int> lst1 = {1,4,3};
+    std::pmr::list<int> lst2 = {2,6,5};
+    lst1.sort();
+    lst2.sort();
+    lst1.merge(lst2);
+    EXPECT_TRUE(std::ranges::equal(lst1, std::initializer_list<int>{1,2,3,4,5,6}));
+    EXPECT_TRUE(lst2.empty());
+
+    std::pmr::list<int> lst3{11,22,33};
+    lst3.splice(std::next(lst3.begin(),1),lst1);
+    EXPECT_TRUE(std::ranges::equal(lst3, std::initializer_list<int>{11,1,2,3,4,5,6,22,33}));
+
+    std::pmr::list<int> lst4{111,222,333};
+    lst3.splice(std::next(lst3.begin()),lst4,std::next(lst4.begin(),1));
+    EXPECT_TRUE(std::ranges::equal(lst3, std::initializer_list<int>{11,222,1,2,3,4,5,6,22,33}));
+
+    std::pmr::list<int> lst5{555};
+    lst5.splice(lst5.begin(),lst3,std::next(lst3.begin(),2),std::next(lst3.begin(),9));
+    EXPECT_TRUE(std::ranges::equal(lst5, std::initializer_list<int>{1,2,3,4,5,6,22,555}));
+
+    lst5.remove(22);
+    lst5.remove_if([](int num){ return num%2 == 0;});
+    EXPECT_TRUE(std::ranges::equal(lst5, std::initializer_list<int>{1,3,5,555}));
+
+    lst5.reverse();
+    EXPECT_TRUE(std::ranges::equal(lst5, std::initializer_list<int>{555,5,3,1}));
+
+    std::pmr::list<int> uList{1,22,22,5,6,6,77,88};
+    uList.unique();
+    EXPECT_TRUE(std::ranges::equal(uList, std::initializer_list<int>{1,22,5,6,77,88}));
+
+    uList.assign({1,4,6,8,9,0,10});
+    uList.sort();
+    EXPECT_TRUE(std::ranges::equal(uList, std::initializer_list<int>{0,1,4,6,8,9,10}));
+}
+
+TYPED_TEST(PmrList, NonMemberFunctions)
+{
+    std::pmr::list<int> lst1{1,2,3,4};
+    std::pmr::list<int> lst2{1,2,3,4,5};
+    std::pmr::list<int> lst3{1,2,3,4};
+
+    EXPECT_TRUE(lst1==lst3);
+    EXPECT_FALSE(lst1==lst2);
+    EXPECT_TRUE(lst1 < lst2);
+    EXPECT_TRUE(lst2 >= lst1);
+
+    std::swap(lst1, lst2);
+    EXPECT_TRUE(std::ranges::equal(lst1, std::initializer_list<int>{1,2,3,4,5}));
+    EXPECT_TRUE(std::ranges::equal(lst2, std::initializer_list<int>{1,2,3,4}));
+
+    lst3.push_back(4);
+    lst3.push_back(2);
+    std::erase(lst3,4);
+    EXPECT_TRUE(std::ranges::equal(lst3, std::initializer_list<int>{1,2,3,2}));
+    std::erase_if(lst3, [](int num){return (num % 2 ) == 0;});
+    EXPECT_TRUE(std::ranges::equal(lst3, std::initializer_list<int>{1,3}));
+}
+
+//Random inserts and erases, checked step by step against a list with the default allocator, so freed nodes
+//handed out again by the pool and the arena are exercised
+TYPED_TEST(PmrList, InsertEraseChurn)
+{
+    std::mt19937 gen{42};
+    std::pmr::list<int> lst;
+    std::list<int> expected;
+    for(int round = 0; round < 5000; ++round)
+    {
+        const auto pos = expected.empty() ? 0 : gen() % expected.size();
+        if(gen() % 3 != 0 || expected.empty())
+        {
+            lst.insert(std::next(lst.begin(), pos), round);
+            expected.insert(std::next(expected.begin(), pos), round);
+        }
+        else
+        {
+            lst.erase(std::next(lst.begin(), pos));
+            expected.erase(std::next(expected.begin(), pos));
+        }
+    }
+    EXPECT_TRUE(std::ranges::equal(lst, expected));
+}
+
+//The arena hands freed blocks of the same size class out again and keeps bigger or over aligned blocks apart
+TEST(ArenaResource, ReusesFreedBlocks)
+{
+    utils::ArenaResource arena(1024);
+    void* first = arena.allocate(24, 8);
+    void* second = arena.allocate(24, 8);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(arena.reserved(), 1024 + 2 * sizeof(void*));
+
+    arena.deallocate(first, 24, 8);
+    EXPECT_EQ(arena.allocate(32, 16), first);
+
+    void* aligned = arena.allocate(64, 64);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 64, 0);
+    arena.deallocate(aligned, 64, 64);
+    EXPECT_NE(arena.allocate(64, 16), aligned);
+
+    //Larger than a chunk gets its own chunk
+    void* big = arena.allocate(4096, 8);
+    EXPECT_NE(big, nullptr);
+    EXPECT_GT(arena.reserved(), 4096);
+
+    arena.release();
+    EXPECT_EQ(arena.reserved(), 0);
+    EXPECT_NE(arena.allocate(8, 8), nullptr);
+    EXPECT_NE(&utils::threadArena(), &arena);
+}
+
+//The sort and merge steps of the Operations test through practise::list_sort, once per execution policy
+template<typename Policy>
+class ListSort : public ExecutionPolicyTest<Policy> {};
+TYPED_TEST_SUITE(ListSort, ExecutionPolicies, ExecutionPolicyNames);
+
+TYPED_TEST(ListSort, Operations)
+{
+    std::list<int> lst1 = {1,4,3};
+    std::list<int> lst2 = {2,6,5};
+
+    practise::list_sort(this->policy, lst1);
+    practise::list_sort(this->policy, lst2);
+
+    lst1.merge(lst2);
+    EXPECT_TRUE(std::ranges::equal(lst1, std::initializer_list<int>{1,2,3,4,5,6}));
+
+    std::list<int> uList{1,4,6,8,9,0,10};
+    practise::list_sort(this->policy, uList);
+    EXPECT_TRUE(std::ranges::equal(uList, std::initializer_list<int>{0,1,4,6,8,9,10}));
+
+    practise::list_sort(this->policy, uList, std::greater<>());
+    EXPECT_TRUE(std::ranges::equal(uList, std::initializer_list<int>{10,9,8,6,4,1,0}));
+
+    std::list<int> empty, single{7};
+    practise::list_sort(this->policy, empty);
+    practise::list_sort(this->policy, single);
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(single.front(), 7);
+}
+
+//Many equal keys, the original positions have to stay in order like with std::stable_sort
+TYPED_TEST(ListSort, LargeInputIsStable)
+{
+    const auto values = this->largeInput();
+    std::vector<std::pair<int,int>> expected;
+    for(int i = 0; i < static_cast<int>(values.size()); ++i)
+        expected.emplace_back(values[i], i);
+    std::list<std::pair<int,int>> lst(expected.begin(), expected.end());
+
+    auto byKey = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+    std::ranges::stable_sort(expected, byKey);
+    practise::list_sort(this->policy, lst, byKey);
+    EXPECT_TRUE(std::ranges::equal(lst, expected));
+}
+
+//The parallel mode with a fixed thread count, whatever the hardware has, odd counts leave a run unpaired
+TEST(ListSort, ParallelRuns)
+{
+    std::mt19937 gen{42};
+    std::uniform_int_distribution<int> dist{0, 500};
+    std::vector<std::pair<int,int>> expected;
+    for(int i = 0; i < 100000; ++i)
+        expected.emplace_back(dist(gen), i);
+    auto byKey = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+    auto sorted = expected;
+    std::ranges::stable_sort(sorted, byKey);
+
+    for(unsigned threads : {1u, 2u, 3u, 4u, 7u, 16u})
+    {
+        std::list<std::pair<int,int>> lst(expected.begin(), expected.end());
+        practise::parallel_list_sort(lst, threads, byKey);
+        EXPECT_TRUE(std::ranges::equal(lst, sorted)) << threads << " threads";
+    }
+}
+
+//A throwing comparison keeps every node in the list
+TEST(ListSort, ThrowingCompare)
+{
+    std::vector<int> values(20000);
+    std::iota(values.begin(), values.end(), 0);
+    std::ranges::shuffle(values, std::mt19937{42});
+    for(unsigned threads : {1u, 4u})
+    {
+        std::list<int> lst(values.begin(), values.end());
+        std::atomic<int> calls{0};
+        auto throwing = [&calls](int lhs, int rhs)
+        {
+            if(calls.fetch_add(1) == 50000)
+                throw std::runtime_error("compare");
+            return lhs < rhs;
+        };
+        EXPECT_THROW(practise::parallel_list_sort(lst, threads, throwing), std::runtime_error);
+        std::vector<int> left(lst.begin(), lst.end());
+        std::ranges::sort(left);
+        EXPECT_TRUE(std::ranges::equal(left, std::views::iota(0, 20000)));
+    }
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,373 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <array>
+#include <list>
+#include <memory>
+#include <random>
+#include <ranges>
+#include <string>
+#include "UnrolledList.h"
+
+using practise::unrolled_list;
+
+static_assert(unrolled_list<int>::node_capacity == 64);
+static_assert(unrolled_list<std::string>::node_capacity == 32);
+static_assert(std::bidirectional_iterator<unrolled_list<int>::iterator>);
+static_assert(std::bidirectional_iterator<unrolled_list<int>::const_iterator>);
+
+TEST(UnrolledList, MemberFunctions)
+{
+    //constructors
+    unrolled_list<int> lst;
+    EXPECT_TRUE(lst.empty());
+    EXPECT_EQ(lst.begin(), lst.end());
+
+    unrolled_list<int> lst1(3,4);
+    EXPECT_EQ(lst1.size(),3);
+    EXPECT_TRUE(std::ranges::equal(lst1, std::initializer_list<int>{4,4,4}));
+
+    unrolled_list<int> lst2(5);
+    EXPECT_TRUE(std::ranges::equal(lst2, std::initializer_list<int>{0,0,0,0,0}));
+
+    unrolled_list<int> lst3(lst1.begin(), lst1.end());
+    EXPECT_TRUE(std::ranges::equal(lst3, std::initializer_list<int>{4,4,4}));
+
+    unrolled_list<int> lst4(lst2);
+    EXPECT_EQ(lst4, lst2);
+
+    unrolled_list<int> lst5(unrolled_list<int>(3,1));
+    EXPECT_TRUE(std::ranges::equal(lst5, std::initializer_list<int>{1,1,1}));
+
+    //operator =
+    unrolled_list<int> lst6{1,2,3,4,5};
+    unrolled_list<int> lst7;
+    lst7 = lst6;
+    EXPECT_EQ(lst7, lst6);
+
+    unrolled_list<int> lst8;
+    lst8 = std::move(lst7);
+    EXPECT_TRUE(lst7.empty());
+    EXPECT_TRUE(std::ranges::equal(lst8, std::initializer_list<int>{1,2,3,4,5}));
+
+    //assign
+    unrolled_list<int> assignlst;
+    assignlst.assign(5,4);
+    EXPECT_TRUE(std::ranges::equal(assignlst, std::initializer_list<int>{4,4,4,4,4}));
+
+    auto arr = std::to_array({5,5,5});
+    assignlst.assign(arr.begin(),arr.end());
+    EXPECT_TRUE(std::ranges::equal(assignlst, std::initializer_list<int>{5,5,5}));
+
+    assignlst.assign({11,22,33,44,55});
+    EXPECT_TRUE(std::ranges::equal(assignlst, std::initializer_list<int>{11,22,33,44,55}));
+
+    //element access and iterators over several nodes
+    unrolled_list<int, 4> chunked;
+    for(int i = 0; i < 10; ++i)
+        chunked.push_back(i);
+    EXPECT_EQ(chunked.front(), 0);
+    EXPECT_EQ(chunked.back(), 9);
+    EXPECT_EQ(chunked.node_count(), 3);
+    EXPECT_TRUE(std::ranges::equal(chunked | std::views::reverse, std::initializer_list<int>{9,8,7,6,5,4,3,2,1,0}));
+    auto it = chunked.end();
+    std::advance(it, -6);
+    EXPECT_EQ(*it, 4);
+}
+
+TEST(UnrolledList, Modifiers)
+{
+    //insert
+    unrolled_list<std::string> lst{"Have", "Fun", "With", "List"};
+    lst.insert(lst.begin(),"Testing");
+    EXPECT_EQ(lst.front(),"Testing");
+
+    auto it = lst.begin(); it++; it++;
+    lst.insert(it,2,"->");
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string>{"Testing","Have","->","->","Fun","With","List"}));
+
+    std::array<std::string,3> arr{"Hope","Its", "Working"};
+    lst.insert(lst.begin(),arr.begin(), arr.end());
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string>{"Hope","Its","Working","Testing","Have","->","->","Fun","With","List"}));
+
+    //erase
+    lst.erase(lst.begin());
+    auto pos1 = std::next(lst.begin(),2);
+    auto pos2 = std::next(lst.end(),-1);
+    EXPECT_EQ(*lst.erase(pos1,pos2), "List");
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string>{"Its","Working","List"}));
+
+    //emplace
+    unrolled_list<std::unique_ptr<int>> ptrs;
+    ptrs.emplace(ptrs.begin(), new int(1));
+    ptrs.emplace_front(new int(0));
+    ptrs.emplace_back(new int(2));
+    ptrs.emplace(std::next(ptrs.begin()), std::make_unique<int>(5));
+    auto deref = [](const std::unique_ptr<int>& ptr) { return *ptr; };
+    EXPECT_TRUE(std::ranges::equal(ptrs | std::views::transform(deref), std::initializer_list<int>{0,5,1,2}));
+
+    //push and pop
+    lst.clear();
+    lst.push_back("Hello");
+    lst.push_back("World");
+    lst.push_front("Hi");
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string>{"Hi","Hello","World"}));
+    lst.pop_back();
+    lst.pop_front();
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string>{"Hello"}));
+
+    //resize
+    lst.resize(3, "x");
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string>{"Hello","x","x"}));
+    lst.resize(1);
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string>{"Hello"}));
+
+    //swap
+    unrolled_list<std::string> lst2{"We", "Are", "Swapped"};
+    swap(lst, lst2);
+    EXPECT_TRUE(std::ranges::equal(lst, std::initializer_list<std::string>{"We","Are","Swapped"}));
+    EXPECT_TRUE(std::ranges::equal(lst2, std::initializer_list<std::string>{"Hello"}));
+
+    //Inserting into full nodes splits them, erasing merges the leftovers back
+    unrolled_list<int, 4> chunked;
+    for(int i = 0; i < 8; ++i)
+        chunked.insert(std::next(chunked.begin(), chunked.size() / 2), i);
+    EXPECT_TRUE(std::ranges::equal(chunked, std::initializer_list<int>{1,3,5,7,6,4,2,0}));
+    chunked.erase(std::next(chunked.begin()), std::prev(chunked.end()));
+    EXPECT_TRUE(std::ranges::equal(chunked, std::initializer_list<int>{1,0}));
+    EXPECT_EQ(chunked.node_count(), 1);
+}
+
+//Same scenario as List.Operations
+TEST(UnrolledList, Operations)
+{
+    //merge
+    unrolled_list<int> lst1 = {1,4,3};
+    unrolled_list<int> lst2 = {2,6,5};
+
+    lst1.sort();
+    lst2.sort();
+
+    lst1.merge(lst2);
+    EXPECT_TRUE(std::ranges::equal(lst1, std::initializer_list<int>{1,2,3,4,5,6}));
+    EXPECT_TRUE(lst2.empty());
+
+    //splice
+    unrolled_list<int> lst3{11,22,33};
+    lst3.splice(std::next(lst3.begin(),1),lst1);
+    EXPECT_TRUE(std::ranges::equal(lst3, std::initializer_list<int>{11,1,2,3,4,5,6,22,33}));
+
+    unrolled_list<int> lst4{111,222,333};
+    lst3.splice(std::next(lst3.begin()),lst4,std::next(lst4.begin(),1));
+    EXPECT_TRUE(std::ranges::equal(lst3, std::initializer_list<int>{11,222,1,2,3,4,5,6,22,33}));
+    EXPECT_TRUE(std::ranges::equal(lst4, std::initializer_list<int>{111,333}));
+
+    unrolled_list<int> lst5{555};
+    lst5.splice(lst5.begin(),lst3,std::next(lst3.begin(),2),std::next(lst3.begin(),9));
+    EXPECT_TRUE(std::ranges::equal(lst5, std::initializer_list<int>{1,2,3,4,5,6,22,555}));
+
+    lst1.clear();
+    lst1.assign({777,888,999});
+
+    auto it = lst1.begin();
+    std::advance(it,2);
+
+    auto it2 = lst5.begin();
+    auto it3 = lst5.end();
+    std::advance(it2,2);
+    std::advance(it3,-1);
+    lst1.splice(it,lst5,it2,it3);
+    EXPECT_TRUE(std::ranges::equal(lst1, std::initializer_list<int>{777,888,3,4,5,6,22,999}));
+    EXPECT_EQ(lst1.size(), 8);
+    EXPECT_EQ(lst5.size(), 3);
+
+    //remove
+    unrolled_list<int> rList{1,2,3,2,4,5,4,6,7};
+    EXPECT_EQ(rList.remove(2), 2);
+    EXPECT_TRUE(std::ranges::equal(rList, std::initializer_list<int>{1,3,4,5,4,6,7}));
+    rList.remove(4);
+    EXPECT_TRUE(std::ranges::equal(rList, std::initializer_list<int>{1,3,5,6,7}));
+
+    rList.clear();
+    rList.assign({1,2,3,4,5,6,7,8,9,10});
+    auto removeEven = [](int num){ return num%2 == 0;};
+    EXPECT_EQ(rList.remove_if(removeEven), 5);
+    EXPECT_TRUE(std::ranges::equal(rList, std::initializer_list<int>{1,3,5,7,9}));
+
+    //reverse
+    rList.reverse();
+    EXPECT_TRUE(std::ranges::equal(rList, std::initializer_list<int>{9,7,5,3,1}));
+
+    //unique
+    unrolled_list<int> uList{1,22,22,5,6,77,88};
+    EXPECT_EQ(uList.unique(), 1);
+    EXPECT_TRUE(std::ranges::equal(uList, std::initializer_list<int>{1,22,5,6,77,88}));
+
+    uList.clear();
+    uList.assign({1,2,2,3,4,4,5,6,6,7});
+    uList.unique([](int a, int b){return ((a%2 == 0) && (b%2==0));});
+    EXPECT_TRUE(std::ranges::equal(uList, std::initializer_list<int>{1,2,3,4,5,6,7}));
+
+    //sort
+    uList.clear();
+    uList.assign({1,4,6,8,9,0,10});
+    uList.sort();
+    EXPECT_TRUE(std::ranges::equal(uList, std::initializer_list<int>{0,1,4,6,8,9,10}));
+
+    //sort is stable
+    unrolled_list<std::pair<int,int>> pairs{{2,0},{1,1},{2,2},{1,3}};
+    pairs.sort([](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    EXPECT_TRUE(std::ranges::equal(pairs | std::views::values, std::initializer_list<int>{1,3,0,2}));
+}
+
+//Splicing a long range only splits the two nodes at its ends, everything in between keeps its node
+TEST(UnrolledList, ChunkedSplice)
+{
+    unrolled_list<int, 8> source;
+    for(int i = 0; i < 800; ++i)
+        source.push_back(i);
+    EXPECT_EQ(source.node_count(), 100);
+
+    unrolled_list<int, 8> target{-1, -2};
+    target.splice(std::next(target.begin()), source, std::next(source.begin(), 4), std::next(source.begin(), 796));
+    EXPECT_EQ(target.size(), 794);
+    EXPECT_EQ(source.size(), 8);
+    EXPECT_TRUE(std::ranges::equal(source, std::initializer_list<int>{0,1,2,3,796,797,798,799}));
+    EXPECT_EQ(source.node_count(), 1);
+    EXPECT_LE(target.node_count(), 101);
+    EXPECT_EQ(target.front(), -1);
+    EXPECT_EQ(*std::next(target.begin()), 4);
+    EXPECT_EQ(target.back(), -2);
+
+    //Inside the same list
+    unrolled_list<int, 4> self{0,1,2,3,4,5,6,7,8,9};
+    self.splice(self.begin(), self, std::next(self.begin(), 6), self.end());
+    EXPECT_TRUE(std::ranges::equal(self, std::initializer_list<int>{6,7,8,9,0,1,2,3,4,5}));
+    self.splice(self.end(), self, self.begin(), std::next(self.begin(), 2));
+    EXPECT_TRUE(std::ranges::equal(self, std::initializer_list<int>{8,9,0,1,2,3,4,5,6,7}));
+    self.splice(std::next(self.begin()), self, std::next(self.begin(), 3));
+    EXPECT_TRUE(std::ranges::equal(self, std::initializer_list<int>{8,1,9,0,2,3,4,5,6,7}));
+}
+
+TEST(UnrolledList, NonMemberFunctions)
+{
+    unrolled_list<int> lst1{1,2,3,4};
+    unrolled_list<int> lst2{1,2,3,4,5};
+    unrolled_list<int> lst3{1,2,3,4};
+
+    EXPECT_TRUE(lst1==lst3);
+    EXPECT_FALSE(lst1==lst2);
+    EXPECT_TRUE(lst1 < lst2);
+    EXPECT_TRUE(lst2 >= lst1);
+
+    lst3.push_back(4);
+    lst3.push_back(2);
+    EXPECT_EQ(erase(lst3,4), 2);
+    EXPECT_TRUE(std::ranges::equal(lst3, std::initializer_list<int>{1,2,3,2}));
+
+    lst3.push_back(6);
+    lst3.push_back(8);
+    EXPECT_EQ(erase_if(lst3, [](int num){return (num % 2 ) == 0;}), 4);
+    EXPECT_TRUE(std::ranges::equal(lst3, std::initializer_list<int>{1,3}));
+}
+
+//Random operations on small nodes, so every split, merge and relink path runs, checked against std::list
+TEST(UnrolledList, MatchesStdList)
+{
+    std::mt19937 gen(7);
+    unrolled_list<int, 4> lst, other;
+    std::list<int> expected, expectedOther;
+    auto pick = [&gen](std::size_t size) { return std::uniform_int_distribution<std::size_t>{0, size}(gen); };
+
+    for(int step = 0; step < 4000; ++step)
+    {
+        const auto op = std::uniform_int_distribution<int>{0, 11}(gen);
+        const int value = std::uniform_int_distribution<int>{0, 50}(gen);
+        const auto pos = pick(lst.size());
+        switch(op)
+        {
+            case 0: case 1:
+                lst.insert(std::next(lst.begin(), pos), value);
+                expected.insert(std::next(expected.begin(), pos), value);
+                break;
+            case 2:
+                lst.insert(std::next(lst.begin(), pos), 5, value);
+                expected.insert(std::next(expected.begin(), pos), 5, value);
+                break;
+            case 3:
+            {
+                const auto count = pick(lst.size() - pos);
+                auto it = lst.erase(std::next(lst.begin(), pos), std::next(lst.begin(), pos + count));
+                auto expectedIt = expected.erase(std::next(expected.begin(), pos), std::next(expected.begin(), pos + count));
+                ASSERT_EQ(std::distance(lst.begin(), it), std::distance(expected.begin(), expectedIt));
+                break;
+            }
+            case 4:
+                lst.push_front(value);
+                expected.push_front(value);
+                if(!lst.empty() && value % 2 == 0)
+                {
+                    lst.pop_back();
+                    expected.pop_back();
+                }
+                break;
+            case 5:
+                other.push_back(value);
+                expectedOther.push_back(value);
+                break;
+            case 6:
+            {
+                const auto first = pick(other.size());
+                const auto last = first + pick(other.size() - first);
+                lst.splice(std::next(lst.begin(), pos), other, std::next(other.begin(), first), std::next(other.begin(), last));
+                expected.splice(std::next(expected.begin(), pos), expectedOther,
+                                std::next(expectedOther.begin(), first), std::next(expectedOther.begin(), last));
+                break;
+            }
+            case 7:
+                lst.sort();
+                other.sort();
+                lst.merge(other);
+                expected.sort();
+                expectedOther.sort();
+                expected.merge(expectedOther);
+                break;
+            case 8:
+                ASSERT_EQ(lst.remove_if([value](int val) { return val % 7 == value % 7; }),
+                          expected.remove_if([value](int val) { return val % 7 == value % 7; }));
+                break;
+            case 9:
+                lst.reverse();
+                expected.reverse();
+                ASSERT_EQ(lst.unique(), expected.unique());
+                break;
+            case 10:
+            {
+                const auto at = pick(other.size());
+                other.splice(std::next(other.begin(), at), lst);
+                expectedOther.splice(std::next(expectedOther.begin(), at), expected);
+                lst.swap(other);
+                expected.swap(expectedOther);
+                break;
+            }
+            default:
+                for(int i = 0; i < 20; ++i)
+                {
+                    lst.push_back(value + i);
+                    expected.push_back(value + i);
+                }
+                break;
+        }
+        ASSERT_EQ(lst.size(), expected.size()) << "step " << step;
+        ASSERT_TRUE(std::ranges::equal(lst, expected)) << "step " << step;
+        ASSERT_TRUE(std::ranges::equal(lst | std::views::reverse, expected | std::views::reverse)) << "step " << step;
+        ASSERT_EQ(other.size(), expectedOther.size()) << "step " << step;
+        ASSERT_TRUE(std::ranges::equal(other, expectedOther)) << "step " << step;
+        ASSERT_LE(lst.node_count(), lst.size());
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1,6 +1,7 @@
 #include <iostream>
 #include <gtest/gtest.h>
 #include <vector>
+#include "Utils/AllocationTracking.h"
 
 TEST(VectorTest, Constructor)
 {   
@@ -287,6 +288,44 @@ TEST(VectorTest, NonMemberFunctions)
     EXPECT_TRUE(std::equal(vec3.begin(), vec3.end(), expected4));
 }
 
+//How often the modifiers go to the heap, a budget fails the test when a change to the code allocates more
+TEST(VectorTest, ModifierAllocations)
+{
+    std::vector<int> vec{1,2,3,4,4,4,4};
+    std::vector<int> vec1{11,22,33};
+    {
+        //Growing by a range reallocates once, straight to the final size
+        utils::AllocationBudget budget(1, 10 * sizeof(int));
+        vec1.insert(vec1.begin()+1, vec.begin(), vec.end());
+    }
+    EXPECT_EQ(vec1.size(), 10);
+    {
+        //Within the capacity nothing is allocated
+        vec1.reserve(20);
+        utils::AllocationBudget budget(0);
+        vec1.insert(vec1.end(), {44,55});
+        vec1.emplace(vec1.begin(), 0);
+        vec1.erase(vec1.begin(), vec1.begin()+3);
+        vec1.push_back(66);
+    }
+    {
+        //Growth by push_back is geometric, a few reallocations for many elements
+        std::vector<int> grown;
+        utils::AllocationScope scope;
+        for(int i = 0; i < 1000; ++i)
+            grown.push_back(i);
+        EXPECT_LE(scope.stats().count, 11);
+        EXPECT_GE(scope.stats().peakBytes, 1000 * sizeof(int));
+    }
+    {
+        //Moving the vector steals the buffer, copying it allocates exactly one
+        utils::AllocationBudget budget(1, vec1.capacity() * sizeof(int));
+        auto moved = std::move(vec1);
+        auto copied = moved;
+        EXPECT_EQ(copied, moved);
+    }
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
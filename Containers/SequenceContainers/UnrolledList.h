@@ -0,0 +1,853 @@
+//unrolled_list<T, N> : std::list like container which stores up to N elements per node, in order, in a small
+//array. Walking the list costs one node (and one cache miss) per N elements instead of one per element, so
+//iteration, remove_if, unique and sort run close to vector speed, while insert and erase in the middle only
+//shift the elements of one node. splice relinks whole nodes, only the nodes at the ends of the range are split.
+//Unlike std::list the elements move between and inside the nodes: insert and erase invalidate the iterators
+//into the node they touch and its neighbours, splice, merge, sort, remove and unique invalidate all of them.
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace practise
+{
+
+namespace detail
+{
+    //About 512 bytes of elements per node, at least 32 and at most 64 of them
+    template<typename T>
+    inline constexpr std::size_t unrolledNodeCapacity = std::clamp<std::size_t>(512 / sizeof(T), 32, 64);
+}
+
+template<typename T, std::size_t N = detail::unrolledNodeCapacity<T>>
+class unrolled_list
+{
+    static_assert(N >= 2, "unrolled_list needs at least two elements per node, use std::list otherwise");
+
+    struct NodeBase
+    {
+        NodeBase* prev = nullptr;
+        NodeBase* next = nullptr;
+    };
+
+    //The elements of a node always live in [data(), data() + count), empty nodes are freed right away
+    struct Node : NodeBase
+    {
+        T* data() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+
+        std::size_t count = 0;
+        alignas(T) unsigned char storage[N * sizeof(T)];
+    };
+
+    template<bool Const>
+    class Iterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        Iterator() = default;
+
+        template<bool OtherConst> requires (Const && !OtherConst)
+        Iterator(const Iterator<OtherConst>& other) : mNode(other.mNode), mIndex(other.mIndex) {}
+
+        reference operator*() const { return node()->data()[mIndex]; }
+        pointer operator->() const { return node()->data() + mIndex; }
+
+        Iterator& operator++()
+        {
+            if(++mIndex == node()->count)
+            {
+                mNode = mNode->next;
+                mIndex = 0;
+            }
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        Iterator& operator--()
+        {
+            if(mIndex == 0)
+            {
+                mNode = mNode->prev;
+                mIndex = node()->count;
+            }
+            --mIndex;
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            auto copy = *this;
+            --*this;
+            return copy;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs)
+        {
+            return lhs.mNode == rhs.mNode && lhs.mIndex == rhs.mIndex;
+        }
+
+    private:
+        friend class unrolled_list;
+        friend class Iterator<!Const>;
+
+        Iterator(NodeBase* node, std::size_t index) : mNode(node), mIndex(index) {}
+
+        Node* node() const { return static_cast<Node*>(mNode); }
+
+        NodeBase* mNode = nullptr;
+        std::size_t mIndex = 0;
+    };
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type node_capacity = N;
+
+    //constructors
+    unrolled_list() noexcept = default;
+
+    unrolled_list(size_type count, const T& value)
+    {
+        insert(end(), count, value);
+    }
+
+    explicit unrolled_list(size_type count)
+    {
+        resize(count);
+    }
+
+    template<std::input_iterator InputIt>
+    unrolled_list(InputIt first, InputIt last)
+    {
+        insert(end(), first, last);
+    }
+
+    unrolled_list(std::initializer_list<T> init)
+    {
+        insert(end(), init.begin(), init.end());
+    }
+
+    unrolled_list(const unrolled_list& other)
+    {
+        insert(end(), other.begin(), other.end());
+    }
+
+    unrolled_list(unrolled_list&& other) noexcept
+    {
+        adopt(other);
+    }
+
+    ~unrolled_list()
+    {
+        clear();
+    }
+
+    // = operator
+    unrolled_list& operator=(const unrolled_list& other)
+    {
+        if(this != &other)
+            assign(other.begin(), other.end());
+        return *this;
+    }
+
+    unrolled_list& operator=(unrolled_list&& other) noexcept
+    {
+        if(this != &other)
+        {
+            clear();
+            adopt(other);
+        }
+        return *this;
+    }
+
+    unrolled_list& operator=(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+        return *this;
+    }
+
+    //assign
+    void assign(size_type count, const T& value)
+    {
+        T copy(value);
+        clear();
+        insert(end(), count, copy);
+    }
+
+    template<std::input_iterator InputIt>
+    void assign(InputIt first, InputIt last)
+    {
+        clear();
+        insert(end(), first, last);
+    }
+
+    void assign(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+    }
+
+    //element access
+    reference front() { return *begin(); }
+    const_reference front() const { return *begin(); }
+
+    reference back()
+    {
+        auto* last = asNode(mHead.prev);
+        return last->data()[last->count - 1];
+    }
+
+    const_reference back() const
+    {
+        auto* last = asNode(mHead.prev);
+        return last->data()[last->count - 1];
+    }
+
+    //iterators
+    iterator begin() noexcept { return iterator(mHead.next, 0); }
+    const_iterator begin() const noexcept { return const_iterator(mHead.next, 0); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator end() noexcept { return iterator(head(), 0); }
+    const_iterator end() const noexcept { return const_iterator(head(), 0); }
+    const_iterator cend() const noexcept { return end(); }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    //capacity
+    [[nodiscard]] bool empty() const noexcept { return mSize == 0; }
+    size_type size() const noexcept { return mSize; }
+
+    //Number of nodes, size() / node_count() is how full they are
+    size_type node_count() const noexcept
+    {
+        size_type nodes = 0;
+        for(auto* node = mHead.next; node != head(); node = node->next)
+            ++nodes;
+        return nodes;
+    }
+
+    //modifiers
+    void clear() noexcept
+    {
+        for(auto* node = mHead.next; node != head();)
+        {
+            auto* next = node->next;
+            std::destroy_n(asNode(node)->data(), asNode(node)->count);
+            delete asNode(node);
+            node = next;
+        }
+        mHead.prev = mHead.next = head();
+        mSize = 0;
+    }
+
+    iterator insert(const_iterator pos, const T& value) { return emplace(pos, value); }
+    iterator insert(const_iterator pos, T&& value) { return emplace(pos, std::move(value)); }
+
+    iterator insert(const_iterator pos, size_type count, const T& value)
+    {
+        if(count == 0)
+            return iterator(pos.mNode, pos.mIndex);
+        T copy(value);
+        auto* after = splitAt(pos.mNode, pos.mIndex);
+        auto first = appendBefore(after, copy);
+        for(size_type i = 1; i < count; ++i)
+            appendBefore(after, copy);
+        mergeWithNext(after->prev);
+        return first;
+    }
+
+    //The range is appended to the node in front of pos and to new full nodes, then linked in front of pos
+    template<std::input_iterator InputIt>
+    iterator insert(const_iterator pos, InputIt first, InputIt last)
+    {
+        if(first == last)
+            return iterator(pos.mNode, pos.mIndex);
+        auto* after = splitAt(pos.mNode, pos.mIndex);
+        auto result = appendBefore(after, *first);
+        for(++first; first != last; ++first)
+            appendBefore(after, *first);
+        mergeWithNext(after->prev);
+        return result;
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<T> init)
+    {
+        return insert(pos, init.begin(), init.end());
+    }
+
+    //Goes to the end of the previous node while it has room, otherwise shifts the tail of the node or
+    //splits a full node in half
+    template<typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args)
+    {
+        NodeBase* base = pos.mNode;
+        size_type index = pos.mIndex;
+        if(index == 0 && base->prev != head() && asNode(base->prev)->count < N)
+        {
+            base = base->prev;
+            index = asNode(base)->count;
+        }
+        else if(base == head() || (index == 0 && asNode(base)->count == N))
+        {
+            base = createNode(base);
+            index = 0;
+        }
+        else if(asNode(base)->count == N)
+        {
+            auto* tail = splitAt(base, N / 2);
+            if(index > N / 2)
+            {
+                base = tail;
+                index -= N / 2;
+            }
+        }
+        return constructAt(asNode(base), index, std::forward<Args>(args)...);
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        return erase(pos, std::next(pos));
+    }
+
+    //Removes the range node by node with one shift per node, then merges the nodes left around the position
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        if(first == last)
+            return iterator(first.mNode, first.mIndex);
+        NodeBase* base = first.mNode;
+        size_type index = first.mIndex;
+        while(base != last.mNode)
+        {
+            auto* next = base->next;
+            eraseInNode(asNode(base), index, asNode(base)->count);
+            if(asNode(base)->count == 0)
+                freeNode(base);
+            base = next;
+            index = 0;
+        }
+        if(base != head())
+            eraseInNode(asNode(base), index, last.mIndex);
+        return rebalance(base, index);
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template<typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        return *appendBefore(head(), std::forward<Args>(args)...);
+    }
+
+    void push_front(const T& value) { emplace_front(value); }
+    void push_front(T&& value) { emplace_front(std::move(value)); }
+
+    template<typename... Args>
+    reference emplace_front(Args&&... args)
+    {
+        return *emplace(begin(), std::forward<Args>(args)...);
+    }
+
+    void pop_back()
+    {
+        auto* last = asNode(mHead.prev);
+        std::destroy_at(last->data() + last->count - 1);
+        --mSize;
+        if(--last->count == 0)
+            freeNode(last);
+    }
+
+    void pop_front()
+    {
+        erase(begin());
+    }
+
+    void resize(size_type count)
+    {
+        if(count < mSize)
+            erase(std::next(begin(), static_cast<difference_type>(count)), end());
+        while(mSize < count)
+            emplace_back();
+    }
+
+    void resize(size_type count, const value_type& value)
+    {
+        if(count < mSize)
+            erase(std::next(begin(), static_cast<difference_type>(count)), end());
+        else
+            insert(end(), count - mSize, value);
+    }
+
+    void swap(unrolled_list& other) noexcept
+    {
+        unrolled_list tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    //operations
+    //Both lists are sorted. The merged elements are moved into nodes recycled from the consumed ones, once
+    //one list runs out the rest of the other is linked in node by node. comp must not throw
+    template<typename Compare>
+    void merge(unrolled_list& other, Compare comp)
+    {
+        if(&other == this || other.empty())
+            return;
+        if(empty())
+        {
+            adopt(other);
+            return;
+        }
+
+        NodeBase merged{&merged, &merged};
+        Node* tail = nullptr;
+        Node* spare = nullptr;
+        auto append = [&](T& value)
+        {
+            if(tail == nullptr || tail->count == N)
+            {
+                tail = spare != nullptr ? std::exchange(spare, nullptr) : new Node;
+                linkBefore(tail, &merged);
+            }
+            std::construct_at(tail->data() + tail->count, std::move(value));
+            ++tail->count;
+        };
+
+        struct Cursor
+        {
+            NodeBase* node;
+            size_type index;
+            NodeBase* end;
+
+            T& value() const { return asNode(node)->data()[index]; }
+        };
+        //A consumed node only holds moved from elements, the first one is kept for the output
+        auto advance = [&spare](Cursor& cursor)
+        {
+            auto* node = asNode(cursor.node);
+            if(++cursor.index < node->count)
+                return;
+            cursor.node = node->next;
+            cursor.index = 0;
+            std::destroy_n(node->data(), node->count);
+            node->count = 0;
+            if(spare == nullptr)
+                spare = node;
+            else
+                delete node;
+        };
+        auto drain = [&](Cursor& cursor)
+        {
+            for(auto* partial = cursor.node; cursor.node == partial && cursor.index != 0;)
+            {
+                append(cursor.value());
+                advance(cursor);
+            }
+            if(cursor.node == cursor.end)
+                return;
+            auto* last = cursor.end->prev;
+            cursor.node->prev = merged.prev;
+            merged.prev->next = cursor.node;
+            last->next = &merged;
+            merged.prev = last;
+        };
+
+        Cursor mine{mHead.next, 0, head()};
+        Cursor theirs{other.mHead.next, 0, other.head()};
+        while(mine.node != mine.end && theirs.node != theirs.end)
+        {
+            if(std::invoke(comp, theirs.value(), mine.value()))
+            {
+                append(theirs.value());
+                advance(theirs);
+            }
+            else
+            {
+                append(mine.value());
+                advance(mine);
+            }
+        }
+        drain(mine);
+        drain(theirs);
+        delete spare;
+
+        mHead.next = merged.next;
+        mHead.prev = merged.prev;
+        mHead.next->prev = head();
+        mHead.prev->next = head();
+        mSize += other.mSize;
+        other.mHead.prev = other.mHead.next = other.head();
+        other.mSize = 0;
+    }
+
+    void merge(unrolled_list& other) { merge(other, std::less<>()); }
+    void merge(unrolled_list&& other) { merge(other, std::less<>()); }
+    template<typename Compare>
+    void merge(unrolled_list&& other, Compare comp) { merge(other, comp); }
+
+    //Moves all elements of other in front of pos: the node of pos is split once, then the nodes of other
+    //are linked in as they are
+    void splice(const_iterator pos, unrolled_list& other)
+    {
+        if(&other == this || other.empty())
+            return;
+        auto* at = splitAt(pos.mNode, pos.mIndex);
+        spliceNodes(at, other, other.mHead.next, other.head(), other.mSize);
+    }
+
+    void splice(const_iterator pos, unrolled_list&& other) { splice(pos, other); }
+
+    void splice(const_iterator pos, unrolled_list& other, const_iterator it)
+    {
+        splice(pos, other, it, std::next(it));
+    }
+
+    void splice(const_iterator pos, unrolled_list&& other, const_iterator it) { splice(pos, other, it); }
+
+    //The nodes holding first and last are split so the range is made of whole nodes, which are relinked
+    //without moving their elements. Cost is O(N) for the splits plus O(1) per node in the range
+    void splice(const_iterator pos, unrolled_list& other, const_iterator first, const_iterator last)
+    {
+        if(first == last)
+            return;
+        if(&other == this)
+        {
+            spliceWithin(pos, first, last);
+            return;
+        }
+        auto* lastNode = other.splitAt(last.mNode, last.mIndex);
+        auto* firstNode = other.splitAt(first.mNode, first.mIndex);
+        size_type count = 0;
+        for(auto* node = firstNode; node != lastNode; node = node->next)
+            count += asNode(node)->count;
+        auto* at = splitAt(pos.mNode, pos.mIndex);
+        spliceNodes(at, other, firstNode, lastNode, count);
+    }
+
+    void splice(const_iterator pos, unrolled_list&& other, const_iterator first, const_iterator last)
+    {
+        splice(pos, other, first, last);
+    }
+
+    //The kept elements are moved forward over the removed ones, the emptied tail is freed.
+    //value must not be an element of the list
+    size_type remove(const T& value)
+    {
+        return remove_if([&value](const T& element) { return element == value; });
+    }
+
+    template<typename UnaryPredicate>
+    size_type remove_if(UnaryPredicate pred)
+    {
+        return eraseTail(std::remove_if(begin(), end(), pred));
+    }
+
+    //Reverses the order of the nodes and the elements inside every node, nothing is allocated
+    void reverse() noexcept
+    {
+        for(auto* node = mHead.next; node != head(); node = node->prev)
+        {
+            std::reverse(asNode(node)->data(), asNode(node)->data() + asNode(node)->count);
+            std::swap(node->prev, node->next);
+        }
+        std::swap(mHead.prev, mHead.next);
+    }
+
+    size_type unique() { return unique(std::equal_to<>()); }
+
+    template<typename BinaryPredicate>
+    size_type unique(BinaryPredicate pred)
+    {
+        return eraseTail(std::unique(begin(), end(), pred));
+    }
+
+    //Stable like std::list::sort. The elements are sorted in one contiguous buffer and moved back into the
+    //same nodes, which beats merging through the nodes for every size
+    void sort() { sort(std::less<>()); }
+
+    template<typename Compare>
+    void sort(Compare comp)
+    {
+        if(mSize < 2)
+            return;
+        std::vector<T> values;
+        values.reserve(mSize);
+        std::move(begin(), end(), std::back_inserter(values));
+        std::stable_sort(values.begin(), values.end(), comp);
+        std::move(values.begin(), values.end(), begin());
+    }
+
+    //non member functions
+    friend bool operator==(const unrolled_list& lhs, const unrolled_list& rhs)
+    {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    friend auto operator<=>(const unrolled_list& lhs, const unrolled_list& rhs)
+    {
+        return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend void swap(unrolled_list& lhs, unrolled_list& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+private:
+    static Node* asNode(NodeBase* node) noexcept { return static_cast<Node*>(node); }
+    NodeBase* head() const noexcept { return const_cast<NodeBase*>(&mHead); }
+
+    static void linkBefore(NodeBase* node, NodeBase* pos) noexcept
+    {
+        node->prev = pos->prev;
+        node->next = pos;
+        pos->prev->next = node;
+        pos->prev = node;
+    }
+
+    static void unlink(NodeBase* node) noexcept
+    {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+    }
+
+    Node* createNode(NodeBase* before)
+    {
+        auto* node = new Node;
+        linkBefore(node, before);
+        return node;
+    }
+
+    //Only for nodes without elements left
+    static void freeNode(NodeBase* node) noexcept
+    {
+        unlink(node);
+        delete asNode(node);
+    }
+
+    //Takes over the nodes of other, this has to be empty
+    void adopt(unrolled_list& other) noexcept
+    {
+        if(other.empty())
+            return;
+        mHead.next = other.mHead.next;
+        mHead.prev = other.mHead.prev;
+        mHead.next->prev = head();
+        mHead.prev->next = head();
+        mSize = other.mSize;
+        other.mHead.prev = other.mHead.next = other.head();
+        other.mSize = 0;
+    }
+
+    //The position past the last element of a node is the first element of the next one
+    iterator makeIterator(NodeBase* node, size_type index) const noexcept
+    {
+        if(node != head() && index == asNode(node)->count)
+            return iterator(node->next, 0);
+        return iterator(node, index);
+    }
+
+    template<typename... Args>
+    iterator constructAt(Node* node, size_type index, Args&&... args)
+    {
+        T* data = node->data();
+        if(index == node->count)
+        {
+            try
+            {
+                std::construct_at(data + index, std::forward<Args>(args)...);
+            }
+            catch(...)
+            {
+                if(node->count == 0)
+                    freeNode(node);
+                throw;
+            }
+            ++node->count;
+        }
+        else
+        {
+            //Built first, args may refer to one of the elements about to shift
+            T value(std::forward<Args>(args)...);
+            const auto last = node->count;
+            std::construct_at(data + last, std::move(data[last - 1]));
+            ++node->count;
+            std::move_backward(data + index, data + last - 1, data + last);
+            data[index] = std::move(value);
+        }
+        ++mSize;
+        return iterator(node, index);
+    }
+
+    //Appends to the node in front of after, or to a new node when that one is full
+    template<typename... Args>
+    iterator appendBefore(NodeBase* after, Args&&... args)
+    {
+        auto* base = after->prev;
+        if(base == head() || asNode(base)->count == N)
+            base = createNode(after);
+        return constructAt(asNode(base), asNode(base)->count, std::forward<Args>(args)...);
+    }
+
+    //Moves the elements from index on into a new node after node, returns the node starting at the position
+    NodeBase* splitAt(NodeBase* base, size_type index)
+    {
+        if(index == 0)
+            return base;
+        auto* node = asNode(base);
+        auto* tail = createNode(node->next);
+        try
+        {
+            std::uninitialized_move(node->data() + index, node->data() + node->count, tail->data());
+        }
+        catch(...)
+        {
+            freeNode(tail);
+            throw;
+        }
+        tail->count = node->count - index;
+        std::destroy(node->data() + index, node->data() + node->count);
+        node->count = index;
+        return tail;
+    }
+
+    //Moves the elements of the next node into this one when they fit
+    void mergeWithNext(NodeBase* base)
+    {
+        if(base == head() || base->next == head())
+            return;
+        auto* node = asNode(base);
+        auto* next = asNode(base->next);
+        if(node->count + next->count > N)
+            return;
+        std::uninitialized_move(next->data(), next->data() + next->count, node->data() + node->count);
+        node->count += next->count;
+        std::destroy_n(next->data(), next->count);
+        freeNode(next);
+    }
+
+    void eraseInNode(Node* node, size_type from, size_type to)
+    {
+        T* data = node->data();
+        std::move(data + to, data + node->count, data + from);
+        std::destroy(data + node->count - (to - from), data + node->count);
+        node->count -= to - from;
+        mSize -= to - from;
+    }
+
+    //After an erase the node is folded into the previous one when both fit into one node (that also closes
+    //the seam of a range erase), a node left less than a quarter full takes in the next one
+    iterator rebalance(NodeBase* base, size_type index)
+    {
+        if(base == head())
+        {
+            if(mHead.prev == head())
+                return end();
+            base = mHead.prev;
+            index = asNode(base)->count;
+        }
+        if(base->prev != head() && asNode(base->prev)->count + asNode(base)->count <= N)
+        {
+            base = base->prev;
+            index += asNode(base)->count;
+            mergeWithNext(base);
+        }
+        else if(asNode(base)->count < N / 4)
+            mergeWithNext(base);
+        return makeIterator(base, index);
+    }
+
+    size_type eraseTail(iterator newEnd)
+    {
+        const auto removed = static_cast<size_type>(std::distance(newEnd, end()));
+        erase(newEnd, end());
+        return removed;
+    }
+
+    //Unlinks the nodes [first, last) of other and links them in front of at, then merges the nodes at the
+    //seams when they fit into one
+    void spliceNodes(NodeBase* at, unrolled_list& other, NodeBase* first, NodeBase* last, size_type count)
+    {
+        auto* before = first->prev;
+        auto* lastIncluded = last->prev;
+        before->next = last;
+        last->prev = before;
+        other.mSize -= count;
+
+        first->prev = at->prev;
+        lastIncluded->next = at;
+        at->prev->next = first;
+        at->prev = lastIncluded;
+        mSize += count;
+
+        other.mergeWithNext(before);
+        mergeWithNext(lastIncluded);
+        mergeWithNext(first->prev);
+    }
+
+    //Splicing inside the same list goes through a temporary list, pos is found again by its index
+    void spliceWithin(const_iterator pos, const_iterator first, const_iterator last)
+    {
+        const auto posIndex = std::distance(cbegin(), pos);
+        const auto firstIndex = std::distance(cbegin(), first);
+        const auto count = std::distance(first, last);
+        if(posIndex >= firstIndex && posIndex <= firstIndex + count)
+            return;
+        unrolled_list moved;
+        moved.splice(moved.end(), *this, first, last);
+        const auto target = posIndex > firstIndex ? posIndex - count : posIndex;
+        splice(std::next(cbegin(), target), moved);
+    }
+
+    NodeBase mHead{head(), head()};
+    size_type mSize = 0;
+};
+
+//std::erase/std::erase_if counterparts, found through ADL
+template<typename T, std::size_t N, typename U>
+typename unrolled_list<T, N>::size_type erase(unrolled_list<T, N>& lst, const U& value)
+{
+    return lst.remove_if([&value](const T& element) { return element == value; });
+}
+
+template<typename T, std::size_t N, typename Pred>
+typename unrolled_list<T, N>::size_type erase_if(unrolled_list<T, N>& lst, Pred pred)
+{
+    return lst.remove_if(pred);
+}
+
+}
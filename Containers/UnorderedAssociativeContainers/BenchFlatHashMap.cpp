@@ -0,0 +1,119 @@
+#include <benchmark/benchmark.h>
+#include <unordered_map>
+#include "FlatHashMap.h"
+#include "Utils/BenchmarkUtils.h"
+
+//Keys [0, count) are present, keys [count, 2*count) are guaranteed misses
+template<typename Map>
+static Map buildMap(std::int64_t count)
+{
+    Map map;
+    for(auto key : bench::iotaInts(count))
+        map.try_emplace(key, key);
+    return map;
+}
+
+template<typename Map>
+static void BM_Insert(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        Map map;
+        for(auto key : keys)
+            map.try_emplace(key, key);
+        benchmark::DoNotOptimize(map.size());
+    }
+    bench::reportPerOp(state, count, sizeof(typename Map::value_type));
+}
+BENCHMARK_TEMPLATE(BM_Insert, std::unordered_map<int, int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_Insert, practise::flat_hash_map<int, int>)->Apply(bench::elementSweep);
+
+template<typename Map>
+static void BM_LookupHit(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto map = buildMap<Map>(count);
+    auto probes = bench::randomInts(count, static_cast<int>(count - 1));
+    for(auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for(auto key : probes)
+            sum += map.find(key)->second;
+        benchmark::DoNotOptimize(sum);
+    }
+    bench::reportPerOp(state, count, sizeof(typename Map::value_type));
+}
+BENCHMARK_TEMPLATE(BM_LookupHit, std::unordered_map<int, int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_LookupHit, practise::flat_hash_map<int, int>)->Apply(bench::elementSweep);
+
+template<typename Map>
+static void BM_LookupMiss(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto map = buildMap<Map>(count);
+    auto probes = bench::randomInts(count, static_cast<int>(count - 1));
+    for(auto& key : probes)
+        key += static_cast<int>(count);
+    for(auto _ : state)
+    {
+        std::int64_t found = 0;
+        for(auto key : probes)
+            found += map.contains(key);
+        benchmark::DoNotOptimize(found);
+    }
+    bench::reportPerOp(state, count, sizeof(typename Map::value_type));
+}
+BENCHMARK_TEMPLATE(BM_LookupMiss, std::unordered_map<int, int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_LookupMiss, practise::flat_hash_map<int, int>)->Apply(bench::elementSweep);
+
+//Steady state churn: every op erases one live key and inserts a new one, so the size stays constant
+template<typename Map>
+static void BM_EraseHeavy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        auto map = buildMap<Map>(count);
+        state.ResumeTiming();
+        for(int key = 0; key < count; ++key)
+        {
+            map.erase(key);
+            map.try_emplace(key + static_cast<int>(count), key);
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+    bench::reportPerOp(state, 2 * count, sizeof(typename Map::value_type));
+}
+BENCHMARK_TEMPLATE(BM_EraseHeavy, std::unordered_map<int, int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_EraseHeavy, practise::flat_hash_map<int, int>)->Apply(bench::elementSweep);
+
+//90% hits, 10% misses, one insert out of every ten ops
+template<typename Map>
+static void BM_MixedWorkload(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto probes = bench::randomInts(count, static_cast<int>(count * 10 / 9));
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        auto map = buildMap<Map>(count);
+        state.ResumeTiming();
+        std::int64_t found = 0;
+        for(std::int64_t i = 0; i < count; ++i)
+        {
+            if(i % 10 == 0)
+                map.try_emplace(probes[i] + static_cast<int>(count), 0);
+            else
+                found += map.contains(probes[i]);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    bench::reportPerOp(state, count, sizeof(typename Map::value_type));
+}
+BENCHMARK_TEMPLATE(BM_MixedWorkload, std::unordered_map<int, int>)->Apply(bench::elementSweep);
+BENCHMARK_TEMPLATE(BM_MixedWorkload, practise::flat_hash_map<int, int>)->Apply(bench::elementSweep);
+
+BENCHMARK_MAIN();
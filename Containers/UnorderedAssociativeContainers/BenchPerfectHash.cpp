@@ -0,0 +1,180 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "PerfectHash.h"
+
+//Lookups in a fixed table of 32 country calling codes: perfect_hash_map built at compile time, a
+//std::unordered_map built once before timing, and the switch statement the compiler lowers to jump tables
+//or compare trees. Half of the probes are misses.
+static constexpr auto countryCodeValues = std::to_array<std::pair<int, std::string_view>>({
+    {1,"United States"},{7,"Russia"},{20,"Egypt"},{27,"South Africa"},{30,"Greece"},{31,"Netherlands"},
+    {32,"Belgium"},{33,"France"},{34,"Spain"},{36,"Hungary"},{39,"Italy"},{40,"Romania"},{41,"Switzerland"},
+    {43,"Austria"},{44,"United Kingdom"},{45,"Denmark"},{46,"Sweden"},{47,"Norway"},{48,"Poland"},{49,"Germany"},
+    {51,"Peru"},{52,"Mexico"},{54,"Argentina"},{55,"Brazil"},{61,"Australia"},{81,"Japan"},{82,"South Korea"},
+    {86,"China"},{90,"Turkey"},{91,"India"},{351,"Portugal"},{353,"Ireland"}});
+
+static constexpr auto countryCodes = practise::make_perfect_hash_map(countryCodeValues);
+
+static std::string_view countrySwitch(int code)
+{
+    switch(code)
+    {
+        case 1: return "United States";
+        case 7: return "Russia";
+        case 20: return "Egypt";
+        case 27: return "South Africa";
+        case 30: return "Greece";
+        case 31: return "Netherlands";
+        case 32: return "Belgium";
+        case 33: return "France";
+        case 34: return "Spain";
+        case 36: return "Hungary";
+        case 39: return "Italy";
+        case 40: return "Romania";
+        case 41: return "Switzerland";
+        case 43: return "Austria";
+        case 44: return "United Kingdom";
+        case 45: return "Denmark";
+        case 46: return "Sweden";
+        case 47: return "Norway";
+        case 48: return "Poland";
+        case 49: return "Germany";
+        case 51: return "Peru";
+        case 52: return "Mexico";
+        case 54: return "Argentina";
+        case 55: return "Brazil";
+        case 61: return "Australia";
+        case 81: return "Japan";
+        case 82: return "South Korea";
+        case 86: return "China";
+        case 90: return "Turkey";
+        case 91: return "India";
+        case 351: return "Portugal";
+        case 353: return "Ireland";
+        default: return {};
+    }
+}
+
+struct SwitchLookup
+{
+    std::string_view operator()(int code) const { return countrySwitch(code); }
+};
+
+struct UnorderedMapLookup
+{
+    std::unordered_map<int, std::string_view> map{countryCodeValues.begin(), countryCodeValues.end()};
+
+    std::string_view operator()(int code) const
+    {
+        auto it = map.find(code);
+        return it == map.end() ? std::string_view() : it->second;
+    }
+};
+
+struct PerfectHashLookup
+{
+    std::string_view operator()(int code) const
+    {
+        auto it = countryCodes.find(code);
+        return it == countryCodes.end() ? std::string_view() : it->second;
+    }
+};
+
+//Codes from the table and codes in [0, 400) outside of it, alternating in random order
+static std::vector<int> countryProbes(std::size_t count)
+{
+    std::mt19937 gen{42};
+    std::vector<int> probes(count);
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        if(i % 2 == 0)
+            probes[i] = countryCodeValues[gen() % countryCodeValues.size()].first;
+        else
+            for(probes[i] = static_cast<int>(gen() % 400); countryCodes.contains(probes[i]); probes[i] = static_cast<int>(gen() % 400));
+    }
+    return probes;
+}
+
+template<typename Lookup>
+static void BM_CountryCode(benchmark::State& state)
+{
+    const Lookup lookup;
+    const auto probes = countryProbes(4096);
+    for(auto _ : state)
+    {
+        std::size_t total = 0;
+        for(auto code : probes)
+            total += lookup(code).size();
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(probes.size()));
+}
+BENCHMARK_TEMPLATE(BM_CountryCode, SwitchLookup);
+BENCHMARK_TEMPLATE(BM_CountryCode, UnorderedMapLookup);
+BENCHMARK_TEMPLATE(BM_CountryCode, PerfectHashLookup);
+
+//Keyword recognition, the usual job of a generated perfect hash in a lexer
+static constexpr auto keywordValues = std::to_array<std::string_view>({
+    "alignas","alignof","auto","bool","break","case","catch","char","class","concept","const","consteval",
+    "constexpr","constinit","continue","decltype","default","delete","do","double","else","enum","explicit",
+    "extern","false","float","for","friend","goto","if","inline","int","long","mutable","namespace","new",
+    "noexcept","nullptr","operator","private","protected","public","requires","return","short","signed",
+    "sizeof","static","struct","switch","template","this","throw","true","try","typedef","typename","union",
+    "unsigned","using","virtual","void","volatile","while"});
+
+static constexpr auto keywords = practise::make_perfect_hash_set(keywordValues);
+
+struct UnorderedSetKeywords
+{
+    std::unordered_set<std::string_view> set{keywordValues.begin(), keywordValues.end()};
+
+    bool operator()(std::string_view word) const { return set.contains(word); }
+};
+
+struct PerfectHashKeywords
+{
+    bool operator()(std::string_view word) const { return keywords.contains(word); }
+};
+
+//Keywords and identifiers made of keywords with one letter changed
+static std::vector<std::string_view> keywordProbes(std::vector<std::string>& storage, std::size_t count)
+{
+    std::mt19937 gen{7};
+    storage.reserve(count);
+    std::vector<std::string_view> probes;
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        std::string word(keywordValues[gen() % keywordValues.size()]);
+        if(i % 2)
+            word[gen() % word.size()] = static_cast<char>('a' + gen() % 26);
+        storage.push_back(std::move(word));
+        probes.push_back(storage.back());
+    }
+    return probes;
+}
+
+template<typename Lookup>
+static void BM_Keyword(benchmark::State& state)
+{
+    const Lookup lookup;
+    std::vector<std::string> storage;
+    const auto probes = keywordProbes(storage, 4096);
+    for(auto _ : state)
+    {
+        std::size_t found = 0;
+        for(auto word : probes)
+            found += lookup(word);
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(probes.size()));
+}
+BENCHMARK_TEMPLATE(BM_Keyword, UnorderedSetKeywords);
+BENCHMARK_TEMPLATE(BM_Keyword, PerfectHashKeywords);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+#include <unordered_map>
+#include "Utils/BenchmarkUtils.h"
+#include "Utils/MemoryResourceBenchmarkUtils.h"
+
+using Container = std::unordered_map<int, int>;
+
+static void BM_UnorderedMapInsert(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        Container container;
+        for(auto key : keys)
+            container.try_emplace(key, key);
+        benchmark::DoNotOptimize(container.size());
+    }
+    bench::reportPerOp(state, count, sizeof(Container::value_type));
+}
+BENCHMARK(BM_UnorderedMapInsert)->Apply(bench::elementSweep);
+
+static void BM_UnorderedMapFind(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    Container container;
+    for(auto key : keys)
+        container.try_emplace(key, key);
+    for(auto _ : state)
+    {
+        std::size_t hits = 0;
+        for(auto key : keys)
+            hits += container.contains(key);
+        benchmark::DoNotOptimize(hits);
+    }
+    bench::reportPerOp(state, count, sizeof(Container::value_type));
+}
+BENCHMARK(BM_UnorderedMapFind)->Apply(bench::elementSweep);
+
+//LookUp test shape: equal_range
+static void BM_UnorderedMapEqualRange(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    Container container;
+    for(auto key : keys)
+        container.try_emplace(key, key);
+    for(auto _ : state)
+    {
+        std::size_t found = 0;
+        for(auto key : keys)
+        {
+            auto [first, last] = container.equal_range(key);
+            found += (first != last);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    bench::reportPerOp(state, count, sizeof(Container::value_type));
+}
+BENCHMARK(BM_UnorderedMapEqualRange)->Apply(bench::elementSweep);
+
+static void BM_UnorderedMapIterate(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    Container container;
+    for(auto key : keys)
+        container.try_emplace(key, key);
+    for(auto _ : state)
+    {
+        std::size_t visited = 0;
+        for(auto &value : container)
+        {
+            benchmark::DoNotOptimize(&value);
+            ++visited;
+        }
+        benchmark::DoNotOptimize(visited);
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(container.size()), sizeof(Container::value_type));
+}
+BENCHMARK(BM_UnorderedMapIterate)->Apply(bench::elementSweep);
+
+static void BM_UnorderedMapEraseIf(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        Container container;
+        for(auto key : keys)
+            container.try_emplace(key, key);
+        state.ResumeTiming();
+        std::erase_if(container, [](auto &value){return (value.first % 2) == 0;});
+        benchmark::DoNotOptimize(container.size());
+    }
+    bench::reportPerOp(state, count, sizeof(Container::value_type));
+}
+BENCHMARK(BM_UnorderedMapEraseIf)->Apply(bench::elementSweep);
+
+//Insert/erase churn with std::allocator, monotonic, pool and the thread arena, see bench::insertEraseChurn
+template<typename Resource>
+static void BM_UnorderedMapInsertEraseResource(benchmark::State& state)
+{
+    using UnorderedMap = std::unordered_map<int, int, std::hash<int>, std::equal_to<int>, typename Resource::template allocator_type<std::pair<const int, int>>>;
+    bench::insertEraseChurn<UnorderedMap, Resource>(state, [](UnorderedMap& map, int val) { map.emplace(val, val); });
+}
+BENCHMARK_MEMORY_RESOURCES(BM_UnorderedMapInsertEraseResource);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+#include <unordered_set>
+#include "Utils/BenchmarkUtils.h"
+#include "Utils/MemoryResourceBenchmarkUtils.h"
+
+using Container = std::unordered_set<int>;
+
+static void BM_UnorderedSetInsert(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        Container container;
+        for(auto key : keys)
+            container.insert(key);
+        benchmark::DoNotOptimize(container.size());
+    }
+    bench::reportPerOp(state, count, sizeof(Container::value_type));
+}
+BENCHMARK(BM_UnorderedSetInsert)->Apply(bench::elementSweep);
+
+static void BM_UnorderedSetFind(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    Container container;
+    for(auto key : keys)
+        container.insert(key);
+    for(auto _ : state)
+    {
+        std::size_t hits = 0;
+        for(auto key : keys)
+            hits += container.contains(key);
+        benchmark::DoNotOptimize(hits);
+    }
+    bench::reportPerOp(state, count, sizeof(Container::value_type));
+}
+BENCHMARK(BM_UnorderedSetFind)->Apply(bench::elementSweep);
+
+//LookUp test shape: equal_range
+static void BM_UnorderedSetEqualRange(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    Container container;
+    for(auto key : keys)
+        container.insert(key);
+    for(auto _ : state)
+    {
+        std::size_t found = 0;
+        for(auto key : keys)
+        {
+            auto [first, last] = container.equal_range(key);
+            found += (first != last);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    bench::reportPerOp(state, count, sizeof(Container::value_type));
+}
+BENCHMARK(BM_UnorderedSetEqualRange)->Apply(bench::elementSweep);
+
+static void BM_UnorderedSetIterate(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    Container container;
+    for(auto key : keys)
+        container.insert(key);
+    for(auto _ : state)
+    {
+        std::size_t visited = 0;
+        for(auto &value : container)
+        {
+            benchmark::DoNotOptimize(&value);
+            ++visited;
+        }
+        benchmark::DoNotOptimize(visited);
+    }
+    bench::reportPerOp(state, static_cast<std::int64_t>(container.size()), sizeof(Container::value_type));
+}
+BENCHMARK(BM_UnorderedSetIterate)->Apply(bench::elementSweep);
+
+static void BM_UnorderedSetEraseIf(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto keys = bench::randomInts(count);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        Container container;
+        for(auto key : keys)
+            container.insert(key);
+        state.ResumeTiming();
+        std::erase_if(container, [](auto &value){return (value % 2) == 0;});
+        benchmark::DoNotOptimize(container.size());
+    }
+    bench::reportPerOp(state, count, sizeof(Container::value_type));
+}
+BENCHMARK(BM_UnorderedSetEraseIf)->Apply(bench::elementSweep);
+
+//Insert/erase churn with std::allocator, monotonic, pool and the thread arena, see bench::insertEraseChurn
+template<typename Resource>
+static void BM_UnorderedSetInsertEraseResource(benchmark::State& state)
+{
+    using UnorderedSet = std::unordered_set<int, std::hash<int>, std::equal_to<int>, typename Resource::template allocator_type<int>>;
+    bench::insertEraseChurn<UnorderedSet, Resource>(state, [](UnorderedSet& set, int val) { set.insert(val); });
+}
+BENCHMARK_MEMORY_RESOURCES(BM_UnorderedSetInsertEraseResource);
+
+BENCHMARK_MAIN();
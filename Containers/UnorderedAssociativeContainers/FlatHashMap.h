@@ -0,0 +1,889 @@
+//flat_hash_map<Key, T, Hash, KeyEqual> : open addressing hash map in the style of the Swiss table.
+//Elements live directly in one slot array, next to it a control byte per slot keeps 7 bits of the hash
+//(or the empty/deleted marker). Lookups compare a whole group of control bytes at once (SSE2/AVX2, or
+//8 bytes at a time without SIMD) and only touch the slots whose 7 hash bits match.
+//Unlike std::unordered_map references and iterators are invalidated by every insertion which rehashes.
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace practise
+{
+
+namespace detail
+{
+    using ctrl_t = std::int8_t;
+
+    //Full slots store the 7 low bits of the hash (0..127), so a negative control byte is always a free slot
+    inline constexpr ctrl_t ctrlEmpty = -128;
+    inline constexpr ctrl_t ctrlDeleted = -2;
+
+    inline bool isFull(ctrl_t ctrl) { return ctrl >= 0; }
+
+    //Set bits of a group match, iterated from the lowest slot. Shift converts a bit index into a slot index.
+    template<typename MaskType, int Shift>
+    class BitMask
+    {
+    public:
+        explicit BitMask(MaskType mask) : mMask(mask) {}
+
+        explicit operator bool() const { return mMask != 0; }
+        std::size_t lowest() const { return static_cast<std::size_t>(std::countr_zero(mMask)) >> Shift; }
+
+        BitMask begin() const { return *this; }
+        BitMask end() const { return BitMask(0); }
+        std::size_t operator*() const { return lowest(); }
+        BitMask& operator++() { mMask &= (mMask - 1); return *this; }
+        bool operator!=(const BitMask& other) const { return mMask != other.mMask; }
+
+    private:
+        MaskType mMask;
+    };
+
+#if defined(__AVX2__)
+    struct Group
+    {
+        static constexpr std::size_t width = 32;
+
+        explicit Group(const ctrl_t* pos) : mCtrl(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pos))) {}
+
+        BitMask<std::uint32_t, 0> match(ctrl_t h2) const
+        {
+            return BitMask<std::uint32_t, 0>(static_cast<std::uint32_t>(
+                _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_set1_epi8(h2), mCtrl))));
+        }
+
+        BitMask<std::uint32_t, 0> matchEmpty() const { return match(ctrlEmpty); }
+
+        BitMask<std::uint32_t, 0> matchEmptyOrDeleted() const
+        {
+            return BitMask<std::uint32_t, 0>(static_cast<std::uint32_t>(_mm256_movemask_epi8(mCtrl)));
+        }
+
+        __m256i mCtrl;
+    };
+#elif defined(__SSE2__)
+    struct Group
+    {
+        static constexpr std::size_t width = 16;
+
+        explicit Group(const ctrl_t* pos) : mCtrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+        BitMask<std::uint32_t, 0> match(ctrl_t h2) const
+        {
+            return BitMask<std::uint32_t, 0>(static_cast<std::uint32_t>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), mCtrl))));
+        }
+
+        BitMask<std::uint32_t, 0> matchEmpty() const { return match(ctrlEmpty); }
+
+        //The sign bit is only set for empty and deleted control bytes
+        BitMask<std::uint32_t, 0> matchEmptyOrDeleted() const
+        {
+            return BitMask<std::uint32_t, 0>(static_cast<std::uint32_t>(_mm_movemask_epi8(mCtrl)));
+        }
+
+        __m128i mCtrl;
+    };
+#else
+    //Portable fallback, 8 control bytes in a (little endian) 64 bit word
+    struct Group
+    {
+        static constexpr std::size_t width = 8;
+        static constexpr std::uint64_t lsbs = 0x0101010101010101ULL;
+        static constexpr std::uint64_t msbs = 0x8080808080808080ULL;
+
+        explicit Group(const ctrl_t* pos) { std::memcpy(&mCtrl, pos, sizeof(mCtrl)); }
+
+        //May report a false positive right after a real match, the key compare filters it out
+        BitMask<std::uint64_t, 3> match(ctrl_t h2) const
+        {
+            auto x = mCtrl ^ (lsbs * static_cast<std::uint8_t>(h2));
+            return BitMask<std::uint64_t, 3>((x - lsbs) & ~x & msbs);
+        }
+
+        //empty is 0b10000000 and deleted 0b11111110, so empty is "sign bit set and bit 1 clear"
+        BitMask<std::uint64_t, 3> matchEmpty() const
+        {
+            return BitMask<std::uint64_t, 3>((mCtrl & (~mCtrl << 6)) & msbs);
+        }
+
+        BitMask<std::uint64_t, 3> matchEmptyOrDeleted() const
+        {
+            return BitMask<std::uint64_t, 3>(mCtrl & msbs);
+        }
+
+        std::uint64_t mCtrl;
+    };
+#endif
+
+    //std::hash of integers is the identity, spread the bits before splitting into h1/h2
+    inline std::size_t mixHash(std::size_t hash)
+    {
+        constexpr std::uint64_t kMul = 0x9E3779B97F4A7C15ULL;
+        auto product = static_cast<unsigned __int128>(hash) * kMul;
+        return static_cast<std::size_t>(static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64));
+    }
+}
+
+template<typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class flat_hash_map
+{
+    using ctrl_t = detail::ctrl_t;
+    using Group = detail::Group;
+
+    //A slot overlays the element seen through the iterators with the same pair with a mutable key, like the
+    //slots of Abseil's maps. Elements are constructed as mutableValue, so rehash and extract move the key out of
+    //a non-const object, the iterators hand out value.
+    union slot_type
+    {
+        slot_type() {}
+        ~slot_type() {}
+
+        std::pair<const Key, T> value;
+        std::pair<Key, T> mutableValue;
+    };
+    static_assert(sizeof(std::pair<Key, T>) == sizeof(std::pair<const Key, T>));
+
+public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    template<bool IsConst>
+    class basic_iterator
+    {
+        friend class flat_hash_map;
+        using element_type = flat_hash_map::value_type;
+        using slot_pointer = std::conditional_t<IsConst, const slot_type*, slot_type*>;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = element_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<IsConst, const element_type&, element_type&>;
+        using pointer = std::conditional_t<IsConst, const element_type*, element_type*>;
+
+        basic_iterator() = default;
+
+        //iterator -> const_iterator
+        template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+        basic_iterator(const basic_iterator<OtherConst>& other)
+            : mCtrl(other.mCtrl), mSlot(other.mSlot), mEnd(other.mEnd) {}
+
+        reference operator*() const { return *operator->(); }
+        pointer operator->() const { return std::launder(&mSlot->value); }
+
+        basic_iterator& operator++()
+        {
+            ++mCtrl;
+            ++mSlot;
+            skipFree();
+            return *this;
+        }
+
+        basic_iterator operator++(int)
+        {
+            auto tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) { return lhs.mSlot == rhs.mSlot; }
+
+    private:
+        basic_iterator(const ctrl_t* ctrl, slot_pointer slot, const ctrl_t* end)
+            : mCtrl(ctrl), mSlot(slot), mEnd(end) {}
+
+        void skipFree()
+        {
+            while(mCtrl != mEnd && !detail::isFull(*mCtrl))
+            {
+                ++mCtrl;
+                ++mSlot;
+            }
+        }
+
+        const ctrl_t* mCtrl = nullptr;
+        slot_pointer mSlot = nullptr;
+        const ctrl_t* mEnd = nullptr;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    //Elements are stored inline in the slot array, so extract() moves the element out into the handle
+    class node_type
+    {
+        friend class flat_hash_map;
+
+    public:
+        node_type() = default;
+
+        bool empty() const { return !mValue.has_value(); }
+        explicit operator bool() const { return mValue.has_value(); }
+
+        Key& key() const { return mValue->first; }
+        T& mapped() const { return mValue->second; }
+
+    private:
+        mutable std::optional<std::pair<Key, T>> mValue;
+    };
+
+    struct insert_return_type
+    {
+        iterator position;
+        bool inserted;
+        node_type node;
+    };
+
+    //constructors
+    flat_hash_map() = default;
+
+    explicit flat_hash_map(size_type bucketCount, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual())
+        : mHash(hash), mEqual(equal)
+    {
+        reserve(bucketCount);
+    }
+
+    template<std::input_iterator InputIt>
+    flat_hash_map(InputIt first, InputIt last)
+    {
+        insert(first, last);
+    }
+
+    flat_hash_map(std::initializer_list<value_type> init)
+    {
+        insert(init);
+    }
+
+    flat_hash_map(const flat_hash_map& other)
+        : mHash(other.mHash), mEqual(other.mEqual)
+    {
+        reserve(other.size());
+        for(auto& value : other)
+            insertUnique(hashOf(value.first), value);
+    }
+
+    flat_hash_map(flat_hash_map&& other) noexcept
+        : mHash(std::move(other.mHash)), mEqual(std::move(other.mEqual))
+    {
+        stealFrom(other);
+    }
+
+    ~flat_hash_map()
+    {
+        destroyAll();
+    }
+
+    // = operator
+    flat_hash_map& operator=(const flat_hash_map& other)
+    {
+        if(this != &other)
+        {
+            flat_hash_map tmp(other);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    flat_hash_map& operator=(flat_hash_map&& other) noexcept
+    {
+        if(this != &other)
+        {
+            destroyAll();
+            mHash = std::move(other.mHash);
+            mEqual = std::move(other.mEqual);
+            stealFrom(other);
+        }
+        return *this;
+    }
+
+    flat_hash_map& operator=(std::initializer_list<value_type> init)
+    {
+        clear();
+        insert(init);
+        return *this;
+    }
+
+    //iterators
+    iterator begin() noexcept
+    {
+        iterator it(mCtrl, mSlots, mCtrl + mCapacity);
+        it.skipFree();
+        return it;
+    }
+
+    const_iterator begin() const noexcept
+    {
+        const_iterator it(mCtrl, mSlots, mCtrl + mCapacity);
+        it.skipFree();
+        return it;
+    }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    iterator end() noexcept { return iterator(mCtrl + mCapacity, mSlots + mCapacity, mCtrl + mCapacity); }
+    const_iterator end() const noexcept { return const_iterator(mCtrl + mCapacity, mSlots + mCapacity, mCtrl + mCapacity); }
+    const_iterator cend() const noexcept { return end(); }
+
+    //capacity
+    [[nodiscard]] bool empty() const noexcept { return mSize == 0; }
+    size_type size() const noexcept { return mSize; }
+    size_type max_size() const noexcept { return static_cast<size_type>(-1) / sizeof(value_type); }
+
+    //modifiers
+    void clear() noexcept
+    {
+        if(mCapacity == 0)
+            return;
+        for(size_type i = 0; i < mCapacity; ++i)
+            if(detail::isFull(mCtrl[i]))
+                destroySlot(mSlots + i);
+        std::memset(mCtrl, static_cast<unsigned char>(detail::ctrlEmpty), mCapacity + Group::width);
+        mSize = 0;
+        mGrowthLeft = maxLoad(mCapacity);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return try_emplace(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    template<typename P, typename = std::enable_if_t<std::is_constructible_v<value_type, P&&>>>
+    std::pair<iterator, bool> insert(P&& value)
+    {
+        return emplace(std::forward<P>(value));
+    }
+
+    //The hint means nothing for a hash table, it only exists for API parity
+    iterator insert(const_iterator, const value_type& value)
+    {
+        return insert(value).first;
+    }
+
+    template<typename P, typename = std::enable_if_t<std::is_constructible_v<value_type, P&&>>>
+    iterator insert(const_iterator, P&& value)
+    {
+        return emplace(std::forward<P>(value)).first;
+    }
+
+    template<std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        if constexpr(std::forward_iterator<InputIt>)
+            reserve(mSize + static_cast<size_type>(std::distance(first, last)));
+        for(; first != last; ++first)
+            emplace(*first);
+    }
+
+    void insert(std::initializer_list<value_type> init)
+    {
+        insert(init.begin(), init.end());
+    }
+
+    insert_return_type insert(node_type&& node)
+    {
+        if(node.empty())
+            return {end(), false, node_type()};
+        const auto hash = hashOf(node.key());
+        if(auto index = findIndex(node.key(), hash))
+            return {iteratorAt(*index), false, std::move(node)};
+        auto index = prepareInsert(hash);
+        constructSlot(mSlots + index, std::move(node.mValue->first), std::move(node.mValue->second));
+        node.mValue.reset();
+        return {iteratorAt(index), true, node_type()};
+    }
+
+    iterator insert(const_iterator, node_type&& node)
+    {
+        return insert(std::move(node)).position;
+    }
+
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj)
+    {
+        auto [it, inserted] = try_emplace(key, std::forward<M>(obj));
+        if(!inserted)
+            it->second = std::forward<M>(obj);
+        return {it, inserted};
+    }
+
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(Key&& key, M&& obj)
+    {
+        auto [it, inserted] = try_emplace(std::move(key), std::forward<M>(obj));
+        if(!inserted)
+            it->second = std::forward<M>(obj);
+        return {it, inserted};
+    }
+
+    template<typename M>
+    iterator insert_or_assign(const_iterator, const Key& key, M&& obj)
+    {
+        return insert_or_assign(key, std::forward<M>(obj)).first;
+    }
+
+    template<typename M>
+    iterator insert_or_assign(const_iterator, Key&& key, M&& obj)
+    {
+        return insert_or_assign(std::move(key), std::forward<M>(obj)).first;
+    }
+
+    //The element is built first since the key may have to be constructed out of args
+    template<typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        std::pair<Key, T> value(std::forward<Args>(args)...);
+        const auto hash = hashOf(value.first);
+        if(auto index = findIndex(value.first, hash))
+            return {iteratorAt(*index), false};
+        auto index = prepareInsert(hash);
+        constructSlot(mSlots + index, std::move(value));
+        return {iteratorAt(index), true};
+    }
+
+    template<typename... Args>
+    iterator emplace_hint(const_iterator, Args&&... args)
+    {
+        return emplace(std::forward<Args>(args)...).first;
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+    {
+        return tryEmplaceImpl(key, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args)
+    {
+        return tryEmplaceImpl(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    iterator try_emplace(const_iterator, const Key& key, Args&&... args)
+    {
+        return try_emplace(key, std::forward<Args>(args)...).first;
+    }
+
+    template<typename... Args>
+    iterator try_emplace(const_iterator, Key&& key, Args&&... args)
+    {
+        return try_emplace(std::move(key), std::forward<Args>(args)...).first;
+    }
+
+    //Erasing leaves a tombstone, iteration order of the remaining elements does not change
+    iterator erase(iterator pos)
+    {
+        eraseIndex(indexOf(pos));
+        ++pos;
+        return pos;
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        return erase(iteratorAt(indexOf(pos)));
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        while(first != last)
+            first = erase(first);
+        return iteratorAt(indexOf(last));
+    }
+
+    size_type erase(const Key& key)
+    {
+        auto index = findIndex(key, hashOf(key));
+        if(!index)
+            return 0;
+        eraseIndex(*index);
+        return 1;
+    }
+
+    void swap(flat_hash_map& other) noexcept
+    {
+        using std::swap;
+        swap(mHash, other.mHash);
+        swap(mEqual, other.mEqual);
+        swap(mCtrl, other.mCtrl);
+        swap(mSlots, other.mSlots);
+        swap(mCapacity, other.mCapacity);
+        swap(mSize, other.mSize);
+        swap(mGrowthLeft, other.mGrowthLeft);
+    }
+
+    node_type extract(const_iterator pos)
+    {
+        const auto index = indexOf(pos);
+        node_type node;
+        node.mValue.emplace(std::move(mSlots[index].mutableValue));
+        eraseIndex(index);
+        return node;
+    }
+
+    node_type extract(const Key& key)
+    {
+        auto index = findIndex(key, hashOf(key));
+        if(!index)
+            return node_type();
+        return extract(const_iterator(iteratorAt(*index)));
+    }
+
+    //Moves every element whose key is not present yet out of source
+    template<typename H2, typename P2>
+    void merge(flat_hash_map<Key, T, H2, P2>& source)
+    {
+        for(auto it = source.begin(); it != source.end();)
+        {
+            const auto hash = hashOf(it->first);
+            if(findIndex(it->first, hash))
+            {
+                ++it;
+                continue;
+            }
+            auto node = source.extract(it++);
+            auto index = prepareInsert(hash);
+            constructSlot(mSlots + index, std::move(node.key()), std::move(node.mapped()));
+        }
+    }
+
+    template<typename H2, typename P2>
+    void merge(flat_hash_map<Key, T, H2, P2>&& source)
+    {
+        merge(source);
+    }
+
+    //element access
+    T& at(const Key& key)
+    {
+        auto index = findIndex(key, hashOf(key));
+        if(!index)
+            throw std::out_of_range("flat_hash_map::at");
+        return mSlots[*index].mutableValue.second;
+    }
+
+    const T& at(const Key& key) const
+    {
+        auto index = findIndex(key, hashOf(key));
+        if(!index)
+            throw std::out_of_range("flat_hash_map::at");
+        return mSlots[*index].mutableValue.second;
+    }
+
+    T& operator[](const Key& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    T& operator[](Key&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    //lookup
+    size_type count(const Key& key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    iterator find(const Key& key)
+    {
+        auto index = findIndex(key, hashOf(key));
+        return index ? iteratorAt(*index) : end();
+    }
+
+    const_iterator find(const Key& key) const
+    {
+        auto index = findIndex(key, hashOf(key));
+        return index ? const_iterator(const_cast<flat_hash_map*>(this)->iteratorAt(*index)) : end();
+    }
+
+    bool contains(const Key& key) const
+    {
+        return findIndex(key, hashOf(key)).has_value();
+    }
+
+    std::pair<iterator, iterator> equal_range(const Key& key)
+    {
+        auto it = find(key);
+        if(it == end())
+            return {it, it};
+        return {it, std::next(it)};
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+    {
+        auto it = find(key);
+        if(it == end())
+            return {it, it};
+        return {it, std::next(it)};
+    }
+
+    //bucket interface, every slot is a bucket
+    size_type bucket_count() const noexcept { return mCapacity; }
+    float load_factor() const noexcept { return mCapacity ? static_cast<float>(mSize) / static_cast<float>(mCapacity) : 0.0f; }
+    float max_load_factor() const noexcept { return 7.0f / 8.0f; }
+
+    void reserve(size_type count)
+    {
+        if(count > mSize + mGrowthLeft)
+            rehash(count);
+    }
+
+    //Rebuilds the table with room for at least count elements, which also drops all tombstones
+    void rehash(size_type count)
+    {
+        size_type capacity = Group::width;
+        while(maxLoad(capacity) < std::max(count, mSize))
+            capacity *= 2;
+        resize(capacity);
+    }
+
+    //observers
+    hasher hash_function() const { return mHash; }
+    key_equal key_eq() const { return mEqual; }
+
+    //non member functions
+    friend bool operator==(const flat_hash_map& lhs, const flat_hash_map& rhs)
+    {
+        if(lhs.size() != rhs.size())
+            return false;
+        for(auto& value : lhs)
+        {
+            auto it = rhs.find(value.first);
+            if(it == rhs.end() || !(it->second == value.second))
+                return false;
+        }
+        return true;
+    }
+
+    friend void swap(flat_hash_map& lhs, flat_hash_map& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+private:
+    static size_type maxLoad(size_type capacity) { return capacity - capacity / 8; }
+
+    size_type hashOf(const Key& key) const { return detail::mixHash(mHash(key)); }
+    static size_type h1(size_type hash) { return hash >> 7; }
+    static ctrl_t h2(size_type hash) { return static_cast<ctrl_t>(hash & 0x7F); }
+
+    iterator iteratorAt(size_type index) { return iterator(mCtrl + index, mSlots + index, mCtrl + mCapacity); }
+
+    template<bool IsConst>
+    size_type indexOf(const basic_iterator<IsConst>& it) const { return static_cast<size_type>(it.mCtrl - mCtrl); }
+
+    //Writes the control byte and its mirror behind the table, so a group load at the last slots wraps around
+    void setCtrl(size_type index, ctrl_t value)
+    {
+        mCtrl[index] = value;
+        if(index < Group::width)
+            mCtrl[mCapacity + index] = value;
+    }
+
+    //Probes group by group with growing steps (triangular numbers), which visits every group of a power of two table
+    std::optional<size_type> findIndex(const Key& key, size_type hash) const
+    {
+        if(mCapacity == 0)
+            return std::nullopt;
+        const size_type mask = mCapacity - 1;
+        size_type pos = h1(hash) & mask;
+        for(size_type step = Group::width;; step += Group::width)
+        {
+            Group group(mCtrl + pos);
+            for(auto bit : group.match(h2(hash)))
+            {
+                const auto index = (pos + bit) & mask;
+                if(mEqual(mSlots[index].mutableValue.first, key))
+                    return index;
+            }
+            if(group.matchEmpty())
+                return std::nullopt;
+            pos = (pos + step) & mask;
+        }
+    }
+
+    size_type findFirstNonFull(size_type hash) const
+    {
+        const size_type mask = mCapacity - 1;
+        size_type pos = h1(hash) & mask;
+        for(size_type step = Group::width;; step += Group::width)
+        {
+            if(auto freeSlots = Group(mCtrl + pos).matchEmptyOrDeleted())
+                return (pos + freeSlots.lowest()) & mask;
+            pos = (pos + step) & mask;
+        }
+    }
+
+    //Returns the slot for a key known to be absent, growing the table when it is out of empty slots
+    size_type prepareInsert(size_type hash)
+    {
+        if(mCapacity == 0)
+            resize(Group::width);
+        auto index = findFirstNonFull(hash);
+        if(mGrowthLeft == 0 && mCtrl[index] != detail::ctrlDeleted)
+        {
+            //Mostly tombstones: rebuild at the same size, otherwise double
+            resize(mSize * 2 < maxLoad(mCapacity) ? mCapacity : mCapacity * 2);
+            index = findFirstNonFull(hash);
+        }
+        if(mCtrl[index] == detail::ctrlEmpty)
+            --mGrowthLeft;
+        setCtrl(index, h2(hash));
+        ++mSize;
+        return index;
+    }
+
+    template<typename K, typename... Args>
+    std::pair<iterator, bool> tryEmplaceImpl(K&& key, Args&&... args)
+    {
+        const auto hash = hashOf(key);
+        if(auto index = findIndex(key, hash))
+            return {iteratorAt(*index), false};
+        auto index = prepareInsert(hash);
+        constructSlot(mSlots + index, std::piecewise_construct,
+                      std::forward_as_tuple(std::forward<K>(key)),
+                      std::forward_as_tuple(std::forward<Args>(args)...));
+        return {iteratorAt(index), true};
+    }
+
+    //Used by copy construction where the keys are already known to be unique
+    void insertUnique(size_type hash, const value_type& value)
+    {
+        auto index = prepareInsert(hash);
+        constructSlot(mSlots + index, value);
+    }
+
+    void eraseIndex(size_type index)
+    {
+        destroySlot(mSlots + index);
+        setCtrl(index, detail::ctrlDeleted);
+        --mSize;
+    }
+
+    void resize(size_type newCapacity)
+    {
+        auto oldCtrl = mCtrl;
+        auto oldSlots = mSlots;
+        auto oldCapacity = mCapacity;
+
+        mCtrl = new ctrl_t[newCapacity + Group::width];
+        mSlots = static_cast<slot_type*>(::operator new(newCapacity * sizeof(slot_type), std::align_val_t{alignof(slot_type)}));
+        mCapacity = newCapacity;
+        std::memset(mCtrl, static_cast<unsigned char>(detail::ctrlEmpty), newCapacity + Group::width);
+        mGrowthLeft = maxLoad(newCapacity) - mSize;
+
+        for(size_type i = 0; i < oldCapacity; ++i)
+        {
+            if(!detail::isFull(oldCtrl[i]))
+                continue;
+            const auto hash = hashOf(oldSlots[i].mutableValue.first);
+            const auto index = findFirstNonFull(hash);
+            setCtrl(index, h2(hash));
+            constructSlot(mSlots + index, std::move(oldSlots[i].mutableValue));
+            destroySlot(oldSlots + i);
+        }
+        freeTable(oldCtrl, oldSlots, oldCapacity);
+    }
+
+    //Starts the lifetime of the slot with mutableValue as its active member
+    template<typename... Args>
+    static void constructSlot(slot_type* slot, Args&&... args)
+    {
+        ::new(static_cast<void*>(slot)) slot_type;
+        std::construct_at(&slot->mutableValue, std::forward<Args>(args)...);
+    }
+
+    static void destroySlot(slot_type* slot)
+    {
+        std::destroy_at(&slot->mutableValue);
+        std::destroy_at(slot);
+    }
+
+    static void freeTable(ctrl_t* ctrl, slot_type* slots, size_type capacity)
+    {
+        if(capacity == 0)
+            return;
+        delete[] ctrl;
+        ::operator delete(slots, std::align_val_t{alignof(slot_type)});
+    }
+
+    void destroyAll() noexcept
+    {
+        clear();
+        freeTable(mCtrl, mSlots, mCapacity);
+        mCtrl = nullptr;
+        mSlots = nullptr;
+        mCapacity = 0;
+        mGrowthLeft = 0;
+    }
+
+    void stealFrom(flat_hash_map& other) noexcept
+    {
+        mCtrl = std::exchange(other.mCtrl, nullptr);
+        mSlots = std::exchange(other.mSlots, nullptr);
+        mCapacity = std::exchange(other.mCapacity, 0);
+        mSize = std::exchange(other.mSize, 0);
+        mGrowthLeft = std::exchange(other.mGrowthLeft, 0);
+    }
+
+    template<typename, typename, typename, typename>
+    friend class flat_hash_map;
+
+    [[no_unique_address]] Hash mHash{};
+    [[no_unique_address]] KeyEqual mEqual{};
+    ctrl_t* mCtrl = nullptr;
+    slot_type* mSlots = nullptr;
+    size_type mCapacity = 0;
+    size_type mSize = 0;
+    size_type mGrowthLeft = 0;
+};
+
+//std::erase_if counterpart, found through ADL
+template<typename Key, typename T, typename Hash, typename KeyEqual, typename Pred>
+typename flat_hash_map<Key, T, Hash, KeyEqual>::size_type erase_if(flat_hash_map<Key, T, Hash, KeyEqual>& map, Pred pred)
+{
+    const auto oldSize = map.size();
+    for(auto it = map.begin(); it != map.end();)
+    {
+        if(pred(*it))
+            it = map.erase(it);
+        else
+            ++it;
+    }
+    return oldSize - map.size();
+}
+
+}
@@ -0,0 +1,317 @@
+//perfect_hash_map<Key, T, N, Hash, KeyEqual> / perfect_hash_set<Key, N, Hash, KeyEqual> : immutable hash tables
+//over N keys known at compile time, built by make_perfect_hash_map/make_perfect_hash_set from a std::array.
+//The build runs during constant evaluation and searches a hash function without any collision for exactly those
+//keys (hash and displace): the keys are spread over buckets of about two keys, then each bucket, largest first,
+//gets the displacement which sends all of its keys to free slots. A lookup is one hash of the key, one
+//displacement and one key comparison, there is no probing and nothing is constructed at run time.
+//Duplicate keys, or keys for which no perfect hash is found, make the constant evaluation (and so the
+//compilation) fail. Hash is called as hash(key, seed) and has to be usable in constant expressions,
+//constexpr_hash covers integers, enums and std::string_view.
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace practise
+{
+
+namespace detail
+{
+    inline constexpr std::uint64_t goldenRatio = 0x9E3779B97F4A7C15ULL;
+
+    //Finalizer of MurmurHash3, every input bit reaches every output bit
+    constexpr std::uint64_t fmix64(std::uint64_t x) noexcept
+    {
+        x ^= x >> 33;
+        x *= 0xFF51AFD7ED558CCDULL;
+        x ^= x >> 33;
+        x *= 0xC4CEB9FE1A85EC53ULL;
+        x ^= x >> 33;
+        return x;
+    }
+}
+
+//Seeded hashes usable in constant expressions
+template<typename Key>
+struct constexpr_hash;
+
+template<typename Key>
+    requires std::integral<Key> || std::is_enum_v<Key>
+struct constexpr_hash<Key>
+{
+    constexpr std::uint64_t operator()(Key key, std::uint64_t seed) const noexcept
+    {
+        if constexpr(std::is_enum_v<Key>)
+            return constexpr_hash<std::underlying_type_t<Key>>()(static_cast<std::underlying_type_t<Key>>(key), seed);
+        else
+            return detail::fmix64(static_cast<std::uint64_t>(key) ^ seed);
+    }
+};
+
+template<>
+struct constexpr_hash<std::string_view>
+{
+    //8 chars per step, little endian; one unaligned load for whole words at run time
+    constexpr std::uint64_t operator()(std::string_view key, std::uint64_t seed) const noexcept
+    {
+        auto word = [&](std::size_t first, std::size_t count)
+        {
+            std::uint64_t value = 0;
+            if(!std::is_constant_evaluated() && count == 8 && std::endian::native == std::endian::little)
+            {
+                std::memcpy(&value, key.data() + first, 8);
+                return value;
+            }
+            for(std::size_t i = 0; i < count; ++i)
+                value |= std::uint64_t{static_cast<unsigned char>(key[first + i])} << (8 * i);
+            return value;
+        };
+        std::uint64_t hash = seed ^ (key.size() * detail::goldenRatio);
+        std::size_t i = 0;
+        for(; i + 8 <= key.size(); i += 8)
+            hash = std::rotl(hash ^ word(i, 8), 29) * detail::goldenRatio;
+        if(i < key.size())
+            hash = std::rotl(hash ^ word(i, key.size() - i), 29) * detail::goldenRatio;
+        return detail::fmix64(hash);
+    }
+};
+
+namespace detail
+{
+    //Storage and lookup shared by perfect_hash_map (Value = std::pair<Key, T>) and perfect_hash_set (Value = Key)
+    template<typename Key, typename Value, std::size_t N, typename Hash, typename KeyEqual>
+    class perfect_hash_table
+    {
+        static_assert(N > 0, "a perfect hash table needs at least one key");
+
+    public:
+        using key_type = Key;
+        using value_type = Value;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using reference = const value_type&;
+        using const_reference = const value_type&;
+        using iterator = const value_type*;
+        using const_iterator = const value_type*;
+
+        //Load factor of at most 0.8 keeps the search for the last buckets short
+        static constexpr size_type slot_count = std::max<size_type>(2, std::bit_ceil(N + N / 4));
+        static constexpr size_type bucket_count = std::max<size_type>(2, std::bit_ceil(N / 2 + 1));
+
+        //Throws std::invalid_argument on duplicate keys and std::logic_error when no perfect hash is found,
+        //which is a compile error when called from make_perfect_hash_map/make_perfect_hash_set
+        constexpr explicit perfect_hash_table(const std::array<Value, N>& values, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual())
+            : mValues(values), mHash(hash), mEqual(equal)
+        {
+            for(std::uint64_t attempt = 0; attempt < maxSeeds; ++attempt)
+            {
+                mSeed = fmix64(attempt + 1);
+                if(tryBuild())
+                    return;
+            }
+            throw std::logic_error("perfect_hash_table: no perfect hash function found for the keys");
+        }
+
+        //iterators, in the order of the initial array
+        constexpr const_iterator begin() const noexcept { return mValues.data(); }
+        constexpr const_iterator end() const noexcept { return mValues.data() + N; }
+        constexpr const_iterator cbegin() const noexcept { return begin(); }
+        constexpr const_iterator cend() const noexcept { return end(); }
+
+        //capacity
+        constexpr bool empty() const noexcept { return false; }
+        constexpr size_type size() const noexcept { return N; }
+        constexpr size_type max_size() const noexcept { return N; }
+
+        //lookup
+        constexpr const_iterator find(const Key& key) const
+        {
+            const auto& candidate = mValues[mSlots[slotOf(mHash(key, mSeed), mDisplacements)]];
+            return mEqual(keyOf(candidate), key) ? &candidate : end();
+        }
+
+        constexpr bool contains(const Key& key) const
+        {
+            return find(key) != end();
+        }
+
+        constexpr size_type count(const Key& key) const
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        constexpr std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+        {
+            const auto it = find(key);
+            return {it, it == end() ? it : it + 1};
+        }
+
+        //observers
+        constexpr hasher hash_function() const { return mHash; }
+        constexpr key_equal key_eq() const { return mEqual; }
+
+    protected:
+        static constexpr const Key& keyOf(const Value& value) noexcept
+        {
+            if constexpr(std::is_same_v<Key, Value>)
+                return value;
+            else
+                return value.first;
+        }
+
+    private:
+        using index_type = std::conditional_t<(N <= std::numeric_limits<std::uint8_t>::max()), std::uint8_t,
+                           std::conditional_t<(N <= std::numeric_limits<std::uint16_t>::max()), std::uint16_t, std::uint32_t>>;
+
+        static constexpr int bucketShift = 64 - std::countr_zero(bucket_count);
+        static constexpr int slotShift = 64 - std::countr_zero(slot_count);
+        static constexpr std::uint64_t maxSeeds = 64;
+        static constexpr std::uint64_t maxDisplacements = std::uint64_t{1} << 16;
+
+        //The bucket is taken from the high bits of the hash, the slot from the high bits of the displaced hash
+        static constexpr size_type slotOf(std::uint64_t hash, const std::array<std::uint64_t, bucket_count>& displacements) noexcept
+        {
+            return static_cast<size_type>(((hash ^ displacements[hash >> bucketShift]) * goldenRatio) >> slotShift);
+        }
+
+        static constexpr size_type slotOf(std::uint64_t hash, std::uint64_t displacement) noexcept
+        {
+            return static_cast<size_type>(((hash ^ displacement) * goldenRatio) >> slotShift);
+        }
+
+        constexpr bool tryBuild()
+        {
+            std::array<std::uint64_t, N> hashes{};
+            std::array<size_type, bucket_count> bucketSizes{};
+            for(size_type i = 0; i < N; ++i)
+            {
+                hashes[i] = mHash(keyOf(mValues[i]), mSeed);
+                ++bucketSizes[hashes[i] >> bucketShift];
+            }
+
+            //Largest buckets first while most slots are free, equal hashes end up next to each other
+            std::array<size_type, N> order{};
+            std::iota(order.begin(), order.end(), size_type{0});
+            std::sort(order.begin(), order.end(), [&](size_type a, size_type b)
+            {
+                const auto bucketA = hashes[a] >> bucketShift;
+                const auto bucketB = hashes[b] >> bucketShift;
+                if(bucketSizes[bucketA] != bucketSizes[bucketB])
+                    return bucketSizes[bucketA] > bucketSizes[bucketB];
+                if(bucketA != bucketB)
+                    return bucketA < bucketB;
+                return hashes[a] < hashes[b];
+            });
+            for(size_type i = 1; i < N; ++i)
+            {
+                if(hashes[order[i]] != hashes[order[i - 1]])
+                    continue;
+                if(mEqual(keyOf(mValues[order[i]]), keyOf(mValues[order[i - 1]])))
+                    throw std::invalid_argument("perfect_hash_table: duplicate key");
+                //Two keys with the same 64 bit hash cannot be separated by any displacement
+                return false;
+            }
+
+            std::array<bool, slot_count> used{};
+            mDisplacements = {};
+            //Free slots keep pointing at some element: a missing key never compares equal to it, as an equal key
+            //would have the same hash and land in that element's own slot
+            mSlots = {};
+            for(size_type first = 0; first < N;)
+            {
+                const auto bucket = hashes[order[first]] >> bucketShift;
+                const auto last = first + bucketSizes[bucket];
+                bool placed = false;
+                for(std::uint64_t attempt = 0; attempt < maxDisplacements && !placed; ++attempt)
+                {
+                    const auto displacement = fmix64(mSeed ^ (attempt * goldenRatio));
+                    size_type i = first;
+                    for(; i < last; ++i)
+                    {
+                        const auto slot = slotOf(hashes[order[i]], displacement);
+                        if(used[slot])
+                            break;
+                        used[slot] = true;
+                        mSlots[slot] = static_cast<index_type>(order[i]);
+                    }
+                    placed = i == last;
+                    if(placed)
+                        mDisplacements[bucket] = displacement;
+                    else
+                        while(i-- > first)
+                            used[slotOf(hashes[order[i]], displacement)] = false;
+                }
+                if(!placed)
+                    return false;
+                first = last;
+            }
+            return true;
+        }
+
+        std::array<Value, N> mValues;
+        std::array<std::uint64_t, bucket_count> mDisplacements{};
+        std::array<index_type, slot_count> mSlots{};
+        std::uint64_t mSeed = 0;
+        [[no_unique_address]] Hash mHash;
+        [[no_unique_address]] KeyEqual mEqual;
+    };
+}
+
+template<typename Key, typename T, std::size_t N, typename Hash = constexpr_hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class perfect_hash_map : public detail::perfect_hash_table<Key, std::pair<Key, T>, N, Hash, KeyEqual>
+{
+    using Base = detail::perfect_hash_table<Key, std::pair<Key, T>, N, Hash, KeyEqual>;
+
+public:
+    using mapped_type = T;
+
+    using Base::Base;
+
+    //element access, the table is immutable so there is no inserting operator[]
+    constexpr const T& at(const Key& key) const
+    {
+        const auto it = this->find(key);
+        if(it == this->end())
+            throw std::out_of_range("perfect_hash_map::at: key not found");
+        return it->second;
+    }
+};
+
+template<typename Key, std::size_t N, typename Hash = constexpr_hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class perfect_hash_set : public detail::perfect_hash_table<Key, Key, N, Hash, KeyEqual>
+{
+    using Base = detail::perfect_hash_table<Key, Key, N, Hash, KeyEqual>;
+
+public:
+    using Base::Base;
+};
+
+//Builders which can only run at compile time, used as
+//constexpr auto codes = practise::make_perfect_hash_map(std::to_array<std::pair<int, std::string_view>>({{49, "Germany"}, {91, "India"}}));
+template<typename Key, typename T, std::size_t N, typename Hash = constexpr_hash<Key>, typename KeyEqual = std::equal_to<Key>>
+consteval perfect_hash_map<Key, T, N, Hash, KeyEqual> make_perfect_hash_map(const std::array<std::pair<Key, T>, N>& values, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual())
+{
+    return perfect_hash_map<Key, T, N, Hash, KeyEqual>(values, hash, equal);
+}
+
+template<typename Key, std::size_t N, typename Hash = constexpr_hash<Key>, typename KeyEqual = std::equal_to<Key>>
+consteval perfect_hash_set<Key, N, Hash, KeyEqual> make_perfect_hash_set(const std::array<Key, N>& keys, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual())
+{
+    return perfect_hash_set<Key, N, Hash, KeyEqual>(keys, hash, equal);
+}
+
+}
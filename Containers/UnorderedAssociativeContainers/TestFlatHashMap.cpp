@@ -0,0 +1,410 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "FlatHashMap.h"
+
+//Same scenarios as TestUnorderedMap.cpp, run against the open addressing flat_hash_map.
+//Checks which relied on the bucket order of std::unordered_map are written order independent here.
+bool compareContainers(auto &container1, auto &&container2)
+{
+    if(container1.size() != container2.size())
+        return false;
+    for(auto &key:container1)
+        if(!container2.contains(key.first))
+            return false;
+    return true;
+}
+
+bool compareUserDefinedValuesContainers(auto &container1, auto &&container2)
+{
+    for(auto &value:container1)
+        if(!container2.contains(value.first.getValue()))
+            return false;
+    return true;
+}
+
+TEST(FlatHashMap, MemberFunctions)
+{
+    practise::flat_hash_map<int, std::string> uMap;
+    EXPECT_TRUE(uMap.empty());
+
+    //User defined type
+    class Key
+    {
+    public:
+        std::string val;
+    public:
+        Key(std::string v):val(v){};
+        ~Key(){};
+
+        std::string getVal() const{return val;}
+    };
+
+    //use the custom comparator
+    auto keyCmp = [](const Key &a, const Key &b) { return a.getVal() == b.getVal(); };
+
+    //use the custom hash
+    struct Hasher
+    {
+        size_t operator()(const Key &x) const
+        {
+            return std::hash<std::string>()(x.getVal());
+        }
+    };
+
+    //The value type is also custom type. Just to check that values doesn't need hash
+    class Value
+    {
+        public:
+            int val;
+        public:
+            Value(int v):val(v){};
+            ~Value(){};
+
+        int getVal() const{return val;}
+    };
+
+    practise::flat_hash_map<Key,Value,Hasher,decltype(keyCmp)> uMap1{{Key("Str1"),Value(1)}};
+    EXPECT_EQ(uMap1.size(),1);
+    EXPECT_TRUE(uMap1.contains(Key("Str1")));
+
+    std::array<std::pair<int,std::string>, 4> initialValues{{{49,"Germany"},{91,"India"},{36,"Hungary"},{33,"France"}}};
+    practise::flat_hash_map<int, std::string> uMap2(initialValues.begin(), initialValues.end());
+    EXPECT_EQ(uMap2.size(),4);
+
+    practise::flat_hash_map<int, std::string> uMap3(uMap2);
+    EXPECT_TRUE(compareContainers(uMap3,uMap2));
+    practise::flat_hash_map<int, std::string> uMap4(std::move(uMap3));
+    EXPECT_TRUE(compareContainers(uMap4,uMap2));
+    EXPECT_TRUE(uMap3.empty());
+
+    practise::flat_hash_map<int, std::string> uMap5{{12,"John"},{22,"Sven"},{33,"White"}};
+    EXPECT_TRUE(compareContainers(uMap5,(std::map<int,std::string>{{12,"John"},{22,"Sven"},{33,"White"}})));
+
+    //= operator
+    uMap = uMap2;
+    EXPECT_TRUE(compareContainers(uMap,uMap2));
+
+    practise::flat_hash_map<int, std::string> uMap6{{20,"Hi"},{11,"how"},{1,"are"},{-2,"you"}};
+    uMap2 = std::move(uMap6);
+    EXPECT_TRUE(compareContainers(uMap2,(std::map<int,std::string>{{20,"Hi"},{11,"how"},{1,"are"},{-2,"you"}})));
+}
+
+TEST(FlatHashMap, ElementAccess)
+{
+    practise::flat_hash_map<int, char> uMap{{1,'a'},{4,'b'},{2,'c'},{3,'d'}};
+
+    EXPECT_EQ(uMap.at(4),'b');
+    EXPECT_EQ(uMap.at(2),'c');
+    EXPECT_THROW(uMap.at(9), std::out_of_range);
+
+    EXPECT_EQ(uMap[1],'a');
+    EXPECT_EQ(uMap[3],'d');
+
+    uMap[1] = 'e';
+    uMap[3] = 'f';
+
+    EXPECT_EQ(uMap[1],'e');
+    EXPECT_EQ(uMap[3],'f');
+
+    //operator[] default inserts a missing key
+    EXPECT_EQ(uMap[10],'\0');
+    EXPECT_EQ(uMap.size(),5);
+}
+
+TEST(FlatHashMap, Iterators)
+{
+    practise::flat_hash_map<int, char> uMap{{1,'a'},{4,'b'},{2,'c'},{3,'d'}};
+
+    //No order is guaranteed, so only check every element is visited exactly once
+    std::map<int,char> visited(uMap.begin(), uMap.end());
+    EXPECT_EQ(visited, (std::map<int,char>{{1,'a'},{2,'c'},{3,'d'},{4,'b'}}));
+    EXPECT_EQ(std::distance(uMap.cbegin(), uMap.cend()), 4);
+
+    auto it = uMap.begin();
+    it->second = 'z';
+    EXPECT_EQ(uMap.at(it->first),'z');
+
+    practise::flat_hash_map<int, char> emptyMap;
+    EXPECT_TRUE(emptyMap.begin() == emptyMap.end());
+}
+
+TEST(FlatHashMap, Capacity)
+{
+    practise::flat_hash_map<std::string, std::vector<int>> uMap;
+    EXPECT_TRUE(uMap.empty());
+
+    uMap = {{"First",{1,2,3}},{"Second",{2,3,4}}};
+    EXPECT_EQ(uMap.size(),2);
+
+    //Growing past many groups keeps every element reachable
+    practise::flat_hash_map<int, int> bigMap;
+    for(int i = 0; i < 10000; ++i)
+        bigMap.try_emplace(i, i * 2);
+    EXPECT_EQ(bigMap.size(), 10000);
+    EXPECT_LE(bigMap.load_factor(), bigMap.max_load_factor());
+    for(int i = 0; i < 10000; ++i)
+        ASSERT_EQ(bigMap.at(i), i * 2);
+
+    bigMap.reserve(50000);
+    EXPECT_GE(bigMap.bucket_count(), 50000);
+    EXPECT_EQ(bigMap.size(), 10000);
+}
+
+TEST(FlatHashMap, Modifiers)
+{
+    practise::flat_hash_map<int, std::vector<int>> uMap{{1,{1,2,3}},{3,{2,3,4}}};
+    EXPECT_EQ(uMap.size(),2);
+    EXPECT_FALSE(uMap.empty());
+
+    uMap.clear();
+    EXPECT_EQ(uMap.size(),0);
+    EXPECT_TRUE(uMap.empty());
+
+    //rvalue
+    uMap.insert({2,{1,4,5}});
+    uMap.insert({1,{1,2,3}});
+    uMap.insert({3,{2,3,4}});
+    std::map<int, std::vector<int>> expectedMap{{1,{1,2,3}},{2,{1,4,5}},{3,{2,3,4}}};
+    EXPECT_TRUE(compareContainers(uMap,expectedMap));
+
+    //lvalue
+    std::pair<int,std::vector<int>> val{5,{2,4,5}};
+    uMap.insert(val);
+    std::map<int, std::vector<int>> expectedMap1{{1,{1,2,3}},{2,{1,4,5}},{3,{2,3,4}},{5,{2,4,5}}};
+    EXPECT_TRUE(compareContainers(uMap,expectedMap1));
+
+    //rvalue with emplace
+    uMap.insert(std::pair<int,std::vector<int>>{7,{2,4,5}});
+    std::map<int, std::vector<int>> expectedMap2{{1,{1,2,3}},{2,{1,4,5}},{3,{2,3,4}},{5,{2,4,5}},{7,{2,4,5}}};
+    EXPECT_TRUE(compareContainers(uMap,expectedMap2));
+
+    //Same lvalue, rvalue and emplace with position insertion
+    practise::flat_hash_map<int,char> uMap1{{1,'a'},{4,'b'}};
+    uMap1.insert(++uMap1.begin(),{2,'c'});
+    uMap1.insert(uMap1.begin(), std::pair<int,char>{7,'e'});
+    std::pair<int,char> val2{3,'f'};
+    uMap1.insert(uMap1.begin(),val2);
+    std::map<int,char> expectedMap3{{1,'a'},{2,'c'},{3,'f'},{4,'b'},{7,'e'}};
+    EXPECT_TRUE(compareContainers(uMap1,expectedMap3));
+
+    //range insertion
+    practise::flat_hash_map<int,char> uMap2;
+    uMap2.insert(uMap1.begin(),uMap1.end());
+    EXPECT_TRUE(compareContainers(uMap2,expectedMap3));
+
+    uMap2.insert({{1,'a'},{5,'o'}});
+    EXPECT_EQ(uMap2.size(),6);
+
+    //node_type insertion, the node carries the element out of one map into the other
+    auto node = uMap1.extract(7);
+    EXPECT_FALSE(node.empty());
+    EXPECT_EQ(uMap1.size(),4);
+    node.key() = 70;
+    practise::flat_hash_map<int,char> uMap3;
+    auto result = uMap3.insert(std::move(node));
+    EXPECT_TRUE(result.inserted);
+    EXPECT_EQ(result.position->first,70);
+    EXPECT_EQ(uMap3.at(70),'e');
+
+    //insert_or_assign since the keys are same both are not inserted into map. so the size is same
+    uMap2.insert_or_assign(1,'s');
+    uMap2.insert_or_assign(++uMap2.begin(),2,'h');
+    EXPECT_EQ(uMap2.size(),6);
+    EXPECT_EQ(uMap2.at(1),'s');
+    EXPECT_EQ(uMap2.at(2),'h');
+
+    //emplace
+    class TestConstructor
+    {
+        public:
+            TestConstructor(int val): m_Value(val){};
+            ~TestConstructor() = default;
+
+            int getValue () const{return m_Value;}
+
+            bool operator<(const TestConstructor &other) const
+            {
+              return m_Value < other.m_Value;
+            }
+        protected:
+            int m_Value = 0;
+    };
+
+    //use the custom comparator
+    auto keyCmp = [](const TestConstructor &a, const TestConstructor &b) { return a.getValue() == b.getValue(); };
+
+    //use the custom hash
+    struct Hasher
+    {
+        size_t operator()(const TestConstructor &x) const
+        {
+            return std::hash<int>()(x.getValue());
+        }
+    };
+
+    practise::flat_hash_map<TestConstructor,int,Hasher,decltype(keyCmp)> cUMap;
+    cUMap.emplace(1,11);
+    cUMap.emplace(2,22);
+    cUMap.emplace(3,33);
+    EXPECT_FALSE(cUMap.emplace(3,99).second);
+
+    EXPECT_TRUE(compareUserDefinedValuesContainers(cUMap,(std::map<TestConstructor,int>{{1,11},{2,22},{3,33}})));
+
+    cUMap.emplace_hint(cUMap.begin(),4,44);
+    cUMap.emplace_hint(cUMap.begin(),-1,-11);
+    std::map<int,TestConstructor> expectedMap9{{-1,-11},{1,11},{2,22},{3,33},{4,44}};
+    EXPECT_TRUE(compareUserDefinedValuesContainers(cUMap,expectedMap9));
+
+    //try_emplace does nothing if the key is already present.
+    cUMap.try_emplace(3,333);
+    cUMap.try_emplace(7,77);
+    cUMap.try_emplace(cUMap.end(),8,88);
+    EXPECT_EQ(cUMap.at(3),33);
+    std::map<int,TestConstructor> expectedMap10{{-1,-11},{1,11},{2,22},{3,33},{4,44},{7,77},{8,88}};
+    EXPECT_TRUE(compareUserDefinedValuesContainers(cUMap,expectedMap10));
+    EXPECT_EQ(cUMap.size(),7);
+
+    cUMap.erase(cUMap.begin());
+    EXPECT_EQ(cUMap.size(),6);
+
+    auto cIt = cUMap.begin();
+    std::advance(cIt,3);
+    cUMap.erase(cUMap.begin(),cIt);
+    EXPECT_EQ(cUMap.size(),3);
+
+    //swap
+    practise::flat_hash_map<TestConstructor,int,Hasher,decltype(keyCmp)> cMap1{{-10,11},{-20,22}};
+    cMap1.swap(cUMap);
+    EXPECT_EQ(cUMap.size(),2);
+    EXPECT_EQ(cMap1.size(),3);
+
+    //extract check if the key is present and then extract just to be safe
+    //the extracted node is removed from container
+    auto firstKey = cMap1.begin()->first;
+    if(cMap1.contains(firstKey))
+    {
+        auto node2 = cMap1.extract(firstKey);
+        node2.key() = TestConstructor(5);
+        node2.mapped() = 33;
+        EXPECT_EQ(cMap1.size(),2);
+    }
+
+    //merge moves the elements with new keys, duplicates stay in the source
+    cUMap.emplace(cMap1.begin()->first.getValue(), 0);
+    cMap1.merge(cUMap);
+    EXPECT_EQ(cMap1.size(),4);
+    EXPECT_EQ(cUMap.size(),1);
+}
+
+TEST(FlatHashMap, EraseHeavy)
+{
+    //Tombstones left by erase must not break lookups or grow the table without bound
+    practise::flat_hash_map<int,int> map;
+    for(int round = 0; round < 50; ++round)
+    {
+        for(int i = 0; i < 1000; ++i)
+            map.try_emplace(round * 1000 + i, i);
+        for(int i = 0; i < 1000; ++i)
+            ASSERT_EQ(map.erase(round * 1000 + i), 1);
+    }
+    EXPECT_TRUE(map.empty());
+    EXPECT_LE(map.bucket_count(), 4096);
+    EXPECT_FALSE(map.contains(0));
+}
+
+TEST(FlatHashMap, MoveOnlyKeys)
+{
+    //Rehash, emplace and extract move the keys, they are never copied
+    practise::flat_hash_map<std::unique_ptr<int>,int> map;
+    std::vector<int*> keys;
+    for(int i = 0; i < 1000; ++i)
+    {
+        auto key = std::make_unique<int>(i);
+        keys.push_back(key.get());
+        EXPECT_TRUE(map.emplace(std::move(key), i).second);
+    }
+    EXPECT_EQ(map.size(),1000);
+    for(const auto& [key, value] : map)
+        EXPECT_EQ(*key, value);
+
+    auto node = map.extract(std::find_if(map.begin(), map.end(), [&](const auto& element){ return element.first.get() == keys[7]; }));
+    EXPECT_EQ(node.key().get(), keys[7]);
+    EXPECT_EQ(node.mapped(), 7);
+    EXPECT_EQ(map.size(),999);
+    EXPECT_TRUE(map.insert(std::move(node)).inserted);
+    EXPECT_EQ(map.size(),1000);
+}
+
+TEST(FlatHashMap, LookUp)
+{
+    practise::flat_hash_map<int,char> map;
+    map.insert({{1,'a'},{3,'b'},{2,'c'}});
+    EXPECT_EQ(map.count(3),1);
+    EXPECT_EQ(map.count(9),0);
+
+    auto foundElement = map.find(2);
+    EXPECT_EQ(foundElement->first,2);
+    EXPECT_EQ(foundElement->second,'c');
+    EXPECT_TRUE(map.find(9) == map.end());
+
+    EXPECT_TRUE(map.contains(1));
+    EXPECT_FALSE(map.contains(7));
+
+    map.insert({4,'d'});
+    auto [it1,it2] = map.equal_range(2);
+    EXPECT_EQ(it1->first,2);
+    EXPECT_EQ(it1->second,'c');
+    EXPECT_EQ(std::distance(it1,it2),1);
+
+    auto [it3,it4] = map.equal_range(9);
+    EXPECT_TRUE(it3 == it4);
+}
+
+TEST(FlatHashMap, Observers)
+{
+    practise::flat_hash_map<int,char> uMap{{1,'a'},{2,'b'},{4,'c'},{5,'e'}};
+
+    auto key_eq = uMap.key_eq();
+    EXPECT_TRUE(key_eq(1,1));
+    EXPECT_FALSE(key_eq(2,1));
+
+    auto hash_func = uMap.hash_function();
+    EXPECT_EQ(hash_func(1),1);
+    EXPECT_EQ(hash_func(100),100);
+}
+
+TEST(FlatHashMap, NonMemberFunctions)
+{
+    practise::flat_hash_map<int,char> uMap1{{1,'a'},{2,'b'},{3,'c'},{4,'d'}};
+    practise::flat_hash_map<int,char> uMap2{{1,'a'},{2,'b'},{3,'c'},{4,'d'},{5,'f'}};
+    practise::flat_hash_map<int,char> uMap3{{1,'a'},{2,'b'},{3,'c'},{4,'d'}};
+
+    EXPECT_TRUE(uMap1==uMap3);
+    EXPECT_FALSE(uMap1==uMap2);
+
+    std::swap(uMap1, uMap2);
+    std::map<int,char> expected1{{1,'a'},{2,'b'},{3,'c'},{4,'d'},{5,'f'}};
+    std::map<int,char> expected2{{1,'a'},{2,'b'},{3,'c'},{4,'d'}};
+
+    EXPECT_TRUE(compareContainers(uMap1, expected1));
+    EXPECT_TRUE(compareContainers(uMap2, expected2));
+
+    //The map3 would have values of {1,'a'},{2,'b'},{3,'c'},{4,'d'}
+    //Now delete all keys with even numbers by using predicate
+    std::map<int,char> expected3{{1,'a'},{3,'c'}};
+    auto deleteEvenKeysNode = [](const std::pair<const int,char>& key){return (key.first % 2 ) == 0;};
+    EXPECT_EQ(erase_if(uMap3, deleteEvenKeysNode), 2);
+    EXPECT_TRUE(compareContainers(uMap3, expected3));
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
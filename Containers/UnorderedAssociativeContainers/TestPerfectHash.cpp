@@ -0,0 +1,137 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <map>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_set>
+#include "PerfectHash.h"
+
+//Tables built at compile time, the static_asserts run the lookups during compilation as well
+constexpr auto countryCodes = practise::make_perfect_hash_map(
+    std::to_array<std::pair<int, std::string_view>>({{49,"Germany"},{91,"India"},{36,"Hungary"},{33,"France"}}));
+
+static_assert(countryCodes.size() == 4);
+static_assert(countryCodes.at(49) == "Germany");
+static_assert(countryCodes.at(33) == "France");
+static_assert(countryCodes.contains(91));
+static_assert(!countryCodes.contains(44));
+static_assert(countryCodes.find(1) == countryCodes.end());
+
+constexpr auto keywords = practise::make_perfect_hash_set(
+    std::to_array<std::string_view>({"break","case","class","const","constexpr","continue","default","do","else","enum",
+                                     "for","if","namespace","return","sizeof","static","struct","switch","template","while"}));
+
+static_assert(keywords.contains("constexpr"));
+static_assert(!keywords.contains("constexp"));
+static_assert(!keywords.contains(""));
+
+enum class Colour { red, green, blue, black };
+
+constexpr auto colourNames = practise::make_perfect_hash_map(
+    std::to_array<std::pair<Colour, std::string_view>>({{Colour::red,"red"},{Colour::green,"green"},{Colour::blue,"blue"}}));
+
+static_assert(colourNames.at(Colour::blue) == "blue");
+static_assert(!colourNames.contains(Colour::black));
+
+//Keys spread over the whole int range, with 1000 of them the displacement search runs for many buckets
+constexpr std::array<std::pair<int, int>, 1000> makeSquares()
+{
+    std::array<std::pair<int, int>, 1000> values{};
+    for(int i = 0; i < 1000; ++i)
+        values[i] = {i * 1999993 - 1000000000, i};
+    return values;
+}
+
+constexpr auto squares = practise::make_perfect_hash_map(makeSquares());
+
+TEST(PerfectHashMap, MemberFunctions)
+{
+    EXPECT_EQ(countryCodes.size(),4);
+    EXPECT_FALSE(countryCodes.empty());
+    EXPECT_EQ(countryCodes.max_size(),4);
+    EXPECT_GE(countryCodes.slot_count,countryCodes.size());
+
+    //Iteration keeps the order of the array the table was built from
+    auto initialValues = std::to_array<std::pair<int, std::string_view>>({{49,"Germany"},{91,"India"},{36,"Hungary"},{33,"France"}});
+    EXPECT_TRUE(std::equal(countryCodes.begin(), countryCodes.end(), initialValues.begin(), initialValues.end()));
+    EXPECT_EQ(std::distance(countryCodes.cbegin(), countryCodes.cend()),4);
+}
+
+TEST(PerfectHashMap, LookUp)
+{
+    EXPECT_EQ(countryCodes.at(91),"India");
+    EXPECT_EQ(countryCodes.find(36)->second,"Hungary");
+    EXPECT_EQ(countryCodes.count(33),1);
+    EXPECT_EQ(countryCodes.count(34),0);
+    EXPECT_THROW(countryCodes.at(0), std::out_of_range);
+
+    auto [first, last] = countryCodes.equal_range(49);
+    EXPECT_EQ(std::distance(first, last),1);
+    EXPECT_EQ(first->second,"Germany");
+    auto [missFirst, missLast] = countryCodes.equal_range(50);
+    EXPECT_EQ(missFirst,missLast);
+
+    EXPECT_EQ(colourNames.at(Colour::red),"red");
+    EXPECT_EQ(colourNames.find(Colour::black),colourNames.end());
+}
+
+TEST(PerfectHashMap, ManyKeys)
+{
+    const auto values = makeSquares();
+    for(auto &[key, value] : values)
+    {
+        auto it = squares.find(key);
+        ASSERT_NE(it,squares.end());
+        EXPECT_EQ(it->first,key);
+        EXPECT_EQ(it->second,value);
+    }
+
+    std::map<int, int> reference(values.begin(), values.end());
+    int misses = 0;
+    for(int key = -1000000000; key < 1000000000; key += 999983)
+    {
+        if(!reference.contains(key))
+        {
+            EXPECT_FALSE(squares.contains(key)) << key;
+            ++misses;
+        }
+    }
+    EXPECT_GT(misses,0);
+}
+
+TEST(PerfectHashMap, RuntimeConstruction)
+{
+    //The constructor is constexpr, not consteval: it also builds at run time, and reports with exceptions what
+    //is a compile error in make_perfect_hash_map
+    practise::perfect_hash_map<int, int, 3> map(std::to_array<std::pair<int, int>>({{1,10},{2,20},{3,30}}));
+    EXPECT_EQ(map.at(2),20);
+    EXPECT_FALSE(map.contains(4));
+
+    auto duplicates = std::to_array<std::pair<int, int>>({{1,10},{2,20},{1,30}});
+    EXPECT_THROW((practise::perfect_hash_map<int, int, 3>(duplicates)), std::invalid_argument);
+    EXPECT_THROW((practise::perfect_hash_set<std::string_view, 2>(std::to_array<std::string_view>({"a","a"}))), std::invalid_argument);
+}
+
+TEST(PerfectHashSet, LookUp)
+{
+    EXPECT_EQ(keywords.size(),20);
+    for(auto keyword : keywords)
+        EXPECT_TRUE(keywords.contains(keyword)) << keyword;
+
+    //Prefixes, extensions and case changes of the keywords are all misses
+    const std::unordered_set<std::string_view> reference(keywords.begin(), keywords.end());
+    for(std::string_view word : {"brea","breaks","Break","names","namespace_","templat","whilst","i","fo","x"})
+    {
+        EXPECT_EQ(keywords.contains(word), reference.contains(word)) << word;
+        EXPECT_EQ(keywords.find(word), keywords.end()) << word;
+    }
+    EXPECT_EQ(*keywords.find("switch"),"switch");
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1,6 +1,11 @@
 #include <iostream>
 #include <gtest/gtest.h>
 #include <unordered_map>
+#include <map>
+#include <memory_resource>
+#include <random>
+#include <set>
+#include "Containers/MemoryResourceTest.h"
 
 bool compareContainers(auto &container1, auto &&container2)
 {
@@ -340,6 +345,129 @@ TEST(UnorderedMap, NonMemberFunctions)
     EXPECT_TRUE(compareContainers(uMap3, expected3));
 }
 
+//Same scenarios over std::pmr::unordered_map, once per memory resource. The bucket array is allocated
+//from the resource as well, so rehashing is covered by the inserts
+template<typename Resource>
+class PmrUnorderedMap : public MemoryResourceTest<Resource> {};
+TYPED_TEST_SUITE(PmrUnorderedMap, MemoryResources, MemoryResourceNames);
+
+TYPED_TEST(PmrUnorderedMap, MemberFunctions)
+{
+    std::pmr::unordered_map<int, std::pmr::string> uMap;
+    EXPECT_TRUE(uMap.empty());
+    EXPECT_EQ(uMap.get_allocator().resource(), this->resource());
+
+    std::array<std::pair<int,std::string_view>, 4> initialValues{{{49,"Germany"},{91,"India"},{36,"Hungary"},{33,"France"}}};
+    std::pmr::unordered_map<int, std::pmr::string> uMap2(initialValues.begin(), initialValues.end());
+    EXPECT_EQ(uMap2.size(),4);
+    EXPECT_EQ(uMap2.at(91),"India");
+    EXPECT_EQ(uMap2.at(91).get_allocator().resource(), this->resource());
+
+    std::pmr::unordered_map<int, std::pmr::string> uMap3(uMap2);
+    EXPECT_EQ(uMap3, uMap2);
+    EXPECT_EQ(uMap3.get_allocator().resource(), this->resource());
+
+    uMap = std::move(uMap3);
+    EXPECT_EQ(uMap, uMap2);
+
+    std::pmr::unordered_map<int, std::pmr::string> uMap4(16);
+    EXPECT_GE(uMap4.bucket_count(),16);
+}
+
+TYPED_TEST(PmrUnorderedMap, ElementAccess)
+{
+    std::pmr::unordered_map<int, char> uMap{{1,'a'},{4,'b'},{2,'c'},{3,'d'}};
+    EXPECT_EQ(uMap.at(4),'b');
+    EXPECT_EQ(uMap[1],'a');
+    uMap[1] = 'e';
+    uMap[7] = 'g';
+    EXPECT_EQ(uMap[1],'e');
+    EXPECT_EQ(uMap.at(7),'g');
+    EXPECT_THROW(uMap.at(8), std::out_of_range);
+}
+
+TYPED_TEST(PmrUnorderedMap, Modifiers)
+{
+    std::pmr::unordered_map<int,char> uMap1{{1,'a'},{4,'b'}};
+    uMap1.insert({2,'c'});
+    uMap1.insert({{3,'f'},{5,'o'}});
+    uMap1.insert_or_assign(5,'p');
+    uMap1.try_emplace(5,'x');
+    uMap1.emplace(7,'e');
+    uMap1.emplace_hint(uMap1.begin(),0,'w');
+    EXPECT_EQ(uMap1, (std::pmr::unordered_map<int,char>{{0,'w'},{1,'a'},{2,'c'},{3,'f'},{4,'b'},{5,'p'},{7,'e'}}));
+
+    std::pmr::unordered_map<int,char> uMap2;
+    auto node = uMap1.extract(4);
+    const auto* address = &node.mapped();
+    uMap2.insert(std::move(node));
+    EXPECT_EQ(&uMap2.at(4), address);
+
+    uMap1.erase(uMap1.find(0));
+    EXPECT_EQ(uMap1.erase(7),1);
+    EXPECT_EQ(uMap1, (std::pmr::unordered_map<int,char>{{1,'a'},{2,'c'},{3,'f'},{5,'p'}}));
+
+    uMap2.insert({1,'z'});
+    uMap1.merge(uMap2);
+    EXPECT_EQ(uMap1.size(),5);
+    EXPECT_EQ(uMap2, (std::pmr::unordered_map<int,char>{{1,'z'}}));
+
+    uMap1.swap(uMap2);
+    EXPECT_EQ(uMap2.size(),5);
+
+    uMap2.rehash(1000);
+    EXPECT_GE(uMap2.bucket_count(),1000);
+    EXPECT_EQ(uMap2.at(4),'b');
+    uMap2.clear();
+    EXPECT_TRUE(uMap2.empty());
+}
+
+TYPED_TEST(PmrUnorderedMap, LookUp)
+{
+    std::pmr::unordered_map<int,char> uMap{{1,'a'},{3,'b'},{2,'c'}};
+    EXPECT_EQ(uMap.count(3),1);
+    EXPECT_EQ(uMap.find(2)->second,'c');
+    EXPECT_TRUE(uMap.contains(1));
+    EXPECT_FALSE(uMap.contains(7));
+
+    auto [it1,it2] = uMap.equal_range(2);
+    EXPECT_EQ(std::distance(it1,it2),1);
+    EXPECT_EQ(it1->second,'c');
+}
+
+TYPED_TEST(PmrUnorderedMap, NonMemberFunctions)
+{
+    std::pmr::unordered_map<int,char> uMap1{{1,'a'},{2,'b'},{3,'c'},{4,'d'}};
+    std::pmr::unordered_map<int,char> uMap2{{1,'a'},{2,'b'},{3,'c'},{4,'d'},{5,'f'}};
+    EXPECT_FALSE(uMap1==uMap2);
+
+    std::swap(uMap1, uMap2);
+    EXPECT_EQ(uMap1.size(),5);
+
+    std::erase_if(uMap1, [](const auto& key){return (key.first % 2 ) == 0;});
+    EXPECT_EQ(uMap1, (std::pmr::unordered_map<int,char>{{1,'a'},{3,'c'},{5,'f'}}));
+}
+
+//Random inserts and erases checked against an unordered_map with the default allocator
+TYPED_TEST(PmrUnorderedMap, InsertEraseChurn)
+{
+    std::mt19937 gen{42};
+    std::pmr::unordered_map<int,int> uMap;
+    std::unordered_map<int,int> expected;
+    for(int round = 0; round < 20000; ++round)
+    {
+        const int key = static_cast<int>(gen() % 2000);
+        if(gen() % 3 != 0)
+        {
+            uMap.insert_or_assign(key, round);
+            expected.insert_or_assign(key, round);
+        }
+        else
+            EXPECT_EQ(uMap.erase(key), expected.erase(key));
+    }
+    EXPECT_EQ((std::map<int,int>(uMap.begin(), uMap.end())), (std::map<int,int>(expected.begin(), expected.end())));
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
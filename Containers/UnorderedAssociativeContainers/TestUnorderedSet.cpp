@@ -1,6 +1,11 @@
 #include <iostream>
 #include <gtest/gtest.h>
 #include <unordered_set>
+#include <map>
+#include <memory_resource>
+#include <random>
+#include <set>
+#include "Containers/MemoryResourceTest.h"
 
 bool compareContainers(auto &container1, auto &&container2)
 {
@@ -315,6 +320,107 @@ TEST(UnorderedSet, NonMemberFunctions)
     EXPECT_TRUE(compareContainers(uSet3,std::set<int>({1,3})));
 }
 
+//Same scenarios over std::pmr::unordered_set, once per memory resource
+template<typename Resource>
+class PmrUnorderedSet : public MemoryResourceTest<Resource> {};
+TYPED_TEST_SUITE(PmrUnorderedSet, MemoryResources, MemoryResourceNames);
+
+TYPED_TEST(PmrUnorderedSet, MemberFunctions)
+{
+    std::pmr::unordered_set<int> uSet;
+    EXPECT_TRUE(uSet.empty());
+    EXPECT_EQ(uSet.get_allocator().resource(), this->resource());
+
+    std::array<int,5> values{5,1,4,1,3};
+    std::pmr::unordered_set<int> uSet1(values.begin(), values.end());
+    EXPECT_EQ(uSet1, (std::pmr::unordered_set<int>{1,3,4,5}));
+
+    std::pmr::unordered_set<int> uSet2(uSet1);
+    EXPECT_EQ(uSet2, uSet1);
+    EXPECT_EQ(uSet2.get_allocator().resource(), this->resource());
+
+    uSet = std::move(uSet2);
+    EXPECT_EQ(uSet, uSet1);
+
+    std::pmr::unordered_set<std::pmr::string> strings{"Hello","World"};
+    EXPECT_EQ(strings.begin()->get_allocator().resource(), this->resource());
+    EXPECT_TRUE(strings.contains("World"));
+}
+
+TYPED_TEST(PmrUnorderedSet, Modifiers)
+{
+    std::pmr::unordered_set<int> uSet{1,4};
+    uSet.insert(2);
+    uSet.insert({3,5,5});
+    uSet.emplace(8);
+    uSet.emplace_hint(uSet.begin(),0);
+    EXPECT_EQ(uSet, (std::pmr::unordered_set<int>{0,1,2,3,4,5,8}));
+    EXPECT_FALSE(uSet.insert(4).second);
+
+    std::pmr::unordered_set<int> uSet2;
+    auto node = uSet.extract(4);
+    node.value() = 40;
+    uSet2.insert(std::move(node));
+    EXPECT_EQ(uSet2, (std::pmr::unordered_set<int>{40}));
+
+    EXPECT_EQ(uSet.erase(8),1);
+    uSet.erase(uSet.find(0));
+    EXPECT_EQ(uSet, (std::pmr::unordered_set<int>{1,2,3,5}));
+
+    uSet2.insert(5);
+    uSet.merge(uSet2);
+    EXPECT_EQ(uSet, (std::pmr::unordered_set<int>{1,2,3,5,40}));
+    EXPECT_EQ(uSet2, (std::pmr::unordered_set<int>{5}));
+
+    uSet.swap(uSet2);
+    EXPECT_EQ(uSet2.size(),5);
+    uSet2.reserve(1000);
+    EXPECT_TRUE(uSet2.contains(40));
+    uSet2.clear();
+    EXPECT_TRUE(uSet2.empty());
+}
+
+TYPED_TEST(PmrUnorderedSet, LookUp)
+{
+    std::pmr::unordered_set<int> uSet{1,3,2};
+    EXPECT_EQ(uSet.count(3),1);
+    EXPECT_EQ(*uSet.find(2),2);
+    EXPECT_TRUE(uSet.contains(1));
+    EXPECT_FALSE(uSet.contains(7));
+    auto [it1,it2] = uSet.equal_range(2);
+    EXPECT_EQ(std::distance(it1,it2),1);
+}
+
+TYPED_TEST(PmrUnorderedSet, NonMemberFunctions)
+{
+    std::pmr::unordered_set<int> uSet1{1,2,3,4};
+    std::pmr::unordered_set<int> uSet2{1,2,3,4,5};
+    EXPECT_FALSE(uSet1 == uSet2);
+
+    std::swap(uSet1, uSet2);
+    EXPECT_EQ(uSet1.size(),5);
+
+    std::erase_if(uSet1, [](int key){return (key % 2 ) == 0;});
+    EXPECT_EQ(uSet1, (std::pmr::unordered_set<int>{1,3,5}));
+}
+
+//Random inserts and erases checked against an unordered_set with the default allocator
+TYPED_TEST(PmrUnorderedSet, InsertEraseChurn)
+{
+    std::mt19937 gen{42};
+    std::pmr::unordered_set<int> uSet;
+    std::unordered_set<int> expected;
+    for(int round = 0; round < 20000; ++round)
+    {
+        const int key = static_cast<int>(gen() % 2000);
+        if(gen() % 3 != 0)
+            EXPECT_EQ(uSet.insert(key).second, expected.insert(key).second);
+        else
+            EXPECT_EQ(uSet.erase(key), expected.erase(key));
+    }
+    EXPECT_EQ(std::set<int>(uSet.begin(), uSet.end()), std::set<int>(expected.begin(), expected.end()));
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
@@ -2,10 +2,16 @@ include(CMakeParseArguments)
 
 #Function could have been just simple with 2 parameters
 #But we use the cmake_parse_arguments, keeping in mind to use it to parse much more options for future
+#BENCH_FILE_NAME : optional google benchmark source, builds the companion bench* binary (testVector -> benchVector)
+#LIBRARIES       : optional extra libraries linked to both the test and the bench binary
+#NO_ALLOCATION_TRACKING : keep the default operator new/delete in the test binary, otherwise the
+#                         allocationTracking library counts the allocations of every test
+#BENCH_ALLOCATION_TRACKING : link allocationTracking into the bench binary as well, for benchmarks reporting
+#                            utils::allocationCounters()
 function(add_test_project)
-    set(options)
-    set(oneValueArgs TARGET INPUT_FILE_NAME)
-    set(multiArgsValue)
+    set(options NO_ALLOCATION_TRACKING BENCH_ALLOCATION_TRACKING)
+    set(oneValueArgs TARGET INPUT_FILE_NAME BENCH_FILE_NAME)
+    set(multiArgsValue LIBRARIES)
     cmake_parse_arguments(ARGS "${options}" "${oneValueArgs}" "${multiArgsValue}" ${ARGN})
     if("${ARGS_TARGET}" STREQUAL "" OR "${ARGS_INPUT_FILE_NAME}" STREQUAL "")
         message(FATAL_ERROR "Invalid arguments please provide target name and the source")
@@ -13,6 +19,26 @@ function(add_test_project)
 
     add_executable(${ARGS_TARGET} ${ARGS_INPUT_FILE_NAME})
 
-    target_link_libraries(${ARGS_TARGET} GTest::gtest)
+    target_include_directories(${ARGS_TARGET} PRIVATE ${PROJECT_SOURCE_DIR})
+    target_link_libraries(${ARGS_TARGET} GTest::gtest ${ARGS_LIBRARIES})
+    if(NOT ARGS_NO_ALLOCATION_TRACKING)
+        target_link_libraries(${ARGS_TARGET} allocationTracking)
+    endif()
+
+    if(BUILD_BENCHMARKS AND NOT "${ARGS_BENCH_FILE_NAME}" STREQUAL "")
+        string(REGEX REPLACE "^test" "bench" benchTarget ${ARGS_TARGET})
+        if("${benchTarget}" STREQUAL "${ARGS_TARGET}")
+            set(benchTarget "bench_${ARGS_TARGET}")
+        endif()
+
+        add_executable(${benchTarget} ${ARGS_BENCH_FILE_NAME})
+
+        target_include_directories(${benchTarget} PRIVATE ${PROJECT_SOURCE_DIR})
+        target_compile_definitions(${benchTarget} PRIVATE BENCH_MAX_ELEMENTS=${BENCH_MAX_ELEMENTS})
+        target_link_libraries(${benchTarget} benchmark::benchmark ${ARGS_LIBRARIES})
+        if(ARGS_BENCH_ALLOCATION_TRACKING)
+            target_link_libraries(${benchTarget} allocationTracking)
+        endif()
+    endif()
 
-endfunction(add_test_project)
\ No newline at end of file
+endfunction(add_test_project)
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+#include <concepts>
+#include <cstdint>
+#include <random>
+#include <string>
+#include "Rope.h"
+#include "Utils/BenchmarkUtils.h"
+
+//std::string against practise::rope on documents of 1 MiB, 100 MiB and 1 GiB
+static void documentSizes(benchmark::internal::Benchmark* b)
+{
+    b->Arg(std::int64_t{1} << 20)->Arg(std::int64_t{100} << 20)->Arg(std::int64_t{1} << 30);
+}
+
+//Lower case words separated by spaces, generated in place so the 1 GiB document is the only copy
+static std::string makeDocument(std::int64_t count)
+{
+    std::mt19937_64 gen{42};
+    std::string text(static_cast<std::size_t>(count), ' ');
+    for(auto& ch : text)
+        if(const auto letter = gen() % 27; letter != 26)
+            ch = static_cast<char>('a' + letter);
+    return text;
+}
+
+//Inserts, erases and replaces of up to 32 chars at random positions, the size of the document stays about
+//the same. Every edit moves the tail of a std::string, the rope only rebuilds the path to the edit.
+template<typename Text>
+static void BM_TextRandomEdits(benchmark::State& state)
+{
+    constexpr int editsPerIteration = 16;
+    Text text(makeDocument(state.range(0)));
+    const std::string chars(32, 'e');
+    std::mt19937_64 gen{7};
+    for(auto _ : state)
+    {
+        for(int edit = 0; edit < editsPerIteration; ++edit)
+        {
+            const auto pos = gen() % text.size();
+            const auto count = 1 + gen() % 32;
+            switch(edit % 3)
+            {
+                case 0: text.insert(pos, std::string_view(chars).substr(0, count)); break;
+                case 1: text.erase(pos, count); break;
+                default: text.replace(pos, count, std::string_view(chars).substr(0, count / 2)); break;
+            }
+        }
+        benchmark::DoNotOptimize(text.size());
+    }
+    bench::reportPerOp(state, editsPerIteration, 32);
+}
+BENCHMARK_TEMPLATE(BM_TextRandomEdits, std::string)->Apply(documentSizes);
+BENCHMARK_TEMPLATE(BM_TextRandomEdits, practise::rope)->Apply(documentSizes);
+
+//Search for a word missing from the document after 10000 random edits cut the rope into pieces, the
+//std::string gets the edited text in one go
+template<typename Text>
+static void BM_TextFindAfterEdits(benchmark::State& state)
+{
+    const auto size = state.range(0);
+    practise::rope edited(makeDocument(size));
+    std::mt19937_64 gen{7};
+    for(int edit = 0; edit < 10000; ++edit)
+        edited.insert(gen() % edited.size(), "edit");
+    Text text;
+    if constexpr(std::same_as<Text, practise::rope>)
+        text = std::move(edited);
+    else
+        text = edited.str();
+    for(auto _ : state)
+        benchmark::DoNotOptimize(text.find("missing_word"));
+    bench::reportPerOp(state, size, sizeof(char));
+}
+BENCHMARK_TEMPLATE(BM_TextFindAfterEdits, std::string)->Apply(documentSizes);
+BENCHMARK_TEMPLATE(BM_TextFindAfterEdits, practise::rope)->Apply(documentSizes);
+
+BENCHMARK_MAIN();
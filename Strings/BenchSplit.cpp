@@ -0,0 +1,162 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <execution>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Split.h"
+#include "Utils/BenchmarkUtils.h"
+
+//Delimiter sets: one char (CSV like), and six chars, past the sizes StringSearch.h compares one by one
+struct Comma
+{
+    static constexpr std::string_view chars = ",";
+};
+
+struct Punctuation
+{
+    static constexpr std::string_view chars = " \t\n,;:";
+};
+
+//Words of 1 to 12 lower case letters, each followed by one delimiter of the set
+template<typename Set>
+static std::string makeRecords(std::int64_t count)
+{
+    std::mt19937_64 gen{42};
+    std::string text;
+    text.reserve(static_cast<std::size_t>(count) + 16);
+    while(text.size() < static_cast<std::size_t>(count))
+    {
+        text.append(1 + gen() % 12, static_cast<char>('a' + gen() % 26));
+        text.push_back(Set::chars[gen() % Set::chars.size()]);
+    }
+    text.resize(static_cast<std::size_t>(count));
+    return text;
+}
+
+//The pattern split replaces: find_first_of for the next delimiter, the piece copied out as a std::string
+template<typename Set>
+static void BM_SplitFindFirstOfCopy(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto text = makeRecords<Set>(count);
+    for(auto _ : state)
+    {
+        std::vector<std::string> pieces;
+        for(std::size_t start = 0;;)
+        {
+            const auto end = text.find_first_of(Set::chars, start);
+            pieces.push_back(text.substr(start, end - start));
+            if(end == std::string::npos)
+                break;
+            start = end + 1;
+        }
+        benchmark::DoNotOptimize(pieces.data());
+    }
+    bench::reportPerOp(state, count, sizeof(char));
+}
+
+//Same loop keeping std::string_view pieces, only the search is left
+template<typename Set>
+static void BM_SplitFindFirstOf(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto text = makeRecords<Set>(count);
+    const std::string_view view = text;
+    for(auto _ : state)
+    {
+        std::size_t total = 0;
+        for(std::size_t start = 0;;)
+        {
+            const auto end = view.find_first_of(Set::chars, start);
+            total += view.substr(start, end - start).size();
+            if(end == std::string_view::npos)
+                break;
+            start = end + 1;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    bench::reportPerOp(state, count, sizeof(char));
+}
+
+template<typename Set>
+static void BM_SplitView(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto text = makeRecords<Set>(count);
+    const practise::delimiter_set delimiters(Set::chars);
+    for(auto _ : state)
+    {
+        std::size_t total = 0;
+        for(auto piece : practise::split(text, delimiters))
+            total += piece.size();
+        benchmark::DoNotOptimize(total);
+    }
+    bench::reportPerOp(state, count, sizeof(char));
+}
+
+//Pieces collected into a std::vector<std::string_view> on every hardware thread
+template<typename Set>
+static void BM_SplitParallel(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto text = makeRecords<Set>(count);
+    const practise::delimiter_set delimiters(Set::chars);
+    for(auto _ : state)
+    {
+        auto pieces = practise::split(std::execution::par, text, delimiters);
+        benchmark::DoNotOptimize(pieces.data());
+    }
+    bench::reportPerOp(state, count, sizeof(char));
+}
+
+//Token loop with find_first_not_of/find_first_of against tokenize
+template<typename Set>
+static void BM_TokenizeFindFirstOf(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto text = makeRecords<Set>(count);
+    const std::string_view view = text;
+    for(auto _ : state)
+    {
+        std::size_t total = 0;
+        for(auto start = view.find_first_not_of(Set::chars); start != std::string_view::npos; start = view.find_first_not_of(Set::chars, start))
+        {
+            const auto end = std::min(view.find_first_of(Set::chars, start), view.size());
+            total += end - start;
+            start = end;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    bench::reportPerOp(state, count, sizeof(char));
+}
+
+template<typename Set>
+static void BM_TokenizeView(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto text = makeRecords<Set>(count);
+    const practise::delimiter_set delimiters(Set::chars);
+    for(auto _ : state)
+    {
+        std::size_t total = 0;
+        for(auto token : practise::tokenize(text, delimiters))
+            total += token.size();
+        benchmark::DoNotOptimize(total);
+    }
+    bench::reportPerOp(state, count, sizeof(char));
+}
+
+#define BENCHMARK_SPLIT(set) \
+    BENCHMARK_TEMPLATE(BM_SplitFindFirstOfCopy, set)->Apply(bench::elementSweep); \
+    BENCHMARK_TEMPLATE(BM_SplitFindFirstOf, set)->Apply(bench::elementSweep); \
+    BENCHMARK_TEMPLATE(BM_SplitView, set)->Apply(bench::elementSweep); \
+    BENCHMARK_TEMPLATE(BM_SplitParallel, set)->Apply(bench::elementSweep); \
+    BENCHMARK_TEMPLATE(BM_TokenizeFindFirstOf, set)->Apply(bench::elementSweep); \
+    BENCHMARK_TEMPLATE(BM_TokenizeView, set)->Apply(bench::elementSweep)
+
+BENCHMARK_SPLIT(Comma);
+BENCHMARK_SPLIT(Punctuation);
+
+BENCHMARK_MAIN();
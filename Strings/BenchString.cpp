@@ -0,0 +1,205 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "CompactString.h"
+#include "Utils/BenchmarkUtils.h"
+#include "Utils/MemoryResourceBenchmarkUtils.h"
+
+//Log like text: lower case words separated by spaces, with the needle appended at the very end
+static std::string makeText(std::int64_t count, const std::string &tail = {})
+{
+    auto letters = bench::randomInts(count, 26);
+    std::string text(static_cast<std::size_t>(count), ' ');
+    for(std::size_t i = 0; i < text.size(); ++i)
+        if(letters[i] != 26)
+            text[i] = static_cast<char>('a' + letters[i]);
+    return text + tail;
+}
+
+static void BM_StringAppend(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    for(auto _ : state)
+    {
+        std::string str;
+        for(std::int64_t i = 0; i < count; ++i)
+            str.append(1, 'a');
+        benchmark::DoNotOptimize(str.data());
+    }
+    bench::reportPerOp(state, count, sizeof(char));
+}
+BENCHMARK(BM_StringAppend)->Apply(bench::elementSweep);
+
+//Operations test shape: insert/replace in the middle of the string
+static void BM_StringInsertMiddle(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto text = makeText(count);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        auto str = text;
+        state.ResumeTiming();
+        str.insert(str.size() / 2, "inserted");
+        str.replace(str.size() / 3, 8, "replaced");
+        benchmark::DoNotOptimize(str.data());
+    }
+    bench::reportPerOp(state, count, sizeof(char));
+}
+BENCHMARK(BM_StringInsertMiddle)->Apply(bench::elementSweep);
+
+static void BM_StringFind(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto text = makeText(count, "substring");
+    for(auto _ : state)
+        benchmark::DoNotOptimize(text.find("substring"));
+    bench::reportPerOp(state, count, sizeof(char));
+}
+BENCHMARK(BM_StringFind)->Apply(bench::elementSweep);
+
+static void BM_StringRFind(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto text = "substring" + makeText(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(text.rfind("substring"));
+    bench::reportPerOp(state, count, sizeof(char));
+}
+BENCHMARK(BM_StringRFind)->Apply(bench::elementSweep);
+
+static void BM_StringFindFirstOf(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto text = makeText(count, "#");
+    for(auto _ : state)
+        benchmark::DoNotOptimize(text.find_first_of("#@!"));
+    bench::reportPerOp(state, count, sizeof(char));
+}
+BENCHMARK(BM_StringFindFirstOf)->Apply(bench::elementSweep);
+
+static void BM_StringEraseIf(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    auto text = makeText(count);
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        auto str = text;
+        state.ResumeTiming();
+        std::erase_if(str, [](char c){return c == ' ';});
+        benchmark::DoNotOptimize(str.data());
+    }
+    bench::reportPerOp(state, count, sizeof(char));
+}
+BENCHMARK(BM_StringEraseIf)->Apply(bench::elementSweep);
+
+//Memory footprint of many resident strings: std::string, practise::compact_string and interned
+//compact_strings, over key distributions seen in services. Keys are generated while the strings are built, the
+//RSS growth over the trimmed heap is reported as rss and rss/string
+struct StdStrings
+{
+    using type = std::string;
+    static type make(std::string_view key) { return type(key); }
+};
+
+struct CompactStrings
+{
+    using type = practise::compact_string;
+    static type make(std::string_view key) { return type(key); }
+};
+
+struct InternedStrings
+{
+    using type = practise::compact_string;
+    static type make(std::string_view key) { return type::interned(key); }
+};
+
+//Short ids, 8 to 20 chars ("user:1234567"), nearly all distinct
+struct IdKeys
+{
+    static std::string_view make(std::mt19937_64& gen, char* buffer)
+    {
+        static constexpr const char* prefixes[] = {"user:", "order:", "session:", "sku:"};
+        const auto length = std::snprintf(buffer, 64, "%s%llu", prefixes[gen() % 4],
+                                          static_cast<unsigned long long>(gen() % 100'000'000'000ull));
+        return {buffer, static_cast<std::size_t>(length)};
+    }
+};
+
+//36 char UUIDs, all distinct
+struct UuidKeys
+{
+    static std::string_view make(std::mt19937_64& gen, char* buffer)
+    {
+        const auto high = gen(), low = gen();
+        std::snprintf(buffer, 64, "%08llx-%04llx-%04llx-%04llx-%012llx", static_cast<unsigned long long>(high >> 32),
+                      static_cast<unsigned long long>((high >> 16) & 0xFFFF), static_cast<unsigned long long>(high & 0xFFFF),
+                      static_cast<unsigned long long>(low >> 48), static_cast<unsigned long long>(low & 0xFFFFFFFFFFFFull));
+        return {buffer, 36};
+    }
+};
+
+//URL paths of 30 to 60 chars out of 10000 distinct ones, the popular ones repeating far more often
+struct PathKeys
+{
+    static std::string_view make(std::mt19937_64& gen, char* buffer)
+    {
+        const auto spread = gen() % 10'000;
+        const auto path = spread * spread / 10'000;
+        const auto length = std::snprintf(buffer, 64, "/api/v2/tenants/%llu/resources/%llu",
+                                          static_cast<unsigned long long>(path % 97), static_cast<unsigned long long>(path));
+        return {buffer, static_cast<std::size_t>(length)};
+    }
+};
+
+template<typename Strings, typename Keys>
+static void BM_StringFootprint(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    std::int64_t peak = 0;
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        bench::trimHeap();
+        const auto before = bench::residentBytes();
+        state.ResumeTiming();
+        {
+            std::mt19937_64 gen{42};
+            char buffer[64];
+            std::vector<typename Strings::type> strings;
+            strings.reserve(static_cast<std::size_t>(count));
+            for(std::int64_t i = 0; i < count; ++i)
+                strings.push_back(Strings::make(Keys::make(gen, buffer)));
+            state.PauseTiming();
+            peak = std::max(peak, bench::residentBytes() - before);
+            benchmark::DoNotOptimize(strings.data());
+            state.ResumeTiming();
+        }
+    }
+    bench::reportPerOp(state, count, sizeof(typename Strings::type));
+    state.counters["rss"] = benchmark::Counter(static_cast<double>(peak), benchmark::Counter::kDefaults,
+                                               benchmark::Counter::OneK::kIs1024);
+    state.counters["rss/string"] = benchmark::Counter(static_cast<double>(peak) / static_cast<double>(count));
+}
+
+//1e5 up to 1e7 resident strings
+static void footprintSweep(benchmark::internal::Benchmark* b)
+{
+    for(std::int64_t n = 100'000; n <= std::min<std::int64_t>(bench::maxElements, 10'000'000); n *= 10)
+        b->Arg(n);
+}
+
+#define BENCHMARK_STRING_FOOTPRINT(keys) \
+    BENCHMARK_TEMPLATE(BM_StringFootprint, StdStrings, keys)->Apply(footprintSweep)->Iterations(3); \
+    BENCHMARK_TEMPLATE(BM_StringFootprint, CompactStrings, keys)->Apply(footprintSweep)->Iterations(3); \
+    BENCHMARK_TEMPLATE(BM_StringFootprint, InternedStrings, keys)->Apply(footprintSweep)->Iterations(3)
+
+BENCHMARK_STRING_FOOTPRINT(IdKeys);
+BENCHMARK_STRING_FOOTPRINT(UuidKeys);
+BENCHMARK_STRING_FOOTPRINT(PathKeys);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,208 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <random>
+#include <string>
+#include "StringSearch.h"
+#include "Utils/BenchmarkUtils.h"
+#include "Utils/MappedFile.h"
+
+//Log scanning shape: the needle does not occur, so every call scans the whole buffer. Sizes are the usual
+//sweep plus a 1 GiB buffer, needle lengths cover the byte filter and the Horspool range.
+static constexpr std::int64_t gigabyte = std::int64_t{1} << 30;
+
+static void sizeSweep(benchmark::internal::Benchmark* b)
+{
+    bench::elementSweep(b);
+    b->Arg(gigabyte);
+}
+
+//Lower case words separated by spaces, the text of each size is generated once and shared by all benchmarks
+static const std::string& logText(std::int64_t count)
+{
+    static std::map<std::int64_t, std::string> texts;
+    auto& text = texts[count];
+    if(text.empty())
+    {
+        std::mt19937_64 gen{42};
+        text.resize(static_cast<std::size_t>(count));
+        for(std::size_t i = 0; i < text.size(); i += 8)
+        {
+            auto bits = gen();
+            for(std::size_t k = i; k < std::min(i + 8, text.size()); ++k, bits >>= 8)
+            {
+                const auto letter = (bits & 0xff) % 27;
+                text[k] = letter == 26 ? ' ' : static_cast<char>('a' + letter);
+            }
+        }
+    }
+    return text;
+}
+
+//Lower case needle which is practically never part of the random text
+static std::string missingNeedle(std::int64_t length)
+{
+    std::string needle(static_cast<std::size_t>(length), 'q');
+    for(std::size_t i = 0; i < needle.size(); i += 2)
+        needle[i] = 'x';
+    return needle;
+}
+
+struct StdStringView
+{
+    static std::size_t find(std::string_view hay, std::string_view needle) { return hay.find(needle); }
+    static std::size_t rfind(std::string_view hay, std::string_view needle) { return hay.rfind(needle); }
+    static std::size_t find_first_of(std::string_view hay, std::string_view chars) { return hay.find_first_of(chars); }
+    static std::size_t find_last_not_of(std::string_view hay, std::string_view chars) { return hay.find_last_not_of(chars); }
+};
+
+struct SimdSearch
+{
+    static std::size_t find(std::string_view hay, std::string_view needle) { return practise::find(hay, needle); }
+    static std::size_t rfind(std::string_view hay, std::string_view needle) { return practise::rfind(hay, needle); }
+    static std::size_t find_first_of(std::string_view hay, std::string_view chars) { return practise::find_first_of(hay, chars); }
+    static std::size_t find_last_not_of(std::string_view hay, std::string_view chars) { return practise::find_last_not_of(hay, chars); }
+};
+
+template<typename Impl>
+static void BM_Find(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const std::string_view text = logText(count);
+    const auto needle = missingNeedle(9);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(Impl::find(text, needle));
+    bench::reportPerOp(state, count, sizeof(char));
+}
+BENCHMARK_TEMPLATE(BM_Find, StdStringView)->Apply(sizeSweep);
+BENCHMARK_TEMPLATE(BM_Find, SimdSearch)->Apply(sizeSweep);
+
+//The same text mapped from a file of 1 GiB and 4 GiB, written to utils::inputDirectory() on the first run.
+//Each iteration streams the whole file through the page cache, or from disk when it does not fit.
+static utils::MappedFile mappedLogText(std::int64_t count)
+{
+    return utils::generatedFile<char>("bench-log-text", static_cast<std::size_t>(count), [](std::span<char> chunk, std::size_t first)
+    {
+        std::mt19937_64 gen{first};
+        for(auto& ch : chunk)
+        {
+            const auto letter = gen() % 27;
+            ch = letter == 26 ? ' ' : static_cast<char>('a' + letter);
+        }
+    });
+}
+
+template<typename Impl>
+static void BM_FindMapped(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto file = mappedLogText(count);
+    const auto needle = missingNeedle(9);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(Impl::find(file.view(), needle));
+    bench::reportPerOp(state, count, sizeof(char));
+}
+BENCHMARK_TEMPLATE(BM_FindMapped, StdStringView)->Apply(bench::mappedFileSizes)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_FindMapped, SimdSearch)->Apply(bench::mappedFileSizes)->UseRealTime();
+
+template<typename Impl>
+static void BM_FindFirstOfMapped(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const auto file = mappedLogText(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(Impl::find_first_of(file.view(), "0123456789"));
+    bench::reportPerOp(state, count, sizeof(char));
+}
+BENCHMARK_TEMPLATE(BM_FindFirstOfMapped, StdStringView)->Apply(bench::mappedFileSizes)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_FindFirstOfMapped, SimdSearch)->Apply(bench::mappedFileSizes)->UseRealTime();
+
+//Args are {elements, needle length}
+template<typename Impl>
+static void BM_FindNeedleLength(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const std::string_view text = logText(count);
+    const auto needle = missingNeedle(state.range(1));
+    for(auto _ : state)
+        benchmark::DoNotOptimize(Impl::find(text, needle));
+    bench::reportPerOp(state, count, sizeof(char));
+}
+BENCHMARK_TEMPLATE(BM_FindNeedleLength, StdStringView)->ArgsProduct({{1 << 24}, {2, 4, 16, 64, 128, 512}});
+BENCHMARK_TEMPLATE(BM_FindNeedleLength, SimdSearch)->ArgsProduct({{1 << 24}, {2, 4, 16, 64, 128, 512}});
+
+template<typename Impl>
+static void BM_RFind(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const std::string_view text = logText(count);
+    const auto needle = missingNeedle(9);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(Impl::rfind(text, needle));
+    bench::reportPerOp(state, count, sizeof(char));
+}
+BENCHMARK_TEMPLATE(BM_RFind, StdStringView)->Apply(sizeSweep);
+BENCHMARK_TEMPLATE(BM_RFind, SimdSearch)->Apply(sizeSweep);
+
+template<typename Impl>
+static void BM_FindFirstOf(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const std::string_view text = logText(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(Impl::find_first_of(text, "#@!\n"));
+    bench::reportPerOp(state, count, sizeof(char));
+}
+BENCHMARK_TEMPLATE(BM_FindFirstOf, StdStringView)->Apply(sizeSweep);
+BENCHMARK_TEMPLATE(BM_FindFirstOf, SimdSearch)->Apply(sizeSweep);
+
+template<typename Impl>
+static void BM_FindLastNotOf(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const std::string_view text = logText(count);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(Impl::find_last_not_of(text, "abcdefghijklmnopqrstuvwxyz "));
+    bench::reportPerOp(state, count, sizeof(char));
+}
+BENCHMARK_TEMPLATE(BM_FindLastNotOf, StdStringView)->Apply(sizeSweep);
+BENCHMARK_TEMPLATE(BM_FindLastNotOf, SimdSearch)->Apply(sizeSweep);
+
+//std::search with the default byte compare, the standard Horspool searcher and string_searcher
+static void BM_StdSearch(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const std::string_view text = logText(count);
+    const auto needle = missingNeedle(9);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::search(text.begin(), text.end(), needle.begin(), needle.end()));
+    bench::reportPerOp(state, count, sizeof(char));
+}
+BENCHMARK(BM_StdSearch)->Apply(sizeSweep);
+
+static void BM_StdHorspoolSearcher(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const std::string_view text = logText(count);
+    const auto needle = missingNeedle(9);
+    const std::boyer_moore_horspool_searcher searcher(needle.begin(), needle.end());
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::search(text.begin(), text.end(), searcher));
+    bench::reportPerOp(state, count, sizeof(char));
+}
+BENCHMARK(BM_StdHorspoolSearcher)->Apply(sizeSweep);
+
+static void BM_StringSearcher(benchmark::State& state)
+{
+    const auto count = state.range(0);
+    const std::string_view text = logText(count);
+    const auto needle = missingNeedle(9);
+    const practise::string_searcher searcher(needle);
+    for(auto _ : state)
+        benchmark::DoNotOptimize(std::search(text.begin(), text.end(), searcher));
+    bench::reportPerOp(state, count, sizeof(char));
+}
+BENCHMARK(BM_StringSearcher)->Apply(sizeSweep);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,853 @@
+//compact_string : std::string replacement for services keeping huge numbers of short strings resident. It is
+//24 bytes (std::string is 32) and keeps up to 23 chars inline (std::string 15): the last byte of the object
+//holds 23 - size for an inline string, so it doubles as the terminating null once the string is full.
+//Longer strings live on the heap as {data, size, capacity}, the top byte of the capacity word is the tag
+//that tells them apart from inline ones.
+//A long string can also be interned into a string_pool: equal strings then share one refcounted copy in the
+//pool, copies only bump the refcount and the pool entry goes away with the last string using it. An interned
+//string is immutable, anything that may write to it (including the non const data(), begin() and
+//operator[]) first gives it its own heap copy.
+//The member functions follow std::string, the search functions go through the vectorized StringSearch.h.
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include "StringSearch.h"
+
+namespace practise
+{
+
+//Deduplicated storage of interned strings, split into shards by hash so threads interning different strings
+//rarely wait for each other. The pool has to outlive every string interned into it, global() never dies.
+class string_pool
+{
+public:
+    string_pool() = default;
+    string_pool(const string_pool&) = delete;
+    string_pool& operator=(const string_pool&) = delete;
+
+    ~string_pool()
+    {
+        for(auto& shard : mShards)
+            for(auto* entry : shard.entries)
+                destroy(entry);
+    }
+
+    //Pool used by compact_string::intern() when none is given, intentionally leaked so strings in static
+    //objects can still release their entries at exit
+    static string_pool& global()
+    {
+        static auto* pool = new string_pool;
+        return *pool;
+    }
+
+    //Distinct strings held
+    std::size_t size() const
+    {
+        std::size_t count = 0;
+        for(const auto& shard : mShards)
+        {
+            std::lock_guard lock(shard.mutex);
+            count += shard.entries.size();
+        }
+        return count;
+    }
+
+    //Heap bytes held by the entries, headers included
+    std::size_t bytes() const
+    {
+        std::size_t total = 0;
+        for(const auto& shard : mShards)
+        {
+            std::lock_guard lock(shard.mutex);
+            for(const auto* entry : shard.entries)
+                total += sizeof(Entry) + entry->size + 1;
+        }
+        return total;
+    }
+
+private:
+    friend class compact_string;
+
+    //Header in front of the chars of every interned string
+    struct Entry
+    {
+        std::atomic<std::size_t> refs;
+        string_pool* pool;
+        std::size_t hash;
+        std::size_t size;
+
+        char* chars() { return reinterpret_cast<char*>(this + 1); }
+        std::string_view view() { return {chars(), size}; }
+    };
+
+    struct Key
+    {
+        std::string_view chars;
+        std::size_t hash;
+    };
+
+    struct EntryHash
+    {
+        using is_transparent = void;
+        std::size_t operator()(const Entry* entry) const { return entry->hash; }
+        std::size_t operator()(const Key& key) const { return key.hash; }
+    };
+
+    struct EntryEqual
+    {
+        using is_transparent = void;
+        bool operator()(Entry* lhs, Entry* rhs) const { return lhs == rhs; }
+        bool operator()(const Key& key, Entry* entry) const { return key.hash == entry->hash && key.chars == entry->view(); }
+        bool operator()(Entry* entry, const Key& key) const { return (*this)(key, entry); }
+    };
+
+    static constexpr std::size_t shardCount = 16;
+
+    struct alignas(64) Shard
+    {
+        mutable std::mutex mutex;
+        std::unordered_set<Entry*, EntryHash, EntryEqual> entries;
+    };
+
+    Shard& shardFor(std::size_t hash) { return mShards[(hash >> 7) % shardCount]; }
+
+    static Entry* entryOf(const char* chars) { return reinterpret_cast<Entry*>(const_cast<char*>(chars)) - 1; }
+
+    static void destroy(Entry* entry)
+    {
+        const auto bytes = sizeof(Entry) + entry->size + 1;
+        entry->~Entry();
+        ::operator delete(entry, bytes);
+    }
+
+    //Chars of the entry holding str, with one more reference on it
+    const char* acquire(std::string_view str)
+    {
+        const Key key{str, std::hash<std::string_view>{}(str)};
+        auto& shard = shardFor(key.hash);
+        std::lock_guard lock(shard.mutex);
+        if(auto found = shard.entries.find(key); found != shard.entries.end())
+        {
+            (*found)->refs.fetch_add(1, std::memory_order_relaxed);
+            return (*found)->chars();
+        }
+        auto* entry = new(::operator new(sizeof(Entry) + str.size() + 1)) Entry{{1}, this, key.hash, str.size()};
+        std::memcpy(entry->chars(), str.data(), str.size());
+        entry->chars()[str.size()] = '\0';
+        try
+        {
+            shard.entries.insert(entry);
+        }
+        catch(...)
+        {
+            destroy(entry);
+            throw;
+        }
+        return entry->chars();
+    }
+
+    //The caller already holds a reference
+    static void addRef(const char* chars)
+    {
+        entryOf(chars)->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //Only the last reference is dropped under the shard lock, so acquire() never finds an entry whose count
+    //already reached zero
+    static void release(const char* chars)
+    {
+        auto* entry = entryOf(chars);
+        auto refs = entry->refs.load(std::memory_order_relaxed);
+        while(refs > 1)
+            if(entry->refs.compare_exchange_weak(refs, refs - 1, std::memory_order_release, std::memory_order_relaxed))
+                return;
+
+        auto& shard = entry->pool->shardFor(entry->hash);
+        std::unique_lock lock(shard.mutex);
+        if(entry->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            shard.entries.erase(entry);
+            lock.unlock();
+            destroy(entry);
+        }
+    }
+
+    std::array<Shard, shardCount> mShards;
+};
+
+class compact_string
+{
+public:
+    using traits_type = std::char_traits<char>;
+    using value_type = char;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = char&;
+    using const_reference = const char&;
+    using pointer = char*;
+    using const_pointer = const char*;
+    using iterator = char*;
+    using const_iterator = const char*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type npos = static_cast<size_type>(-1);
+    static constexpr size_type inline_capacity = 23;
+
+    //constructors
+    compact_string() noexcept : mRep{}
+    {
+        setInlineSize(0);
+    }
+
+    compact_string(size_type count, char ch) : compact_string()
+    {
+        append(count, ch);
+    }
+
+    compact_string(const char* str, size_type count) : compact_string()
+    {
+        append(str, count);
+    }
+
+    compact_string(const char* str) : compact_string(str, traits_type::length(str))
+    {
+    }
+
+    compact_string(std::nullptr_t) = delete;
+
+    explicit compact_string(std::string_view str) : compact_string(str.data(), str.size())
+    {
+    }
+
+    compact_string(std::string_view str, size_type pos, size_type count = npos) : compact_string()
+    {
+        append(str, pos, count);
+    }
+
+    template<std::input_iterator InputIt>
+    compact_string(InputIt first, InputIt last) : compact_string()
+    {
+        append(first, last);
+    }
+
+    compact_string(std::initializer_list<char> init) : compact_string(init.begin(), init.size())
+    {
+    }
+
+    //Interned strings share the entry, heap strings get a copy without the spare capacity
+    compact_string(const compact_string& other)
+    {
+        if(other.isInterned())
+            string_pool::addRef(other.mRep.data);
+        if(other.isHeap())
+        {
+            setInlineSize(0);
+            append(other.mRep.data, other.mRep.size);
+        }
+        else
+            mRep = other.mRep;
+    }
+
+    compact_string(compact_string&& other) noexcept : mRep(other.mRep)
+    {
+        other.setInlineSize(0);
+    }
+
+    ~compact_string()
+    {
+        releaseStorage();
+    }
+
+    // = operator
+    compact_string& operator=(const compact_string& other)
+    {
+        if(this != &other)
+        {
+            compact_string copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    compact_string& operator=(compact_string&& other) noexcept
+    {
+        if(this != &other)
+        {
+            releaseStorage();
+            mRep = other.mRep;
+            other.setInlineSize(0);
+        }
+        return *this;
+    }
+
+    compact_string& operator=(const char* str) { return assign(str); }
+    compact_string& operator=(char ch) { return assign(1, ch); }
+    compact_string& operator=(std::initializer_list<char> init) { return assign(init); }
+    compact_string& operator=(std::string_view str) { return assign(str); }
+    compact_string& operator=(std::nullptr_t) = delete;
+
+    //assign
+    compact_string& assign(size_type count, char ch) { return replace(0, npos, count, ch); }
+    compact_string& assign(const compact_string& str) { return *this = str; }
+    compact_string& assign(compact_string&& str) noexcept { return *this = std::move(str); }
+    compact_string& assign(const char* str, size_type count) { return replace(0, npos, str, count); }
+    compact_string& assign(const char* str) { return replace(0, npos, str); }
+    compact_string& assign(std::string_view str) { return replace(0, npos, str); }
+    compact_string& assign(std::string_view str, size_type pos, size_type count = npos) { return replace(0, npos, str, pos, count); }
+    compact_string& assign(std::initializer_list<char> init) { return replace(0, npos, init.begin(), init.size()); }
+
+    template<std::input_iterator InputIt>
+    compact_string& assign(InputIt first, InputIt last)
+    {
+        return replace(cbegin(), cend(), first, last);
+    }
+
+    //element access, the non const ones give an interned string its own copy first
+    reference at(size_type pos)
+    {
+        if(pos >= size())
+            throw std::out_of_range("compact_string::at");
+        return data()[pos];
+    }
+
+    const_reference at(size_type pos) const
+    {
+        if(pos >= size())
+            throw std::out_of_range("compact_string::at");
+        return data()[pos];
+    }
+
+    reference operator[](size_type pos) { return data()[pos]; }
+    const_reference operator[](size_type pos) const { return data()[pos]; }
+    reference front() { return data()[0]; }
+    const_reference front() const { return data()[0]; }
+    reference back() { return data()[size() - 1]; }
+    const_reference back() const { return data()[size() - 1]; }
+
+    char* data()
+    {
+        if(isInterned())
+            unshare(size());
+        return buffer();
+    }
+
+    const char* data() const noexcept { return buffer(); }
+    const char* c_str() const noexcept { return buffer(); }
+
+    operator std::string_view() const noexcept { return {buffer(), size()}; }
+
+    //iterators
+    iterator begin() { return data(); }
+    const_iterator begin() const noexcept { return data(); }
+    const_iterator cbegin() const noexcept { return data(); }
+    iterator end() { return data() + size(); }
+    const_iterator end() const noexcept { return data() + size(); }
+    const_iterator cend() const noexcept { return data() + size(); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    //capacity
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+    size_type size() const noexcept { return isInline() ? inline_capacity - tag() : mRep.size; }
+    size_type length() const noexcept { return size(); }
+    static constexpr size_type max_size() noexcept { return capacityMask - 1; }
+
+    //Interned strings have no spare room, their capacity is their size
+    size_type capacity() const noexcept
+    {
+        if(isInline())
+            return inline_capacity;
+        return isHeap() ? mRep.capacity & capacityMask : mRep.size;
+    }
+
+    void reserve(size_type newCapacity)
+    {
+        if(newCapacity > max_size())
+            throw std::length_error("compact_string::reserve");
+        if(newCapacity > capacity() || isInterned())
+            unshare(std::max(newCapacity, size()));
+    }
+
+    //Heap strings short enough move back inline
+    void shrink_to_fit()
+    {
+        if(isHeap() && capacity() > size())
+            unshare(size());
+    }
+
+    //operations
+    void clear() noexcept
+    {
+        if(isHeap())
+            setHeapSize(0);
+        else
+        {
+            releaseStorage();
+            setInlineSize(0);
+        }
+    }
+
+    compact_string& insert(size_type index, size_type count, char ch) { return replace(index, 0, count, ch); }
+    compact_string& insert(size_type index, const char* str) { return replace(index, 0, str); }
+    compact_string& insert(size_type index, const char* str, size_type count) { return replace(index, 0, str, count); }
+    compact_string& insert(size_type index, std::string_view str) { return replace(index, 0, str); }
+
+    compact_string& insert(size_type index, std::string_view str, size_type pos, size_type count = npos)
+    {
+        return replace(index, 0, str, pos, count);
+    }
+
+    iterator insert(const_iterator pos, char ch) { return insert(pos, 1, ch); }
+
+    iterator insert(const_iterator pos, size_type count, char ch)
+    {
+        const auto index = offset(pos);
+        replace(index, 0, count, ch);
+        return begin() + index;
+    }
+
+    template<std::input_iterator InputIt>
+    iterator insert(const_iterator pos, InputIt first, InputIt last)
+    {
+        const auto index = offset(pos);
+        replace(pos, pos, first, last);
+        return begin() + index;
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<char> init) { return insert(pos, init.begin(), init.end()); }
+
+    compact_string& erase(size_type index = 0, size_type count = npos) { return replace(index, count, "", 0); }
+
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        const auto index = offset(first);
+        replace(index, offset(last) - index, "", 0);
+        return begin() + index;
+    }
+
+    void push_back(char ch)
+    {
+        if(const auto oldSize = size(); isInline() && oldSize < inline_capacity)
+        {
+            inlineBuffer()[oldSize] = ch;
+            setInlineSize(oldSize + 1);
+        }
+        else
+            append(1, ch);
+    }
+
+    void pop_back() { erase(size() - 1, 1); }
+
+    compact_string& append(size_type count, char ch) { return replace(size(), 0, count, ch); }
+    compact_string& append(const char* str, size_type count) { return replace(size(), 0, str, count); }
+    compact_string& append(const char* str) { return replace(size(), 0, str); }
+    compact_string& append(std::string_view str) { return replace(size(), 0, str); }
+    compact_string& append(std::string_view str, size_type pos, size_type count = npos) { return replace(size(), 0, str, pos, count); }
+    compact_string& append(std::initializer_list<char> init) { return replace(size(), 0, init.begin(), init.size()); }
+
+    template<std::input_iterator InputIt>
+    compact_string& append(InputIt first, InputIt last)
+    {
+        return replace(cend(), cend(), first, last);
+    }
+
+    compact_string& operator+=(std::string_view str) { return append(str); }
+    compact_string& operator+=(const char* str) { return append(str); }
+    compact_string& operator+=(char ch) { return append(1, ch); }
+    compact_string& operator+=(std::initializer_list<char> init) { return append(init); }
+
+    int compare(std::string_view str) const noexcept { return view().compare(str); }
+    int compare(size_type pos, size_type count, std::string_view str) const { return view(pos, count, "compare").compare(str); }
+
+    int compare(size_type pos1, size_type count1, std::string_view str, size_type pos2, size_type count2 = npos) const
+    {
+        if(pos2 > str.size())
+            throw std::out_of_range("compact_string::compare");
+        return view(pos1, count1, "compare").compare(str.substr(pos2, count2));
+    }
+
+    int compare(size_type pos, size_type count, const char* str, size_type count2) const
+    {
+        return view(pos, count, "compare").compare(std::string_view(str, count2));
+    }
+
+    bool starts_with(std::string_view str) const noexcept { return view().starts_with(str); }
+    bool starts_with(char ch) const noexcept { return view().starts_with(ch); }
+    bool starts_with(const char* str) const { return view().starts_with(str); }
+    bool ends_with(std::string_view str) const noexcept { return view().ends_with(str); }
+    bool ends_with(char ch) const noexcept { return view().ends_with(ch); }
+    bool ends_with(const char* str) const { return view().ends_with(str); }
+    bool contains(std::string_view str) const noexcept { return find(str) != npos; }
+    bool contains(char ch) const noexcept { return find(ch) != npos; }
+    bool contains(const char* str) const { return find(str) != npos; }
+
+    //replace, everything that changes the chars ends up in the pointer/count or the fill version
+    compact_string& replace(size_type pos, size_type count, const char* str, size_type count2)
+    {
+        count = std::min(count, checkPos(pos, "replace"));
+        if(count2 != 0 && std::less_equal<const char*>()(buffer(), str) && std::less<const char*>()(str, buffer() + size()))
+        {
+            //The replacement lives in this string and may move, work from a copy
+            const compact_string copy(str, count2);
+            return replace(pos, count, copy.buffer(), count2);
+        }
+        traits_type::copy(openGap(pos, count, count2), str, count2);
+        return *this;
+    }
+
+    compact_string& replace(size_type pos, size_type count, size_type count2, char ch)
+    {
+        count = std::min(count, checkPos(pos, "replace"));
+        traits_type::assign(openGap(pos, count, count2), count2, ch);
+        return *this;
+    }
+
+    compact_string& replace(size_type pos, size_type count, std::string_view str) { return replace(pos, count, str.data(), str.size()); }
+
+    compact_string& replace(size_type pos, size_type count, std::string_view str, size_type pos2, size_type count2 = npos)
+    {
+        if(pos2 > str.size())
+            throw std::out_of_range("compact_string::replace");
+        return replace(pos, count, str.substr(pos2, count2));
+    }
+
+    compact_string& replace(const_iterator first, const_iterator last, std::string_view str)
+    {
+        return replace(offset(first), offset(last) - offset(first), str);
+    }
+
+    compact_string& replace(const_iterator first, const_iterator last, const char* str, size_type count2)
+    {
+        return replace(offset(first), offset(last) - offset(first), str, count2);
+    }
+
+    compact_string& replace(const_iterator first, const_iterator last, size_type count2, char ch)
+    {
+        return replace(offset(first), offset(last) - offset(first), count2, ch);
+    }
+
+    template<std::input_iterator InputIt>
+    compact_string& replace(const_iterator first, const_iterator last, InputIt first2, InputIt last2)
+    {
+        const auto pos = offset(first);
+        const auto count = offset(last) - pos;
+        if constexpr(std::contiguous_iterator<InputIt> && std::same_as<std::iter_value_t<InputIt>, char>)
+            return replace(pos, count, std::to_address(first2), static_cast<size_type>(last2 - first2));
+        else
+        {
+            //Other iterators may point into this string or only be walked once, collect the chars first
+            compact_string chars;
+            for(; first2 != last2; ++first2)
+                chars.push_back(*first2);
+            return replace(pos, count, chars.buffer(), chars.size());
+        }
+    }
+
+    compact_string& replace(const_iterator first, const_iterator last, std::initializer_list<char> init)
+    {
+        return replace(first, last, init.begin(), init.size());
+    }
+
+    compact_string substr(size_type pos = 0, size_type count = npos) const
+    {
+        return compact_string(view(pos, count, "substr"));
+    }
+
+    size_type copy(char* dest, size_type count, size_type pos = 0) const
+    {
+        const auto chars = view(pos, count, "copy");
+        traits_type::copy(dest, chars.data(), chars.size());
+        return chars.size();
+    }
+
+    void resize(size_type count, char ch = char())
+    {
+        const auto oldSize = size();
+        if(count > oldSize)
+            append(count - oldSize, ch);
+        else
+            erase(count);
+    }
+
+    void swap(compact_string& other) noexcept { std::swap(mRep, other.mRep); }
+
+    //search
+    size_type find(std::string_view str, size_type pos = 0) const noexcept { return practise::find(view(), str, pos); }
+    size_type find(const char* str, size_type pos, size_type count) const { return find(std::string_view(str, count), pos); }
+    size_type find(char ch, size_type pos = 0) const noexcept { return practise::find(view(), ch, pos); }
+    size_type rfind(std::string_view str, size_type pos = npos) const noexcept { return practise::rfind(view(), str, pos); }
+    size_type rfind(const char* str, size_type pos, size_type count) const { return rfind(std::string_view(str, count), pos); }
+    size_type rfind(char ch, size_type pos = npos) const noexcept { return practise::rfind(view(), ch, pos); }
+    size_type find_first_of(std::string_view chars, size_type pos = 0) const noexcept { return practise::find_first_of(view(), chars, pos); }
+    size_type find_first_of(const char* chars, size_type pos, size_type count) const { return find_first_of(std::string_view(chars, count), pos); }
+    size_type find_first_of(char ch, size_type pos = 0) const noexcept { return find(ch, pos); }
+    size_type find_first_not_of(std::string_view chars, size_type pos = 0) const noexcept { return practise::find_first_not_of(view(), chars, pos); }
+    size_type find_first_not_of(const char* chars, size_type pos, size_type count) const { return find_first_not_of(std::string_view(chars, count), pos); }
+    size_type find_first_not_of(char ch, size_type pos = 0) const noexcept { return find_first_not_of(std::string_view(&ch, 1), pos); }
+    size_type find_last_of(std::string_view chars, size_type pos = npos) const noexcept { return practise::find_last_of(view(), chars, pos); }
+    size_type find_last_of(const char* chars, size_type pos, size_type count) const { return find_last_of(std::string_view(chars, count), pos); }
+    size_type find_last_of(char ch, size_type pos = npos) const noexcept { return rfind(ch, pos); }
+    size_type find_last_not_of(std::string_view chars, size_type pos = npos) const noexcept { return practise::find_last_not_of(view(), chars, pos); }
+    size_type find_last_not_of(const char* chars, size_type pos, size_type count) const { return find_last_not_of(std::string_view(chars, count), pos); }
+    size_type find_last_not_of(char ch, size_type pos = npos) const noexcept { return find_last_not_of(std::string_view(&ch, 1), pos); }
+
+    //interning
+    //Moves the chars into the pool, or onto the entry an equal string already has there. Strings that fit
+    //inline stay inline, they would not get any smaller
+    void intern(string_pool& pool = string_pool::global())
+    {
+        if(size() <= inline_capacity)
+        {
+            shrink_to_fit();
+            return;
+        }
+        if(isInterned() && string_pool::entryOf(mRep.data)->pool == &pool)
+            return;
+        const auto* chars = pool.acquire(view());
+        const auto length = size();
+        releaseStorage();
+        mRep = {const_cast<char*>(chars), length, size_type{internedTag} << tagShift};
+    }
+
+    static compact_string interned(std::string_view str, string_pool& pool = string_pool::global())
+    {
+        compact_string result;
+        if(str.size() <= inline_capacity)
+            result.assign(str);
+        else
+            result.mRep = {const_cast<char*>(pool.acquire(str)), str.size(), size_type{internedTag} << tagShift};
+        return result;
+    }
+
+    bool is_interned() const noexcept { return isInterned(); }
+
+private:
+    //The last byte of the object is the inline size byte, or the top byte of the capacity word
+    struct Rep
+    {
+        char* data;
+        size_type size;
+        size_type capacity;
+    };
+
+    static constexpr unsigned char heapTag = 0x80;
+    static constexpr unsigned char internedTag = 0x40;
+    static constexpr size_type tagShift = 56;
+    static constexpr size_type capacityMask = (size_type{1} << tagShift) - 1;
+
+    static_assert(std::endian::native == std::endian::little, "the tag byte has to be the top byte of the capacity");
+    static_assert(sizeof(Rep) == inline_capacity + 1);
+
+    unsigned char tag() const noexcept { return reinterpret_cast<const unsigned char*>(&mRep)[inline_capacity]; }
+    bool isInline() const noexcept { return tag() <= inline_capacity; }
+    bool isHeap() const noexcept { return tag() == heapTag; }
+    bool isInterned() const noexcept { return tag() == internedTag; }
+
+    char* inlineBuffer() noexcept { return reinterpret_cast<char*>(&mRep); }
+    const char* inlineBuffer() const noexcept { return reinterpret_cast<const char*>(&mRep); }
+    char* buffer() noexcept { return isInline() ? inlineBuffer() : mRep.data; }
+    const char* buffer() const noexcept { return isInline() ? inlineBuffer() : mRep.data; }
+
+    std::string_view view() const noexcept { return {buffer(), size()}; }
+
+    std::string_view view(size_type pos, size_type count, const char* function) const
+    {
+        const auto rest = checkPos(pos, function);
+        return {buffer() + pos, std::min(count, rest)};
+    }
+
+    //Chars from pos to the end, throws when pos is past the end
+    size_type checkPos(size_type pos, const char* function) const
+    {
+        if(pos > size())
+            throw std::out_of_range(std::string("compact_string::") + function);
+        return size() - pos;
+    }
+
+    size_type offset(const_iterator pos) const noexcept { return static_cast<size_type>(pos - buffer()); }
+
+    //With size 23 the null terminator and the size byte are the same byte
+    void setInlineSize(size_type newSize) noexcept
+    {
+        inlineBuffer()[newSize] = '\0';
+        reinterpret_cast<unsigned char*>(&mRep)[inline_capacity] = static_cast<unsigned char>(inline_capacity - newSize);
+    }
+
+    void setHeapSize(size_type newSize) noexcept
+    {
+        mRep.size = newSize;
+        mRep.data[newSize] = '\0';
+    }
+
+    void setSize(size_type newSize) noexcept
+    {
+        if(isInline())
+            setInlineSize(newSize);
+        else
+            setHeapSize(newSize);
+    }
+
+    void releaseStorage() noexcept
+    {
+        if(isHeap())
+            delete[] mRep.data;
+        else if(isInterned())
+            string_pool::release(mRep.data);
+    }
+
+    //Turns an empty inline string into one with room for newCapacity chars
+    char* allocate(size_type newCapacity)
+    {
+        if(newCapacity <= inline_capacity)
+            return inlineBuffer();
+        mRep = {new char[newCapacity + 1], 0, newCapacity | size_type{heapTag} << tagShift};
+        mRep.data[0] = '\0';
+        return mRep.data;
+    }
+
+    //setSize right after allocate(newCapacity), without looking at the tag again
+    void setAllocatedSize(size_type newCapacity, size_type newSize) noexcept
+    {
+        if(newCapacity <= inline_capacity)
+            setInlineSize(newSize);
+        else
+            setHeapSize(newSize);
+    }
+
+    //Own copy of the chars with room for newCapacity, inline when they fit
+    void unshare(size_type newCapacity)
+    {
+        compact_string copy;
+        traits_type::copy(copy.allocate(newCapacity), buffer(), size());
+        copy.setAllocatedSize(newCapacity, size());
+        swap(copy);
+    }
+
+    //Replaces count chars at pos by count2 unset chars and returns them. Strings that are interned or too
+    //small get a new buffer, growing at least twice as large so repeated appends stay amortized O(1)
+    char* openGap(size_type pos, size_type count, size_type count2)
+    {
+        const auto oldSize = size();
+        if(count2 > max_size() - (oldSize - count))
+            throw std::length_error("compact_string: too long");
+        const auto newSize = oldSize - count + count2;
+        const auto tail = oldSize - pos - count;
+        if(!isInterned() && newSize <= capacity())
+        {
+            auto* chars = buffer();
+            traits_type::move(chars + pos + count2, chars + pos + count, tail);
+            setSize(newSize);
+            return chars + pos;
+        }
+
+        compact_string grown;
+        const auto newCapacity = newSize <= inline_capacity ? newSize : std::min(std::max(newSize, 2 * capacity()), max_size());
+        auto* chars = grown.allocate(newCapacity);
+        traits_type::copy(chars, buffer(), pos);
+        traits_type::copy(chars + pos + count2, buffer() + pos + count, tail);
+        grown.setAllocatedSize(newCapacity, newSize);
+        swap(grown);
+        return buffer() + pos;
+    }
+
+    Rep mRep;
+};
+
+static_assert(sizeof(compact_string) == 24);
+
+//non member functions
+inline compact_string operator+(const compact_string& lhs, std::string_view rhs)
+{
+    compact_string result;
+    result.reserve(lhs.size() + rhs.size());
+    return std::move(result.append(lhs).append(rhs));
+}
+
+inline compact_string operator+(const compact_string& lhs, const compact_string& rhs) { return lhs + std::string_view(rhs); }
+inline compact_string operator+(const compact_string& lhs, const char* rhs) { return lhs + std::string_view(rhs); }
+inline compact_string operator+(const compact_string& lhs, char rhs) { return lhs + std::string_view(&rhs, 1); }
+inline compact_string operator+(compact_string&& lhs, std::string_view rhs) { return std::move(lhs.append(rhs)); }
+inline compact_string operator+(compact_string&& lhs, const compact_string& rhs) { return std::move(lhs.append(rhs)); }
+inline compact_string operator+(compact_string&& lhs, const char* rhs) { return std::move(lhs.append(rhs)); }
+inline compact_string operator+(compact_string&& lhs, char rhs) { return std::move(lhs.append(1, rhs)); }
+
+inline compact_string operator+(std::string_view lhs, const compact_string& rhs)
+{
+    compact_string result;
+    result.reserve(lhs.size() + rhs.size());
+    return std::move(result.append(lhs).append(rhs));
+}
+
+inline compact_string operator+(const char* lhs, const compact_string& rhs) { return std::string_view(lhs) + rhs; }
+inline compact_string operator+(char lhs, const compact_string& rhs) { return std::string_view(&lhs, 1) + rhs; }
+
+inline bool operator==(const compact_string& lhs, const compact_string& rhs) noexcept { return std::string_view(lhs) == std::string_view(rhs); }
+inline bool operator==(const compact_string& lhs, const char* rhs) { return std::string_view(lhs) == rhs; }
+inline bool operator==(const compact_string& lhs, std::string_view rhs) noexcept { return std::string_view(lhs) == rhs; }
+
+inline std::strong_ordering operator<=>(const compact_string& lhs, const compact_string& rhs) noexcept
+{
+    return std::string_view(lhs) <=> std::string_view(rhs);
+}
+
+inline std::strong_ordering operator<=>(const compact_string& lhs, const char* rhs) { return std::string_view(lhs) <=> rhs; }
+inline std::strong_ordering operator<=>(const compact_string& lhs, std::string_view rhs) noexcept { return std::string_view(lhs) <=> rhs; }
+
+inline void swap(compact_string& lhs, compact_string& rhs) noexcept { lhs.swap(rhs); }
+
+inline compact_string::size_type erase(compact_string& str, char value)
+{
+    const auto removed = std::remove(str.begin(), str.end(), value);
+    const auto count = static_cast<compact_string::size_type>(str.end() - removed);
+    str.erase(removed, str.end());
+    return count;
+}
+
+template<typename Pred>
+compact_string::size_type erase_if(compact_string& str, Pred pred)
+{
+    const auto removed = std::remove_if(str.begin(), str.end(), pred);
+    const auto count = static_cast<compact_string::size_type>(str.end() - removed);
+    str.erase(removed, str.end());
+    return count;
+}
+
+inline std::ostream& operator<<(std::ostream& out, const compact_string& str)
+{
+    return out << std::string_view(str);
+}
+
+}
+
+template<>
+struct std::hash<practise::compact_string>
+{
+    std::size_t operator()(const practise::compact_string& str) const noexcept
+    {
+        return std::hash<std::string_view>{}(str);
+    }
+};
@@ -0,0 +1,631 @@
+//rope : text type for large documents that are edited in place. The chars live in immutable pieces of shared
+//buffers (a piece table) and the pieces are the leaves of an AVL tree ordered by position, every node knowing
+//the number of chars below it. insert, erase and replace split the tree at the edit positions and join the
+//parts back around the new piece in O(log pieces), whatever the size of the text, instead of moving everything
+//behind the edit like std::string. Splitting a piece only creates two views on the same buffer, chars are
+//copied only when small neighbouring pieces are merged, so a file loaded as one piece stays one buffer.
+//Nodes are never modified once built, edits copy the O(log pieces) nodes on the path they change: copies
+//and substr() share the tree in O(1)/O(log pieces) without copying chars, and a rope can be read by several
+//threads while another thread edits its own copy.
+//Any edit invalidates the iterators, the search functions go through the vectorized StringSearch.h piece by
+//piece.
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include "StringSearch.h"
+
+namespace practise
+{
+
+class rope
+{
+    struct Node;
+    using NodePtr = std::shared_ptr<const Node>;
+
+    //Leaves have height 0 and a piece, internal nodes two children
+    struct Node
+    {
+        std::size_t size = 0;
+        int height = 0;
+        NodePtr left;
+        NodePtr right;
+        //Aliases the buffer owning the piece, points to its first char
+        std::shared_ptr<const char> chars;
+    };
+
+public:
+    using traits_type = std::char_traits<char>;
+    using value_type = char;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_reference = const char&;
+    using const_pointer = const char*;
+
+    static constexpr size_type npos = std::string_view::npos;
+
+    //Neighbouring pieces whose chars add up to at most this many are copied into one piece
+    static constexpr size_type merge_limit = 512;
+
+    //Random access over the chars, remembers the piece it points into so walking the text only looks the
+    //tree up once per piece
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = char;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const char*;
+        using reference = const char&;
+
+        const_iterator() = default;
+
+        reference operator*() const { return *locate(); }
+        pointer operator->() const { return locate(); }
+        reference operator[](difference_type offset) const { return *(*this + offset); }
+
+        const_iterator& operator++() { ++mPos; return *this; }
+        const_iterator operator++(int) { auto old = *this; ++mPos; return old; }
+        const_iterator& operator--() { --mPos; return *this; }
+        const_iterator operator--(int) { auto old = *this; --mPos; return old; }
+        const_iterator& operator+=(difference_type offset) { mPos += static_cast<size_type>(offset); return *this; }
+        const_iterator& operator-=(difference_type offset) { mPos -= static_cast<size_type>(offset); return *this; }
+
+        friend const_iterator operator+(const_iterator it, difference_type offset) { return it += offset; }
+        friend const_iterator operator+(difference_type offset, const_iterator it) { return it += offset; }
+        friend const_iterator operator-(const_iterator it, difference_type offset) { return it -= offset; }
+        friend difference_type operator-(const const_iterator& lhs, const const_iterator& rhs)
+        {
+            return static_cast<difference_type>(lhs.mPos - rhs.mPos);
+        }
+        friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) { return lhs.mPos == rhs.mPos; }
+        friend auto operator<=>(const const_iterator& lhs, const const_iterator& rhs) { return lhs.mPos <=> rhs.mPos; }
+
+    private:
+        friend class rope;
+
+        const_iterator(const rope* owner, size_type pos) : mRope(owner), mPos(pos) {}
+
+        const char* locate() const
+        {
+            if(mPos - mPieceStart >= mPieceSize)
+            {
+                const auto [leaf, start] = leafAt(mRope->mRoot.get(), mPos);
+                mPiece = leaf->chars.get();
+                mPieceStart = start;
+                mPieceSize = leaf->size;
+            }
+            return mPiece + (mPos - mPieceStart);
+        }
+
+        const rope* mRope = nullptr;
+        size_type mPos = 0;
+        mutable const char* mPiece = nullptr;
+        mutable size_type mPieceStart = 0;
+        mutable size_type mPieceSize = 0;
+    };
+    using iterator = const_iterator;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using reverse_iterator = const_reverse_iterator;
+
+    rope() = default;
+    explicit rope(std::string_view str) : mRoot(copyPiece(str)) {}
+    explicit rope(const char* str) : rope(std::string_view(str)) {}
+    explicit rope(size_type count, char ch) : rope(std::string(count, ch)) {}
+
+    //Takes over the buffer of str without copying the chars
+    explicit rope(std::string&& str)
+    {
+        if(str.empty())
+            return;
+        auto owner = std::make_shared<const std::string>(std::move(str));
+        mRoot = makeLeaf(std::shared_ptr<const char>(owner, owner->data()), owner->size());
+    }
+
+    //Uses size chars of an existing buffer, chars keeps it alive (a mapped file, a buffer shared with other
+    //ropes, ...). The buffer must not change while a rope uses it.
+    explicit rope(std::shared_ptr<const char> chars, size_type size) : mRoot(size ? makeLeaf(std::move(chars), size) : nullptr) {}
+
+    template<std::input_iterator It>
+    explicit rope(It first, It last) : rope(std::string(first, last)) {}
+
+    //Element access
+    char at(size_type pos) const
+    {
+        if(pos >= size())
+            throw std::out_of_range("rope::at");
+        return (*this)[pos];
+    }
+
+    char operator[](size_type pos) const
+    {
+        const auto [leaf, start] = leafAt(mRoot.get(), pos);
+        return leaf->chars.get()[pos - start];
+    }
+
+    char front() const { return (*this)[0]; }
+    char back() const { return (*this)[size() - 1]; }
+
+    //Iterators
+    const_iterator begin() const noexcept { return {this, 0}; }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator end() const noexcept { return {this, size()}; }
+    const_iterator cend() const noexcept { return end(); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    //Capacity
+    bool empty() const noexcept { return !mRoot; }
+    size_type size() const noexcept { return mRoot ? mRoot->size : 0; }
+    size_type length() const noexcept { return size(); }
+    size_type max_size() const noexcept { return std::string_view().max_size(); }
+
+    //Number of pieces the text is split into
+    size_type piece_count() const noexcept { return pieceCount(mRoot.get()); }
+
+    //Height of the tree, 0 for a single piece
+    int depth() const noexcept { return mRoot ? mRoot->height : 0; }
+
+    //Operations
+    void clear() noexcept { mRoot.reset(); }
+
+    rope& insert(size_type pos, std::string_view str)
+    {
+        checkPos(pos, "insert");
+        return splice(pos, 0, copyPiece(str));
+    }
+
+    //The pieces of str are shared, not copied
+    rope& insert(size_type pos, const rope& str)
+    {
+        checkPos(pos, "insert");
+        return splice(pos, 0, str.mRoot);
+    }
+
+    rope& insert(size_type pos, size_type count, char ch) { return insert(pos, std::string(count, ch)); }
+
+    rope& erase(size_type pos = 0, size_type count = npos)
+    {
+        checkPos(pos, "erase");
+        return splice(pos, count, nullptr);
+    }
+
+    rope& replace(size_type pos, size_type count, std::string_view str)
+    {
+        checkPos(pos, "replace");
+        return splice(pos, count, copyPiece(str));
+    }
+
+    rope& replace(size_type pos, size_type count, const rope& str)
+    {
+        checkPos(pos, "replace");
+        return splice(pos, count, str.mRoot);
+    }
+
+    rope& append(std::string_view str) { mRoot = concat(mRoot, copyPiece(str)); return *this; }
+    rope& append(const rope& str) { mRoot = concat(mRoot, str.mRoot); return *this; }
+    rope& append(size_type count, char ch) { return append(std::string(count, ch)); }
+    rope& operator+=(std::string_view str) { return append(str); }
+    rope& operator+=(const rope& str) { return append(str); }
+    rope& operator+=(char ch) { return append(std::string_view(&ch, 1)); }
+
+    void push_back(char ch) { append(std::string_view(&ch, 1)); }
+    void pop_back() { erase(size() - 1, 1); }
+
+    //Shares the pieces of [pos, pos + count) with this rope, no char is copied
+    rope substr(size_type pos = 0, size_type count = npos) const
+    {
+        checkPos(pos, "substr");
+        rope sub;
+        sub.mRoot = split(split(mRoot, pos).second, count).first;
+        return sub;
+    }
+
+    size_type copy(char* dest, size_type count, size_type pos = 0) const
+    {
+        checkPos(pos, "copy");
+        count = std::min(count, size() - pos);
+        visitPieces(mRoot.get(), pos, pos + count, [&dest](std::string_view piece)
+        {
+            dest = std::copy(piece.begin(), piece.end(), dest);
+            return true;
+        });
+        return count;
+    }
+
+    //All the chars in one std::string
+    std::string str() const
+    {
+        std::string result;
+        result.reserve(size());
+        for_each_piece([&result](std::string_view piece) { result.append(piece); });
+        return result;
+    }
+
+    explicit operator std::string() const { return str(); }
+
+    //Calls f(std::string_view) for every piece of [pos, pos + count), in order
+    template<typename F>
+    void for_each_piece(size_type pos, size_type count, F f) const
+    {
+        checkPos(pos, "for_each_piece");
+        count = std::min(count, size() - pos);
+        visitPieces(mRoot.get(), pos, pos + count, [&f](std::string_view piece) { f(piece); return true; });
+    }
+
+    template<typename F>
+    void for_each_piece(F f) const { for_each_piece(0, npos, std::move(f)); }
+
+    void swap(rope& other) noexcept { mRoot.swap(other.mRoot); }
+
+    int compare(const rope& str) const
+    {
+        //Walks the pieces of both ropes side by side
+        std::string_view rest;
+        size_type pos = 0;
+        int order = 0;
+        visitPieces(mRoot.get(), 0, size(), [&](std::string_view piece)
+        {
+            while(!piece.empty() && pos < str.size())
+            {
+                if(rest.empty())
+                {
+                    const auto [leaf, start] = leafAt(str.mRoot.get(), pos);
+                    rest = {leaf->chars.get() + (pos - start), leaf->size - (pos - start)};
+                }
+                const auto count = std::min(piece.size(), rest.size());
+                if((order = traits_type::compare(piece.data(), rest.data(), count)) != 0)
+                    return false;
+                piece.remove_prefix(count);
+                rest.remove_prefix(count);
+                pos += count;
+            }
+            return piece.empty();
+        });
+        if(order != 0)
+            return order;
+        return size() == str.size() ? 0 : (size() < str.size() ? -1 : 1);
+    }
+
+    int compare(std::string_view str) const
+    {
+        int order = 0;
+        size_type pos = 0;
+        visitPieces(mRoot.get(), 0, std::min(size(), str.size()), [&](std::string_view piece)
+        {
+            order = traits_type::compare(piece.data(), str.data() + pos, piece.size());
+            pos += piece.size();
+            return order == 0;
+        });
+        if(order != 0)
+            return order;
+        return size() == str.size() ? 0 : (size() < str.size() ? -1 : 1);
+    }
+
+    bool starts_with(std::string_view str) const { return size() >= str.size() && substr(0, str.size()).compare(str) == 0; }
+    bool ends_with(std::string_view str) const { return size() >= str.size() && substr(size() - str.size()).compare(str) == 0; }
+    bool contains(std::string_view str) const { return find(str) != npos; }
+
+    //Search, same results as std::string
+    size_type find(std::string_view str, size_type pos = 0) const
+    {
+        if(pos > size() || str.size() > size() - pos)
+            return npos;
+        if(str.empty())
+            return pos;
+
+        //seam holds the last str.size() - 1 chars before the current piece, a match starting there and
+        //ending in the piece comes before every match inside the piece
+        std::string seam, window;
+        size_type found = npos;
+        size_type offset = pos;
+        visitPieces(mRoot.get(), pos, size(), [&](std::string_view piece)
+        {
+            if(!seam.empty())
+            {
+                window.assign(seam).append(piece.substr(0, str.size() - 1));
+                if(const auto hit = practise::find(window, str); hit < seam.size())
+                {
+                    found = offset - seam.size() + hit;
+                    return false;
+                }
+            }
+            if(const auto hit = practise::find(piece, str); hit != npos)
+            {
+                found = offset + hit;
+                return false;
+            }
+            keepTail(seam, piece, str.size() - 1);
+            offset += piece.size();
+            return true;
+        });
+        return found;
+    }
+
+    size_type find(char ch, size_type pos = 0) const { return find(std::string_view(&ch, 1), pos); }
+
+    size_type rfind(std::string_view str, size_type pos = npos) const
+    {
+        if(str.size() > size())
+            return npos;
+        pos = std::min(pos, size() - str.size());
+        if(str.empty())
+            return pos;
+
+        //Mirror of find: seam holds the first str.size() - 1 chars after the current piece, a match starting in
+        //the piece and ending in the seam comes after every match inside the piece
+        std::string seam, window;
+        size_type found = npos;
+        size_type end = pos + str.size();
+        visitPiecesBackward(mRoot.get(), 0, end, [&](std::string_view piece)
+        {
+            const auto offset = end - piece.size();
+            if(!seam.empty())
+            {
+                const auto head = piece.size() - std::min(piece.size(), str.size() - 1);
+                window.assign(piece.substr(head)).append(seam);
+                if(const auto hit = practise::rfind(window, str); hit != npos)
+                {
+                    found = offset + head + hit;
+                    return false;
+                }
+            }
+            if(const auto hit = practise::rfind(piece, str); hit != npos)
+            {
+                found = offset + hit;
+                return false;
+            }
+            keepHead(seam, piece, str.size() - 1);
+            end = offset;
+            return true;
+        });
+        return found;
+    }
+
+    size_type rfind(char ch, size_type pos = npos) const { return rfind(std::string_view(&ch, 1), pos); }
+
+private:
+    void checkPos(size_type pos, const char* function) const
+    {
+        if(pos > size())
+            throw std::out_of_range(std::string("rope::") + function);
+    }
+
+    //Replaces [pos, pos + count) with the pieces of middle
+    rope& splice(size_type pos, size_type count, NodePtr middle)
+    {
+        auto [head, rest] = split(mRoot, pos);
+        auto tail = split(std::move(rest), count).second;
+        mRoot = concat(concat(std::move(head), std::move(middle)), std::move(tail));
+        return *this;
+    }
+
+    static int height(const NodePtr& node) noexcept { return node ? node->height : -1; }
+
+    static NodePtr makeLeaf(std::shared_ptr<const char> chars, size_type size)
+    {
+        auto leaf = std::make_shared<Node>();
+        leaf->size = size;
+        leaf->chars = std::move(chars);
+        return leaf;
+    }
+
+    static NodePtr copyPiece(std::string_view first, std::string_view second = {})
+    {
+        if(first.empty() && second.empty())
+            return nullptr;
+        std::shared_ptr<char[]> buffer = std::make_shared_for_overwrite<char[]>(first.size() + second.size());
+        std::copy(second.begin(), second.end(), std::copy(first.begin(), first.end(), buffer.get()));
+        return makeLeaf(std::shared_ptr<const char>(buffer, buffer.get()), first.size() + second.size());
+    }
+
+    static NodePtr makeNode(NodePtr left, NodePtr right)
+    {
+        auto node = std::make_shared<Node>();
+        node->size = left->size + right->size;
+        node->height = std::max(left->height, right->height) + 1;
+        node->left = std::move(left);
+        node->right = std::move(right);
+        return node;
+    }
+
+    //Node over left and right whose heights differ by at most 2, rotated back into AVL shape
+    static NodePtr balance(NodePtr left, NodePtr right)
+    {
+        if(height(left) > height(right) + 1)
+        {
+            if(height(left->left) >= height(left->right))
+                return makeNode(left->left, makeNode(left->right, std::move(right)));
+            return makeNode(makeNode(left->left, left->right->left), makeNode(left->right->right, std::move(right)));
+        }
+        if(height(right) > height(left) + 1)
+        {
+            if(height(right->right) >= height(right->left))
+                return makeNode(makeNode(std::move(left), right->left), right->right);
+            return makeNode(makeNode(std::move(left), right->left->left), makeNode(right->left->right, right->right));
+        }
+        return makeNode(std::move(left), std::move(right));
+    }
+
+    //Concatenation of two balanced trees, O(difference of their heights)
+    static NodePtr join(NodePtr left, NodePtr right)
+    {
+        if(!left)
+            return right;
+        if(!right)
+            return left;
+        if(left->height > right->height + 1)
+            return balance(left->left, join(left->right, std::move(right)));
+        if(right->height > left->height + 1)
+            return balance(join(std::move(left), right->left), right->right);
+        return makeNode(std::move(left), std::move(right));
+    }
+
+    //[0, pos) and [pos, size) of node, a piece cut in two keeps sharing its buffer
+    static std::pair<NodePtr, NodePtr> split(NodePtr node, size_type pos)
+    {
+        if(!node || pos >= node->size)
+            return {std::move(node), nullptr};
+        if(pos == 0)
+            return {nullptr, std::move(node)};
+        if(node->height == 0)
+            return {makeLeaf(node->chars, pos), makeLeaf(std::shared_ptr<const char>(node->chars, node->chars.get() + pos), node->size - pos)};
+        const auto leftSize = node->left->size;
+        if(pos < leftSize)
+        {
+            auto [head, tail] = split(node->left, pos);
+            return {std::move(head), join(std::move(tail), node->right)};
+        }
+        auto [head, tail] = split(node->right, pos - leftSize);
+        return {join(node->left, std::move(head)), std::move(tail)};
+    }
+
+    static const Node* firstLeaf(const Node* node) noexcept
+    {
+        while(node->height)
+            node = node->left.get();
+        return node;
+    }
+
+    static const Node* lastLeaf(const Node* node) noexcept
+    {
+        while(node->height)
+            node = node->right.get();
+        return node;
+    }
+
+    static bool sameBuffer(const Node* lhs, const Node* rhs) noexcept
+    {
+        return !lhs->chars.owner_before(rhs->chars) && !rhs->chars.owner_before(lhs->chars);
+    }
+
+    //join that keeps the number of pieces down: the pieces meeting at the seam become one when they are
+    //neighbours in the same buffer (an erase put back, a substr appended to what it came from) or small
+    static NodePtr concat(NodePtr left, NodePtr right)
+    {
+        if(!left)
+            return right;
+        if(!right)
+            return left;
+        const auto* last = lastLeaf(left.get());
+        const auto* first = firstLeaf(right.get());
+        NodePtr merged;
+        if(last->chars.get() + last->size == first->chars.get() && sameBuffer(last, first))
+            merged = makeLeaf(last->chars, last->size + first->size);
+        else if(last->size + first->size <= merge_limit)
+            merged = copyPiece({last->chars.get(), last->size}, {first->chars.get(), first->size});
+        else
+            return join(std::move(left), std::move(right));
+        const auto leftSize = left->size - last->size;
+        const auto firstSize = first->size;
+        return join(join(split(std::move(left), leftSize).first, std::move(merged)), split(std::move(right), firstSize).second);
+    }
+
+    //Leaf holding pos and the position of its first char, pos < size
+    static std::pair<const Node*, size_type> leafAt(const Node* node, size_type pos) noexcept
+    {
+        size_type start = 0;
+        while(node->height)
+        {
+            if(pos - start < node->left->size)
+                node = node->left.get();
+            else
+            {
+                start += node->left->size;
+                node = node->right.get();
+            }
+        }
+        return {node, start};
+    }
+
+    static size_type pieceCount(const Node* node) noexcept
+    {
+        if(!node)
+            return 0;
+        return node->height ? pieceCount(node->left.get()) + pieceCount(node->right.get()) : 1;
+    }
+
+    //Calls f with the parts of the pieces covering [first, last) of node, in order, until f returns false
+    template<typename F>
+    static bool visitPieces(const Node* node, size_type first, size_type last, F&& f)
+    {
+        if(!node || first >= last)
+            return true;
+        if(node->height == 0)
+            return f(std::string_view(node->chars.get() + first, last - first));
+        const auto leftSize = node->left->size;
+        if(first < leftSize && !visitPieces(node->left.get(), first, std::min(last, leftSize), f))
+            return false;
+        if(last > leftSize)
+            return visitPieces(node->right.get(), first > leftSize ? first - leftSize : 0, last - leftSize, f);
+        return true;
+    }
+
+    //Same from the back
+    template<typename F>
+    static bool visitPiecesBackward(const Node* node, size_type first, size_type last, F&& f)
+    {
+        if(!node || first >= last)
+            return true;
+        if(node->height == 0)
+            return f(std::string_view(node->chars.get() + first, last - first));
+        const auto leftSize = node->left->size;
+        if(last > leftSize && !visitPiecesBackward(node->right.get(), first > leftSize ? first - leftSize : 0, last - leftSize, f))
+            return false;
+        if(first < leftSize)
+            return visitPiecesBackward(node->left.get(), first, std::min(last, leftSize), f);
+        return true;
+    }
+
+    //seam becomes the last count chars of seam followed by piece
+    static void keepTail(std::string& seam, std::string_view piece, size_type count)
+    {
+        if(piece.size() >= count)
+            seam.assign(piece.substr(piece.size() - count));
+        else
+        {
+            seam.append(piece);
+            seam.erase(0, seam.size() - std::min(seam.size(), count));
+        }
+    }
+
+    //seam becomes the first count chars of piece followed by seam
+    static void keepHead(std::string& seam, std::string_view piece, size_type count)
+    {
+        if(piece.size() >= count)
+            seam.assign(piece.substr(0, count));
+        else
+        {
+            seam.insert(0, piece);
+            seam.resize(std::min(seam.size(), count));
+        }
+    }
+
+    NodePtr mRoot;
+};
+
+inline bool operator==(const rope& lhs, const rope& rhs) { return lhs.size() == rhs.size() && lhs.compare(rhs) == 0; }
+inline bool operator==(const rope& lhs, std::string_view rhs) { return lhs.size() == rhs.size() && lhs.compare(rhs) == 0; }
+inline std::strong_ordering operator<=>(const rope& lhs, const rope& rhs) { return lhs.compare(rhs) <=> 0; }
+inline std::strong_ordering operator<=>(const rope& lhs, std::string_view rhs) { return lhs.compare(rhs) <=> 0; }
+
+inline void swap(rope& lhs, rope& rhs) noexcept { lhs.swap(rhs); }
+
+inline std::ostream& operator<<(std::ostream& os, const rope& str)
+{
+    str.for_each_piece([&os](std::string_view piece) { os.write(piece.data(), static_cast<std::streamsize>(piece.size())); });
+    return os;
+}
+
+}
@@ -0,0 +1,385 @@
+//Zero copy splitting of a buffer into std::string_view pieces at any char of a delimiter set.
+//split(text, delimiters) is the find_first_of loop as a lazy range: every delimiter ends a piece, so n
+//delimiters give n + 1 pieces, empty ones included. tokenize(text, delimiters) is the
+//find_first_not_of/find_first_of loop: runs of delimiters are skipped and only the non empty tokens come out.
+//The delimiter_set keeps its chars in a 256 bit lookup table and classifies the text 64 bytes at a time into
+//a bit mask of delimiter positions: with AVX2 any set takes two nibble table lookups per 32 bytes, with SSE2
+//small sets are compared member by member, bigger ones (and every set without SIMD) go through the table.
+//The iterators keep the mask of the current block, so short pieces cost a bit scan instead of a new search.
+//With an execution policy the pieces are collected into a std::vector, the parallel policies cut the text
+//at delimiters into one chunk per thread and split the chunks on worker threads.
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <execution>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Algorithms/ParallelChunks.h"
+#include "Algorithms/SimdDispatch.h"
+
+#if PRACTISE_SIMD_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace practise
+{
+
+namespace detail
+{
+    //Chars classified per step, one bit each in a std::uint64_t
+    inline constexpr std::size_t delimiterBlock = 64;
+
+    //Sets up to this size are compared member by member with SSE2, bigger ones use the lookup table
+    inline constexpr std::size_t sse2SetSize = 8;
+
+    //Chars per chunk: the scan runs at memory speed and every chunk collects its pieces in a vector of its
+    //own, so chunks are much longer than the minParallelChunk of the Algorithms headers
+    inline constexpr std::size_t minParallelSplitChunk = 1 << 20;
+
+    struct DelimiterTables
+    {
+        //Bit c set when char c is a delimiter
+        std::array<std::uint64_t, 4> bits{};
+        //Bit h of lowRows[l] (highRows[l]) set when the char with low nibble l and high nibble h (h + 8) is a delimiter
+        alignas(16) std::array<unsigned char, 16> lowRows{};
+        alignas(16) std::array<unsigned char, 16> highRows{};
+        std::array<char, sse2SetSize> members{};
+        std::size_t memberCount = 0;
+
+        bool contains(char c) const noexcept
+        {
+            const auto byte = static_cast<unsigned char>(c);
+            return (bits[byte >> 6] >> (byte & 63)) & 1;
+        }
+    };
+
+    using ClassifyBlock = std::uint64_t (*)(const char* block, const DelimiterTables& tables);
+
+    //Bit i set when block[i] is a delimiter
+    inline std::uint64_t classifyScalar(const char* block, const DelimiterTables& tables)
+    {
+        std::uint64_t mask = 0;
+        for(std::size_t i = 0; i < delimiterBlock; ++i)
+            mask |= std::uint64_t{tables.contains(block[i])} << i;
+        return mask;
+    }
+
+#if PRACTISE_SIMD_DISPATCH
+    inline std::uint64_t classifySse2(const char* block, const DelimiterTables& tables)
+    {
+        __m128i members[sse2SetSize];
+        for(std::size_t k = 0; k < tables.memberCount; ++k)
+            members[k] = _mm_set1_epi8(tables.members[k]);
+        std::uint64_t mask = 0;
+        for(std::size_t part = 0; part < delimiterBlock / 16; ++part)
+        {
+            const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + part * 16));
+            auto hits = _mm_setzero_si128();
+            for(std::size_t k = 0; k < tables.memberCount; ++k)
+                hits = _mm_or_si128(hits, _mm_cmpeq_epi8(bytes, members[k]));
+            mask |= static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(hits))) << (part * 16);
+        }
+        return mask;
+    }
+
+    //The row of the low nibble holds one bit per high nibble, the high nibble picks the row half and the bit
+    [[gnu::target("avx2")]] inline std::uint32_t classifyAvx2Part(const char* part, __m256i lowRows, __m256i highRows)
+    {
+        const auto bitOfHigh = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+                                                1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+        const auto nibble = _mm256_set1_epi8(0x0F);
+        const auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(part));
+        const auto low = _mm256_and_si256(bytes, nibble);
+        const auto high = _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibble);
+        //blendv looks at the top bit of each byte, high << 4 moves bit 3 (high nibble >= 8) there
+        const auto row = _mm256_blendv_epi8(_mm256_shuffle_epi8(lowRows, low), _mm256_shuffle_epi8(highRows, low),
+                                            _mm256_slli_epi16(high, 4));
+        const auto hits = _mm256_and_si256(row, _mm256_shuffle_epi8(bitOfHigh, high));
+        return ~static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hits, _mm256_setzero_si256())));
+    }
+
+    [[gnu::target("avx2")]] inline std::uint64_t classifyAvx2(const char* block, const DelimiterTables& tables)
+    {
+        const auto lowRows = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(tables.lowRows.data())));
+        const auto highRows = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(tables.highRows.data())));
+        return classifyAvx2Part(block, lowRows, highRows)
+             | static_cast<std::uint64_t>(classifyAvx2Part(block + 32, lowRows, highRows)) << 32;
+    }
+#endif
+}
+
+//Set of delimiter chars and the block classifier picked for it
+class delimiter_set
+{
+public:
+    explicit delimiter_set(std::string_view chars) : delimiter_set(chars, detail::simdLevel()) {}
+
+    //Nibble lookups with AVX2, member compares with SSE2 for sets of up to detail::sse2SetSize chars, the lookup
+    //table otherwise
+    delimiter_set(std::string_view chars, detail::SimdLevel level)
+    {
+        for(auto c : chars)
+        {
+            const auto byte = static_cast<unsigned char>(c);
+            if(mTables.contains(c))
+                continue;
+            mTables.bits[byte >> 6] |= std::uint64_t{1} << (byte & 63);
+            auto& rows = byte < 0x80 ? mTables.lowRows : mTables.highRows;
+            rows[byte & 0x0F] |= static_cast<unsigned char>(1u << ((byte >> 4) & 7));
+            if(mTables.memberCount < detail::sse2SetSize)
+                mTables.members[mTables.memberCount] = c;
+            ++mTables.memberCount;
+        }
+#if PRACTISE_SIMD_DISPATCH
+        if(level >= detail::SimdLevel::avx2)
+            mClassify = detail::classifyAvx2;
+        else if(level == detail::SimdLevel::sse2 && mTables.memberCount <= detail::sse2SetSize)
+            mClassify = detail::classifySse2;
+#else
+        (void)level;
+#endif
+    }
+
+    explicit delimiter_set(char c) : delimiter_set(std::string_view(&c, 1)) {}
+
+    bool contains(char c) const noexcept { return mTables.contains(c); }
+
+    //Bit i set when block[i] is a delimiter, block holds 64 chars
+    std::uint64_t classify(const char* block) const { return mClassify(block, mTables); }
+
+    //Same for the last count < 64 chars of a buffer, the bits past count are clear
+    std::uint64_t classify(const char* chars, std::size_t count) const
+    {
+        char block[detail::delimiterBlock]{};
+        std::memcpy(block, chars, count);
+        return classify(block) & ((std::uint64_t{1} << count) - 1);
+    }
+
+    //Index of the first char in [pos, text.size()) that is a delimiter (IsDelimiter) or not one, text.size()
+    //when there is none
+    template<bool IsDelimiter = true>
+    std::size_t find(std::string_view text, std::size_t pos = 0) const
+    {
+        std::uint64_t mask = 0;
+        std::size_t block = std::string_view::npos;
+        return find<IsDelimiter>(text, pos, block, mask);
+    }
+
+private:
+    template<bool Trim>
+    friend class basic_split_view;
+
+    //find with the mask of the last block classified, reused while pos stays inside it
+    template<bool IsDelimiter>
+    std::size_t find(std::string_view text, std::size_t pos, std::size_t& block, std::uint64_t& mask) const
+    {
+        while(pos < text.size())
+        {
+            const auto start = pos - pos % detail::delimiterBlock;
+            const auto count = std::min(detail::delimiterBlock, text.size() - start);
+            if(start != block)
+            {
+                mask = count == detail::delimiterBlock ? classify(text.data() + start) : classify(text.data() + start, count);
+                block = start;
+            }
+            auto wanted = IsDelimiter ? mask : ~mask;
+            if(count < detail::delimiterBlock)
+                wanted &= (std::uint64_t{1} << count) - 1;
+            wanted >>= pos - start;
+            if(wanted)
+                return pos + static_cast<std::size_t>(std::countr_zero(wanted));
+            pos = start + detail::delimiterBlock;
+        }
+        return text.size();
+    }
+
+    detail::DelimiterTables mTables;
+    detail::ClassifyBlock mClassify = detail::classifyScalar;
+};
+
+//Pieces of text between the delimiters, Trim skips the empty ones (tokenize)
+template<bool Trim>
+class basic_split_view : public std::ranges::view_interface<basic_split_view<Trim>>
+{
+public:
+    class iterator
+    {
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::string_view;
+
+        iterator() = default;
+
+        std::string_view operator*() const { return mParent->mText.substr(mBegin, mEnd - mBegin); }
+
+        iterator& operator++()
+        {
+            const auto text = mParent->mText;
+            if(mEnd == text.size())
+                mBegin = mEnd = done;
+            else if constexpr(Trim)
+                seek(nextOf<false>(mEnd + 1));
+            else
+                seek(mEnd + 1);
+            return *this;
+        }
+
+        iterator operator++(int) { auto old = *this; ++*this; return old; }
+
+        friend bool operator==(const iterator& lhs, const iterator& rhs) { return lhs.mBegin == rhs.mBegin; }
+
+    private:
+        friend class basic_split_view;
+
+        static constexpr std::size_t done = std::string_view::npos;
+
+        //Piece starting at begin, tokenize has no piece left once begin reaches the end of the text
+        void seek(std::size_t begin)
+        {
+            if(Trim && begin == mParent->mText.size())
+            {
+                mBegin = mEnd = done;
+                return;
+            }
+            mBegin = begin;
+            mEnd = nextOf<true>(begin);
+        }
+
+        template<bool IsDelimiter>
+        std::size_t nextOf(std::size_t pos)
+        {
+            return mParent->mDelimiters.template find<IsDelimiter>(mParent->mText, pos, mBlock, mMask);
+        }
+
+        const basic_split_view* mParent = nullptr;
+        std::size_t mBegin = done;
+        std::size_t mEnd = done;
+        std::size_t mBlock = done;
+        std::uint64_t mMask = 0;
+    };
+
+    basic_split_view() = default;
+    basic_split_view(std::string_view text, delimiter_set delimiters) : mText(text), mDelimiters(delimiters) {}
+
+    iterator begin() const
+    {
+        iterator it;
+        it.mParent = this;
+        if constexpr(Trim)
+            it.seek(it.template nextOf<false>(0));
+        else
+            it.seek(0);
+        return it;
+    }
+
+    iterator end() const
+    {
+        iterator it;
+        it.mParent = this;
+        return it;
+    }
+
+    std::string_view text() const noexcept { return mText; }
+
+private:
+    std::string_view mText;
+    delimiter_set mDelimiters{std::string_view()};
+};
+
+using split_view = basic_split_view<false>;
+using token_view = basic_split_view<true>;
+
+inline split_view split(std::string_view text, std::string_view delimiters) { return {text, delimiter_set(delimiters)}; }
+inline split_view split(std::string_view text, char delimiter) { return {text, delimiter_set(delimiter)}; }
+inline split_view split(std::string_view text, const delimiter_set& delimiters) { return {text, delimiters}; }
+
+inline token_view tokenize(std::string_view text, std::string_view delimiters = " \t\n\v\f\r") { return {text, delimiter_set(delimiters)}; }
+inline token_view tokenize(std::string_view text, const delimiter_set& delimiters) { return {text, delimiters}; }
+
+namespace detail
+{
+    template<bool Trim>
+    std::vector<std::string_view> collectPieces(std::string_view text, const delimiter_set& delimiters)
+    {
+        const basic_split_view<Trim> pieces(text, delimiters);
+        return {pieces.begin(), pieces.end()};
+    }
+
+    //Cuts text into threadCount chunks that each end right after a delimiter (the last one at the end of the
+    //text), so no piece crosses a chunk, and splits them on worker threads
+    template<bool Trim>
+    std::vector<std::string_view> parallelPieces(std::string_view text, const delimiter_set& delimiters, unsigned threadCount)
+    {
+        const Chunks chunks(text.size(), minParallelSplitChunk, threadCount);
+        if(chunks.count == 1)
+            return collectPieces<Trim>(text, delimiters);
+
+        std::vector<std::size_t> bounds(chunks.count + 1, text.size());
+        bounds[0] = 0;
+        for(std::size_t chunk = 1; chunk < chunks.count; ++chunk)
+        {
+            const auto delimiter = delimiters.find(text, std::max(bounds[chunk - 1], chunks.first(chunk)));
+            bounds[chunk] = delimiter == text.size() ? delimiter : delimiter + 1;
+        }
+
+        //A chunk ending before the end of the text ends with a delimiter, split gives it an empty last piece
+        //which is not one of the text. Chunks left empty once the delimiters ran out hold no piece.
+        std::vector<std::vector<std::string_view>> chunkPieces(chunks.count);
+        auto splitChunk = [&](std::size_t chunk)
+        {
+            if(bounds[chunk] == bounds[chunk + 1])
+                return;
+            auto& pieces = chunkPieces[chunk];
+            pieces = collectPieces<Trim>(text.substr(bounds[chunk], bounds[chunk + 1] - bounds[chunk]), delimiters);
+            if(!Trim && bounds[chunk + 1] != text.size())
+                pieces.pop_back();
+        };
+        runChunks(chunks.count, splitChunk);
+
+        auto pieces = std::move(chunkPieces[0]);
+        for(std::size_t chunk = 1; chunk < chunks.count; ++chunk)
+            pieces.insert(pieces.end(), chunkPieces[chunk].begin(), chunkPieces[chunk].end());
+        return pieces;
+    }
+}
+
+//Parallel mode as in Algorithms/ParallelChunks.h, chunks of at least detail::minParallelSplitChunk chars
+inline std::vector<std::string_view> parallel_split(std::string_view text, const delimiter_set& delimiters, unsigned threadCount)
+{
+    return detail::parallelPieces<false>(text, delimiters, threadCount);
+}
+
+inline std::vector<std::string_view> parallel_tokenize(std::string_view text, const delimiter_set& delimiters, unsigned threadCount)
+{
+    return detail::parallelPieces<true>(text, delimiters, threadCount);
+}
+
+//Execution policy front ends, seq and unseq collect the lazy range
+template<typename Policy>
+    requires std::is_execution_policy_v<std::remove_cvref_t<Policy>>
+std::vector<std::string_view> split(Policy&&, std::string_view text, const delimiter_set& delimiters)
+{
+    return parallel_split(text, delimiters, detail::policyThreads<Policy>());
+}
+
+template<typename Policy>
+    requires std::is_execution_policy_v<std::remove_cvref_t<Policy>>
+std::vector<std::string_view> tokenize(Policy&&, std::string_view text, const delimiter_set& delimiters)
+{
+    return parallel_tokenize(text, delimiters, detail::policyThreads<Policy>());
+}
+
+}
@@ -0,0 +1,391 @@
+//Vectorized search over contiguous chars with the semantics of the std::string find family
+//(find, rfind, find_first_of, find_first_not_of, find_last_of, find_last_not_of) as free functions on
+//std::string_view. Substrings use the first-and-last-byte filter: a block of candidate positions is compared
+//against the first and the last byte of the needle at once (SSE2 16 / AVX2 32 positions per step) and only
+//positions where both bytes match are verified with memcmp. Long needles, and every needle when SIMD is
+//not available, go through Boyer-Moore-Horspool which skips up to the needle length per step.
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace practise
+{
+
+inline constexpr std::size_t npos = std::string_view::npos;
+
+namespace detail
+{
+#if defined(__AVX2__)
+    struct ByteBlock
+    {
+        static constexpr std::size_t width = 32;
+
+        static ByteBlock load(const char* pos) { return {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pos))}; }
+        static ByteBlock splat(char c) { return {_mm256_set1_epi8(c)}; }
+
+        std::uint32_t eq(ByteBlock other) const
+        {
+            return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(mBytes, other.mBytes)));
+        }
+
+        __m256i mBytes;
+    };
+#elif defined(__SSE2__)
+    struct ByteBlock
+    {
+        static constexpr std::size_t width = 16;
+
+        static ByteBlock load(const char* pos) { return {_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))}; }
+        static ByteBlock splat(char c) { return {_mm_set1_epi8(c)}; }
+
+        std::uint32_t eq(ByteBlock other) const
+        {
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(mBytes, other.mBytes)));
+        }
+
+        __m128i mBytes;
+    };
+#endif
+
+#if defined(__AVX2__) || defined(__SSE2__)
+    inline constexpr bool simdSearch = true;
+    inline constexpr std::uint32_t fullMask = static_cast<std::uint32_t>((std::uint64_t{1} << ByteBlock::width) - 1);
+#else
+    inline constexpr bool simdSearch = false;
+#endif
+
+    //From this needle length on Horspool skips far enough per step to beat the byte filter
+    inline constexpr std::size_t horspoolMinLength = 128;
+
+    //Sets up to this size are matched with one compare per member and block, bigger ones with a lookup table
+    inline constexpr std::size_t simdSetSize = 4;
+
+    inline std::size_t highestBit(std::uint32_t mask) { return 31 - static_cast<std::size_t>(std::countl_zero(mask)); }
+
+    //Skip tables of Boyer-Moore-Horspool, indexed by the byte under the last (forward) or first (reverse) window position
+    using SkipTable = std::array<std::size_t, 256>;
+
+    inline SkipTable forwardSkips(const char* needle, std::size_t m)
+    {
+        SkipTable skips;
+        skips.fill(m);
+        for(std::size_t j = 0; j + 1 < m; ++j)
+            skips[static_cast<unsigned char>(needle[j])] = m - 1 - j;
+        return skips;
+    }
+
+    inline SkipTable reverseSkips(const char* needle, std::size_t m)
+    {
+        SkipTable skips;
+        skips.fill(m);
+        for(std::size_t j = m - 1; j >= 1; --j)
+            skips[static_cast<unsigned char>(needle[j])] = j;
+        return skips;
+    }
+
+    //First start in [pos, n - m] where the needle (m >= 2) matches
+    inline std::size_t findHorspool(const char* hay, std::size_t n, const char* needle, std::size_t m,
+                                    std::size_t pos, const SkipTable& skips)
+    {
+        const char last = needle[m - 1];
+        for(std::size_t s = pos; s + m <= n;)
+        {
+            const char c = hay[s + m - 1];
+            if(c == last && std::memcmp(hay + s, needle, m - 1) == 0)
+                return s;
+            s += skips[static_cast<unsigned char>(c)];
+        }
+        return npos;
+    }
+
+    //Last start in [0, lastStart] where the needle (m >= 2) matches, the window is shifted by its first byte
+    inline std::size_t rfindHorspool(const char* hay, const char* needle, std::size_t m,
+                                     std::size_t lastStart, const SkipTable& skips)
+    {
+        const char first = needle[0];
+        for(std::size_t s = lastStart;;)
+        {
+            const char c = hay[s];
+            if(c == first && std::memcmp(hay + s + 1, needle + 1, m - 1) == 0)
+                return s;
+            const auto skip = skips[static_cast<unsigned char>(c)];
+            if(s < skip)
+                return npos;
+            s -= skip;
+        }
+    }
+
+    inline std::size_t findScalar(const char* hay, std::size_t n, const char* needle, std::size_t m, std::size_t pos)
+    {
+        for(std::size_t s = pos; s + m <= n; ++s)
+        {
+            auto hit = static_cast<const char*>(std::memchr(hay + s, needle[0], n - m + 1 - s));
+            if(!hit)
+                return npos;
+            s = static_cast<std::size_t>(hit - hay);
+            if(std::memcmp(hit + 1, needle + 1, m - 1) == 0)
+                return s;
+        }
+        return npos;
+    }
+
+    inline std::size_t rfindScalar(const char* hay, const char* needle, std::size_t m, std::size_t firstStart, std::size_t endStart)
+    {
+        for(std::size_t s = endStart; s-- > firstStart;)
+            if(hay[s] == needle[0] && std::memcmp(hay + s + 1, needle + 1, m - 1) == 0)
+                return s;
+        return npos;
+    }
+
+#if defined(__AVX2__) || defined(__SSE2__)
+    inline std::size_t findFirstLast(const char* hay, std::size_t n, const char* needle, std::size_t m, std::size_t pos)
+    {
+        constexpr auto width = ByteBlock::width;
+        const auto first = ByteBlock::splat(needle[0]);
+        const auto last = ByteBlock::splat(needle[m - 1]);
+        std::size_t s = pos;
+        for(; s + m - 1 + width <= n; s += width)
+        {
+            auto mask = ByteBlock::load(hay + s).eq(first) & ByteBlock::load(hay + s + m - 1).eq(last);
+            for(; mask; mask &= mask - 1)
+            {
+                const auto candidate = s + static_cast<std::size_t>(std::countr_zero(mask));
+                if(std::memcmp(hay + candidate + 1, needle + 1, m - 2) == 0)
+                    return candidate;
+            }
+        }
+        return findScalar(hay, n, needle, m, s);
+    }
+
+    inline std::size_t rfindFirstLast(const char* hay, const char* needle, std::size_t m, std::size_t lastStart)
+    {
+        constexpr auto width = ByteBlock::width;
+        const auto first = ByteBlock::splat(needle[0]);
+        const auto last = ByteBlock::splat(needle[m - 1]);
+        //Blocks cover the starts [end - width, end), walking down from the last allowed start
+        std::size_t end = lastStart + 1;
+        for(; end >= width; end -= width)
+        {
+            const auto s = end - width;
+            auto mask = ByteBlock::load(hay + s).eq(first) & ByteBlock::load(hay + s + m - 1).eq(last);
+            while(mask)
+            {
+                const auto bit = highestBit(mask);
+                if(std::memcmp(hay + s + bit + 1, needle + 1, m - 2) == 0)
+                    return s + bit;
+                mask &= ~(std::uint32_t{1} << bit);
+            }
+        }
+        return rfindScalar(hay, needle, m, 0, end);
+    }
+#endif
+
+    //256 entry membership table of a character set
+    class CharSet
+    {
+    public:
+        explicit CharSet(std::string_view chars)
+        {
+            for(auto c : chars)
+                mMembers[static_cast<unsigned char>(c)] = true;
+        }
+
+        bool contains(char c) const { return mMembers[static_cast<unsigned char>(c)]; }
+
+    private:
+        std::array<bool, 256> mMembers{};
+    };
+
+    //First index in [pos, n) whose membership in chars equals Member
+    template<bool Member>
+    std::size_t findOf(const char* hay, std::size_t n, std::string_view chars, std::size_t pos)
+    {
+        std::size_t i = pos;
+#if defined(__AVX2__) || defined(__SSE2__)
+        if(chars.size() <= simdSetSize)
+        {
+            std::array<ByteBlock, simdSetSize> members;
+            for(std::size_t k = 0; k < chars.size(); ++k)
+                members[k] = ByteBlock::splat(chars[k]);
+            for(; i + ByteBlock::width <= n; i += ByteBlock::width)
+            {
+                const auto block = ByteBlock::load(hay + i);
+                std::uint32_t mask = 0;
+                for(std::size_t k = 0; k < chars.size(); ++k)
+                    mask |= block.eq(members[k]);
+                if constexpr(!Member)
+                    mask = ~mask & fullMask;
+                if(mask)
+                    return i + static_cast<std::size_t>(std::countr_zero(mask));
+            }
+        }
+#endif
+        const CharSet set(chars);
+        for(; i < n; ++i)
+            if(set.contains(hay[i]) == Member)
+                return i;
+        return npos;
+    }
+
+    //Last index in [0, last] whose membership in chars equals Member
+    template<bool Member>
+    std::size_t findLastOf(const char* hay, std::string_view chars, std::size_t last)
+    {
+        std::size_t end = last + 1;
+#if defined(__AVX2__) || defined(__SSE2__)
+        if(chars.size() <= simdSetSize)
+        {
+            std::array<ByteBlock, simdSetSize> members;
+            for(std::size_t k = 0; k < chars.size(); ++k)
+                members[k] = ByteBlock::splat(chars[k]);
+            for(; end >= ByteBlock::width; end -= ByteBlock::width)
+            {
+                const auto block = ByteBlock::load(hay + end - ByteBlock::width);
+                std::uint32_t mask = 0;
+                for(std::size_t k = 0; k < chars.size(); ++k)
+                    mask |= block.eq(members[k]);
+                if constexpr(!Member)
+                    mask = ~mask & fullMask;
+                if(mask)
+                    return end - ByteBlock::width + highestBit(mask);
+            }
+        }
+#endif
+        const CharSet set(chars);
+        while(end-- > 0)
+            if(set.contains(hay[end]) == Member)
+                return end;
+        return npos;
+    }
+}
+
+//Same results as std::string_view::find(needle, pos)
+inline std::size_t find(std::string_view hay, std::string_view needle, std::size_t pos = 0)
+{
+    const auto n = hay.size();
+    const auto m = needle.size();
+    if(m == 0)
+        return pos <= n ? pos : npos;
+    if(pos >= n || m > n - pos)
+        return npos;
+    if(m == 1)
+    {
+        auto hit = static_cast<const char*>(std::memchr(hay.data() + pos, needle[0], n - pos));
+        return hit ? static_cast<std::size_t>(hit - hay.data()) : npos;
+    }
+    if(!detail::simdSearch || m >= detail::horspoolMinLength)
+        return detail::findHorspool(hay.data(), n, needle.data(), m, pos, detail::forwardSkips(needle.data(), m));
+#if defined(__AVX2__) || defined(__SSE2__)
+    return detail::findFirstLast(hay.data(), n, needle.data(), m, pos);
+#else
+    return npos;
+#endif
+}
+
+inline std::size_t find(std::string_view hay, char c, std::size_t pos = 0)
+{
+    return find(hay, std::string_view(&c, 1), pos);
+}
+
+//Same results as std::string_view::rfind(needle, pos), pos is the last start position considered
+inline std::size_t rfind(std::string_view hay, std::string_view needle, std::size_t pos = npos)
+{
+    const auto n = hay.size();
+    const auto m = needle.size();
+    if(m > n)
+        return npos;
+    const auto lastStart = std::min(pos, n - m);
+    if(m == 0)
+        return lastStart;
+    if(m == 1)
+        return detail::findLastOf<true>(hay.data(), needle, lastStart);
+    if(!detail::simdSearch || m >= detail::horspoolMinLength)
+        return detail::rfindHorspool(hay.data(), needle.data(), m, lastStart, detail::reverseSkips(needle.data(), m));
+#if defined(__AVX2__) || defined(__SSE2__)
+    return detail::rfindFirstLast(hay.data(), needle.data(), m, lastStart);
+#else
+    return npos;
+#endif
+}
+
+inline std::size_t rfind(std::string_view hay, char c, std::size_t pos = npos)
+{
+    return rfind(hay, std::string_view(&c, 1), pos);
+}
+
+inline std::size_t find_first_of(std::string_view hay, std::string_view chars, std::size_t pos = 0)
+{
+    if(chars.empty() || pos >= hay.size())
+        return npos;
+    return detail::findOf<true>(hay.data(), hay.size(), chars, pos);
+}
+
+inline std::size_t find_first_not_of(std::string_view hay, std::string_view chars, std::size_t pos = 0)
+{
+    if(pos >= hay.size())
+        return npos;
+    return detail::findOf<false>(hay.data(), hay.size(), chars, pos);
+}
+
+inline std::size_t find_last_of(std::string_view hay, std::string_view chars, std::size_t pos = npos)
+{
+    if(chars.empty() || hay.empty())
+        return npos;
+    return detail::findLastOf<true>(hay.data(), chars, std::min(pos, hay.size() - 1));
+}
+
+inline std::size_t find_last_not_of(std::string_view hay, std::string_view chars, std::size_t pos = npos)
+{
+    if(hay.empty())
+        return npos;
+    return detail::findLastOf<false>(hay.data(), chars, std::min(pos, hay.size() - 1));
+}
+
+//Searcher for std::search(first, last, searcher) over contiguous chars, like std::boyer_moore_horspool_searcher.
+//The needle is not copied and has to outlive the searcher.
+class string_searcher
+{
+public:
+    explicit string_searcher(std::string_view needle) : mNeedle(needle)
+    {
+        if(mNeedle.size() >= 2 && (!detail::simdSearch || mNeedle.size() >= detail::horspoolMinLength))
+            mSkips = detail::forwardSkips(mNeedle.data(), mNeedle.size());
+    }
+
+    template<std::contiguous_iterator It>
+    string_searcher(It first, It last) : string_searcher(std::string_view(std::to_address(first), static_cast<std::size_t>(last - first))) {}
+
+    template<std::contiguous_iterator It>
+    std::pair<It, It> operator()(It first, It last) const
+    {
+        const std::string_view hay(std::to_address(first), static_cast<std::size_t>(last - first));
+        const auto m = mNeedle.size();
+        std::size_t pos;
+        if(m >= 2 && m <= hay.size() && (!detail::simdSearch || m >= detail::horspoolMinLength))
+            pos = detail::findHorspool(hay.data(), hay.size(), mNeedle.data(), m, 0, mSkips);
+        else
+            pos = find(hay, mNeedle);
+        if(pos == npos)
+            return {last, last};
+        return {first + static_cast<std::ptrdiff_t>(pos), first + static_cast<std::ptrdiff_t>(pos + m)};
+    }
+
+private:
+    std::string_view mNeedle;
+    detail::SkipTable mSkips{};
+};
+
+}
@@ -0,0 +1,306 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Rope.h"
+
+using practise::rope;
+
+static_assert(std::random_access_iterator<rope::const_iterator>);
+
+//Text cut into pieces of pieceSize chars, each one a separate buffer. Small neighbouring pieces are merged, so
+//every other piece is merge_limit chars long
+static rope makePieces(const std::string& text, std::size_t pieceSize)
+{
+    rope str;
+    for(std::size_t pos = 0, piece = 0; pos < text.size(); pos += piece)
+    {
+        piece = str.piece_count() % 2 ? rope::merge_limit : pieceSize;
+        str.append(rope(text.substr(pos, piece)));
+    }
+    return str;
+}
+
+TEST(Rope, MemberFunctions)
+{
+    rope str;
+    EXPECT_TRUE(str.empty());
+    EXPECT_EQ(str.size(), 0);
+    EXPECT_EQ(str.begin(), str.end());
+    EXPECT_EQ(str.piece_count(), 0);
+
+    rope str1("Hello World");
+    EXPECT_EQ(str1.size(), 11);
+    EXPECT_EQ(str1, "Hello World");
+    EXPECT_EQ(str1.piece_count(), 1);
+
+    rope str2(3, 'a');
+    EXPECT_EQ(str2, "aaa");
+
+    const std::string text = "from a string";
+    rope str3(text.begin(), text.end());
+    EXPECT_EQ(str3.str(), text);
+
+    rope str4(std::string("moved in"));
+    EXPECT_EQ(str4, "moved in");
+
+    //Copies share the tree, edits to one leave the other alone
+    rope str5(str1);
+    str5.insert(5, ",");
+    EXPECT_EQ(str5, "Hello, World");
+    EXPECT_EQ(str1, "Hello World");
+
+    rope str6(std::move(str5));
+    EXPECT_EQ(str6, "Hello, World");
+
+    str = str6;
+    EXPECT_EQ(str, str6);
+    str6.clear();
+    EXPECT_TRUE(str6.empty());
+    EXPECT_EQ(str, "Hello, World");
+
+    swap(str, str6);
+    EXPECT_TRUE(str.empty());
+    EXPECT_EQ(str6, "Hello, World");
+}
+
+TEST(Rope, ElementAccess)
+{
+    std::string text;
+    for(int line = 0; line < 40; ++line)
+        text += "the quick brown fox jumps over the lazy dog ";
+    text.pop_back();
+    auto str = makePieces(text, 5);
+    EXPECT_EQ(str.piece_count(), 7);
+    for(std::size_t pos = 0; pos < text.size(); ++pos)
+    {
+        EXPECT_EQ(str[pos], text[pos]);
+        EXPECT_EQ(str.at(pos), text[pos]);
+    }
+    EXPECT_EQ(str.front(), 't');
+    EXPECT_EQ(str.back(), 'g');
+    EXPECT_THROW(str.at(text.size()), std::out_of_range);
+
+    EXPECT_TRUE(std::equal(str.begin(), str.end(), text.begin(), text.end()));
+    EXPECT_TRUE(std::equal(str.rbegin(), str.rend(), text.rbegin(), text.rend()));
+    EXPECT_EQ(str.end() - str.begin(), static_cast<std::ptrdiff_t>(text.size()));
+    EXPECT_EQ(str.begin()[12], text[12]);
+    EXPECT_EQ(*(str.end() - 3), 'd');
+    EXPECT_EQ(std::string(str.begin() + 4, str.begin() + 9), "quick");
+    EXPECT_EQ(std::string(str.begin() + 512, str.begin() + 522), text.substr(512, 10));
+    EXPECT_EQ(std::count(str.begin(), str.end(), 'o'), std::count(text.begin(), text.end(), 'o'));
+
+    std::ostringstream os;
+    os << str;
+    EXPECT_EQ(os.str(), text);
+
+    std::string buffer(5, '\0');
+    EXPECT_EQ(str.copy(buffer.data(), 5, 16), 5);
+    EXPECT_EQ(buffer, "fox j");
+    EXPECT_EQ(str.copy(buffer.data(), 5, text.size() - 3), 3);
+    EXPECT_THROW(str.copy(buffer.data(), 5, text.size() + 1), std::out_of_range);
+}
+
+TEST(Rope, Operations)
+{
+    rope str("Hello World");
+    str.insert(5, ",");
+    EXPECT_EQ(str, "Hello, World");
+    str.insert(str.size(), 3, '!');
+    EXPECT_EQ(str, "Hello, World!!!");
+    str.erase(12, 2);
+    EXPECT_EQ(str, "Hello, World!");
+    str.replace(7, 5, "Rope");
+    EXPECT_EQ(str, "Hello, Rope!");
+    str.replace(0, 5, rope("Goodbye"));
+    EXPECT_EQ(str, "Goodbye, Rope!");
+    str.append(" Bye");
+    str += '.';
+    str.push_back('.');
+    EXPECT_EQ(str, "Goodbye, Rope! Bye..");
+    str.pop_back();
+    EXPECT_EQ(str.substr(9, 4), "Rope");
+    EXPECT_EQ(str.substr(15), "Bye.");
+    EXPECT_TRUE(str.substr(str.size()).empty());
+    str.erase(7);
+    EXPECT_EQ(str, "Goodbye");
+    str.erase();
+    EXPECT_TRUE(str.empty());
+
+    //A rope inserted into itself
+    rope twice("abc");
+    twice.insert(1, twice);
+    EXPECT_EQ(twice, "aabcbc");
+    twice.append(twice);
+    EXPECT_EQ(twice, "aabcbcaabcbc");
+
+    EXPECT_THROW(str.insert(1, "x"), std::out_of_range);
+    EXPECT_THROW(str.erase(1), std::out_of_range);
+    EXPECT_THROW(str.replace(1, 1, "x"), std::out_of_range);
+    EXPECT_THROW(str.substr(1), std::out_of_range);
+
+    //Comparisons against ropes split differently and plain strings
+    const std::string text = "comparing ropes piece by piece";
+    EXPECT_EQ(makePieces(text, 3), makePieces(text, 7));
+    EXPECT_EQ(makePieces(text, 3) <=> rope(text), std::strong_ordering::equal);
+    EXPECT_LT(makePieces("abcd", 1), makePieces("abce", 3));
+    EXPECT_GT(makePieces("abcd", 2), rope("abc"));
+    EXPECT_LT(makePieces("abc", 2), rope("abcd"));
+    EXPECT_LT(rope("abc"), std::string_view("abd"));
+    EXPECT_GT(rope("abc"), std::string_view("ab"));
+    EXPECT_NE(rope("abc"), std::string_view("abd"));
+    EXPECT_TRUE(rope(text).starts_with("comparing"));
+    EXPECT_TRUE(makePieces(text, 4).ends_with("by piece"));
+    EXPECT_FALSE(rope("ab").ends_with("abc"));
+    EXPECT_TRUE(makePieces(text, 2).contains("ropes"));
+}
+
+TEST(Rope, MatchesStdString)
+{
+    std::mt19937 gen{5};
+    std::string expected;
+    rope str;
+    for(int step = 0; step < 5000; ++step)
+    {
+        const auto pos = expected.empty() ? 0 : gen() % (expected.size() + 1);
+        const auto count = gen() % 40;
+        const std::string chars(gen() % 300, static_cast<char>('a' + gen() % 26));
+        switch(gen() % 6)
+        {
+            case 0: expected.insert(pos, chars); str.insert(pos, chars); break;
+            case 1: expected.erase(pos, count); str.erase(pos, count); break;
+            case 2: expected.replace(pos, count, chars); str.replace(pos, count, chars); break;
+            case 3: expected.append(chars); str.append(chars); break;
+            case 4:
+            {
+                //Moves a part of the text somewhere else by sharing it
+                const auto part = str.substr(pos, count);
+                const auto moved = expected.substr(pos, count);
+                str.erase(pos, count);
+                expected.erase(pos, count);
+                const auto to = expected.empty() ? 0 : gen() % (expected.size() + 1);
+                str.insert(to, part);
+                expected.insert(to, moved);
+                break;
+            }
+            default: expected.push_back('p'); str.push_back('p'); break;
+        }
+        ASSERT_EQ(str.size(), expected.size()) << "step " << step;
+        ASSERT_EQ(str.str(), expected) << "step " << step;
+    }
+    //The tree stays balanced
+    EXPECT_LE(str.depth(), 2 * std::bit_width(str.piece_count()));
+}
+
+TEST(Rope, PiecesShareBuffers)
+{
+    const std::string text(100000, 'x');
+    rope str(text);
+    const char* buffer = nullptr;
+    str.for_each_piece([&buffer](std::string_view piece) { buffer = piece.data(); });
+
+    //substr and erase only cut the piece, the chars stay in the original buffer
+    const auto sub = str.substr(1000, 50000);
+    EXPECT_EQ(sub.piece_count(), 1);
+    sub.for_each_piece([buffer](std::string_view piece) { EXPECT_EQ(piece.data(), buffer + 1000); });
+
+    str.insert(50000, "inserted");
+    EXPECT_EQ(str.piece_count(), 3);
+    std::vector<const char*> pieces;
+    str.for_each_piece([&pieces](std::string_view piece) { pieces.push_back(piece.data()); });
+    ASSERT_EQ(pieces.size(), 3);
+    EXPECT_EQ(pieces[0], buffer);
+    EXPECT_EQ(pieces[2], buffer + 50000);
+
+    //Taking the insert back out rejoins the neighbouring parts of the buffer into one piece
+    str.erase(50000, 8);
+    EXPECT_EQ(str.piece_count(), 1);
+    EXPECT_EQ(str, text);
+
+    //Small pieces are merged
+    rope small;
+    for(int i = 0; i < 100; ++i)
+        small.append("abc");
+    EXPECT_EQ(small.piece_count(), 1);
+
+    //An external buffer is used in place
+    auto external = std::make_shared<const std::string>("an external buffer");
+    rope adopted(std::shared_ptr<const char>(external, external->data()), external->size());
+    adopted.for_each_piece([&external](std::string_view piece) { EXPECT_EQ(piece.data(), external->data()); });
+    EXPECT_EQ(adopted, *external);
+
+    std::vector<std::string_view> parts;
+    const auto digits = makePieces(std::string(2 * rope::merge_limit, '-') + "0123456789" + std::string(600, '+'), 4);
+    digits.for_each_piece(2 * rope::merge_limit + 6, 8, [&parts](std::string_view piece) { parts.push_back(piece); });
+    EXPECT_EQ(parts, (std::vector<std::string_view>{"67", "89++", "++"}));
+}
+
+TEST(Rope, Search)
+{
+    std::mt19937 gen{7};
+    std::string text(20000, 'a');
+    for(auto& ch : text)
+        ch = static_cast<char>('a' + gen() % 3);
+
+    //Pieces shorter and longer than the needles, so matches cross one or several pieces
+    for(std::size_t pieceSize : {1, 3, 64, 700, 20000})
+    {
+        const auto str = makePieces(text, pieceSize);
+        for(std::size_t needleSize : {1, 2, 5, 9, 130})
+        {
+            for(int round = 0; round < 20; ++round)
+            {
+                const auto from = gen() % (text.size() - needleSize);
+                const auto needle = round % 4 == 3 ? std::string(needleSize, 'd') : text.substr(from, needleSize);
+                const auto pos = gen() % (text.size() + 2);
+                ASSERT_EQ(str.find(needle, pos), text.find(needle, pos)) << pieceSize << " " << needle << " " << pos;
+                ASSERT_EQ(str.rfind(needle, pos), text.rfind(needle, pos)) << pieceSize << " " << needle << " " << pos;
+                ASSERT_EQ(str.find(needle), text.find(needle));
+                ASSERT_EQ(str.rfind(needle), text.rfind(needle));
+            }
+        }
+        EXPECT_EQ(str.find('c', 17), text.find('c', 17));
+        EXPECT_EQ(str.rfind('b', 17), text.rfind('b', 17));
+        EXPECT_EQ(str.find("", 5), 5);
+        EXPECT_EQ(str.find("", text.size() + 1), rope::npos);
+        EXPECT_EQ(str.rfind(""), text.size());
+    }
+
+    rope empty;
+    EXPECT_EQ(empty.find(""), 0);
+    EXPECT_EQ(empty.find("a"), rope::npos);
+    EXPECT_EQ(empty.rfind("a"), rope::npos);
+    EXPECT_EQ(empty.rfind(""), 0);
+}
+
+//Readers of a rope and a writer of its copy never see each other
+TEST(Rope, CopiesAcrossThreads)
+{
+    const std::string text(50000, 'r');
+    rope shared(text);
+    std::vector<std::thread> threads;
+    for(int thread = 0; thread < 4; ++thread)
+        threads.emplace_back([shared, thread]() mutable
+        {
+            auto copy = shared;
+            for(int step = 0; step < 500; ++step)
+                copy.insert(static_cast<std::size_t>(step * 97 + thread) % copy.size(), "w");
+            EXPECT_EQ(copy.size(), 50500);
+            EXPECT_EQ(shared.find('w'), rope::npos);
+        });
+    for(auto& thread : threads)
+        thread.join();
+    EXPECT_EQ(shared, text);
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,147 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <execution>
+#include <random>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Split.h"
+#include "Algorithms/SimdLevelTest.h"
+
+using practise::delimiter_set;
+using practise::detail::SimdLevel;
+
+static_assert(std::ranges::forward_range<practise::split_view>);
+static_assert(std::ranges::view<practise::split_view>);
+static_assert(std::ranges::common_range<practise::token_view>);
+
+using Pieces = std::vector<std::string_view>;
+
+static Pieces collect(const auto& range)
+{
+    return {range.begin(), range.end()};
+}
+
+//The loops split and tokenize replace
+static Pieces findFirstOfLoop(std::string_view text, std::string_view delimiters)
+{
+    Pieces pieces;
+    for(std::size_t start = 0;;)
+    {
+        const auto end = text.find_first_of(delimiters, start);
+        pieces.push_back(text.substr(start, end - start));
+        if(end == std::string_view::npos)
+            return pieces;
+        start = end + 1;
+    }
+}
+
+static Pieces findFirstNotOfLoop(std::string_view text, std::string_view delimiters)
+{
+    Pieces tokens;
+    for(auto start = text.find_first_not_of(delimiters); start != std::string_view::npos; start = text.find_first_not_of(delimiters, start))
+    {
+        const auto end = std::min(text.find_first_of(delimiters, start), text.size());
+        tokens.push_back(text.substr(start, end - start));
+        start = end;
+    }
+    return tokens;
+}
+
+TEST(Split, Basics)
+{
+    EXPECT_EQ(collect(practise::split("a,b,,c", ',')), (Pieces{"a", "b", "", "c"}));
+    EXPECT_EQ(collect(practise::split(",a;b,", ",;")), (Pieces{"", "a", "b", ""}));
+    EXPECT_EQ(collect(practise::split("", ",")), (Pieces{""}));
+    EXPECT_EQ(collect(practise::split(",,", ",")), (Pieces{"", "", ""}));
+    EXPECT_EQ(collect(practise::split("no delimiter", ",")), (Pieces{"no delimiter"}));
+    EXPECT_EQ(collect(practise::split("no delimiter", "")), (Pieces{"no delimiter"}));
+
+    EXPECT_EQ(collect(practise::tokenize("  the quick\tbrown\n\nfox ")), (Pieces{"the", "quick", "brown", "fox"}));
+    EXPECT_EQ(collect(practise::tokenize("a,b,,c", ",")), (Pieces{"a", "b", "c"}));
+    EXPECT_TRUE(collect(practise::tokenize("", ",")).empty());
+    EXPECT_TRUE(collect(practise::tokenize(",,,", ",")).empty());
+    EXPECT_EQ(collect(practise::tokenize("word", ",")), (Pieces{"word"}));
+
+    //The pieces are views on the text
+    const std::string text = "key=value;other=thing";
+    for(auto piece : practise::split(text, "=;"))
+    {
+        EXPECT_GE(piece.data(), text.data());
+        EXPECT_LE(piece.data() + piece.size(), text.data() + text.size());
+    }
+
+    //Works with the range adaptors
+    auto lengths = practise::tokenize("one three fifteen") | std::views::transform([](std::string_view word) { return word.size(); });
+    EXPECT_EQ((std::vector<std::size_t>(lengths.begin(), lengths.end())), (std::vector<std::size_t>{3, 5, 7}));
+    EXPECT_EQ(std::ranges::distance(practise::split("1,2,3,4", ',')), 4);
+}
+
+TEST(Split, MatchesFindLoops)
+{
+    std::mt19937 gen{11};
+    const std::vector<std::string> sets = {",", " \t", ",;:", " \t\n,;:", "abcdefgh", "aeiouAEIOU.,;!?", "\x80\xff\x7f\x01", std::string(1, '\0')};
+    for(const auto& set : sets)
+        for(auto level : supportedSimdLevels({SimdLevel::scalar, SimdLevel::sse2, SimdLevel::avx2}))
+        {
+            const delimiter_set delimiters(set, level);
+            for(int round = 0; round < 30; ++round)
+            {
+                //Random bytes with delimiters at a random density, lengths around the 64 byte blocks
+                std::string text(gen() % 300, '\0');
+                const auto density = 1 + gen() % 8;
+                for(auto& ch : text)
+                    ch = gen() % density == 0 ? set[gen() % set.size()] : static_cast<char>(gen() % 256);
+                ASSERT_EQ(collect(practise::split(text, delimiters)), findFirstOfLoop(text, set)) << static_cast<int>(level);
+                ASSERT_EQ(collect(practise::tokenize(text, delimiters)), findFirstNotOfLoop(text, set)) << static_cast<int>(level);
+            }
+
+            //Every byte value against the lookup table
+            std::string bytes(256, '\0');
+            for(int byte = 0; byte < 256; ++byte)
+                bytes[static_cast<std::size_t>(byte)] = static_cast<char>(byte);
+            for(std::size_t block = 0; block < 256; block += 64)
+            {
+                const auto mask = delimiters.classify(bytes.data() + block);
+                for(std::size_t i = 0; i < 64; ++i)
+                    ASSERT_EQ((mask >> i) & 1, set.find(bytes[block + i]) != std::string::npos) << block + i;
+            }
+        }
+}
+
+TEST(Split, Parallel)
+{
+    std::mt19937 gen{13};
+    std::string text(6 * practise::detail::minParallelSplitChunk + 123, ' ');
+    for(auto& ch : text)
+        if(const auto draw = gen() % 8; draw < 6)
+            ch = static_cast<char>('a' + draw);
+        else if(draw == 6)
+            ch = ',';
+
+    const delimiter_set delimiters(", ");
+    const auto pieces = collect(practise::split(text, delimiters));
+    const auto tokens = collect(practise::tokenize(text, delimiters));
+    for(unsigned threads : {1u, 2u, 4u, 7u})
+    {
+        EXPECT_EQ(practise::parallel_split(text, delimiters, threads), pieces) << threads;
+        EXPECT_EQ(practise::parallel_tokenize(text, delimiters, threads), tokens) << threads;
+    }
+    EXPECT_EQ(practise::split(std::execution::par, text, delimiters), pieces);
+    EXPECT_EQ(practise::tokenize(std::execution::seq, text, delimiters), tokens);
+
+    //Delimiters only at the very end or nowhere leave the chunks after the first empty
+    std::string tail(3 * practise::detail::minParallelSplitChunk, 'x');
+    tail += ",,";
+    EXPECT_EQ(practise::parallel_split(tail, delimiters, 3), (Pieces{std::string_view(tail).substr(0, tail.size() - 2), "", ""}));
+    EXPECT_EQ(practise::parallel_tokenize(tail, delimiters, 3), (Pieces{std::string_view(tail).substr(0, tail.size() - 2)}));
+    tail.resize(tail.size() - 2);
+    EXPECT_EQ(practise::parallel_split(tail, delimiters, 3), (Pieces{tail}));
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
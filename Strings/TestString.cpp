@@ -1,64 +1,90 @@
 #include <iostream>
 #include <gtest/gtest.h>
+#include <array>
+#include <random>
 #include <string>
+#include <thread>
+#include <vector>
+#include "CompactString.h"
+#include "StringSearch.h"
+#include "Utils/AllocationTracking.h"
+#include "Utils/MappedFile.h"
 
-TEST(String, MemberFunctions)
+//Every String test runs once with std::string and once with practise::compact_string, which has to behave the same
+template<typename Str>
+class String : public testing::Test {};
+
+template<typename Str>
+class Strings : public testing::Test {};
+
+using StringTypes = testing::Types<std::string, practise::compact_string>;
+
+struct StringTypeNames
+{
+    template<typename Str>
+    static std::string GetName(int) { return std::is_same_v<Str, std::string> ? "std_string" : "compact_string"; }
+};
+
+TYPED_TEST_SUITE(String, StringTypes, StringTypeNames);
+TYPED_TEST_SUITE(Strings, StringTypes, StringTypeNames);
+
+TYPED_TEST(String, MemberFunctions)
 {
     //Constructors
-    std::string str;
+    TypeParam str;
     EXPECT_TRUE(str.empty());
 
-    std::string str1(5,'s');
+    TypeParam str1(5,'s');
     EXPECT_EQ(str1.size(),5);
     EXPECT_STREQ(str1.c_str(),"sssss");
 
     str.assign({"Hello the strings world is beautiful"});
-    std::string str2(str,6);
+    TypeParam str2(str,6);
     EXPECT_STREQ(str2.c_str(),"the strings world is beautiful");
 
-    std::string str3(std::move(str2),4);
+    TypeParam str3(std::move(str2),4);
     EXPECT_STREQ(str3.c_str(),"strings world is beautiful");
 
-    std::string str4(str3,8,5);
+    TypeParam str4(str3,8,5);
     EXPECT_STREQ(str4.c_str(),"world");
 
-    std::string str5("Hello World",5);
+    TypeParam str5("Hello World",5);
     EXPECT_STREQ(str5.c_str(),"Hello");
 
-    std::string str6("Hello World");
+    TypeParam str6("Hello World");
     EXPECT_STREQ(str6.c_str(),"Hello World");
     EXPECT_EQ(str6.size(),11);
 
     std::array<char, 25> arr{"Hello everything is good"};
     auto endIt = arr.begin();
     std::advance(endIt,16);
-    std::string str7(arr.begin(),endIt);
+    TypeParam str7(arr.begin(),endIt);
     EXPECT_STREQ(str7.c_str(),"Hello everything");
 
-    std::string str8(str7);
+    TypeParam str8(str7);
     EXPECT_STREQ(str7.c_str(),"Hello everything");
 
-    std::string str9("Hello Good People");
+    TypeParam str9("Hello Good People");
     EXPECT_STREQ(str9.c_str(),"Hello Good People");
 
-    std::string str10({"Initilized using initilizer list"});
+    TypeParam str10({"Initilized using initilizer list"});
     EXPECT_STREQ(str10.c_str(),"Initilized using initilizer list");
 
     std::string_view strView{"String views"};
-    std::string str11(strView);
+    TypeParam str11(strView);
     EXPECT_STREQ(str11.c_str(),"String views");
 
-    std::string str12(strView,7,4);
+    TypeParam str12(strView,7,4);
     EXPECT_STREQ(str12.c_str(),"view");
 
     //operator = 
-    std::string str13 = str12;
+    TypeParam str13 = str12;
     EXPECT_STREQ(str13.c_str(),"view");
 
-    std::string str14 = std::move(str11);
+    TypeParam str14 = std::move(str11);
     EXPECT_STREQ(str14.c_str(),"String views");
 
-    std::string str15 = "Testing Strings";
+    TypeParam str15 = "Testing Strings";
     EXPECT_STREQ(str15.c_str(),"Testing Strings");
 
     str15 = "T";
@@ -100,9 +126,9 @@ TEST(String, MemberFunctions)
 
 }
 
-TEST(String, ElementAccess)
+TYPED_TEST(String, ElementAccess)
 {
-    std::string str("Hello World");
+    TypeParam str("Hello World");
 
     EXPECT_EQ(str.at(2),'l');
     EXPECT_ANY_THROW(str.at(20));
@@ -119,9 +145,9 @@ TEST(String, ElementAccess)
     std::string_view str2 = str;
 }
 
-TEST(String, Iterators)
+TYPED_TEST(String, Iterators)
 {
-    std::string str{"Playing with strings"};
+    TypeParam str{"Playing with strings"};
 
     EXPECT_EQ(*str.begin(),'P');
     EXPECT_EQ(*(str.end()-1),'s');
@@ -142,30 +168,31 @@ TEST(String, Iterators)
     EXPECT_EQ(*eIt,'r');
 }
 
-TEST(String, Capacity)
+TYPED_TEST(String, Capacity)
 {
-    std::string str;
+    TypeParam str;
     EXPECT_TRUE(str.empty());
 
     str.assign("Hello World");
     EXPECT_EQ(str.size(),11);
     EXPECT_EQ(str.length(),11);
 
-    //Checking current capacity 
-    EXPECT_EQ(str.capacity(),15);
+    //Checking current capacity, the inline buffer: 15 chars for std::string, 23 for compact_string
+    const auto inlineCapacity = TypeParam().capacity();
+    EXPECT_EQ(str.capacity(),inlineCapacity);
     
     str.reserve(100);
     //Now check new capacity after increasing
     EXPECT_EQ(str.capacity(),100);
 
     str.shrink_to_fit();
-    EXPECT_EQ(str.capacity(),15);
+    EXPECT_EQ(str.capacity(),inlineCapacity);
 }
 
-TEST(String, Operations)
+TYPED_TEST(String, Operations)
 {
     //clear
-    std::string str = "Hello World";
+    TypeParam str = "Hello World";
     EXPECT_FALSE(str.empty());
 
     str.clear();
@@ -185,7 +212,7 @@ TEST(String, Operations)
     str.clear();
     str.assign("Hello");
 
-    std::string str2(" World");
+    TypeParam str2(" World");
     str.insert(str.size(),str2);
     EXPECT_STREQ(str.c_str(),"Hello World");
 
@@ -392,7 +419,8 @@ TEST(String, Operations)
     EXPECT_STREQ(substring.c_str(),"substring");
 
     //copy
-    char arr[10];
+    //copy does not write the terminating null
+    char arr[10]{};
     str.copy(arr,9,12);
     EXPECT_STREQ(arr,"substring");
 
@@ -411,39 +439,39 @@ TEST(String, Operations)
 
 }
 
-TEST(Strings, Search)
+TYPED_TEST(Strings, Search)
 {
-    std::string str("Searching for the substring and then at the at last beststring j");
-    std::string substr = "substring";
+    TypeParam str("Searching for the substring and then at the at last beststring j");
+    TypeParam substr = "substring";
 
     //find
-    EXPECT_NE(str.find(substr,18),std::string::npos);
-    EXPECT_EQ(str.find(substr,20),std::string::npos);
+    EXPECT_NE(str.find(substr,18),TypeParam::npos);
+    EXPECT_EQ(str.find(substr,20),TypeParam::npos);
 
-    EXPECT_NE(str.find("for",1,3),std::string::npos);
-    EXPECT_NE(str.find("substr",18,6),std::string::npos);
-    EXPECT_EQ(str.find("good",1,4),std::string::npos);
+    EXPECT_NE(str.find("for",1,3),TypeParam::npos);
+    EXPECT_NE(str.find("substr",18,6),TypeParam::npos);
+    EXPECT_EQ(str.find("good",1,4),TypeParam::npos);
 
-    EXPECT_NE(str.find("last",1),std::string::npos);
-    EXPECT_EQ(str.find("last",50),std::string::npos);   
+    EXPECT_NE(str.find("last",1),TypeParam::npos);
+    EXPECT_EQ(str.find("last",50),TypeParam::npos);   
 
     std::string_view view("then");
-    EXPECT_NE(str.find(view,1),std::string::npos);
+    EXPECT_NE(str.find(view,1),TypeParam::npos);
 
     //Skipping the stringview and then the character constructor for below memeber functions
     //since its pretty same like above. 
     //rfind
     substr = "at";
-    EXPECT_NE(str.rfind(substr,50),std::string::npos);
-    EXPECT_EQ(str.rfind(substr,20),std::string::npos);
+    EXPECT_NE(str.rfind(substr,50),TypeParam::npos);
+    EXPECT_EQ(str.rfind(substr,20),TypeParam::npos);
 
-    EXPECT_NE(str.rfind("for",20,3),std::string::npos);
-    EXPECT_EQ(str.rfind("for",1,3),std::string::npos);
+    EXPECT_NE(str.rfind("for",20,3),TypeParam::npos);
+    EXPECT_EQ(str.rfind("for",1,3),TypeParam::npos);
 
     //find_first_of
     EXPECT_EQ(str.find_first_of(substr,0),2);
     substr = "k";
-    EXPECT_EQ(str.find_first_of(substr,45),std::string::npos);
+    EXPECT_EQ(str.find_first_of(substr,45),TypeParam::npos);
     
     EXPECT_EQ(str.find_first_of("for",0,2),10);
     EXPECT_EQ(str.find_first_of("at",0,2),2);
@@ -454,7 +482,7 @@ TEST(Strings, Search)
 
     EXPECT_EQ(str.find_first_not_of("Searching for the substring and then at the at oops last beststring ",0),63);
 
-    EXPECT_EQ(str.find_first_not_of("Searching for the substring and then at the at last beststring j",0),std::string::npos);
+    EXPECT_EQ(str.find_first_not_of("Searching for the substring and then at the at last beststring j",0),TypeParam::npos);
 
     EXPECT_EQ(str.find_first_not_of("Searching ",0,10),10);
 
@@ -464,7 +492,7 @@ TEST(Strings, Search)
 
     EXPECT_EQ(str.find_last_of("ou",64),19);
 
-    EXPECT_EQ(str.find_last_of("kz",64),std::string::npos);
+    EXPECT_EQ(str.find_last_of("kz",64),TypeParam::npos);
 
     //find_last_of_not
     str.clear();
@@ -479,11 +507,52 @@ TEST(Strings, Search)
 
 }
 
-TEST(String, NonMemberFunctions)
+//The searches over a mapped file of utils::largeInputBytes() letters and spaces, skipped unless
+//PRACTISE_LARGE_INPUT_BYTES is set. Needles with an underscore only occur where they are planted, one of them across the
+//boundary of the chunks the file is written in.
+TEST(StringsLargeInput, Search)
 {
-    std::string str = "Hello ";
-    std::string str2 = "World";
-    std::string str3 = "Hello ";
+    const auto bytes = utils::largeInputBytes();
+    if(bytes == 0)
+        GTEST_SKIP() << "set PRACTISE_LARGE_INPUT_BYTES to run";
+    constexpr std::string_view needle = "needle_in_the_haystack";
+    const std::array<std::size_t, 3> offsets = {1000, std::min((std::size_t{64} << 20) - 5, bytes / 2), bytes - needle.size() - 1};
+    const auto file = utils::generatedFile<char>("strings-search", bytes, [&](std::span<char> chunk, std::size_t first)
+    {
+        std::mt19937_64 gen{first};
+        for(auto& ch : chunk)
+            ch = static_cast<char>(gen() % 27 == 0 ? ' ' : 'a' + gen() % 26);
+        for(auto offset : offsets)
+            utils::placeAt(chunk, first, offset, std::span(needle.data(), needle.size()));
+    });
+    const auto text = file.view();
+    ASSERT_EQ(text.size(), bytes);
+
+    //find
+    EXPECT_EQ(practise::find(text, needle), offsets[0]);
+    EXPECT_EQ(practise::find(text, needle, offsets[0] + 1), offsets[1]);
+    EXPECT_EQ(practise::find(text, needle, offsets[1] + 1), offsets[2]);
+    EXPECT_EQ(practise::find(text, needle, offsets[2] + 1), practise::npos);
+    EXPECT_EQ(practise::find(text, "needle_missing"), practise::npos);
+    EXPECT_EQ(practise::find(text, '_'), text.find('_'));
+
+    //rfind
+    EXPECT_EQ(practise::rfind(text, needle), offsets[2]);
+    EXPECT_EQ(practise::rfind(text, needle, offsets[2] - 1), offsets[1]);
+    EXPECT_EQ(practise::rfind(text, '_'), text.rfind('_'));
+
+    //find_first_of and friends against std::string_view
+    EXPECT_EQ(practise::find_first_of(text, "_"), offsets[0] + 6);
+    EXPECT_EQ(practise::find_first_of(text, "_0", offsets[1] + needle.size()), text.find_first_of("_0", offsets[1] + needle.size()));
+    EXPECT_EQ(practise::find_first_not_of(text, " abcdefghijklmnopqrstuvwxyz"), offsets[0] + 6);
+    EXPECT_EQ(practise::find_last_of(text, "_"), text.find_last_of('_'));
+}
+
+TYPED_TEST(String, NonMemberFunctions)
+{
+    TypeParam str = "Hello ";
+    TypeParam str2 = "World";
+    TypeParam str3 = "Hello ";
 
     //operator+
     auto concat = str + str2;
@@ -509,19 +578,159 @@ TEST(String, NonMemberFunctions)
     EXPECT_STREQ(str2.c_str(),"Hello ");
     EXPECT_STREQ(str.c_str(),"World");
 
-    //erase
-    std::erase(str, 'd');
+    //erase, std::erase for std::string and practise::erase found through ADL for compact_string
+    using std::erase;
+    using std::erase_if;
+    erase(str, 'd');
     EXPECT_STREQ(str.c_str(),"Worl");
-    std::erase(str, 'r');
+    erase(str, 'r');
     EXPECT_STREQ(str.c_str(),"Wol");
 
     //erase_if
     str = "AbCdEfGhiJKLmnop";
     auto removeSmallCaseLetters = [](char alphabet){ return (alphabet >= 97 && alphabet <= 122);};
-    std::erase_if(str,removeSmallCaseLetters);
+    erase_if(str,removeSmallCaseLetters);
     EXPECT_STREQ(str.c_str(),"ACEGJKL");
 }
 
+TEST(CompactString, InlineStrings)
+{
+    EXPECT_EQ(sizeof(practise::compact_string), 24);
+
+    //Up to 23 chars stay inside the object, the size byte is the terminating null of a full string
+    {
+        utils::AllocationBudget budget(0);
+        practise::compact_string str;
+        for(char ch = 'a'; ch < 'a' + 23; ++ch)
+            str.push_back(ch);
+        EXPECT_EQ(str.size(), 23);
+        EXPECT_EQ(str.capacity(), 23);
+        EXPECT_STREQ(str.c_str(), "abcdefghijklmnopqrstuvw");
+        practise::compact_string copy = str;
+        copy.replace(0, 3, "ABC");
+        EXPECT_EQ(copy, "ABCdefghijklmnopqrstuvw");
+        EXPECT_EQ(str.substr(20), "uvw");
+    }
+
+    practise::compact_string str(23, 'x');
+    str.push_back('y');
+    EXPECT_EQ(str.size(), 24);
+    EXPECT_GE(str.capacity(), 46);
+    str.erase(10);
+    str.shrink_to_fit();
+    EXPECT_EQ(str.capacity(), 23);
+    EXPECT_EQ(str, "xxxxxxxxxx");
+}
+
+//Source chars inside the string itself, they move while the string is edited
+TEST(CompactString, Aliasing)
+{
+    std::string expected("0123456789");
+    practise::compact_string str("0123456789");
+    auto both = [&](auto edit)
+    {
+        edit(expected);
+        edit(str);
+        EXPECT_EQ(std::string_view(str), expected);
+    };
+    both([](auto& s) { s.append(s); });
+    both([](auto& s) { s.insert(5, s.c_str() + 10, 10); });
+    both([](auto& s) { s.replace(0, 20, s.data() + 10, 20); });
+    both([](auto& s) { s.replace(s.begin(), s.begin() + 2, s.begin() + 28, s.end()); });
+    both([](auto& s) { s.assign(s.data() + 25, 5); });
+}
+
+//Random edits applied to std::string and compact_string side by side, across the inline/heap boundary
+TEST(CompactString, MatchesStdString)
+{
+    std::mt19937 gen{3};
+    std::string expected;
+    practise::compact_string str;
+    for(int step = 0; step < 5000; ++step)
+    {
+        const auto pos = expected.empty() ? 0 : gen() % (expected.size() + 1);
+        const auto count = gen() % 12;
+        const std::string chars(gen() % 30, static_cast<char>('a' + gen() % 26));
+        switch(gen() % 6)
+        {
+            case 0: expected.insert(pos, chars); str.insert(pos, chars); break;
+            case 1: expected.erase(pos, count); str.erase(pos, count); break;
+            case 2: expected.replace(pos, count, chars); str.replace(pos, count, chars); break;
+            case 3: expected.append(chars); str.append(chars); break;
+            case 4: expected.resize(count * 3, 'r'); str.resize(count * 3, 'r'); break;
+            default: expected.push_back('p'); str.push_back('p'); break;
+        }
+        ASSERT_EQ(std::string_view(str), expected) << "step " << step;
+        ASSERT_EQ(str.c_str()[str.size()], '\0');
+    }
+}
+
+TEST(CompactString, Interning)
+{
+    practise::string_pool pool;
+    const std::string text = "a key which is too long for the inline buffer";
+    {
+        auto first = practise::compact_string::interned(text, pool);
+        auto second = practise::compact_string(text);
+        second.intern(pool);
+        EXPECT_TRUE(first.is_interned());
+        EXPECT_TRUE(second.is_interned());
+        EXPECT_EQ(first.c_str(), second.c_str());
+        EXPECT_EQ(pool.size(), 1);
+
+        //Copies share the entry without allocating
+        {
+            utils::AllocationBudget budget(0);
+            auto copy = first;
+            EXPECT_EQ(copy.c_str(), first.c_str());
+        }
+
+        //Writing gives the string its own copy, the others keep the pooled one
+        second[0] = 'A';
+        EXPECT_FALSE(second.is_interned());
+        EXPECT_EQ(first, text);
+        EXPECT_EQ(second.substr(1), text.substr(1));
+
+        //Short strings stay inline
+        auto shortKey = practise::compact_string::interned("user:42", pool);
+        EXPECT_FALSE(shortKey.is_interned());
+        EXPECT_EQ(pool.size(), 1);
+    }
+    //The entry went away with its last string
+    EXPECT_EQ(pool.size(), 0);
+    EXPECT_EQ(pool.bytes(), 0);
+}
+
+TEST(CompactString, InterningThreads)
+{
+    practise::string_pool pool;
+    constexpr int threadCount = 4;
+    constexpr int keyCount = 64;
+    auto key = [](int index) { return "/api/v1/customers/" + std::to_string(index) + "/orders/history"; };
+    std::vector<std::thread> threads;
+    std::vector<std::vector<practise::compact_string>> kept(threadCount);
+    for(int thread = 0; thread < threadCount; ++thread)
+        threads.emplace_back([&, thread]
+        {
+            for(int round = 0; round < 200; ++round)
+                for(int index = 0; index < keyCount; ++index)
+                {
+                    auto str = practise::compact_string::interned(key(index), pool);
+                    if(round == thread)
+                        kept[thread].push_back(str);
+                }
+        });
+    for(auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(pool.size(), keyCount);
+    for(int index = 0; index < keyCount; ++index)
+        for(int thread = 1; thread < threadCount; ++thread)
+            EXPECT_EQ(kept[thread][index].c_str(), kept[0][index].c_str());
+    kept.clear();
+    EXPECT_EQ(pool.size(), 0);
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
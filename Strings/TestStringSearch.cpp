@@ -0,0 +1,172 @@
+#include <iostream>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include "StringSearch.h"
+
+//Every assertion of TestString.cpp Strings.Search, run against the vectorized search functions
+TEST(StringSearch, Search)
+{
+    std::string str("Searching for the substring and then at the at last beststring j");
+    std::string substr = "substring";
+
+    //find
+    EXPECT_NE(practise::find(str,substr,18),practise::npos);
+    EXPECT_EQ(practise::find(str,substr,20),practise::npos);
+
+    EXPECT_NE(practise::find(str,std::string_view("for",3),1),practise::npos);
+    EXPECT_NE(practise::find(str,std::string_view("substr",6),18),practise::npos);
+    EXPECT_EQ(practise::find(str,std::string_view("good",4),1),practise::npos);
+
+    EXPECT_NE(practise::find(str,"last",1),practise::npos);
+    EXPECT_EQ(practise::find(str,"last",50),practise::npos);
+
+    std::string_view view("then");
+    EXPECT_NE(practise::find(str,view,1),practise::npos);
+
+    //rfind
+    substr = "at";
+    EXPECT_NE(practise::rfind(str,substr,50),practise::npos);
+    EXPECT_EQ(practise::rfind(str,substr,20),practise::npos);
+
+    EXPECT_NE(practise::rfind(str,std::string_view("for",3),20),practise::npos);
+    EXPECT_EQ(practise::rfind(str,std::string_view("for",3),1),practise::npos);
+
+    //find_first_of
+    EXPECT_EQ(practise::find_first_of(str,substr,0),2);
+    substr = "k";
+    EXPECT_EQ(practise::find_first_of(str,substr,45),practise::npos);
+
+    EXPECT_EQ(practise::find_first_of(str,std::string_view("for",2),0),10);
+    EXPECT_EQ(practise::find_first_of(str,std::string_view("at",2),0),2);
+
+    //find_first_not_of
+    substr = "Sarc";
+    EXPECT_EQ(practise::find_first_not_of(str,substr,0),1);
+
+    EXPECT_EQ(practise::find_first_not_of(str,"Searching for the substring and then at the at oops last beststring ",0),63);
+
+    EXPECT_EQ(practise::find_first_not_of(str,"Searching for the substring and then at the at last beststring j",0),practise::npos);
+
+    EXPECT_EQ(practise::find_first_not_of(str,std::string_view("Searching ",10),0),10);
+
+    //find_last_of
+    substr = "last";
+    EXPECT_EQ(practise::find_last_of(str,substr,64),57);
+
+    EXPECT_EQ(practise::find_last_of(str,"ou",64),19);
+
+    EXPECT_EQ(practise::find_last_of(str,"kz",64),practise::npos);
+
+    //find_last_of_not
+    str.clear();
+    str = "This is a new string";
+    substr = "ok string";
+
+    EXPECT_EQ(practise::find_last_not_of(str,substr,str.length()),12);
+
+    EXPECT_EQ(practise::find_last_not_of(str,"kz",str.length()),19);
+
+    EXPECT_EQ(practise::find_last_not_of(str,std::string_view("string ",7),str.length()),12);
+}
+
+TEST(StringSearch, EdgeCases)
+{
+    const std::string_view str("abcabc");
+
+    //Empty needle matches at pos as long as pos is inside or at the end
+    EXPECT_EQ(practise::find(str,"",0),0);
+    EXPECT_EQ(practise::find(str,"",6),6);
+    EXPECT_EQ(practise::find(str,"",7),practise::npos);
+    EXPECT_EQ(practise::rfind(str,""),6);
+    EXPECT_EQ(practise::rfind(str,"",2),2);
+
+    EXPECT_EQ(practise::find(str,"abcabcd"),practise::npos);
+    EXPECT_EQ(practise::find(str,"abcabc"),0);
+    EXPECT_EQ(practise::rfind(str,"abc"),3);
+    EXPECT_EQ(practise::rfind(str,"abc",2),0);
+    EXPECT_EQ(practise::find(str,'c',3),5);
+    EXPECT_EQ(practise::rfind(str,'a',2),0);
+
+    EXPECT_EQ(practise::find_first_of(str,""),practise::npos);
+    EXPECT_EQ(practise::find_first_not_of(str,""),0);
+    EXPECT_EQ(practise::find_last_not_of(str,""),5);
+    EXPECT_EQ(practise::find_last_of("",""),practise::npos);
+    EXPECT_EQ(practise::find_first_of(str,"c",6),practise::npos);
+}
+
+//Compares every function against std::string_view on random text from a small alphabet, so the byte filter
+//reports many false candidates, with needles from 1 byte up to beyond the Horspool threshold
+TEST(StringSearch, MatchesStdStringView)
+{
+    std::mt19937 gen{42};
+    for(int round = 0; round < 300; ++round)
+    {
+        const auto alphabet = static_cast<char>(2 + round % 4);
+        std::uniform_int_distribution<std::size_t> lengthDist{0, 700};
+        std::string text(lengthDist(gen), ' ');
+        std::uniform_int_distribution<int> charDist{0, alphabet - 1};
+        for(auto& c : text)
+            c = static_cast<char>('a' + charDist(gen));
+        const std::string_view hay(text);
+
+        std::uniform_int_distribution<std::size_t> needleDist{1, 200};
+        std::string needle;
+        if(!text.empty() && round % 2 == 0)
+        {
+            //Taken from the text so there is at least one match
+            std::uniform_int_distribution<std::size_t> startDist{0, text.size() - 1};
+            const auto start = startDist(gen);
+            needle = text.substr(start, needleDist(gen));
+        }
+        else
+        {
+            needle.resize(needleDist(gen));
+            for(auto& c : needle)
+                c = static_cast<char>('a' + charDist(gen));
+        }
+
+        const std::string set = needle.substr(0, 1 + round % 6);
+        for(std::size_t pos : {std::size_t{0}, std::size_t{1}, hay.size() / 3, hay.size(), practise::npos})
+        {
+            ASSERT_EQ(practise::find(hay,needle,pos),hay.find(needle,pos)) << hay << " / " << needle << " @" << pos;
+            ASSERT_EQ(practise::rfind(hay,needle,pos),hay.rfind(needle,pos)) << hay << " / " << needle << " @" << pos;
+            ASSERT_EQ(practise::find_first_of(hay,set,pos),hay.find_first_of(set,pos));
+            ASSERT_EQ(practise::find_first_not_of(hay,set,pos),hay.find_first_not_of(set,pos));
+            ASSERT_EQ(practise::find_last_of(hay,set,pos),hay.find_last_of(set,pos));
+            ASSERT_EQ(practise::find_last_not_of(hay,set,pos),hay.find_last_not_of(set,pos));
+        }
+    }
+}
+
+TEST(StringSearch, Searcher)
+{
+    //Same inputs as the std::search test in TestNonModSequenceOperations.cpp
+    std::string str = "Hello world good people going to search substrings";
+    std::string subString = "oing";
+
+    auto it = std::search(str.begin(),str.end(),practise::string_searcher(subString.begin(),subString.end()));
+    EXPECT_EQ(std::distance(str.begin(),it),25);
+    EXPECT_TRUE(std::equal(it,it+subString.length(),"oing"));
+
+    auto it2 = std::search(str.begin(),str.end(),practise::string_searcher("food"));
+    EXPECT_EQ(it2,str.end());
+
+    //Long needle through the Horspool path, compared with the standard searcher
+    std::string text(5000,'a');
+    std::string needle(300,'a');
+    needle.back() = 'b';
+    text.replace(4000,needle.size(),needle);
+    auto it3 = std::search(text.begin(),text.end(),practise::string_searcher(needle));
+    auto it4 = std::search(text.begin(),text.end(),std::boyer_moore_horspool_searcher(needle.begin(),needle.end()));
+    EXPECT_EQ(it3,it4);
+    EXPECT_EQ(std::distance(text.begin(),it3),4000);
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,176 @@
+//Replacement of every global operator new/delete form counting calls, bytes and live bytes, plus a GTest
+//listener printing the counters of each test. Built as an object library so the replacements and the
+//listener registration are always linked in, even though no test references them directly
+#include "Utils/AllocationTracking.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<std::size_t> gCount{0};
+    std::atomic<std::size_t> gBytes{0};
+    std::atomic<std::size_t> gLive{0};
+    std::atomic<std::size_t> gPeak{0};
+
+    void raisePeak(std::size_t bytes)
+    {
+        auto peak = gPeak.load(std::memory_order_relaxed);
+        while(peak < bytes && !gPeak.compare_exchange_weak(peak, bytes, std::memory_order_relaxed))
+            ;
+    }
+
+    //Every block starts with a header holding the requested size and the header size, so delete knows how
+    //many live bytes go away without relying on the sized delete forms
+    struct Header
+    {
+        std::size_t size;
+        std::size_t offset;
+    };
+    constexpr std::size_t headerSize = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+    static_assert(sizeof(Header) <= headerSize);
+
+    Header* headerOf(void* ptr) { return static_cast<Header*>(ptr) - 1; }
+
+    void* tryAllocate(std::size_t size, std::size_t alignment) noexcept
+    {
+        const auto offset = std::max(alignment, headerSize);
+        void* raw = nullptr;
+        if(alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            raw = std::malloc(size + offset);
+        else
+            raw = std::aligned_alloc(alignment, (size + offset + alignment - 1) / alignment * alignment);
+        if(raw == nullptr)
+            return nullptr;
+
+        void* ptr = static_cast<char*>(raw) + offset;
+        *headerOf(ptr) = {size, offset};
+        gCount.fetch_add(1, std::memory_order_relaxed);
+        gBytes.fetch_add(size, std::memory_order_relaxed);
+        raisePeak(gLive.fetch_add(size, std::memory_order_relaxed) + size);
+        return ptr;
+    }
+
+    //Retries through the new handler like the standard operator new does
+    void* allocate(std::size_t size, std::size_t alignment)
+    {
+        while(true)
+        {
+            if(void* ptr = tryAllocate(size, alignment))
+                return ptr;
+            auto handler = std::get_new_handler();
+            if(handler == nullptr)
+                throw std::bad_alloc();
+            handler();
+        }
+    }
+
+    void* allocateNoThrow(std::size_t size, std::size_t alignment) noexcept
+    {
+        try
+        {
+            return allocate(size, alignment);
+        }
+        catch(...)
+        {
+            return nullptr;
+        }
+    }
+
+    void deallocate(void* ptr) noexcept
+    {
+        if(ptr == nullptr)
+            return;
+        const auto header = *headerOf(ptr);
+        gLive.fetch_sub(header.size, std::memory_order_relaxed);
+        std::free(static_cast<char*>(ptr) - header.offset);
+    }
+
+    //Prints one line per test, GTest sends the end events to the listeners in reverse order so it comes
+    //right before the result line of the default printer:
+    //[  ALLOCS  ] VectorTest.Modifiers: 12 allocations, 480 bytes, peak 256 bytes
+    class AllocationReporter : public testing::EmptyTestEventListener
+    {
+    public:
+        void OnTestStart(const testing::TestInfo&) override
+        {
+            mStart = utils::allocationCounters();
+            utils::resetPeakBytes();
+        }
+
+        void OnTestEnd(const testing::TestInfo& info) override
+        {
+            const auto now = utils::allocationCounters();
+            std::printf("[  ALLOCS  ] %s.%s: %zu allocations, %zu bytes, peak %zu bytes\n", info.test_suite_name(),
+                        info.name(), now.count - mStart.count, now.bytes - mStart.bytes,
+                        now.peakBytes - std::min(now.peakBytes, mStart.liveBytes));
+            std::fflush(stdout);
+        }
+
+    private:
+        utils::AllocationCounters mStart;
+    };
+
+    //Registered before main, GTest keeps the listeners added before InitGoogleTest
+    const bool gReporterRegistered = []
+    {
+        testing::UnitTest::GetInstance()->listeners().Append(new AllocationReporter);
+        return true;
+    }();
+}
+
+namespace utils
+{
+    AllocationCounters allocationCounters()
+    {
+        return {gCount.load(std::memory_order_relaxed), gBytes.load(std::memory_order_relaxed),
+                gLive.load(std::memory_order_relaxed), gPeak.load(std::memory_order_relaxed)};
+    }
+
+    void resetPeakBytes() { gPeak.store(gLive.load(std::memory_order_relaxed), std::memory_order_relaxed); }
+
+    void raisePeakBytes(std::size_t bytes) { raisePeak(bytes); }
+}
+
+void* operator new(std::size_t size) { return allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](std::size_t size) { return allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocateNoThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocateNoThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocateNoThrow(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocateNoThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(ptr); }
@@ -0,0 +1,91 @@
+//Heap allocation counters for the test binaries. AllocationTracking.cpp replaces the global operator
+//new/delete and is linked into every test binary by add_test_project; it also prints the allocation count,
+//bytes and peak live bytes of every GTest test next to its result line.
+//AllocationScope measures the allocations of a block of code, AllocationBudget fails the running test when
+//that block allocates more than declared:
+//    {
+//        utils::AllocationBudget budget(1);
+//        vec.insert(vec.begin() + 1, other.begin(), other.end());     //must reallocate at most once
+//    }
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <source_location>
+#include <gtest/gtest.h>
+
+namespace utils
+{
+    //Totals since the start of the process, over all threads
+    struct AllocationCounters
+    {
+        std::size_t count = 0;          //calls to operator new
+        std::size_t bytes = 0;          //bytes requested by them
+        std::size_t liveBytes = 0;      //bytes not deleted yet
+        std::size_t peakBytes = 0;      //highest liveBytes since the last resetPeakBytes
+    };
+
+    AllocationCounters allocationCounters();
+    //Restarts the peak at the current live bytes, or raises it to at least bytes
+    void resetPeakBytes();
+    void raisePeakBytes(std::size_t bytes);
+
+    struct AllocationStats
+    {
+        std::size_t count = 0;
+        std::size_t bytes = 0;
+        std::size_t peakBytes = 0;      //highest live bytes over the live bytes at the start
+    };
+
+    //Allocations made during the lifetime of the scope. Scopes nest, the enclosing scope (and the per test
+    //report) still sees the peak reached inside
+    class AllocationScope
+    {
+    public:
+        AllocationScope() : mStart(allocationCounters()) { resetPeakBytes(); }
+        ~AllocationScope() { raisePeakBytes(mStart.peakBytes); }
+        AllocationScope(const AllocationScope&) = delete;
+        AllocationScope& operator=(const AllocationScope&) = delete;
+
+        AllocationStats stats() const
+        {
+            const auto now = allocationCounters();
+            return {now.count - mStart.count, now.bytes - mStart.bytes,
+                    now.peakBytes - std::min(now.peakBytes, mStart.liveBytes)};
+        }
+
+    private:
+        AllocationCounters mStart;
+    };
+
+    //Adds a non fatal failure to the running test, at the line declaring the budget, when the scope allocated
+    //more often, more bytes or a higher peak than allowed
+    class AllocationBudget : public AllocationScope
+    {
+    public:
+        static constexpr std::size_t unlimited = std::numeric_limits<std::size_t>::max();
+
+        explicit AllocationBudget(std::size_t maxCount, std::size_t maxBytes = unlimited,
+                                  std::size_t maxPeakBytes = unlimited,
+                                  std::source_location where = std::source_location::current())
+            : mMaxCount(maxCount), mMaxBytes(maxBytes), mMaxPeakBytes(maxPeakBytes), mWhere(where)
+        {}
+
+        ~AllocationBudget()
+        {
+            const auto used = stats();
+            if(used.count > mMaxCount || used.bytes > mMaxBytes || used.peakBytes > mMaxPeakBytes)
+                ADD_FAILURE_AT(mWhere.file_name(), static_cast<int>(mWhere.line()))
+                    << "Allocation budget exceeded: " << used.count << " allocations (budget " << mMaxCount
+                    << "), " << used.bytes << " bytes (budget " << mMaxBytes << "), peak " << used.peakBytes
+                    << " bytes (budget " << mMaxPeakBytes << ")";
+        }
+
+    private:
+        std::size_t mMaxCount;
+        std::size_t mMaxBytes;
+        std::size_t mMaxPeakBytes;
+        std::source_location mWhere;
+    };
+}
@@ -0,0 +1,109 @@
+//Common helpers shared by all the bench* binaries generated through add_test_project
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <unistd.h>
+#include <vector>
+
+#ifndef BENCH_MAX_ELEMENTS
+#define BENCH_MAX_ELEMENTS 100000000
+#endif
+
+namespace bench
+{
+    inline constexpr std::int64_t minElements = 1'000;
+    inline constexpr std::int64_t maxElements = BENCH_MAX_ELEMENTS;
+
+    //Sweeps 1e3, 1e4 ... up to BENCH_MAX_ELEMENTS
+    inline void elementSweep(benchmark::internal::Benchmark* b)
+    {
+        for(std::int64_t n = minElements; n <= maxElements; n *= 10)
+            b->Arg(n);
+    }
+
+    //Data cache sizes reported by the OS, or typical ones (48 KiB L1, 2 MiB L2, 32 MiB L3) when it does not know
+    inline std::int64_t cacheBytes(int level)
+    {
+        long bytes = 0;
+#ifdef _SC_LEVEL1_DCACHE_SIZE
+        bytes = sysconf(level == 1 ? _SC_LEVEL1_DCACHE_SIZE : level == 2 ? _SC_LEVEL2_CACHE_SIZE : _SC_LEVEL3_CACHE_SIZE);
+#endif
+        if(bytes > 0)
+            return bytes;
+        return level == 1 ? 48 << 10 : level == 2 ? 2 << 20 : 32 << 20;
+    }
+
+    //Buffer sizes in bytes which fit in L1, L2 and L3 (half of each) and one which only fits in DRAM (twice L3,
+    //at least 256 MiB)
+    inline void cacheLevelSweep(benchmark::internal::Benchmark* b)
+    {
+        b->ArgName("bytes");
+        for(int level = 1; level <= 3; ++level)
+            b->Arg(cacheBytes(level) / 2);
+        b->Arg(std::max<std::int64_t>(2 * cacheBytes(3), std::int64_t{256} << 20));
+    }
+
+    //Sizes in bytes of the inputs mapped from disk through utils::generatedFile, past what fits next to them in RAM
+    inline void mappedFileSizes(benchmark::internal::Benchmark* b)
+    {
+        b->Arg(std::int64_t{1} << 30)->Arg(std::int64_t{4} << 30);
+    }
+
+    //Reports time/op (printed in ns), bytes/op and throughput (items/s, bytes/s) where one "op" is
+    //one element touched by the timed loop and elements is the number of ops done in a single iteration
+    inline void reportPerOp(benchmark::State& state, std::int64_t elements, std::int64_t bytesPerOp)
+    {
+        state.SetItemsProcessed(state.iterations() * elements);
+        state.SetBytesProcessed(state.iterations() * elements * bytesPerOp);
+        state.counters["time/op"] = benchmark::Counter(static_cast<double>(elements),
+            benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+        state.counters["bytes/op"] = benchmark::Counter(static_cast<double>(bytesPerOp));
+    }
+
+    //Same seed for every run so regressions are compared on identical inputs
+    inline std::vector<int> randomInts(std::int64_t count, int maxValue = std::numeric_limits<int>::max())
+    {
+        std::mt19937 gen{42};
+        std::uniform_int_distribution<int> dist{0, maxValue};
+        std::vector<int> values(static_cast<std::size_t>(count));
+        for(auto& val : values)
+            val = dist(gen);
+        return values;
+    }
+
+    //randomInts for any arithmetic type, integers over their whole range and floating point in [-1, 1)
+    template<typename T>
+    std::vector<T> randomValues(std::int64_t count)
+    {
+        std::mt19937_64 gen{42};
+        std::vector<T> values(static_cast<std::size_t>(count));
+        if constexpr(std::is_floating_point_v<T>)
+        {
+            std::uniform_real_distribution<T> dist{-1, 1};
+            for(auto& val : values)
+                val = dist(gen);
+        }
+        else
+        {
+            //uniform_int_distribution is not defined for char sized types
+            using Wide = std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>;
+            std::uniform_int_distribution<Wide> dist{std::numeric_limits<T>::min(), std::numeric_limits<T>::max()};
+            for(auto& val : values)
+                val = static_cast<T>(dist(gen));
+        }
+        return values;
+    }
+
+    inline std::vector<int> iotaInts(std::int64_t count)
+    {
+        std::vector<int> values(static_cast<std::size_t>(count));
+        std::iota(values.begin(), values.end(), 0);
+        return values;
+    }
+}
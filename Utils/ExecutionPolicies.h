@@ -0,0 +1,47 @@
+//Maps the standard execution policy types to their policy objects and printable names, so tests and
+//benchmarks can be written once as templates over the policy type
+#pragma once
+
+#include <execution>
+#include <string_view>
+
+namespace utils
+{
+    template<typename Policy>
+    struct ExecutionPolicyTraits;
+
+    template<>
+    struct ExecutionPolicyTraits<std::execution::sequenced_policy>
+    {
+        static constexpr const auto& policy = std::execution::seq;
+        static constexpr std::string_view name = "seq";
+        static constexpr bool parallel = false;
+    };
+
+    template<>
+    struct ExecutionPolicyTraits<std::execution::parallel_policy>
+    {
+        static constexpr const auto& policy = std::execution::par;
+        static constexpr std::string_view name = "par";
+        static constexpr bool parallel = true;
+    };
+
+    template<>
+    struct ExecutionPolicyTraits<std::execution::parallel_unsequenced_policy>
+    {
+        static constexpr const auto& policy = std::execution::par_unseq;
+        static constexpr std::string_view name = "par_unseq";
+        static constexpr bool parallel = true;
+    };
+
+    template<>
+    struct ExecutionPolicyTraits<std::execution::unsequenced_policy>
+    {
+        static constexpr const auto& policy = std::execution::unseq;
+        static constexpr std::string_view name = "unseq";
+        static constexpr bool parallel = false;
+    };
+
+    template<typename Policy>
+    inline constexpr const Policy& executionPolicy = ExecutionPolicyTraits<Policy>::policy;
+}
@@ -0,0 +1,194 @@
+//Read only memory mapped files, so tests and benchmarks can run over inputs far bigger than what they would
+//want to copy into a std::vector. The mapping is handed out as std::string_view or std::span<const T>, and
+//the kernel is told how it is going to be read: sequential read ahead by default, transparent huge pages
+//where the kernel supports them for file mappings. generatedFile() writes an input once per machine and
+//maps it again on later runs. POSIX only.
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace utils
+{
+    class MappedFile
+    {
+        public:
+            enum class Access { normal, sequential, random };
+
+            MappedFile() = default;
+
+            //Maps the whole file, throws std::system_error when it cannot be opened or mapped
+            explicit MappedFile(const std::filesystem::path& path, Access access = Access::sequential, bool hugePages = true)
+            {
+                const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+                if(fd < 0)
+                    throw std::system_error(errno, std::generic_category(), "open " + path.string());
+                struct stat info{};
+                if(::fstat(fd, &info) != 0)
+                {
+                    const auto error = errno;
+                    ::close(fd);
+                    throw std::system_error(error, std::generic_category(), "fstat " + path.string());
+                }
+                mSize = static_cast<std::size_t>(info.st_size);
+                if(mSize)
+                {
+                    void* data = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+                    if(data == MAP_FAILED)
+                    {
+                        const auto error = errno;
+                        ::close(fd);
+                        throw std::system_error(error, std::generic_category(), "mmap " + path.string());
+                    }
+                    mData = static_cast<const std::byte*>(data);
+                }
+                //The mapping keeps the file alive
+                ::close(fd);
+                advise(access);
+#ifdef MADV_HUGEPAGE
+                //Only honoured for file mappings by kernels built with read only THP support, a hint otherwise
+                if(hugePages && mData)
+                    ::madvise(const_cast<std::byte*>(mData), mSize, MADV_HUGEPAGE);
+#else
+                (void)hugePages;
+#endif
+            }
+
+            MappedFile(MappedFile&& other) noexcept
+                : mData(std::exchange(other.mData, nullptr)), mSize(std::exchange(other.mSize, 0))
+            {
+            }
+
+            MappedFile& operator=(MappedFile other) noexcept
+            {
+                std::swap(mData, other.mData);
+                std::swap(mSize, other.mSize);
+                return *this;
+            }
+
+            ~MappedFile()
+            {
+                if(mData)
+                    ::munmap(const_cast<std::byte*>(mData), mSize);
+            }
+
+            //Read ahead pattern of the kernel for the following accesses
+            void advise(Access access) const noexcept
+            {
+                if(!mData)
+                    return;
+                const int advice = access == Access::sequential ? MADV_SEQUENTIAL
+                                 : access == Access::random ? MADV_RANDOM : MADV_NORMAL;
+                ::madvise(const_cast<std::byte*>(mData), mSize, advice);
+            }
+
+            //Starts reading the whole file into the page cache in the background
+            void prefetch() const noexcept
+            {
+                if(mData)
+                    ::madvise(const_cast<std::byte*>(mData), mSize, MADV_WILLNEED);
+            }
+
+            const std::byte* data() const noexcept { return mData; }
+            std::size_t size() const noexcept { return mSize; }
+            bool empty() const noexcept { return mSize == 0; }
+
+            std::string_view view() const noexcept
+            {
+                return {reinterpret_cast<const char*>(mData), mSize};
+            }
+
+            //The whole Ts in the file, the mapping starts on a page boundary so any T is aligned
+            template<typename T>
+                requires std::is_trivially_copyable_v<T>
+            std::span<const T> span() const noexcept
+            {
+                return {reinterpret_cast<const T*>(mData), mSize / sizeof(T)};
+            }
+
+        private:
+            const std::byte* mData = nullptr;
+            std::size_t mSize = 0;
+    };
+
+    //Directory of the generated inputs: $PRACTISE_INPUT_DIR, or practise-inputs in the temp directory
+    inline std::filesystem::path inputDirectory()
+    {
+        if(const char* dir = std::getenv("PRACTISE_INPUT_DIR"); dir && *dir)
+            return dir;
+        return std::filesystem::temp_directory_path() / "practise-inputs";
+    }
+
+    //Size of the large input tests, $PRACTISE_LARGE_INPUT_BYTES (e.g. 268435456, or multi GB runs). 0 when it
+    //is not set: the tests write a file of that size, so they are skipped unless asked for.
+    inline std::size_t largeInputBytes()
+    {
+        if(const char* bytes = std::getenv("PRACTISE_LARGE_INPUT_BYTES"); bytes && *bytes)
+            return static_cast<std::size_t>(std::strtoull(bytes, nullptr, 10));
+        return 0;
+    }
+
+    //Copies the part of values that lands in chunk when values is placed at index offset of the file, for fill
+    //functions planting known contents into generated data
+    template<typename T>
+    void placeAt(std::span<T> chunk, std::size_t firstIndex, std::size_t offset, std::span<const T> values)
+    {
+        const auto begin = std::max(firstIndex, offset);
+        const auto end = std::min(firstIndex + chunk.size(), offset + values.size());
+        if(begin < end)
+            std::copy(values.begin() + static_cast<std::ptrdiff_t>(begin - offset), values.begin() + static_cast<std::ptrdiff_t>(end - offset),
+                      chunk.begin() + static_cast<std::ptrdiff_t>(begin - firstIndex));
+    }
+
+    //Maps inputDirectory()/name-count.bin holding count Ts. The file is written on first use in chunks,
+    //fill(std::span<T> chunk, std::size_t firstIndex) sets the elements [firstIndex, firstIndex + chunk.size()),
+    //and reused as long as it has the right size, so name has to change with the contents.
+    template<typename T, typename Fill>
+        requires std::is_trivially_copyable_v<T>
+    MappedFile generatedFile(std::string_view name, std::size_t count, Fill fill, MappedFile::Access access = MappedFile::Access::sequential)
+    {
+        const auto directory = inputDirectory();
+        const auto path = directory / (std::string(name) + "-" + std::to_string(count) + ".bin");
+        const auto bytes = count * sizeof(T);
+        std::error_code error;
+        if(!std::filesystem::exists(path, error) || std::filesystem::file_size(path, error) != bytes)
+        {
+            std::filesystem::create_directories(directory);
+            //Written next to the final name and renamed, an interrupted run never leaves a short input behind.
+            //The pid keeps binaries generating the same input at once from writing into one partial file.
+            auto partial = path;
+            partial += "." + std::to_string(::getpid()) + ".partial";
+            {
+                std::ofstream out(partial, std::ios::binary | std::ios::trunc);
+                constexpr std::size_t chunkElements = (std::size_t{64} << 20) / sizeof(T);
+                std::vector<T> chunk(std::min(count, chunkElements));
+                for(std::size_t first = 0; first < count; first += chunk.size())
+                {
+                    const std::span<T> part(chunk.data(), std::min(chunk.size(), count - first));
+                    fill(part, first);
+                    out.write(reinterpret_cast<const char*>(part.data()), static_cast<std::streamsize>(part.size_bytes()));
+                }
+                if(!out.flush())
+                    throw std::system_error(std::make_error_code(std::errc::io_error), "write " + partial.string());
+            }
+            std::filesystem::rename(partial, path);
+        }
+        return MappedFile(path, access);
+    }
+}
@@ -0,0 +1,99 @@
+//Insert/erase churn benchmark shared by the node based containers, run once with std::allocator and once
+//per memory resource so the pmr variants can be compared against the default heap
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <unistd.h>
+#include "Utils/BenchmarkUtils.h"
+#include "Utils/MemoryResources.h"
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+namespace bench
+{
+    //Node containers with a monotonic resource keep every erased node, so stop at 1e6 elements
+    inline void churnSweep(benchmark::internal::Benchmark* b)
+    {
+        for(std::int64_t n = minElements; n <= std::min<std::int64_t>(maxElements, 1'000'000); n *= 10)
+            b->Arg(n);
+    }
+
+    //Resident set size of the process, 0 where /proc is not available
+    inline std::int64_t residentBytes()
+    {
+        long pages = 0, resident = 0;
+        if(auto* statm = std::fopen("/proc/self/statm", "r"))
+        {
+            if(std::fscanf(statm, "%ld %ld", &pages, &resident) != 2)
+                resident = 0;
+            std::fclose(statm);
+        }
+        return static_cast<std::int64_t>(resident) * sysconf(_SC_PAGESIZE);
+    }
+
+    //Hands the memory freed by earlier benchmarks back to the OS, otherwise the default allocator would
+    //reuse it and show no RSS growth at all
+    inline void trimHeap()
+    {
+#ifdef __GLIBC__
+        malloc_trim(0);
+#endif
+    }
+
+    //The value of a list or set element, the key of a map entry
+    template<typename T>
+    int churnKey(const T& element)
+    {
+        if constexpr(requires { element.first; })
+            return element.first;
+        else
+            return element;
+    }
+
+    //One iteration builds a container from random values, erases the odd ones, inserts them again and
+    //destroys the container together with its resource. That is 2 ops per element, the RSS growth of the
+    //filled container over the trimmed heap is reported as rss and rss/elem
+    template<typename Container, typename Resource, typename Insert>
+    void insertEraseChurn(benchmark::State& state, Insert insert)
+    {
+        const auto count = state.range(0);
+        const auto values = randomInts(count);
+        std::int64_t peak = 0;
+        for(auto _ : state)
+        {
+            state.PauseTiming();
+            trimHeap();
+            const auto before = residentBytes();
+            state.ResumeTiming();
+            {
+                Resource resource;
+                Container container(resource.template allocator<typename Container::value_type>());
+                for(auto val : values)
+                    insert(container, val);
+                std::erase_if(container, [](const auto& element) { return bench::churnKey(element) % 2 != 0; });
+                for(auto val : values)
+                    if(val % 2 != 0)
+                        insert(container, val);
+
+                state.PauseTiming();
+                peak = std::max(peak, residentBytes() - before);
+                benchmark::DoNotOptimize(container);
+                state.ResumeTiming();
+            }
+        }
+        reportPerOp(state, 2 * count, sizeof(typename Container::value_type));
+        state.counters["rss"] = benchmark::Counter(static_cast<double>(peak), benchmark::Counter::kDefaults,
+                                                   benchmark::Counter::OneK::kIs1024);
+        state.counters["rss/elem"] = benchmark::Counter(static_cast<double>(peak) / static_cast<double>(count));
+    }
+}
+
+//Registers a benchmark template for std::allocator and every memory resource kind
+#define BENCHMARK_MEMORY_RESOURCES(func) \
+    BENCHMARK_TEMPLATE(func, utils::DefaultAllocator)->Apply(bench::churnSweep); \
+    BENCHMARK_TEMPLATE(func, utils::MonotonicResource)->Apply(bench::churnSweep); \
+    BENCHMARK_TEMPLATE(func, utils::PoolResource)->Apply(bench::churnSweep); \
+    BENCHMARK_TEMPLATE(func, utils::ThreadArenaResource)->Apply(bench::churnSweep)
@@ -0,0 +1,198 @@
+//Memory resources the node based container tests and benchmarks are run over. Every kind exposes
+//allocator<T>() so the same code can build a container with the default allocator or a pmr one
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+#include <utility>
+
+namespace utils
+{
+    //Arena for a single thread: memory is bumped out of chunks which are only returned to the upstream
+    //resource on release() or destruction. Unlike monotonic_buffer_resource, freed small blocks go to a
+    //free list per 16 byte size class and are handed out again, so insert/erase churn of node based
+    //containers does not grow the arena. Not synchronized, use threadArena() to get the calling thread's one.
+    class ArenaResource : public std::pmr::memory_resource
+    {
+        public:
+            static constexpr std::size_t granularity = 16;
+            static constexpr std::size_t maxSmallBlock = 512;
+
+            explicit ArenaResource(std::size_t chunkSize = 64 * 1024,
+                                   std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+                : mChunkSize(std::max(chunkSize, maxSmallBlock)), mUpstream(upstream)
+            {
+            }
+
+            ArenaResource(const ArenaResource&) = delete;
+            ArenaResource& operator=(const ArenaResource&) = delete;
+
+            ~ArenaResource() override { release(); }
+
+            //Gives every chunk back to the upstream resource, all blocks handed out before become invalid
+            void release() noexcept
+            {
+                while(mChunks)
+                {
+                    auto* chunk = mChunks;
+                    mChunks = chunk->next;
+                    mUpstream->deallocate(chunk, chunk->size, alignof(Chunk));
+                }
+                mFreeLists.fill(nullptr);
+                mCurrent = mEnd = nullptr;
+                mChunkCount = 0;
+                mReserved = 0;
+            }
+
+            //Bytes taken from the upstream resource
+            std::size_t reserved() const noexcept { return mReserved; }
+
+            std::pmr::memory_resource* upstream() const noexcept { return mUpstream; }
+
+        private:
+            struct Chunk
+            {
+                Chunk* next;
+                std::size_t size;
+            };
+
+            struct FreeBlock
+            {
+                FreeBlock* next;
+            };
+
+            static constexpr std::size_t sizeClasses = maxSmallBlock / granularity;
+
+            //Blocks with alignment above the granularity are never put on a free list
+            static bool isSmall(std::size_t bytes, std::size_t alignment) noexcept
+            {
+                return bytes <= maxSmallBlock && alignment <= granularity;
+            }
+
+            static std::size_t sizeClass(std::size_t bytes) noexcept
+            {
+                return (std::max(bytes, std::size_t{1}) - 1) / granularity;
+            }
+
+            void* do_allocate(std::size_t bytes, std::size_t alignment) override
+            {
+                if(isSmall(bytes, alignment))
+                {
+                    auto& head = mFreeLists[sizeClass(bytes)];
+                    if(head)
+                        return std::exchange(head, head->next);
+                    bytes = (sizeClass(bytes) + 1) * granularity;
+                    alignment = granularity;
+                }
+
+                void* ptr = mCurrent;
+                auto space = static_cast<std::size_t>(mEnd - mCurrent);
+                if(!std::align(alignment, bytes, ptr, space))
+                {
+                    grow(bytes + alignment);
+                    ptr = mCurrent;
+                    space = static_cast<std::size_t>(mEnd - mCurrent);
+                    std::align(alignment, bytes, ptr, space);
+                }
+                mCurrent = static_cast<std::byte*>(ptr) + bytes;
+                return ptr;
+            }
+
+            void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+            {
+                if(!isSmall(bytes, alignment))
+                    return;
+                auto& head = mFreeLists[sizeClass(bytes)];
+                head = ::new(ptr) FreeBlock{head};
+            }
+
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+            {
+                return this == &other;
+            }
+
+            //The chunk header sits in front of the usable bytes, chunks double up to 64 times the initial size
+            void grow(std::size_t minBytes)
+            {
+                const auto usable = std::max({minBytes, mChunkSize << std::min<std::size_t>(mChunkCount, 6)});
+                const auto size = sizeof(Chunk) + usable;
+                auto* chunk = ::new(mUpstream->allocate(size, alignof(Chunk))) Chunk{mChunks, size};
+                mChunks = chunk;
+                ++mChunkCount;
+                mReserved += size;
+                mCurrent = reinterpret_cast<std::byte*>(chunk + 1);
+                mEnd = reinterpret_cast<std::byte*>(chunk) + size;
+            }
+
+            std::size_t mChunkSize;
+            std::pmr::memory_resource* mUpstream;
+            Chunk* mChunks = nullptr;
+            std::size_t mChunkCount = 0;
+            std::size_t mReserved = 0;
+            std::byte* mCurrent = nullptr;
+            std::byte* mEnd = nullptr;
+            std::array<FreeBlock*, sizeClasses> mFreeLists{};
+    };
+
+    inline ArenaResource& threadArena()
+    {
+        thread_local ArenaResource arena;
+        return arena;
+    }
+
+    //std::allocator, the baseline the pmr kinds are compared against
+    struct DefaultAllocator
+    {
+        static constexpr std::string_view name = "default";
+
+        template<typename T>
+        using allocator_type = std::allocator<T>;
+
+        template<typename T>
+        allocator_type<T> allocator() { return {}; }
+    };
+
+    template<typename Derived>
+    struct PmrKind
+    {
+        template<typename T>
+        using allocator_type = std::pmr::polymorphic_allocator<T>;
+
+        template<typename T>
+        allocator_type<T> allocator() { return allocator_type<T>(static_cast<Derived*>(this)->get()); }
+    };
+
+    //Upstream is given explicitly, the default constructors would pick up get_default_resource() which the
+    //tests point back at these resources
+    struct MonotonicResource : PmrKind<MonotonicResource>
+    {
+        static constexpr std::string_view name = "monotonic";
+        std::pmr::monotonic_buffer_resource resource{std::pmr::new_delete_resource()};
+        std::pmr::memory_resource* get() { return &resource; }
+    };
+
+    struct PoolResource : PmrKind<PoolResource>
+    {
+        static constexpr std::string_view name = "pool";
+        std::pmr::unsynchronized_pool_resource resource{std::pmr::new_delete_resource()};
+        std::pmr::memory_resource* get() { return &resource; }
+    };
+
+    //Borrows the calling thread's arena and releases it when done, so every user starts from an empty arena
+    struct ThreadArenaResource : PmrKind<ThreadArenaResource>
+    {
+        static constexpr std::string_view name = "arena";
+        ArenaResource& resource = threadArena();
+
+        ThreadArenaResource() = default;
+        ThreadArenaResource(const ThreadArenaResource&) = delete;
+        ThreadArenaResource& operator=(const ThreadArenaResource&) = delete;
+        ~ThreadArenaResource() { resource.release(); }
+
+        std::pmr::memory_resource* get() { return &resource; }
+    };
+}
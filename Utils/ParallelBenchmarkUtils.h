@@ -0,0 +1,46 @@
+//Thread scaling helpers for the execution policy benchmarks, the thread count is capped through TBB
+//which is the backend of the parallel algorithms in libstdc++
+#pragma once
+
+#include <algorithm>
+#include <thread>
+#include <tbb/global_control.h>
+#include "Utils/BenchmarkUtils.h"
+#include "Utils/ExecutionPolicies.h"
+
+namespace bench
+{
+    inline constexpr std::int64_t scalingElements = std::min<std::int64_t>(maxElements, 1 << 24);
+
+    //Args are {elements, threads}: par and par_unseq sweep 1, 2, 4 ... hardware threads,
+    //seq and unseq run on the calling thread only so they are measured once as the baseline
+    template<typename Policy>
+    void threadSweep(benchmark::internal::Benchmark* b)
+    {
+        const auto hardwareThreads = std::max<std::int64_t>(1, std::thread::hardware_concurrency());
+        b->ArgNames({"elements", "threads"});
+        b->UseRealTime();
+        if(!utils::ExecutionPolicyTraits<Policy>::parallel)
+        {
+            b->Args({scalingElements, 1});
+            return;
+        }
+        std::int64_t threads = 1;
+        for(; threads < hardwareThreads; threads *= 2)
+            b->Args({scalingElements, threads});
+        b->Args({scalingElements, hardwareThreads});
+    }
+
+    //Keep the returned object alive for the whole benchmark run
+    inline tbb::global_control limitThreads(const benchmark::State& state)
+    {
+        return tbb::global_control(tbb::global_control::max_allowed_parallelism, static_cast<std::size_t>(state.range(1)));
+    }
+}
+
+//Registers a benchmark template once per standard execution policy with its thread sweep
+#define BENCHMARK_EXECUTION_POLICIES(func) \
+    BENCHMARK_TEMPLATE(func, std::execution::sequenced_policy)->Apply(bench::threadSweep<std::execution::sequenced_policy>); \
+    BENCHMARK_TEMPLATE(func, std::execution::unsequenced_policy)->Apply(bench::threadSweep<std::execution::unsequenced_policy>); \
+    BENCHMARK_TEMPLATE(func, std::execution::parallel_policy)->Apply(bench::threadSweep<std::execution::parallel_policy>); \
+    BENCHMARK_TEMPLATE(func, std::execution::parallel_unsequenced_policy)->Apply(bench::threadSweep<std::execution::parallel_unsequenced_policy>)